@@ -29,6 +29,19 @@ public:
   void restart();
   void stop(const std::string& animationName = "");
   bool _animate(const millisecond_t& delay);
+  /**
+   * @brief Evaluates all the animations at the delay in one pass, without
+   * running their events. Animatables of different targets can be evaluated
+   * concurrently.
+   * @return false if the animatable is paused.
+   */
+  bool _evaluate(const millisecond_t& delay);
+  /**
+   * @brief Runs the events reached by the last evaluation and ends the
+   * animatable if all its animations are over.
+   * @return true if the animatable is still running.
+   */
+  bool _endAnimate();
 
 public:
   IAnimatable* target;
@@ -44,6 +57,7 @@ private:
   millisecond_t _pausedDelay;
   std::vector<Animation*> _animations;
   bool _paused;
+  bool _evaluated;
   Scene* _scene;
 
 }; // end of class Animatable
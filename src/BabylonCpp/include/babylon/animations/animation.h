@@ -1,9 +1,11 @@
 #ifndef BABYLON_ANIMATIONS_ANIMATION_H
 #define BABYLON_ANIMATIONS_ANIMATION_H
 
+#include <babylon/animations/animation_binding.h>
 #include <babylon/animations/animation_event.h>
 #include <babylon/animations/animation_key.h>
 #include <babylon/animations/animation_range.h>
+#include <babylon/animations/animation_track.h>
 #include <babylon/animations/animation_value.h>
 #include <babylon/babylon_global.h>
 
@@ -75,6 +77,10 @@ public:
   AnimationRange& getRange(const std::string& name);
   void reset();
   bool isStopped() const;
+  /**
+   * @brief Returns the keys, which can be modified, the track of the keys
+   * being rebuilt on the next evaluation.
+   */
   std::vector<AnimationKey>& getKeys();
   int getHighestFrame() const;
   IEasingFunction* getEasingFunction();
@@ -100,19 +106,55 @@ public:
                                    float gradient) const;
   std::unique_ptr<Animation> clone() const;
   void setKeys(const std::vector<AnimationKey>& values);
+  /**
+   * @brief Resolves the target property path on the target once, the
+   * animation then writing the animated field directly. Done on the first
+   * frame for a new target, to be called again when targetPropertyPath
+   * changes.
+   */
+  void bind();
   void setValue(const AnimationValue& currentValue, bool blend = false);
   void goToFrame(int frame);
   bool animate(millisecond_t delay, float from, float to, bool loop,
                float speedRatio);
+  /**
+   * @brief Evaluates the animation at the delay and writes the value to the
+   * target, without checking the events. Animations of different targets can
+   * be evaluated concurrently.
+   * @return false if the animation is over.
+   */
+  bool _evaluate(millisecond_t delay, float from, float to, bool loop,
+                 float speedRatio);
+  /**
+   * @brief Runs the actions of the events reached by the last evaluation.
+   */
+  void _checkEvents();
   Json::object serialize() const;
   static Animation* Parse(const Json::value& parsedAnimation);
 
 private:
   AnimationValue _getKeyValue(const AnimationValue& value) const;
+  /**
+   * @brief Finds the key preceding the frame and the eased gradient between
+   * that key and the next one.
+   * @return false if the frame is past the last key.
+   */
+  bool _findKey(int frame, size_t& key, float& gradient);
   AnimationValue
   _interpolate(int currentFrame, int repeatCount, unsigned int loopMode,
                const AnimationValue& offsetValue    = AnimationValue(),
                const AnimationValue& highLimitValue = AnimationValue());
+  /**
+   * @brief Interpolates the value at the frame directly into the bound field,
+   * without intermediate AnimationValue. The offset and the high limit are
+   * null when the loop mode does not use them.
+   * @return false if the animation is not bound to a typed field.
+   */
+  bool _interpolateBound(int currentFrame, int repeatCount,
+                         unsigned int loopMode,
+                         const AnimationValue* offsetValue,
+                         const AnimationValue* highLimitValue);
+  bool _setBoundValue(const AnimationValue& value);
 
 public:
   IAnimatable* _target;
@@ -138,6 +180,12 @@ private:
   // The set of event that will be linked to this animation
   std::vector<AnimationEvent> _events;
   std::unordered_map<std::string, AnimationRange> _ranges;
+  AnimationBinding _binding;
+  // Keys as structure of arrays, rebuilt when the keys change
+  AnimationTrack _track;
+  // Key found by the previous evaluation
+  size_t _keyCursor;
+  bool _trackDirty;
 
 }; // end of class Animation
 
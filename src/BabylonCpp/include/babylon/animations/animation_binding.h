@@ -0,0 +1,43 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_BINDING_H
+#define BABYLON_ANIMATIONS_ANIMATION_BINDING_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Typed destination of an animation, the target property path being
+ * resolved once to a pointer to the animated field of the target.
+ *
+ * Only one of the field pointers is set, matching the data type of the
+ * binding. A binding whose data type is -1 could not be resolved, in which
+ * case the animation writes through IReflect::setProperty.
+ */
+class BABYLON_SHARED_EXPORT AnimationBinding {
+
+public:
+  AnimationBinding();
+  ~AnimationBinding();
+
+  /**
+   * @brief Resolves the target property path on the target.
+   */
+  static AnimationBinding
+  Bind(IAnimatable* target, const std::vector<std::string>& targetPropertyPath);
+
+  bool isBound() const;
+
+public:
+  IAnimatable* target;
+  int dataType;
+  float* floatValue;
+  Vector3* vector3Value;
+  Quaternion* quaternionValue;
+  Color3* color3Value;
+  Matrix* matrixValue;
+
+}; // end of class AnimationBinding
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_BINDING_H
@@ -0,0 +1,67 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_TRACK_H
+#define BABYLON_ANIMATIONS_ANIMATION_TRACK_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Keys of an animation stored as structure of arrays: the frames of
+ * the keys in one array and their values in another, stride() floats per key.
+ *
+ * Only the data types evaluated in place (float, Vector3, Quaternion, Color3
+ * and Matrix) have their values stored, the frames are stored for all types.
+ */
+class BABYLON_SHARED_EXPORT AnimationTrack {
+
+public:
+  /**
+   * @brief Returns the number of floats of a key value of the data type, 0 if
+   * the values of the type are not stored.
+   */
+  static unsigned int Stride(int dataType);
+
+public:
+  AnimationTrack();
+  ~AnimationTrack();
+
+  /** Properties **/
+  size_t size() const;
+  unsigned int stride() const;
+
+  /** Methods **/
+
+  /**
+   * @brief Copies the frames and the values of the keys.
+   */
+  void set(const std::vector<AnimationKey>& keys, int dataType);
+
+  /**
+   * @brief Finds the key preceding the frame, the first key followed by a key
+   * at or past the frame.
+   *
+   * The cursor holds the key found by the previous call: the same key or the
+   * next one, as in sequential playback, are found in constant time, the
+   * other ones by binary search.
+   * @return false if the frame is past the last key, the cursor being left
+   * unchanged.
+   */
+  bool findKey(int frame, size_t& cursor) const;
+
+  int frame(size_t key) const;
+
+  /**
+   * @brief Returns the stride() floats of the value of the key.
+   */
+  const float* value(size_t key) const;
+
+private:
+  unsigned int _stride;
+  Int32Array _frames;
+  Float32Array _values;
+
+}; // end of class AnimationTrack
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_TRACK_H
@@ -33,9 +33,11 @@ class InterpolateValueAction;
 // --- Animations ---
 class Animatable;
 class Animation;
+class AnimationBinding;
 class AnimationEvent;
 class AnimationKey;
 class AnimationRange;
+class AnimationTrack;
 class AnimationValue;
 struct IAnimatable;
 class PathCursor;
@@ -110,16 +112,22 @@ struct WorkerReply;
 // --- Core ---
 struct Image;
 struct NodeCache;
+class TaskGroup;
+class ThreadPool;
 // - Logging
 class LogChannel;
 class LogMessage;
 class Logger;
 // --- Culling ---
 class BoundingBox;
+class BoundingBoxArray;
 class BoundingInfo;
 class BoundingSphere;
+template <class T>
+class DynamicAABBTree;
 struct ICullable;
 class Ray;
+class TriangleBVH;
 // - Octrees
 template <class T>
 struct IOctreeContainer;
@@ -144,6 +152,8 @@ class PointerInfoBase;
 class PointerInfoPre;
 struct RenderingGroupInfo;
 class Scene;
+class ShaderCompilationQueue;
+class ShaderProgramCache;
 // --- Interfaces ---
 class ICanvas;
 class ICanvasRenderingContext2D;
@@ -208,6 +218,7 @@ class ShaderMaterial;
 struct ShaderMaterialOptions;
 class StandardMaterial;
 struct StandardMaterialDefines;
+class UniformBuffer;
 // - Textures
 class BaseTexture;
 class ColorGradingTexture;
@@ -329,11 +340,13 @@ class ISimplifier;
 class QuadraticErrorSimplification;
 class QuadraticMatrix;
 class Reference;
+struct SimplificationMeshData;
 class SimplificationQueue;
 class SimplificationSettings;
 // --- Particles ---
 class ModelShape;
 class Particle;
+class ParticleStore;
 class ParticleSystem;
 class SolidParticle;
 class SolidParticleSystem;
@@ -395,6 +408,7 @@ class EdgesRenderer;
 class OutlineRenderer;
 class RenderingGroup;
 class RenderingManager;
+class RenderQueue;
 // --- Sprites ---
 class Sprite;
 class SpriteManager;
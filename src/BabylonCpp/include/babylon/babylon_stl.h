@@ -59,6 +59,7 @@
 #include <regex>
 
 // Thread support
+#include <atomic>
 #include <future>
 #include <mutex>
 #include <thread>
@@ -97,6 +97,9 @@ private:
   Scene* _scene;
   bool _isDirty;
   Float32Array _transformMatrices;
+  // Inputs of the batched skinning matrices computation
+  Float32Array _invertedAbsoluteTransforms;
+  Float32Array _worldMatrices;
   std::vector<AbstractMesh*> _meshesWithPoseMatrix;
   std::vector<IAnimatable*> _animatables;
   Matrix _identity;
@@ -11,8 +11,8 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT CollideWorker {
 
 public:
-  CollideWorker(Collider* collider, const CollisionCache& collisionCache,
-                const Vector3& finalPosition);
+  CollideWorker(Collider* collider, CollisionCache& collisionCache,
+                Vector3& finalPosition);
   ~CollideWorker();
 
   void collideWithWorld(Vector3& position, Vector3& velocity,
@@ -24,7 +24,9 @@ private:
                                      SerializedMesh& mesh);
   void collideForSubMesh(SerializedSubMesh& subMesh,
                          const Matrix& transformMatrix,
-                         SerializedGeometry& meshGeometry);
+                         SerializedGeometry& meshGeometry,
+                         const Vector3& sweepMinimum,
+                         const Vector3& sweepMaximum);
   bool checkSubmeshCollision(const SerializedSubMesh& subMesh);
 
 public:
@@ -33,8 +35,11 @@ public:
 private:
   Matrix collisionsScalingMatrix;
   Matrix collisionTranformationMatrix;
-  CollisionCache _collisionCache;
-  Vector3 finalPosition;
+  CollisionCache& _collisionCache;
+  Vector3& finalPosition;
+  // Scratch lists of the broadphase and of the triangles hierarchy queries
+  std::vector<unsigned int> _meshIds;
+  std::vector<uint32_t> _faceIds;
 
 }; // end of class CollidePayload
 
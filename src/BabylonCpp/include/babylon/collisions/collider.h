@@ -29,9 +29,17 @@ public:
   void _testTriangle(size_t faceIndex, std::vector<Plane>& trianglePlaneArray,
                      Vector3& p1, Vector3& p2, Vector3& p3, bool hasMaterial);
   void _collide(std::vector<Plane>& trianglePlaneArray,
-                const std::vector<Vector3> pts, const Uint32Array& indices,
+                const std::vector<Vector3>& pts, const Uint32Array& indices,
                 size_t indexStart, size_t indexEnd, unsigned int decal,
                 bool hasMaterial);
+  /**
+   * @brief Same as _collide, for the given triangles only.
+   */
+  void _collideFaces(std::vector<Plane>& trianglePlaneArray,
+                     const std::vector<Vector3>& pts,
+                     const Uint32Array& indices,
+                     const std::vector<uint32_t>& faceIds, unsigned int decal,
+                     bool hasMaterial);
   void _getResponse(Vector3& pos, Vector3& vel);
 
 public:
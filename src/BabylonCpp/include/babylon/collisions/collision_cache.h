@@ -4,6 +4,7 @@
 #include <babylon/babylon_global.h>
 #include <babylon/collisions/serialized_geometry.h>
 #include <babylon/collisions/serialized_mesh.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
 
 namespace BABYLON {
 
@@ -18,15 +19,30 @@ public:
   bool containsMesh(unsigned int id) const;
   SerializedMesh& getMesh(unsigned int id);
   void addMesh(const SerializedMesh& mesh);
+  void addMesh(SerializedMesh&& mesh);
   void removeMesh(unsigned int uniqueId);
   bool containsGeometry(const std::string& id) const;
   SerializedGeometry& getGeometry(const std::string& id);
   void addGeometry(const SerializedGeometry& geometry);
+  void addGeometry(SerializedGeometry&& geometry);
   void removeGeometry(const std::string& id);
 
+  /**
+   * @brief Appends the unique ids of the meshes checking collisions whose
+   * world bounds intersect the sphere.
+   */
+  void intersectsMeshes(const Vector3& sphereCenter, float sphereRadius,
+                        std::vector<unsigned int>& uniqueIds) const;
+
+private:
+  void _updateMeshProxy(const SerializedMesh& mesh);
+
 private:
   std::unordered_map<unsigned int, SerializedMesh> _meshes;
   std::unordered_map<std::string, SerializedGeometry> _geometries;
+  // Broadphase over the world bounds of the meshes checking collisions
+  DynamicAABBTree<unsigned int> _meshesTree;
+  std::unordered_map<unsigned int, int> _meshProxies;
 
 }; // end of class CollisionCache
 
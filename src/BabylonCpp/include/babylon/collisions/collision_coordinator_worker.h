@@ -7,9 +7,18 @@
 #include <babylon/collisions/serialized_mesh.h>
 #include <babylon/collisions/worker.h>
 #include <babylon/math/vector3.h>
+#include <babylon/tools/observer.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Collision coordinator running the collision detection on a
+ * background thread.
+ *
+ * The meshes and geometries are serialized when they change and sent to the
+ * worker thread after each frame, collision requests are processed while the
+ * scene renders and their replies are dispatched after the next frame.
+ */
 class BABYLON_SHARED_EXPORT CollisionCoordinatorWorker
   : public ICollisionCoordinator {
 
@@ -43,6 +52,7 @@ private:
 
 private:
   Scene* _scene;
+  Observer<Scene>::Ptr _afterRenderObserver;
   Vector3 _scaledPosition;
   Vector3 _scaledVelocity;
   std::vector<std::function<void(unsigned int collisionIndex,
@@ -57,6 +67,8 @@ private:
   std::unordered_map<std::string, SerializedGeometry> _addUpdateGeometriesList;
   Uint32Array _toRemoveMeshesArray;
   std::vector<std::string> _toRemoveGeometryArray;
+  // Meshes may be updated from the threads of the parallel evaluation
+  std::mutex _updatesMutex;
 
 }; // end of class CollisionCoordinatorWorker
 
@@ -17,7 +17,7 @@ public:
   virtual ~CollisionDetectorTransferable();
 
   WorkerReply onInit(const InitPayload& payload) override;
-  WorkerReply onUpdate(const UpdatePayload& payload) override;
+  WorkerReply onUpdate(UpdatePayload&& payload) override;
   WorkerReply onCollision(const CollidePayload& payload) override;
 
 private:
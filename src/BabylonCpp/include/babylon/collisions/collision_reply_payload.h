@@ -8,7 +8,8 @@ namespace BABYLON {
 struct BABYLON_SHARED_EXPORT CollisionReplyPayload {
   Float32Array newPosition;
   unsigned int collisionId;
-  unsigned int collidedMeshUniqueId;
+  // -1 when no mesh was hit
+  int collidedMeshUniqueId;
 }; // end of struct CollisionReplyPayload
 
 } // end of namespace BABYLON
@@ -10,7 +10,7 @@ namespace BABYLON {
 
 struct BABYLON_SHARED_EXPORT ICollisionDetector {
   virtual WorkerReply onInit(const InitPayload& payload)         = 0;
-  virtual WorkerReply onUpdate(const UpdatePayload& payload)     = 0;
+  virtual WorkerReply onUpdate(UpdatePayload&& payload)          = 0;
   virtual WorkerReply onCollision(const CollidePayload& payload) = 0;
 }; // end of struct ICollisionDetector
 
@@ -10,6 +10,8 @@ struct BABYLON_SHARED_EXPORT SerializedGeometry {
   Float32Array positions;
   Uint32Array indices;
   Float32Array normals;
+  // Built by the collision worker on first use
+  std::shared_ptr<TriangleBVH> triangleBVH;
   std::vector<Vector3> positionsArray;
 }; // end of struct SerializedGeometry
 
@@ -2,11 +2,24 @@
 #define BABYLON_COLLISIONS_WORKER_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/collisions/babylon_message.h>
 #include <babylon/collisions/collision_detector_transferable.h>
+#include <babylon/collisions/worker_reply.h>
+#include <babylon/core/shared_queue.h>
 #include <babylon/core/structs.h>
+#include <babylon/core/task_group.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Background worker running the collision detector.
+ *
+ * Messages are queued and processed in order by a task of the default thread
+ * pool, a single one at a time, which owns the collision cache. The replies
+ * are queued as well and handed to the callback handler on the thread calling
+ * processReplies(), so that the handler never runs concurrently with the
+ * scene.
+ */
 class BABYLON_SHARED_EXPORT Worker {
 
 public:
@@ -14,15 +27,40 @@ public:
   ~Worker();
 
   void postMessage(const BabylonMessage& message);
-  void postMessage(const BabylonMessage& message,
-                   const std::vector<ArrayBufferView>& serializable);
+
+  /**
+   * @brief Posts the message without copying its payload (the equivalent of
+   * the transfer list of a web worker message).
+   */
+  void postMessage(BabylonMessage&& message);
+
+  /**
+   * @brief Calls the callback handler with the replies received so far, on
+   * the calling thread.
+   */
+  void processReplies();
+
+  /**
+   * @brief Stops the worker once the messages already posted are processed.
+   * The replies not yet processed are discarded.
+   */
   void terminate();
 
 public:
   std::function<void(const WorkerReply& e)> callbackHandler;
 
+private:
+  void _run();
+
 private:
   CollisionDetectorTransferable collisionDetector;
+  // Under _mutex, whether a task is processing the messages
+  std::mutex _mutex;
+  std::deque<std::unique_ptr<BabylonMessage>> _messages;
+  bool _running;
+  bool _terminated;
+  SharedQueue<WorkerReply> _replies;
+  TaskGroup _tasks;
 
 }; // end of struct Worker
 
@@ -0,0 +1,89 @@
+#ifndef BABYLON_CORE_JSON_STREAM_PARSER_H
+#define BABYLON_CORE_JSON_STREAM_PARSER_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief SAX style JSON parser.
+ *
+ * The document is read in a single pass over the input buffer and reported to
+ * a handler as a sequence of events, without building a DOM, so the handler
+ * decides what is kept and how. Arrays holding numbers only are announced with
+ * their number of elements, letting the handler decode them directly into a
+ * pre-sized typed array.
+ */
+class BABYLON_SHARED_EXPORT JsonStreamParser {
+
+public:
+  /**
+   * @brief Receives the events of the parsed document.
+   */
+  class BABYLON_SHARED_EXPORT Handler {
+
+  public:
+    virtual ~Handler();
+
+    virtual void startObject()           = 0;
+    virtual void endObject()             = 0;
+    virtual void key(std::string&& name) = 0;
+    /**
+     * @param numberCount Number of elements when the array holds numbers only,
+     * 0 otherwise.
+     */
+    virtual void startArray(size_t numberCount) = 0;
+    virtual void endArray()                     = 0;
+    virtual void null()                         = 0;
+    virtual void boolean(bool value)            = 0;
+    virtual void number(double value)           = 0;
+    virtual void string(std::string&& value)    = 0;
+
+  }; // end of class Handler
+
+public:
+  JsonStreamParser(Handler& handler);
+  ~JsonStreamParser();
+
+  /** Properties **/
+  /**
+   * @brief Returns the error of the last parse, with its offset in the input.
+   */
+  const std::string& error() const;
+
+  /** Methods **/
+  /**
+   * @brief Parses the document, calling the handler as the values are read.
+   * On error, the events already sent are not undone.
+   * @return Whether the document is valid.
+   */
+  bool parse(const char* data, size_t size);
+
+private:
+  bool _parseValue();
+  bool _parseObject();
+  bool _parseArray();
+  bool _parseString(std::string& value);
+  bool _parseNumber(double& value);
+  bool _parseLiteral(const char* literal);
+  size_t _countNumbers() const;
+  void _skipWhitespace();
+  bool _fail(const std::string& message);
+
+public:
+  // Maximum nesting of objects and arrays
+  size_t maxDepth;
+
+private:
+  Handler& _handler;
+  const char* _begin;
+  const char* _cursor;
+  const char* _end;
+  size_t _depth;
+  std::string _error;
+
+}; // end of class JsonStreamParser
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_JSON_STREAM_PARSER_H
@@ -39,6 +39,55 @@ inline float random()
   return randomNumber(0.f, 1.f);
 }
 
+/**
+ * @brief Seedable pseudo random number generator (SplitMix64).
+ *
+ * Unlike randomNumber(), it is cheap to create and its sequence only depends
+ * on the seed and the stream index, so independent chunks of work can draw
+ * from their own generator and be reproduced whatever the thread running them.
+ */
+class RandomGenerator {
+
+public:
+  RandomGenerator(uint64_t seed, uint64_t stream = 0)
+      : _state{Mix(seed + Mix(stream + 1))}
+  {
+  }
+
+  uint64_t next()
+  {
+    _state += 0x9E3779B97F4A7C15ull;
+    return Mix(_state);
+  }
+
+  /**
+   * @brief Returns a number in [0, 1).
+   */
+  float random()
+  {
+    return static_cast<float>(next() >> 40) * (1.f / 16777216.f);
+  }
+
+  /**
+   * @brief Returns a number in [min, max).
+   */
+  float randomNumber(float min, float max)
+  {
+    return min + (max - min) * random();
+  }
+
+  static uint64_t Mix(uint64_t value)
+  {
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+  }
+
+private:
+  uint64_t _state;
+
+}; // end of class RandomGenerator
+
 } // end of namespace Random
 } // end of namespace BABYLON
 
@@ -0,0 +1,49 @@
+#ifndef BABYLON_CORE_TASK_GROUP_H
+#define BABYLON_CORE_TASK_GROUP_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Tasks posted to a thread pool on behalf of an object, which waits
+ * for them before being destroyed.
+ *
+ * The tasks usually reference their owner: the group, declared as a member
+ * of the owner, waits for the tasks still queued or running when it is
+ * destroyed (or when wait() is called), so that no task outlives its owner.
+ */
+class BABYLON_SHARED_EXPORT TaskGroup {
+
+public:
+  TaskGroup(ThreadPool& threadPool = ThreadPool::Default());
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  ~TaskGroup();
+
+  /** Properties **/
+  /**
+   * @brief Returns the number of tasks of the group queued or running.
+   */
+  size_t pendingCount() const;
+
+  /** Methods **/
+  void post(const ThreadPool::Task& task);
+  /**
+   * @brief Blocks until the tasks of the group are done. Must not be called
+   * from a task of the group.
+   */
+  void wait();
+
+private:
+  ThreadPool& _threadPool;
+  mutable std::mutex _mutex;
+  std::condition_variable _done;
+  size_t _pendingCount;
+
+}; // end of class TaskGroup
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_TASK_GROUP_H
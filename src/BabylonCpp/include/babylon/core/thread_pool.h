@@ -0,0 +1,100 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed set of worker threads running data parallel loops and
+ * background tasks.
+ *
+ * parallelFor() splits an index range in chunks which are grabbed by the
+ * workers and by the calling thread until the range is exhausted, and returns
+ * once every chunk has been processed. Calls from different threads are
+ * serialized and a call issued from a loop body (nested loop) runs on the
+ * calling thread only, so a loop body can safely use code that is itself
+ * parallelized.
+ *
+ * post() queues a task run by the first idle worker, the workers joining the
+ * running loop first. Tasks can run loops themselves. The long lived
+ * background work of the engine (collisions, file loads, shader preprocessing
+ * and mesh simplification) is posted to the Default() pool, so that it does
+ * not start threads of its own.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  using ChunkFunction = std::function<void(size_t begin, size_t end)>;
+  using Task          = std::function<void()>;
+
+public:
+  /**
+   * @param threadCount Number of worker threads, 0 to use one less than the
+   * number of hardware threads (the calling thread also processes chunks)
+   */
+  ThreadPool(size_t threadCount = 0);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  /** Properties **/
+  size_t threadCount() const;
+
+  /** Methods **/
+  /**
+   * @brief Calls func(begin, end) for consecutive sub ranges of [0, count) of
+   * at most chunkSize indices, in parallel. The function must not throw.
+   */
+  void parallelFor(size_t count, size_t chunkSize, const ChunkFunction& func);
+
+  /**
+   * @brief Queues the task, run by a worker thread, or runs it on the calling
+   * thread if the pool has no worker. The tasks still queued when the pool is
+   * destroyed are dropped, see TaskGroup to wait for them. The task must not
+   * throw.
+   */
+  void post(const Task& task);
+
+  /** Statics **/
+  /**
+   * @brief Returns whether the calling thread is running a loop body of any
+   * pool.
+   */
+  static bool IsInParallelFor();
+
+  /**
+   * @brief Returns the process wide pool running the background tasks, with
+   * one less worker than the number of hardware threads, at least one.
+   */
+  static ThreadPool& Default();
+
+private:
+  void _workerLoop();
+  void _runChunks(const ChunkFunction* func, size_t count, size_t chunkSize,
+                  size_t chunksCount);
+
+private:
+  std::vector<std::thread> _threads;
+  std::mutex _submitMutex;
+  std::mutex _mutex;
+  std::condition_variable _wakeUp;
+  std::condition_variable _finished;
+  // Current loop, published under _mutex
+  const ChunkFunction* _func;
+  size_t _count;
+  size_t _chunkSize;
+  size_t _chunksCount;
+  uint64_t _generation;
+  size_t _activeWorkers;
+  bool _stop;
+  std::atomic<size_t> _nextChunk;
+  std::atomic<size_t> _completedChunks;
+  // Queued tasks, under _mutex
+  std::deque<Task> _tasks;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
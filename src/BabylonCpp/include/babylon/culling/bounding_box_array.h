@@ -0,0 +1,59 @@
+#ifndef BABYLON_CULLING_BOUNDING_BOX_ARRAY_H
+#define BABYLON_CULLING_BOUNDING_BOX_ARRAY_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief World bounding boxes stored as structure of arrays, to test many
+ * boxes against the frustum at once with the SIMD kernels.
+ *
+ * Each box is kept as its world center and its 3 world half axes, so the
+ * result is the one of BoundingBox::isInFrustum with the 8 world corners, for
+ * rotated boxes too.
+ */
+class BABYLON_SHARED_EXPORT BoundingBoxArray {
+
+public:
+  BoundingBoxArray();
+  ~BoundingBoxArray();
+
+  /** Properties **/
+  size_t size() const;
+  bool empty() const;
+
+  /** Methods **/
+  void clear();
+
+  /**
+   * @brief Appends the world box of the bounding box, updated by its last
+   * _update() call.
+   * @return The index of the box.
+   */
+  size_t add(const BoundingBox& boundingBox);
+
+  /**
+   * @brief Tests all the boxes against the frustum. Bit i % 32 of
+   * visibility[i / 32] is set if box i intersects the frustum.
+   */
+  void isInFrustum(const std::array<Plane, 6>& frustumPlanes,
+                   std::vector<uint32_t>& visibility) const;
+
+  /** Statics **/
+  static bool IsVisible(const std::vector<uint32_t>& visibility, size_t index);
+
+private:
+  void _reserve(size_t capacity);
+
+private:
+  size_t _size;
+  size_t _capacity;
+  // Centers x, y, z then half axes, _capacity floats each
+  Float32Array _data;
+
+}; // end of class BoundingBoxArray
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BOUNDING_BOX_ARRAY_H
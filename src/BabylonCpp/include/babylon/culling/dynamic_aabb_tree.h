@@ -0,0 +1,102 @@
+#ifndef BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+#define BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Incremental bounding volume hierarchy of axis aligned boxes.
+ *
+ * Every entry (proxy) is stored in a leaf with a fat box, its world box
+ * enlarged by a margin, so that small movements do not require any update of
+ * the tree. Leaves are inserted using the surface area heuristic and the tree
+ * is kept balanced with rotations, so insertion, removal and moves are
+ * O(log n) and no full rebuild is ever needed.
+ */
+template <class T>
+class BABYLON_SHARED_EXPORT DynamicAABBTree {
+
+public:
+  static constexpr int NullNode = -1;
+
+public:
+  DynamicAABBTree(float margin = 0.1f);
+  ~DynamicAABBTree();
+
+  /** Properties **/
+  size_t size() const;
+  bool empty() const;
+  int height() const;
+  float margin() const;
+
+  /** Methods **/
+  /**
+   * @brief Adds an entry with the given world bounds.
+   * @return The proxy id used to move or remove the entry.
+   */
+  int createProxy(const Vector3& minimum, const Vector3& maximum,
+                  const T& data);
+  void destroyProxy(int proxyId);
+
+  /**
+   * @brief Updates the world bounds of an entry.
+   * @return Whether the entry had to be reinserted in the tree.
+   */
+  bool moveProxy(int proxyId, const Vector3& minimum, const Vector3& maximum);
+  T& getData(int proxyId);
+  const Vector3& getFatMinimum(int proxyId) const;
+  const Vector3& getFatMaximum(int proxyId) const;
+  void clear();
+
+  /**
+   * @brief Appends the entries whose fat box intersects the frustum. Subtrees
+   * completely inside the frustum are appended without further tests.
+   */
+  void select(const std::array<Plane, 6>& frustumPlanes,
+              std::vector<T>& selection) const;
+  void intersects(const Vector3& sphereCenter, float sphereRadius,
+                  std::vector<T>& selection) const;
+  void intersectsRay(const Ray& ray, std::vector<T>& selection) const;
+
+private:
+  struct Node {
+    Vector3 minimum;
+    Vector3 maximum;
+    T data;
+    // Parent index, or next free node when in the free list
+    int parent;
+    int child1;
+    int child2;
+    // Leaves have height 0, free nodes -1
+    int height;
+    bool isLeaf() const
+    {
+      return child1 == NullNode;
+    }
+  }; // end of struct Node
+
+  int _allocateNode();
+  void _freeNode(int nodeId);
+  void _insertLeaf(int leaf);
+  void _removeLeaf(int leaf);
+  int _balance(int nodeId);
+  void _fitNode(int nodeId);
+  void _collectLeaves(int nodeId, std::vector<T>& selection) const;
+
+  static float _SurfaceArea(const Vector3& minimum, const Vector3& maximum);
+
+private:
+  std::vector<Node> _nodes;
+  int _root;
+  int _freeList;
+  size_t _proxyCount;
+  float _margin;
+  mutable std::vector<int> _stack;
+
+}; // end of class DynamicAABBTree
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_DYNAMIC_AABB_TREE_H
@@ -20,6 +20,7 @@ public:
   void update(const Vector3& worldMin, const Vector3& worldMax,
               std::vector<T>& entries);
   void addMesh(T& entry);
+  void removeMesh(T& entry);
   std::vector<T>& select(const std::array<Plane, 6>& frustumPlanes,
                          bool allowDuplicate = true);
   std::vector<T>& intersects(const Vector3& sphereCenter, float sphereRadius,
@@ -37,6 +38,9 @@ public:
   static void CreationFuncForSubMeshes(SubMesh* entry,
                                        OctreeBlock<SubMesh*>& block);
 
+private:
+  void _removeDuplicates(std::vector<T>& selection);
+
 public:
   std::vector<T> dynamicContent;
 
@@ -44,6 +48,9 @@ private:
   size_t _maxBlockCapacity;
   size_t _maxDepth;
   std::vector<T> _selectionContent;
+  // Reused by _removeDuplicates() from one selection to the next
+  std::vector<std::pair<T, size_t>> _sortedSelection;
+  std::vector<bool> _firstOccurrences;
   std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
 
 }; // end of class Octree
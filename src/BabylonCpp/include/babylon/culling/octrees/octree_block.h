@@ -24,6 +24,7 @@ public:
   /** Methods **/
   void addEntry(T& entry);
   void addEntries(std::vector<T>& entries);
+  void removeEntry(T& entry);
   void select(const std::array<Plane, 6>& frustumPlanes,
               std::vector<T>& selection, bool allowDuplicate = true);
   void intersects(const Vector3& sphereCenter, float sphereRadius,
@@ -30,6 +30,12 @@ public:
   /** Methods **/
   bool intersectsBoxMinMax(const Vector3& minimum,
                            const Vector3& maximum) const;
+  /**
+   * @brief Intersection test with the box, distance is set to the ray
+   * parameter at which the ray enters the box (0 if the origin is inside).
+   */
+  bool intersectsBoxMinMax(const Vector3& minimum, const Vector3& maximum,
+                           float& distance) const;
   bool intersectsBox(const BoundingBox& box) const;
   bool intersectsSphere(const BoundingSphere& sphere) const;
   std::unique_ptr<IntersectionInfo> intersectsTriangle(const Vector3& vertex0,
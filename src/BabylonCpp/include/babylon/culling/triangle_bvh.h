@@ -0,0 +1,75 @@
+#ifndef BABYLON_CULLING_TRIANGLE_BVH_H
+#define BABYLON_CULLING_TRIANGLE_BVH_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Static bounding volume hierarchy over the triangles of an indexed
+ * geometry, in local space.
+ *
+ * Triangles are stored in hierarchy order with their vertices copied, so a
+ * query only touches the nodes and the triangles along its path. Face ids
+ * reported by the queries are the triangle indices in the source geometry
+ * (first index / 3), as for SubMesh::intersects.
+ */
+class BABYLON_SHARED_EXPORT TriangleBVH {
+
+public:
+  static constexpr size_t MaxTrianglesPerLeaf = 4;
+
+public:
+  TriangleBVH(const Float32Array& positions, const Uint32Array& indices);
+  ~TriangleBVH();
+
+  /** Properties **/
+  size_t trianglesCount() const;
+  size_t nodesCount() const;
+
+  /** Methods **/
+  /**
+   * @brief Returns the closest intersection of the ray with the triangles
+   * whose first index is in [indexStart, indexEnd), or the first one found
+   * when fastCheck is set. Nodes farther than the closest hit found so far
+   * are skipped and children are visited front to back.
+   */
+  std::unique_ptr<IntersectionInfo> intersectsRay(Ray& ray, size_t indexStart,
+                                                  size_t indexEnd,
+                                                  bool fastCheck) const;
+
+  /**
+   * @brief Appends the face ids of the triangles whose first index is in
+   * [indexStart, indexEnd) and whose bounds intersect the box.
+   */
+  void intersectsBox(const Vector3& minimum, const Vector3& maximum,
+                     size_t indexStart, size_t indexEnd,
+                     std::vector<uint32_t>& faceIds) const;
+
+private:
+  struct Node {
+    Vector3 minimum;
+    Vector3 maximum;
+    // Leaves: first triangle and triangles count, inner nodes: index of the
+    // second child (the first child directly follows its parent) and 0
+    uint32_t offset;
+    uint32_t count;
+  }; // end of struct Node
+
+  void _build(std::vector<Vector3>& centroids, uint32_t start, uint32_t end);
+
+  static bool _IntersectsBox(const Vector3& minimum1, const Vector3& maximum1,
+                             const Vector3& minimum2, const Vector3& maximum2);
+
+private:
+  std::vector<Node> _nodes;
+  // 3 vertices per triangle, in hierarchy order
+  std::vector<Vector3> _vertices;
+  std::vector<uint32_t> _faceIds;
+
+}; // end of class TriangleBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_TRIANGLE_BVH_H
@@ -129,6 +129,15 @@ public:
   int getHardwareScalingLevel() const;
   std::vector<GLTexturePtr>& getLoadedTexturesCache();
   EngineCapabilities& getCaps();
+  bool supportsUniformBuffers() const;
+  ShaderCompilationQueue& getShaderCompilationQueue();
+  ShaderProgramCache& getShaderProgramCache();
+  /**
+   * @brief Stores the preprocessed shaders and, when the context supports it,
+   * the linked program binaries in directory so that they are reused on the
+   * next runs. An empty directory keeps the cache in memory only.
+   */
+  void setShaderCacheDirectory(const std::string& directory);
   size_t drawCalls() const;
   PerfCounter& drawCallsPerfCounter();
 
@@ -236,6 +245,10 @@ public:
   /** VBOs **/
   GLBufferPtr createVertexBuffer(const Float32Array& vertices);
   GLBufferPtr createDynamicVertexBuffer(const Float32Array& vertices);
+  /**
+   * Uploads the vertices to the buffer. With a count, only the count floats
+   * from the offset (in floats) are uploaded, at the same place in the buffer.
+   */
   void updateDynamicVertexBuffer(const GLBufferPtr& vertexBuffer,
                                  const Float32Array& vertices, int offset = -1,
                                  int count = -1);
@@ -259,6 +272,18 @@ public:
   void updateAndBindInstancesBuffer(
     GL::IGLBuffer* instancesBuffer, const Float32Array& data,
     const std::vector<InstancingAttributeInfo>& offsetLocations);
+  /**
+   * Uploads the world matrices of an instanced draw into the instances buffer
+   * shared by all the meshes and binds them to the world0..3 attributes of
+   * the effect. The buffer only grows and consecutive draws are packed at
+   * increasing offsets, so a frame does not reallocate nor overwrite data
+   * that is still in use by previous draws. Must be paired with
+   * unbindInstanceAttributes() after the draw.
+   * @param matrices - the world matrices, 16 floats per instance
+   * @param effect - the effect used for the draw
+   */
+  void bindInstancesWorldMatrices(const Float32Array& matrices,
+                                  Effect* effect);
   void applyStates();
   void draw(bool useTriangles, unsigned int indexStart, size_t indexCount,
             size_t instancesCount = 0);
@@ -267,6 +292,20 @@ public:
   void drawUnIndexed(bool useTriangles, int verticesStart, size_t verticesCount,
                      size_t instancesCount = 0);
 
+  /** UBOs **/
+  GLBufferPtr createUniformBuffer(const Float32Array& elements);
+  GLBufferPtr createDynamicUniformBuffer(const Float32Array& elements);
+  void updateUniformBuffer(GL::IGLBuffer* uniformBuffer,
+                           const Float32Array& elements);
+  void bindUniformBuffer(GL::IGLBuffer* buffer);
+  /**
+   * Binds the uniform buffer to the uniform block binding point, unless it is
+   * already bound to it.
+   */
+  void bindUniformBufferBase(GL::IGLBuffer* buffer, unsigned int location);
+  void bindUniformBlock(GL::IGLProgram* program, const std::string& blockName,
+                        unsigned int index);
+
   /** Shaders **/
   void _releaseEffect(Effect* effect);
   Effect* createEffect(
@@ -293,6 +332,23 @@ public:
     = nullptr,
     const std::unordered_map<std::string, unsigned int>& indexParameters
     = std::unordered_map<std::string, unsigned int>());
+  /**
+   * @brief Returns the effect compiled with the material defines. The effects
+   * are looked up by the hash of the shader name and of the defines, the
+   * defines text is only generated when the effect is not compiled yet.
+   */
+  Effect* createEffect(
+    const std::string& baseName,
+    const std::vector<std::string>& attributesNames,
+    const std::vector<std::string>& uniformsNames,
+    const std::vector<std::string>& samplers, const MaterialDefines& defines,
+    EffectFallbacks* fallbacks                                  = nullptr,
+    const std::function<void(const Effect* effect)>& onCompiled = nullptr,
+    const std::function<void(const Effect* effect, const std::string& errors)>&
+      onError
+    = nullptr,
+    const std::unordered_map<std::string, unsigned int>& indexParameters
+    = std::unordered_map<std::string, unsigned int>());
   Effect* createEffectForParticles(
     const std::string& fragmentName,
     const std::vector<std::string>& uniformsNames,
@@ -305,6 +361,30 @@ public:
   std::unique_ptr<GL::IGLProgram> createShaderProgram(
     const std::string& vertexCode, const std::string& fragmentCode,
     const std::string& defines, GL::IGLRenderingContext* gl = nullptr);
+  /**
+   * @brief Issues the compilation and the link of the program without waiting
+   * for the driver. The program must be finalized once completed.
+   * @param binaryKey Set to the key the program binary is stored under by
+   * finalizeShaderProgram(), 0 when it is not stored.
+   */
+  std::unique_ptr<GL::IGLProgram> createShaderProgramAsync(
+    const std::string& vertexCode, const std::string& fragmentCode,
+    const std::string& defines, uint64_t& binaryKey,
+    GL::IGLRenderingContext* gl = nullptr);
+  /**
+   * @brief Returns whether the driver is done compiling and linking the
+   * program, always true without parallel shader compilation.
+   */
+  bool isShaderProgramCompleted(GL::IGLProgram* program,
+                                GL::IGLRenderingContext* gl = nullptr);
+  /**
+   * @brief Checks the link status of the program, waiting for the driver if
+   * needed, and stores its binary.
+   * @return Whether the program is linked, errors holding the link log if not.
+   */
+  bool finalizeShaderProgram(const std::unique_ptr<GL::IGLProgram>& program,
+                             uint64_t binaryKey, std::string& errors,
+                             GL::IGLRenderingContext* gl = nullptr);
   std::unordered_map<std::string, std::unique_ptr<GL::IGLUniformLocation>>
   getUniforms(GL::IGLProgram* shaderProgram,
               const std::vector<std::string>& uniformsNames);
@@ -503,6 +583,11 @@ public:
   bool renderEvenInBackground;
   // To enable/disable IDB support and avoid XHR on .manifest
   bool enableOfflineSupport;
+  // Forces the materials to use plain uniforms instead of uniform buffers
+  bool disableUniformBuffers;
+  // Compiles the new effects in the background, they are not ready until
+  // compiled
+  bool asyncShaderCompilation;
   std::vector<Scene*> scenes;
   // WebVR
   // The new WebVR uses promises.
@@ -535,6 +620,7 @@ private:
 
   int _hardwareScalingLevel;
   EngineCapabilities _caps;
+  InstancedArrays _instancedArrays;
   bool _pointerLockRequested;
   bool _alphaTest;
   bool _isStencilEnable;
@@ -569,7 +655,18 @@ private:
   std::unordered_map<unsigned int, GL::IGLTexture*> _activeTexturesCache;
   Effect* _currentEffect;
   GL::IGLProgram* _currentProgram;
+  // Destroyed after the effects, which leave it when destroyed
+  std::unique_ptr<ShaderCompilationQueue> _shaderCompilationQueue;
   std::unordered_map<std::string, std::unique_ptr<Effect>> _compiledEffects;
+  // Effects of _compiledEffects by hash of their shader name and defines,
+  // with the name and the defines checked on a hit
+  struct EffectByDefines {
+    Effect* effect;
+    std::string baseName;
+    std::unique_ptr<MaterialDefines> defines;
+  }; // end of struct EffectByDefines
+  std::unordered_map<uint64_t, EffectByDefines> _compiledEffectsByDefines;
+  std::unique_ptr<ShaderProgramCache> _shaderProgramCache;
   std::vector<bool> _vertexAttribArraysEnabled;
   Viewport* _cachedViewport;
   std::unordered_map<std::string, VertexBuffer*> _cachedVertexBuffersMap;
@@ -583,6 +680,10 @@ private:
   std::unordered_map<unsigned int, BufferPointer> _currentBufferPointers;
   Int32Array _currentInstanceLocations;
   std::vector<GL::IGLBuffer*> _currentInstanceBuffers;
+  // Uniform buffer bound to each uniform block binding point
+  std::vector<GL::IGLBuffer*> _currentUniformBuffers;
+  GLBufferPtr _instancesWorldBuffer;
+  size_t _instancesWorldBufferOffset;
   Int32Array _textureUnits;
 
   // Hardware supported Compressed Textures
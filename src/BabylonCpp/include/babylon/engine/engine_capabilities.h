@@ -43,6 +43,10 @@ struct BABYLON_SHARED_EXPORT EngineCapabilities {
   bool textureHalfFloatRender;
   bool textureLOD;
   int drawBuffersExtension;
+  bool uniformBuffers;
+  int maxFragmentUniformBlocks;
+  bool programBinary;
+  bool parallelShaderCompile;
 }; // end of struct EngineCapabilities
 
 } // end of namespace BABYLON
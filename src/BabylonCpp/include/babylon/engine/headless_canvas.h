@@ -0,0 +1,43 @@
+#ifndef BABYLON_ENGINE_HEADLESS_CANVAS_H
+#define BABYLON_ENGINE_HEADLESS_CANVAS_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/interfaces/icanvas.h>
+#include <babylon/interfaces/icanvas_rendering_context2D.h>
+
+namespace BABYLON {
+
+namespace GL {
+class HeadlessRenderingContext;
+} // end of namespace GL
+
+/**
+ * @brief Canvas without a window, backed by a HeadlessRenderingContext.
+ */
+class BABYLON_SHARED_EXPORT HeadlessCanvas : public ICanvas {
+
+public:
+  HeadlessCanvas(int width = 1280, int height = 720);
+  virtual ~HeadlessCanvas();
+
+  ClientRect& getBoundingClientRect() override;
+  bool onlyRenderBoundingClientRect() const override;
+  bool initializeContext3d() override;
+  ICanvasRenderingContext2D* getContext2d() override;
+  GL::IGLRenderingContext* getContext3d(const EngineOptions& options) override;
+
+  /**
+   * Returns the headless rendering context used to read back the recorded
+   * commands and the per-frame counters.
+   */
+  GL::HeadlessRenderingContext& renderingContext();
+
+private:
+  GL::HeadlessRenderingContext* _headlessContext;
+  std::unique_ptr<ICanvasRenderingContext2D> _context2d;
+
+}; // end of class HeadlessCanvas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_HEADLESS_CANVAS_H
@@ -0,0 +1,355 @@
+#ifndef BABYLON_ENGINE_HEADLESS_RENDERING_CONTEXT_H
+#define BABYLON_ENGINE_HEADLESS_RENDERING_CONTEXT_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+namespace GL {
+
+/**
+ * @brief Kind of a recorded headless command.
+ */
+enum class HeadlessCommandType : uint8_t {
+  STATE       = 0,
+  BIND        = 1,
+  PROGRAM     = 2,
+  BUFFER      = 3,
+  TEXTURE     = 4,
+  UNIFORM     = 5,
+  ATTRIBUTE   = 6,
+  CLEAR       = 7,
+  DRAW        = 8,
+  RESOURCE    = 9,
+  FRAMEBUFFER = 10
+}; // end of enum class HeadlessCommandType
+
+/**
+ * @brief Compact entry of the headless command log.
+ *
+ * The meaning of the fields depends on the command type: "name" holds the GL
+ * entry point or enum (e.g. GL::TRIANGLES for a draw), "object" the id of the
+ * bound or written GL object and "size" a byte size or element count.
+ */
+struct BABYLON_SHARED_EXPORT HeadlessCommand {
+  HeadlessCommandType type;
+  GLenum name;
+  GLuint object;
+  GLintptr size;
+}; // end of struct HeadlessCommand
+
+/**
+ * @brief Per-frame counters collected by the headless rendering context.
+ */
+struct BABYLON_SHARED_EXPORT HeadlessFrameStats {
+  size_t commands           = 0;
+  size_t drawCalls          = 0;
+  size_t drawnElements      = 0;
+  size_t instancedDrawCalls = 0;
+  size_t drawnInstances     = 0;
+  size_t stateChanges       = 0;
+  size_t programChanges     = 0;
+  size_t bufferBinds        = 0;
+  size_t textureBinds       = 0;
+  size_t bufferUploads      = 0;
+  size_t bufferUploadBytes  = 0;
+  size_t textureUploads     = 0;
+  size_t textureUploadBytes = 0;
+  size_t uniformWrites      = 0;
+  size_t clears             = 0;
+}; // end of struct HeadlessFrameStats
+
+/**
+ * @brief OpenGL rendering context without any GPU or display behind it.
+ *
+ * Every GL call is recorded into a compact command log and aggregated into
+ * per-frame counters, shaders always compile and link successfully and
+ * object creation hands out unique ids. This makes Engine / Scene::render()
+ * runnable as a pure CPU workload (e.g. for benchmarking culling, sorting and
+ * state caching) on machines without a graphics stack.
+ *
+ * Usage:
+ *   HeadlessCanvas canvas;
+ *   auto engine = Engine::New(&canvas);
+ *   ...
+ *   canvas.renderingContext().newFrame();
+ *   scene->render();
+ *   canvas.renderingContext().frameStats().drawCalls;
+ */
+class BABYLON_SHARED_EXPORT HeadlessRenderingContext
+    : public IGLRenderingContext {
+
+public:
+  HeadlessRenderingContext();
+  virtual ~HeadlessRenderingContext();
+
+  /** Frame bookkeeping **/
+
+  /**
+   * Starts a new frame: the counters of the current frame are saved as the
+   * last frame counters, the current counters are reset and the command log
+   * is cleared (its capacity is kept).
+   */
+  void newFrame();
+  const HeadlessFrameStats& frameStats() const;
+  const HeadlessFrameStats& lastFrameStats() const;
+  size_t frameCount() const;
+  const std::vector<HeadlessCommand>& commandLog() const;
+  /**
+   * Enables / disables the command log. Counters are always collected.
+   */
+  void setCommandLogEnabled(bool enabled);
+  bool commandLogEnabled() const;
+
+  /** IGLRenderingContext **/
+  bool initialize() override;
+  void backupGLState() override;
+  void restoreGLState() override;
+  GLenum operator[](const std::string& name) override;
+  void activeTexture(GLenum texture) override;
+  void attachShader(const std::unique_ptr<IGLProgram>& program,
+                    const std::unique_ptr<IGLShader>& shader) override;
+  void bindAttribLocation(IGLProgram* program, GLuint index,
+                          const std::string& name) override;
+  void bindBuffer(GLenum target, IGLBuffer* buffer) override;
+  void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer) override;
+  void bindFramebuffer(GLenum target, IGLFramebuffer* framebuffer) override;
+  void bindRenderbuffer(
+    GLenum target,
+    const std::unique_ptr<IGLRenderbuffer>& renderbuffer) override;
+  void bindTexture(GLenum target, IGLTexture* texture) override;
+  void blendColor(GLclampf red, GLclampf green, GLclampf blue,
+                  GLclampf alpha) override;
+  void blendEquation(GLenum mode) override;
+  void blendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) override;
+  void blendFunc(GLenum sfactor, GLenum dfactor) override;
+  void blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
+                         GLenum dstAlpha) override;
+  void bufferData(GLenum target, GLsizeiptr size, GLenum usage) override;
+  void bufferData(GLenum target, const Float32Array& data,
+                  GLenum usage) override;
+  void bufferData(GLenum target, const Int32Array& data,
+                  GLenum usage) override;
+  void bufferData(GLenum target, const Uint16Array& data,
+                  GLenum usage) override;
+  void bufferData(GLenum target, const Uint32Array& data,
+                  GLenum usage) override;
+  void bufferSubData(GLenum target, GLintptr offset,
+                     const Float32Array& data) override;
+  void bufferSubData(GLenum target, GLintptr offset, Int32Array& data) override;
+  GLenum checkFramebufferStatus(GLenum target) override;
+  void clear(GLuint mask) override;
+  void clearColor(GLclampf red, GLclampf green, GLclampf blue,
+                  GLclampf alpha) override;
+  void clearDepth(GLclampf depth) override;
+  void clearStencil(GLint stencil) override;
+  void colorMask(GLboolean red, GLboolean green, GLboolean blue,
+                 GLboolean alpha) override;
+  void compileShader(const std::unique_ptr<IGLShader>& shader) override;
+  void compressedTexImage2D(GLenum target, GLint level, GLenum internalformat,
+                            GLint width, GLint height, GLint border,
+                            const Uint8Array& pixels) override;
+  void compressedTexSubImage2D(GLenum target, GLint level, GLint xoffset,
+                               GLint yoffset, GLint width, GLint height,
+                               GLenum format, GLsizeiptr size) override;
+  void copyTexImage2D(GLenum target, GLint level, GLenum internalformat,
+                      GLint x, GLint y, GLint width, GLint height,
+                      GLint border) override;
+  void copyTexSubImage2D(GLenum target, GLint level, GLint xoffset,
+                         GLint yoffset, GLint x, GLint y, GLint width,
+                         GLint height) override;
+  std::unique_ptr<IGLBuffer> createBuffer() override;
+  std::unique_ptr<IGLFramebuffer> createFramebuffer() override;
+  std::unique_ptr<IGLProgram> createProgram() override;
+  std::unique_ptr<IGLRenderbuffer> createRenderbuffer() override;
+  std::unique_ptr<IGLShader> createShader(GLenum type) override;
+  std::unique_ptr<IGLTexture> createTexture() override;
+  void cullFace(GLenum mode) override;
+  void deleteBuffer(IGLBuffer* buffer) override;
+  void deleteFramebuffer(
+    const std::unique_ptr<IGLFramebuffer>& framebuffer) override;
+  void deleteProgram(IGLProgram* program) override;
+  void deleteRenderbuffer(
+    const std::unique_ptr<IGLRenderbuffer>& renderbuffer) override;
+  void deleteShader(const std::unique_ptr<IGLShader>& shader) override;
+  void deleteTexture(IGLTexture* texture) override;
+  void depthFunc(GLenum func) override;
+  void depthMask(GLboolean flag) override;
+  void depthRange(GLclampf zNear, GLclampf zFar) override;
+  void detachShader(IGLProgram* program, IGLShader* shader) override;
+  void disable(GLenum cap) override;
+  void disableVertexAttribArray(GLuint index) override;
+  void drawArrays(GLenum mode, GLint first, GLint count) override;
+  void drawElements(GLenum mode, GLint count, GLenum type,
+                    GLintptr offset) override;
+  void drawArraysInstanced(GLenum mode, GLint first, GLint count,
+                           GLint instanceCount) override;
+  void drawElementsInstanced(GLenum mode, GLint count, GLenum type,
+                             GLintptr offset, GLint instanceCount) override;
+  void enable(GLenum cap) override;
+  void enableVertexAttribArray(GLuint index) override;
+  void finish() override;
+  void flush() override;
+  void framebufferRenderbuffer(
+    GLenum target, GLenum attachment, GLenum renderbuffertarget,
+    const std::unique_ptr<IGLRenderbuffer>& renderbuffer) override;
+  void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget,
+                            IGLTexture* texture, GLint level) override;
+  void frontFace(GLenum mode) override;
+  void generateMipmap(GLenum target) override;
+  std::vector<IGLShader*> getAttachedShaders(IGLProgram* program) override;
+  GLint getAttribLocation(IGLProgram* program,
+                          const std::string& name) override;
+  bool hasExtension(const std::string& extension) override;
+  std::array<int, 3> getScissorBoxParameter() override;
+  GLint getParameteri(GLenum pname) override;
+  GLfloat getParameterf(GLenum pname) override;
+  std::string getString(GLenum pname) override;
+  GLint getTexParameteri(GLenum pname) override;
+  GLfloat getTexParameterf(GLenum pname) override;
+  GLenum getError() override;
+  const char* getErrorString(GLenum err) override;
+  GLint getProgramParameter(IGLProgram* program, GLenum pname) override;
+  Uint8Array getProgramBinary(IGLProgram* program,
+                              GLenum& binaryFormat) override;
+  std::string
+  getProgramInfoLog(const std::unique_ptr<IGLProgram>& program) override;
+  any getRenderbufferParameter(GLenum target, GLenum pname) override;
+  GLint getShaderParameter(const std::unique_ptr<IGLShader>& shader,
+                           GLenum pname) override;
+  IGLShaderPrecisionFormat*
+  getShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype) override;
+  std::string
+  getShaderInfoLog(const std::unique_ptr<IGLShader>& shader) override;
+  std::string getShaderSource(IGLShader* shader) override;
+  GLuint getUniformBlockIndex(IGLProgram* program,
+                              const std::string& uniformBlockName) override;
+  std::unique_ptr<IGLUniformLocation>
+  getUniformLocation(IGLProgram* program, const std::string& name) override;
+  void hint(GLenum target, GLenum mode) override;
+  GLboolean isBuffer(IGLBuffer* buffer) override;
+  GLboolean isEnabled(GLenum cap) override;
+  GLboolean isFramebuffer(IGLFramebuffer* framebuffer) override;
+  GLboolean isProgram(const std::unique_ptr<IGLProgram>& program) override;
+  GLboolean isRenderbuffer(IGLRenderbuffer* renderbuffer) override;
+  GLboolean isShader(IGLShader* shader) override;
+  GLboolean isTexture(IGLTexture* texture) override;
+  void lineWidth(GLfloat width) override;
+  bool linkProgram(const std::unique_ptr<IGLProgram>& program) override;
+  void pixelStorei(GLenum pname, GLint param) override;
+  void polygonOffset(GLfloat factor, GLfloat units) override;
+  void programBinary(IGLProgram* program, GLenum binaryFormat,
+                     const Uint8Array& binary) override;
+  void programParameteri(IGLProgram* program, GLenum pname,
+                         GLint value) override;
+  void readPixels(GLint x, GLint y, GLint width, GLint height, GLenum format,
+                  GLenum type, Uint8Array& pixels) override;
+  void renderbufferStorage(GLenum target, GLenum internalformat, GLint width,
+                           GLint height) override;
+  void sampleCoverage(GLclampf value, GLboolean invert) override;
+  void scissor(GLint x, GLint y, GLint width, GLint height) override;
+  void shaderSource(const std::unique_ptr<IGLShader>& shader,
+                    const std::string& source) override;
+  void stencilFunc(GLenum func, GLint ref, GLuint mask) override;
+  void stencilFuncSeparate(GLenum face, GLenum func, GLint ref,
+                           GLuint mask) override;
+  void stencilMask(GLuint mask) override;
+  void stencilMaskSeparate(GLenum face, GLuint mask) override;
+  void stencilOp(GLenum fail, GLenum zfail, GLenum zpass) override;
+  void stencilOpSeparate(GLenum face, GLenum fail, GLenum zfail,
+                         GLenum zpass) override;
+  void texImage2D(GLenum target, GLint level, GLint internalformat,
+                  GLint width, GLint height, GLint border, GLenum format,
+                  GLenum type, const Uint8Array& pixels) override;
+  void texParameterf(GLenum target, GLenum pname, GLfloat param) override;
+  void texParameteri(GLenum target, GLenum pname, GLint param) override;
+  void texSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+                     GLint width, GLint height, GLenum format, GLenum type,
+                     any pixels) override;
+  void uniform1f(IGLUniformLocation* location, GLfloat x) override;
+  void uniform1fv(GL::IGLUniformLocation* uniform,
+                  const Float32Array& array) override;
+  void uniform1i(IGLUniformLocation* location, GLint x) override;
+  void uniform1iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniform2f(IGLUniformLocation* location, GLfloat x, GLfloat y) override;
+  void uniform2fv(IGLUniformLocation* location, const Float32Array& v) override;
+  void uniform2i(IGLUniformLocation* location, GLint x, GLint y) override;
+  void uniform2iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniform3f(IGLUniformLocation* location, GLfloat x, GLfloat y,
+                 GLfloat z) override;
+  void uniform3fv(IGLUniformLocation* location, const Float32Array& v) override;
+  void uniform3i(IGLUniformLocation* location, GLint x, GLint y,
+                 GLint z) override;
+  void uniform3iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniform4f(IGLUniformLocation* location, GLfloat x, GLfloat y, GLfloat z,
+                 GLfloat w) override;
+  void uniform4fv(IGLUniformLocation* location, const Float32Array& v) override;
+  void uniform4i(IGLUniformLocation* location, GLint x, GLint y, GLint z,
+                 GLint w) override;
+  void uniform4iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniformBlockBinding(IGLProgram* program, GLuint uniformBlockIndex,
+                           GLuint uniformBlockBinding) override;
+  void uniformMatrix2fv(IGLUniformLocation* location, GLboolean transpose,
+                        const Float32Array& value) override;
+  void uniformMatrix3fv(IGLUniformLocation* location, GLboolean transpose,
+                        const Float32Array& value) override;
+  void uniformMatrix4fv(IGLUniformLocation* location, GLboolean transpose,
+                        const Float32Array& value) override;
+  void uniformMatrix4fv(IGLUniformLocation* location, GLboolean transpose,
+                        const std::array<float, 16>& value) override;
+  void useProgram(IGLProgram* program) override;
+  void validateProgram(IGLProgram* program) override;
+  void vertexAttrib1f(GLuint indx, GLfloat x) override;
+  void vertexAttrib1fv(GLuint indx, Float32Array& values) override;
+  void vertexAttrib2f(GLuint indx, GLfloat x, GLfloat y) override;
+  void vertexAttrib2fv(GLuint indx, Float32Array& values) override;
+  void vertexAttrib3f(GLuint indx, GLfloat x, GLfloat y, GLfloat z) override;
+  void vertexAttrib3fv(GLuint indx, Float32Array& values) override;
+  void vertexAttrib4f(GLuint indx, GLfloat x, GLfloat y, GLfloat z,
+                      GLfloat w) override;
+  void vertexAttrib4fv(GLuint indx, Float32Array& values) override;
+  void vertexAttribPointer(GLuint indx, GLint size, GLenum type,
+                           GLboolean normalized, GLint stride,
+                           GLintptr offset) override;
+  void vertexAttribDivisor(GLuint index, GLuint divisor) override;
+  void viewport(GLint x, GLint y, GLint width, GLint height) override;
+
+private:
+  void _record(HeadlessCommandType type, GLenum name, GLuint object = 0,
+               GLintptr size = 0);
+  void _recordState(GLenum name, GLuint value = 0);
+  void _recordUniform(IGLUniformLocation* location, size_t byteSize);
+  void _recordBufferUpload(GLenum target, size_t byteSize);
+  GLuint _nextObjectId();
+
+private:
+  bool _commandLogEnabled;
+  GLuint _lastObjectId;
+  size_t _frameCount;
+  HeadlessFrameStats _frameStats;
+  HeadlessFrameStats _lastFrameStats;
+  std::vector<HeadlessCommand> _commandLog;
+  // Bindings
+  GLuint _currentProgram;
+  std::unordered_map<GLenum, GLuint> _boundBuffers;
+  GLenum _activeTexture;
+  std::set<GLenum> _enabledCaps;
+  std::array<int, 4> _scissorBox;
+  // Shader / program reflection
+  std::unordered_map<GLuint, std::string> _shaderSources;
+  std::unordered_map<GLuint, std::vector<std::unique_ptr<IGLShader>>>
+    _attachedShaders;
+  std::unordered_map<GLuint, std::unordered_map<std::string, GLint>>
+    _attribLocations;
+  std::unordered_map<GLuint, std::unordered_map<std::string, GLint>>
+    _uniformLocations;
+  std::unordered_map<GLuint, std::unordered_map<std::string, GLuint>>
+    _uniformBlockIndices;
+  IGLShaderPrecisionFormat _shaderPrecisionFormat;
+
+}; // end of class HeadlessRenderingContext
+
+} // end of namespace GL
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_HEADLESS_RENDERING_CONTEXT_H
@@ -4,6 +4,7 @@
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_global.h>
 #include <babylon/core/structs.h>
+#include <babylon/culling/bounding_box_array.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engine/pointer_info.h>
 #include <babylon/engine/pointer_info_pre.h>
@@ -90,6 +91,13 @@ public:
   PerfCounter& activeParticlesPerfCounter();
   size_t getActiveBones() const;
   PerfCounter& activeBonesPerfCounter();
+  /**
+   * Number of mesh and submesh candidates rejected by the selection octrees
+   * or the selection tree during the last frame, without being individually
+   * frustum tested
+   */
+  size_t getCulledCandidates() const;
+  PerfCounter& culledCandidatesPerfCounter();
   /** Stats **/
   microsecond_t getLastFrameDuration() const;
   PerfCounter& lastFramePerfCounter();
@@ -106,6 +114,7 @@ public:
   float getAnimationRatio() const;
   int getRenderId() const;
   void incrementRenderId();
+  unsigned int getUniqueId();
   /** Pointers handling **/
   /**
    * Attach events to the canvas (To handle actionManagers triggers and raise
@@ -179,6 +188,12 @@ public:
   const Matrix& getProjectionMatrix() const;
   Matrix getTransformMatrix();
   void setTransformMatrix(Matrix& view, Matrix& projection);
+  /**
+   * @brief Returns the uniform buffer of the scene block, holding the view,
+   * view projection and eye position. It is filled when the transform matrix
+   * is set, so once per camera.
+   */
+  UniformBuffer* getSceneUniformBuffer();
   /** Methods **/
   void addMesh(std::unique_ptr<AbstractMesh>&& newMesh);
   int removeMesh(AbstractMesh* toRemove);
@@ -360,9 +375,47 @@ public:
   MinMax getWorldExtends();
   Octree<AbstractMesh*>* createOrUpdateSelectionOctree(size_t maxCapacity = 64,
                                                        size_t maxDepth    = 2);
+  /** Selection tree **/
+  /**
+   * Creates a dynamic bounding volume hierarchy of the scene meshes, used for
+   * the active meshes selection instead of the selection octree. Unlike the
+   * octree, it is kept up to date when meshes are added, moved or removed.
+   * @param margin Enlargement of the mesh bounds in the tree, moves within
+   * this margin do not modify the tree
+   */
+  DynamicAABBTree<AbstractMesh*>* enableSelectionTree(float margin = 0.1f);
+  void disableSelectionTree();
+  DynamicAABBTree<AbstractMesh*>* selectionTree();
+  void _updateSelectionTreeProxy(AbstractMesh* mesh);
+  void _updateSelectionTreeMobility(AbstractMesh* mesh);
+  /** Parallel evaluation **/
+  /**
+   * Evaluates the active meshes on a pool of threads: the world matrices,
+   * bounding infos and frustum tests of the candidates are computed in
+   * parallel, then the meshes are activated on the calling thread, in the same
+   * order as the serial evaluation. The particle systems are simulated on the
+   * pool too, several small systems concurrently and the large ones in chunks
+   * (see ParticleSystem::parallelChunkSize). The active animatables are
+   * evaluated concurrently as well, their events and ends being handled on
+   * the calling thread afterwards, so two active animatables must not animate
+   * the same property. The onAfterWorldMatrixUpdate observers of the meshes
+   * and the custom particle functions are called from the worker threads in
+   * this mode.
+   * @param threadCount Number of worker threads, 0 to use one less than the
+   * number of hardware threads
+   */
+  void enableParallelEvaluation(size_t threadCount = 0);
+  void disableParallelEvaluation();
+  bool isParallelEvaluationEnabled() const;
+  /**
+   * Returns the pool of the parallel evaluation, nullptr if it is disabled.
+   */
+  ThreadPool* getEvaluationPool() const;
   /** Picking **/
-  Ray* createPickingRay(int x, int y, Matrix* world, Camera* camera);
-  Ray* createPickingRayInCameraSpace(int x, int y, Camera* camera);
+  std::unique_ptr<Ray> createPickingRay(int x, int y, Matrix* world,
+                                        Camera* camera);
+  std::unique_ptr<Ray> createPickingRayInCameraSpace(int x, int y,
+                                                     Camera* camera);
   /**
    * @brief Launch a ray to try to pick a mesh in the scene
    * @param x X position on screen
@@ -375,9 +428,9 @@ public:
    * nullptr. In this case, the scene.activeCamera will be used.
    * @return picking info object
    */
-  PickingInfo* pick(int x, int y,
-                    const std::function<bool(AbstractMesh* mesh)>& predicate,
-                    bool fastCheck = false, Camera* camera = nullptr);
+  std::unique_ptr<PickingInfo>
+  pick(int x, int y, const std::function<bool(AbstractMesh* mesh)>& predicate,
+       bool fastCheck = false, Camera* camera = nullptr);
   /**
    * @brief Launch a ray to try to pick a mesh in the scene
    * @param x X position on screen
@@ -389,12 +442,22 @@ public:
    * null. In this case, the scene.activeCamera will be used
    * @return picking info object
    */
-  PickingInfo* pickSprite(int x, int y,
-                          const std::function<bool(Sprite* sprite)>& predicate,
-                          bool fastCheck = false, Camera* camera = nullptr);
-  PickingInfo* pickWithRay(const Ray& ray,
-                           const std::function<bool(Mesh* mesh)>& predicate,
-                           bool fastCheck = false);
+  std::unique_ptr<PickingInfo>
+  pickSprite(int x, int y, const std::function<bool(Sprite* sprite)>& predicate,
+             bool fastCheck = false, Camera* camera = nullptr);
+  /**
+   * @brief Use the given ray to pick a mesh in the scene
+   * @param ray The ray to use, in world space
+   * @param predicate Predicate function used to determine eligible meshes. Can
+   * be set to null. In this case, a mesh must be enabled, visible and with
+   * isPickable set to true
+   * @param fastCheck Returns the first intersection found instead of the
+   * closest one
+   * @return picking info object
+   */
+  std::unique_ptr<PickingInfo>
+  pickWithRay(const Ray& ray, const std::function<bool(Mesh* mesh)>& predicate,
+              bool fastCheck = false);
   /**
    * @brief Launch a ray to try to pick a mesh in the scene
    * @param x X position on screen
@@ -406,7 +469,7 @@ public:
    * null. In this case, the scene.activeCamera will be used
    * @return list with picking info objects
    */
-  std::vector<PickingInfo*>
+  std::vector<std::unique_ptr<PickingInfo>>
   multiPick(int x, int y,
             const std::function<bool(AbstractMesh* mesh)>& predicate,
             Camera* camera);
@@ -418,7 +481,7 @@ public:
    * isPickable set to true
    * @return list with picking info objects
    */
-  std::vector<PickingInfo*>
+  std::vector<std::unique_ptr<PickingInfo>>
   multiPickWithRay(const Ray& ray,
                    const std::function<bool(Mesh* mesh)>& predicate);
   AbstractMesh* getPointerOverMesh();
@@ -480,6 +543,25 @@ public:
   void setRenderingAutoClearDepthStencil(int renderingGroupId,
                                          bool autoClearDepthStencil);
 
+  /**
+   * Specifies whether or not the compatible opaque and alpha test sub meshes
+   * of a rendering group are merged into instanced draw calls.
+   *
+   * @param renderingGroupId The rendering group id corresponding to its index
+   * @param autoInstancing Batches the compatible sub meshes if true.
+   */
+  void setRenderingAutoInstancing(int renderingGroupId, bool autoInstancing);
+
+  /**
+   * Specifies whether or not the queues of a rendering group without a custom
+   * sort function are ordered with radix sorted sort keys, grouping the sub
+   * meshes by material and geometry to reduce the state changes.
+   *
+   * @param renderingGroupId The rendering group id corresponding to its index
+   * @param useSortKeys Sorts the sub meshes with sort keys if true.
+   */
+  void setRenderingSortKeys(int renderingGroupId, bool useSortKeys);
+
 protected:
   /**
    * Constructor
@@ -491,8 +573,20 @@ protected:
 private:
   void _updatePointerPosition(const PointerEvent evt);
   void _animate(const millisecond_t& delay = std::chrono::milliseconds(0));
-  void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh);
+  void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh,
+                        int isInFrustum);
   void _evaluateActiveMeshes();
+  void _animateParticleSystems();
+  void _evaluateActiveMeshesInBatch(
+    const std::vector<AbstractMesh*>& candidates);
+  void
+  _computeWorldMatricesInParallel(const std::vector<AbstractMesh*>& meshes);
+  void _computeSharedWorldMatrices(const std::vector<AbstractMesh*>& meshes);
+  uint8_t _evaluateActiveMeshState(AbstractMesh* mesh);
+  bool _isActiveMeshSelected(AbstractMesh* mesh);
+  void _selectActiveMesh(AbstractMesh* mesh, int isSelected);
+  void _addToSelectionTree(AbstractMesh* mesh);
+  void _removeFromSelectionTree(AbstractMesh* mesh);
   void _activeMesh(AbstractMesh* mesh);
   void _renderForCamera(Camera* camera);
   void _processSubCameras(Camera* camera);
@@ -510,14 +604,25 @@ private:
   // void _switchAudioModeForHeadphones();
   // void _switchAudioModeForNormalSpeakers();
   /** Picking **/
-  PickingInfo*
+  /**
+   * @brief Broadphase of the picking: collects the eligible meshes whose world
+   * bounding box is hit by the world ray, sorted by distance to the ray origin
+   * along with that distance.
+   */
+  void _gatherPickingCandidates(
+    const Ray& worldRay,
+    const std::function<bool(AbstractMesh* mesh)>& predicate,
+    std::vector<std::pair<float, AbstractMesh*>>& candidates);
+  static std::function<bool(AbstractMesh* mesh)>
+  _toAbstractMeshPredicate(const std::function<bool(Mesh* mesh)>& predicate);
+  std::unique_ptr<PickingInfo>
   _internalPick(const std::function<Ray(const Matrix& world)>& rayFunction,
                 const std::function<bool(AbstractMesh* mesh)>& predicate,
                 bool fastCheck);
-  std::vector<PickingInfo*>
+  std::vector<std::unique_ptr<PickingInfo>>
   _internalMultiPick(const std::function<Ray(const Matrix& world)>& rayFunction,
                      const std::function<bool(AbstractMesh* mesh)>& predicate);
-  PickingInfo*
+  std::unique_ptr<PickingInfo>
   _internalPickSprites(const Ray& ray,
                        const std::function<bool(Sprite* sprite)>& predicate,
                        bool fastCheck, Camera* camera);
@@ -799,6 +904,7 @@ private:
   PerfCounter _evaluateActiveMeshesDuration;
   PerfCounter _renderTargetsDuration;
   PerfCounter _renderDuration;
+  PerfCounter _culledCandidates;
   float _animationRatio;
   bool _animationStartDateSet;
   high_res_time_point_t _animationStartDate;
@@ -818,11 +924,33 @@ private:
   std::vector<EdgesRenderer*> _edgesRenderers;
   std::unique_ptr<BoundingBoxRenderer> _boundingBoxRenderer;
   std::unique_ptr<OutlineRenderer> _outlineRenderer;
+  std::unique_ptr<UniformBuffer> _sceneUbo;
   Matrix _viewMatrix;
   Matrix _projectionMatrix;
   bool _frustumPlanesSet;
   std::array<Plane, 6> _frustumPlanes;
   Octree<AbstractMesh*>* _selectionOctree;
+  // Meshes added to the dynamic content of the selection octree since its
+  // last update, inserted in its blocks by the next update
+  std::vector<AbstractMesh*> _meshesAddedSinceOctreeUpdate;
+  std::unique_ptr<DynamicAABBTree<AbstractMesh*>> _selectionTree;
+  std::vector<AbstractMesh*> _selectionTreeContent;
+  // Meshes always selected, kept out of the selection tree
+  std::vector<AbstractMesh*> _selectionTreeAlwaysSelected;
+  // Meshes of the selection tree whose world matrix is not frozen
+  std::vector<AbstractMesh*> _selectionTreeMovableMeshes;
+  // Parallel evaluation
+  std::unique_ptr<ThreadPool> _evaluationPool;
+  std::vector<AbstractMesh*> _evaluationCandidates;
+  std::vector<uint8_t> _evaluationStates;
+  std::vector<ParticleSystem*> _concurrentParticleSystems;
+  std::vector<Animatable*> _evaluatedAnimatables;
+  // Batched frustum culling
+  BoundingBoxArray _cullingBoxes;
+  std::vector<uint32_t> _cullingVisibility;
+  BoundingBoxArray _subMeshCullingBoxes;
+  std::vector<uint32_t> _subMeshCullingVisibility;
+  bool _deferSelectionTreeUpdates;
   AbstractMesh* _pointerOverMesh;
   Sprite* _pointerOverSprite;
   std::unique_ptr<DebugLayer> _debugLayer;
@@ -0,0 +1,95 @@
+#ifndef BABYLON_ENGINE_SHADER_COMPILATION_QUEUE_H
+#define BABYLON_ENGINE_SHADER_COMPILATION_QUEUE_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/task_group.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Queue of the effects compiled in the background.
+ *
+ * The sources of the queued effects are preprocessed (includes and precision)
+ * by tasks of the default thread pool. processResults(), which the scene
+ * calls at the beginning of each frame, then issues the compilation of a
+ * batch of preprocessed effects and completes the effects whose program the
+ * driver is done linking, so that no frame waits for more than a batch of
+ * compilations. Until then the effects are not ready and the meshes using
+ * them are skipped.
+ */
+class BABYLON_SHARED_EXPORT ShaderCompilationQueue {
+
+public:
+  ShaderCompilationQueue(Engine* engine);
+  ~ShaderCompilationQueue();
+
+  /** Properties **/
+  /**
+   * @brief Returns the number of queued effects which are not ready yet. Must
+   * be called on the render thread.
+   */
+  size_t pendingCount() const;
+
+  /** Methods **/
+  /**
+   * @brief Queues the effect with its loaded sources.
+   */
+  void add(Effect* effect, const std::string& vertexCode,
+           const std::string& fragmentCode);
+  /**
+   * @brief Removes the effect from the queue, waiting for its preprocessing if
+   * it is running.
+   */
+  void remove(Effect* effect);
+  /**
+   * @brief Issues the compilation of the next batch of effects and completes
+   * the compiled effects. Must be called on the render thread.
+   */
+  void processResults();
+  /**
+   * @brief Compiles all the queued effects, blocking until they are done.
+   * Must be called on the render thread.
+   */
+  void flush();
+  /**
+   * @brief Drops the queued effects, waiting for the running preprocessing
+   * and deleting the programs being compiled. The dropped effects are never
+   * ready. Must be called on the render thread, before the context is lost.
+   */
+  void clear();
+
+private:
+  struct Job {
+    Effect* effect;
+    std::string vertexCode;
+    std::string fragmentCode;
+    std::unique_ptr<GL::IGLProgram> program;
+    uint64_t binaryKey;
+  }; // end of struct Job
+
+  void _preprocessNext();
+  void _takePreprocessedJobs();
+  void _processResults(bool wait);
+  void _deleteProgram(Job& job);
+
+public:
+  // Compilations issued per call to processResults()
+  size_t maxCompilationsPerFrame;
+
+private:
+  Engine* _engine;
+  mutable std::mutex _mutex;
+  std::condition_variable _preprocessed;
+  // Shared with the tasks, under _mutex
+  std::deque<Job> _preprocessingJobs;
+  std::vector<Job> _preprocessedJobs;
+  std::vector<Effect*> _preprocessingEffects;
+  // Render thread only, waiting for their compilation or linking
+  std::vector<Job> _compilingJobs;
+  TaskGroup _tasks;
+
+}; // end of class ShaderCompilationQueue
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_SHADER_COMPILATION_QUEUE_H
@@ -0,0 +1,86 @@
+#ifndef BABYLON_ENGINE_SHADER_PROGRAM_CACHE_H
+#define BABYLON_ENGINE_SHADER_PROGRAM_CACHE_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Cache of the preprocessed shader sources and of the linked program
+ * binaries, keyed by a 64 bits hash of their content.
+ *
+ * The preprocessed sources are kept in memory and, like the program binaries,
+ * written to disk once a directory is set, so that the next runs skip the
+ * include expansion and the shader compilation. The entries are stored in a
+ * subdirectory named after the cache format and the given version, entries
+ * written by another version are never read.
+ */
+class BABYLON_SHARED_EXPORT ShaderProgramCache {
+
+public:
+  /** Bumped whenever the layout of the entries on disk changes */
+  static constexpr unsigned int FormatVersion = 1;
+
+public:
+  ShaderProgramCache();
+  ~ShaderProgramCache();
+
+  /** Properties **/
+  /**
+   * @brief Returns the directory the entries are stored in, empty when the
+   * cache is in memory only.
+   */
+  const std::string& directory() const;
+  /**
+   * @brief Stores the entries in the subdirectory of directory for the given
+   * version, creating it if needed. An empty directory keeps the entries in
+   * memory only.
+   * @return Whether the entries are stored on disk.
+   */
+  bool setDirectory(const std::string& directory, const std::string& version);
+
+  /** Methods **/
+  /**
+   * @brief Looks up a preprocessed source, in memory then on disk.
+   * @return Whether the source was found.
+   */
+  bool getSource(uint64_t key, std::string& source);
+  void setSource(uint64_t key, const std::string& source);
+  /**
+   * @brief Looks up a program binary on disk.
+   * @return Whether a binary was found.
+   */
+  bool getBinary(uint64_t key, GL::GLenum& binaryFormat, Uint8Array& binary);
+  void setBinary(uint64_t key, GL::GLenum binaryFormat,
+                 const Uint8Array& binary);
+  /**
+   * @brief Removes a program binary, e.g. when the driver rejects it.
+   */
+  void removeBinary(uint64_t key);
+  /**
+   * @brief Drops the entries kept in memory, the entries on disk are kept.
+   */
+  void clear();
+
+  /** Statics **/
+  /**
+   * @brief Returns the 64 bits FNV-1a hash of the data, continuing from hash
+   * to combine several strings.
+   */
+  static uint64_t Hash(const std::string& data,
+                       uint64_t hash = 0xcbf29ce484222325ull);
+
+private:
+  std::string _path(uint64_t key, const char* extension) const;
+
+private:
+  std::string _directory;
+  std::unordered_map<uint64_t, std::string> _sources;
+  std::mutex _mutex;
+
+}; // end of class ShaderProgramCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_SHADER_PROGRAM_CACHE_H
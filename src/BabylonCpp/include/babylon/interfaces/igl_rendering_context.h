@@ -90,6 +90,19 @@ enum GLEnums : GLenum {
   BUFFER_SIZE                  = 0x8764,
   BUFFER_USAGE                 = 0x8765,
   CURRENT_VERTEX_ATTRIB        = 0x8626,
+  /* Uniform Buffer Objects */
+  UNIFORM_BUFFER              = 0x8A11,
+  UNIFORM_BUFFER_BINDING      = 0x8A28,
+  MAX_FRAGMENT_UNIFORM_BLOCKS = 0x8A2D,
+  MAX_UNIFORM_BUFFER_BINDINGS = 0x8A2F,
+  INVALID_INDEX               = 0xFFFFFFFF,
+  /* Program Binaries */
+  PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257,
+  PROGRAM_BINARY_LENGTH           = 0x8741,
+  NUM_PROGRAM_BINARY_FORMATS      = 0x87FE,
+  PROGRAM_BINARY_FORMATS          = 0x87FF,
+  /* Parallel Shader Compile */
+  COMPLETION_STATUS_KHR = 0x91B1,
   /* CullFaceMode */
   FRONT          = 0x0404,
   BACK           = 0x0405,
@@ -318,6 +331,7 @@ enum GLEnums : GLenum {
   VERTEX_ATTRIB_ARRAY_NORMALIZED     = 0x886A,
   VERTEX_ATTRIB_ARRAY_POINTER        = 0x8645,
   VERTEX_ATTRIB_ARRAY_BUFFER_BINDING = 0x889F,
+  VERTEX_ATTRIB_ARRAY_DIVISOR        = 0x88FE,
   /* Shader Source */
   COMPILE_STATUS = 0x8B81,
   /* Shader Precision-Specified Types */
@@ -531,6 +545,8 @@ public:
                                   const std::string& name)
     = 0;
   virtual void bindBuffer(GLenum target, IGLBuffer* buffer)                = 0;
+  virtual void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer)
+    = 0;
   virtual void bindFramebuffer(GLenum target, IGLFramebuffer* framebuffer) = 0;
   virtual void
   bindRenderbuffer(GLenum target,
@@ -619,6 +635,12 @@ public:
   virtual void drawElements(GLenum mode, GLint count, GLenum type,
                             GLintptr offset)
     = 0;
+  virtual void drawArraysInstanced(GLenum mode, GLint first, GLint count,
+                                   GLint instanceCount)
+    = 0;
+  virtual void drawElementsInstanced(GLenum mode, GLint count, GLenum type,
+                                     GLintptr offset, GLint instanceCount)
+    = 0;
   virtual void enable(GLenum cap)                    = 0;
   virtual void enableVertexAttribArray(GLuint index) = 0;
   virtual void finish()                              = 0;
@@ -659,6 +681,8 @@ public:
   //                                              pname)
   //  = 0;
   virtual GLint getProgramParameter(IGLProgram* program, GLenum pname) = 0;
+  virtual Uint8Array getProgramBinary(IGLProgram* program, GLenum& binaryFormat)
+    = 0;
   virtual std::string
   getProgramInfoLog(const std::unique_ptr<IGLProgram>& program)
     = 0;
@@ -677,6 +701,9 @@ public:
   // virtual any getUniform(IGLProgram* program,
   //                       IGLUniformLocation* location)
   //  = 0;
+  virtual GLuint getUniformBlockIndex(IGLProgram* program,
+                                     const std::string& uniformBlockName)
+    = 0;
   virtual std::unique_ptr<IGLUniformLocation>
   getUniformLocation(IGLProgram* program, const std::string& name) = 0;
   // virtual any getVertexAttrib(GLuint index, GLenum pname) = 0;
@@ -693,6 +720,12 @@ public:
   virtual bool linkProgram(const std::unique_ptr<IGLProgram>& program)    = 0;
   virtual void pixelStorei(GLenum pname, GLint param)       = 0;
   virtual void polygonOffset(GLfloat factor, GLfloat units) = 0;
+  virtual void programBinary(IGLProgram* program, GLenum binaryFormat,
+                             const Uint8Array& binary)
+    = 0;
+  virtual void programParameteri(IGLProgram* program, GLenum pname,
+                                 GLint value)
+    = 0;
 
   virtual void readPixels(GLint x, GLint y, GLint width, GLint height,
                           GLenum format, GLenum type, Uint8Array& pixels)
@@ -782,6 +815,10 @@ public:
     = 0;
   virtual void uniform4iv(IGLUniformLocation* location, const Int32Array& v)
     = 0;
+  virtual void uniformBlockBinding(IGLProgram* program,
+                                   GLuint uniformBlockIndex,
+                                   GLuint uniformBlockBinding)
+    = 0;
   virtual void uniformMatrix2fv(IGLUniformLocation* location,
                                 GLboolean transpose, const Float32Array& value)
     = 0;
@@ -811,6 +848,7 @@ public:
                                    GLboolean normalized, GLint stride,
                                    GLintptr offset)
     = 0;
+  virtual void vertexAttribDivisor(GLuint index, GLuint divisor) = 0;
   virtual void viewport(GLint x, GLint y, GLint width, GLint height) = 0;
 
 protected:
@@ -69,6 +69,8 @@ private:
                                const std::string& targetProperty);
   Quaternion* _getQuaternionProperty(AbstractMesh* target,
                                      const std::string& targetProperty);
+  Color3* _getColor3Property(StandardMaterial* target,
+                             const std::string& targetProperty);
 
 }; // end of class IReflect
 
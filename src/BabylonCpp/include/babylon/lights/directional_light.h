@@ -35,6 +35,7 @@ public:
   bool computeTransformedPosition() override;
   void transferToEffect(Effect* effect,
                         const std::string& directionUniformName) override;
+  void transferToUniformBuffer(UniformBuffer* uniformBuffer) override;
   Matrix* _getWorldMatrix() override;
   unsigned int getTypeID() const override;
 
@@ -24,6 +24,7 @@ public:
   ShadowGenerator* getShadowGenerator() override;
   void transferToEffect(Effect* effect, const std::string& directionUniformName,
                         const std::string& groundColorUniformName) override;
+  void transferToUniformBuffer(UniformBuffer* uniformBuffer) override;
   Matrix* _getWorldMatrix() override;
   unsigned int getTypeID() const override;
 
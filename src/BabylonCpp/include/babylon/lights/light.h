@@ -51,6 +51,16 @@ public:
                                 const std::string& uniformName0);
   virtual void transferToEffect(Effect* effect, const std::string& uniformName0,
                                 const std::string& uniformName1);
+  /**
+   * @brief Writes the light data, direction and ground color of the light
+   * block.
+   */
+  virtual void transferToUniformBuffer(UniformBuffer* uniformBuffer);
+  /**
+   * @brief Returns the uniform buffer of the light block, refreshed once per
+   * frame.
+   */
+  UniformBuffer* getUniformBuffer();
   virtual Matrix* _getWorldMatrix();
   bool canAffectMesh(AbstractMesh* mesh);
   Matrix* getWorldMatrix() override;
@@ -85,6 +95,8 @@ public:
 private:
   std::unique_ptr<Matrix> _parentedWorldMatrix;
   std::unique_ptr<Matrix> _worldMatrix;
+  std::unique_ptr<UniformBuffer> _uniformBuffer;
+  int _uniformBufferRenderId;
 
 }; // end of class Light
 
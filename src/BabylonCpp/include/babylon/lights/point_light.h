@@ -26,6 +26,7 @@ public:
   bool computeTransformedPosition() override;
   void transferToEffect(Effect* effect,
                         const std::string& positionUniformName) override;
+  void transferToUniformBuffer(UniformBuffer* uniformBuffer) override;
   bool needCube() const override;
   bool supportsVSM() const override;
   bool needRefreshPerFrame() const override;
@@ -18,6 +18,29 @@ struct BABYLON_SHARED_EXPORT ISceneLoaderPlugin {
   virtual bool load(Scene* scene, const std::string& data,
                     const std::string& rootUrl)
     = 0;
+  /**
+   * @brief Imports the meshes from the content of the file, which can be
+   * memory mapped. By default, the content is copied to call importMesh().
+   */
+  virtual bool importMeshData(const std::vector<std::string>& meshesNames,
+                              Scene* scene, const char* data, size_t size,
+                              const std::string& rootUrl,
+                              std::vector<AbstractMesh*>& meshes,
+                              std::vector<ParticleSystem*>& particleSystems,
+                              std::vector<Skeleton*>& skeletons)
+  {
+    return importMesh(meshesNames, scene, std::string(data, size), rootUrl,
+                      meshes, particleSystems, skeletons);
+  }
+  /**
+   * @brief Loads the scene from the content of the file, which can be memory
+   * mapped. By default, the content is copied to call load().
+   */
+  virtual bool loadData(Scene* scene, const char* data, size_t size,
+                        const std::string& rootUrl)
+  {
+    return load(scene, std::string(data, size), rootUrl);
+  }
 }; // end of struct ISceneLoaderPlugin
 
 } // end of namespace BABYLON
@@ -0,0 +1,70 @@
+#ifndef BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
+#define BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/plugins/babylon/babylon_file_loader.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Loader of the binary .babylonbin scenes, the .babylon scenes
+ * converted once by Convert().
+ *
+ * The file holds the scene document in a compact binary encoding followed by
+ * the vertex data arrays as raw, 16 bytes aligned sections, in the native byte
+ * order:
+ * - header: "BBIN", format version, byte order mark, section count, offset
+ *   and size of the document
+ * - section table: offset and size of each section
+ * - document: tagged values, the packed vertex data arrays (see Json::Parse())
+ *   being references to their section
+ * - sections
+ * Loading decodes the document without any text parsing, and copies each
+ * vertex data array from the memory mapped file in a single block.
+ */
+struct BABYLON_SHARED_EXPORT BabylonBinaryFileLoader
+    : public BabylonFileLoader {
+
+  static constexpr uint32_t FormatVersion = 1;
+
+  BabylonBinaryFileLoader();
+  virtual ~BabylonBinaryFileLoader();
+
+  bool importMesh(const std::vector<std::string>& meshesNames, Scene* scene,
+                  const std::string& data, const std::string& rootUrl,
+                  std::vector<AbstractMesh*>& meshes,
+                  std::vector<ParticleSystem*>& particleSystems,
+                  std::vector<Skeleton*>& skeletons) override;
+  bool load(Scene* scene, const std::string& data,
+            const std::string& rootUrl) override;
+  bool importMeshData(const std::vector<std::string>& meshesNames,
+                      Scene* scene, const char* data, size_t size,
+                      const std::string& rootUrl,
+                      std::vector<AbstractMesh*>& meshes,
+                      std::vector<ParticleSystem*>& particleSystems,
+                      std::vector<Skeleton*>& skeletons) override;
+  bool loadData(Scene* scene, const char* data, size_t size,
+                const std::string& rootUrl) override;
+
+  /**
+   * @brief Encodes the parsed document in the binary format.
+   */
+  static std::string Serialize(const Json::value& parsedData);
+  /**
+   * @brief Decodes the document of a binary file.
+   * @return The decoding error, empty on success.
+   */
+  static std::string Deserialize(const char* data, size_t size,
+                                 Json::value& parsedData);
+  /**
+   * @brief Converts the .babylon file to a binary file.
+   * @return The conversion error, empty on success.
+   */
+  static std::string Convert(const std::string& babylonFilename,
+                             const std::string& binaryFilename);
+
+}; // end of struct BabylonBinaryFileLoader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
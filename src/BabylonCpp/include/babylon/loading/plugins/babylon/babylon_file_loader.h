@@ -28,6 +28,29 @@ struct BABYLON_SHARED_EXPORT BabylonFileLoader : public ISceneLoaderPlugin {
                   std::vector<Skeleton*>& skeletons) override;
   bool load(Scene* scene, const std::string& data,
             const std::string& rootUrl) override;
+  bool importMeshData(const std::vector<std::string>& meshesNames,
+                      Scene* scene, const char* data, size_t size,
+                      const std::string& rootUrl,
+                      std::vector<AbstractMesh*>& meshes,
+                      std::vector<ParticleSystem*>& particleSystems,
+                      std::vector<Skeleton*>& skeletons) override;
+  bool loadData(Scene* scene, const char* data, size_t size,
+                const std::string& rootUrl) override;
+
+  /**
+   * @brief Imports the meshes of the parsed document.
+   */
+  bool importParsedData(const std::vector<std::string>& meshesNames,
+                        Scene* scene, const Json::value& parsedData,
+                        const std::string& rootUrl,
+                        std::vector<AbstractMesh*>& meshes,
+                        std::vector<ParticleSystem*>& particleSystems,
+                        std::vector<Skeleton*>& skeletons);
+  /**
+   * @brief Loads the scene of the parsed document.
+   */
+  bool loadParsedData(Scene* scene, const Json::value& parsedData,
+                      const std::string& rootUrl);
 
 }; // end of struct BabylonFileLoader
 
@@ -39,6 +39,7 @@ public:
   size_t getAttributesCount();
   int getUniformIndex(const std::string& uniformName);
   GL::IGLUniformLocation* getUniform(const std::string& uniformName);
+  GL::IGLUniformLocation* getUniform(int uniformIndex);
   std::vector<std::string>& getSamplers();
   std::string getCompilationError();
   std::string getVertexShaderSource();
@@ -50,6 +51,16 @@ public:
   void
   _loadFragmentShader(const std::string& fragment,
                       std::function<void(const std::string& data)> callback);
+  /**
+   * @brief Expands the includes and sets the precision of the sources. Called
+   * on a worker thread when the effect is compiled in the background.
+   */
+  void _preprocessSources(std::string& vertexCode, std::string& fragmentCode);
+  /**
+   * @brief Completes the effect with its linked program.
+   */
+  void _setProgram(std::unique_ptr<GL::IGLProgram>&& program);
+  void _setCompilationError(const std::string& errors);
   bool isSupported() const;
   void _bindTexture(const std::string& channel, GL::IGLTexture* texture);
   void setTexture(const std::string& channel, BaseTexture* texture);
@@ -57,11 +68,10 @@ public:
                        const std::vector<BaseTexture*>& textures);
   void setTextureFromPostProcess(const std::string& channel,
                                  PostProcess* postProcess);
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z,
-                    float w);
+  bool _cacheMatrix(int uniformIndex, const Matrix& matrix);
+  bool _cacheFloat2(int uniformIndex, float x, float y);
+  bool _cacheFloat3(int uniformIndex, float x, float y, float z);
+  bool _cacheFloat4(int uniformIndex, float x, float y, float z, float w);
   Effect& setIntArray(const std::string& uniformName, const Int32Array& array);
   Effect& setIntArray2(const std::string& uniformName, const Int32Array& array);
   Effect& setIntArray3(const std::string& uniformName, const Int32Array& array);
@@ -96,9 +106,36 @@ public:
   Effect& setColor3(const std::string& uniformName, const Color3& color3);
   Effect& setColor4(const std::string& uniformName, const Color3& color3,
                     float alpha);
+  /**
+   * Setters by uniform index, as returned by getUniformIndex(), to resolve
+   * the names once per effect instead of on every call
+   */
+  Effect& setMatrices(int uniformIndex, const Float32Array& matrices);
+  Effect& setMatrix(int uniformIndex, const Matrix& matrix);
+  Effect& setFloat(int uniformIndex, float value);
+  Effect& setBool(int uniformIndex, bool _bool);
+  Effect& setVector2(int uniformIndex, const Vector2& vector2);
+  Effect& setFloat2(int uniformIndex, float x, float y);
+  Effect& setVector3(int uniformIndex, const Vector3& vector3);
+  Effect& setFloat3(int uniformIndex, float x, float y, float z);
+  Effect& setVector4(int uniformIndex, const Vector4& vector4);
+  Effect& setFloat4(int uniformIndex, float x, float y, float z, float w);
+  Effect& setColor3(int uniformIndex, const Color3& color3);
+  Effect& setColor4(int uniformIndex, const Color3& color3, float alpha);
+  /**
+   * Binds the uniform block of the program to the uniform buffer binding
+   * point. The binding is kept for the lifetime of the program, so this is
+   * only forwarded to the engine once per block.
+   */
+  void bindUniformBlock(const std::string& blockName, unsigned int index);
 
 private:
+  void _indexUniforms();
+  bool _cacheValues(int uniformIndex, const float* values, unsigned int count);
+  void _clearCache(int uniformIndex);
   void _dumpShadersName();
+  void _queueEffect(const std::string& vertexSource,
+                    const std::string& fragmentSource);
   void _processIncludes(
     const std::string& sourceCode,
     const std::function<void(const std::string& data)>& callback);
@@ -121,6 +158,8 @@ private:
   std::vector<std::string> _uniformsNames;
   std::vector<std::string> _samplers;
   bool _isReady;
+  // Whether the effect is in the compilation queue of the engine
+  bool _isQueued;
   std::string _compilationError;
   std::vector<std::string> _attributesNames;
   Int32Array _attributes;
@@ -128,7 +167,13 @@ private:
     _uniforms;
   std::unordered_map<std::string, unsigned int> _indexParameters;
   std::unique_ptr<GL::IGLProgram> _program;
-  std::unordered_map<std::string, Float32Array> _valueCache;
+  std::unordered_map<std::string, int> _uniformIndices;
+  std::vector<GL::IGLUniformLocation*> _uniformLocations;
+  // Last values set, 16 floats per uniform index
+  Float32Array _valueCache;
+  // Number of floats cached per uniform index, 0 when nothing is cached
+  std::vector<unsigned char> _valueCacheSizes;
+  std::unordered_map<std::string, unsigned int> _uniformBlockBindings;
 
 }; // end of class Effect
 
@@ -102,6 +102,7 @@ public:
   Observable<Material> onUnBindObservable;
   // Properties
   std::string id;
+  unsigned int uniqueId;
   std::string name;
   bool checkReadyOnEveryCall;
   bool checkReadyOnlyOnce;
@@ -6,40 +6,171 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Fixed-width set of define flags which keeps the hash of its set flags
+ * up to date.
+ *
+ * Each flag has a pseudo random 64 bits key derived from the seed of the set,
+ * the hash is the xor of the keys of the set flags so that setting or clearing
+ * a flag updates it in constant time. Flags out of range read as false and are
+ * not stored.
+ */
+template <unsigned int N>
+class DefineFlags {
+
+public:
+  class reference {
+
+  public:
+    reference(DefineFlags* flags, unsigned int index)
+        : _flags{flags}, _index{index}
+    {
+    }
+
+    reference& operator=(bool value)
+    {
+      _flags->set(_index, value);
+      return *this;
+    }
+
+    reference& operator=(const reference& other)
+    {
+      _flags->set(_index, other);
+      return *this;
+    }
+
+    operator bool() const
+    {
+      return _flags->test(_index);
+    }
+
+  private:
+    DefineFlags* _flags;
+    unsigned int _index;
+
+  }; // end of class reference
+
+public:
+  DefineFlags(uint64_t seed) : _seed{seed}, _hash{0}
+  {
+    _words.fill(0);
+  }
+
+  static constexpr unsigned int size()
+  {
+    return N;
+  }
+
+  bool operator[](unsigned int index) const
+  {
+    return test(index);
+  }
+
+  reference operator[](unsigned int index)
+  {
+    return reference(this, index);
+  }
+
+  bool operator==(const DefineFlags& other) const
+  {
+    return _words == other._words;
+  }
+
+  bool operator!=(const DefineFlags& other) const
+  {
+    return _words != other._words;
+  }
+
+  bool test(unsigned int index) const
+  {
+    return (index < N) && ((_words[index / 64] >> (index % 64)) & 1);
+  }
+
+  void set(unsigned int index, bool value = true)
+  {
+    if (index >= N || test(index) == value) {
+      return;
+    }
+
+    _words[index / 64] ^= uint64_t(1) << (index % 64);
+    _hash ^= Mix(_seed + index);
+  }
+
+  void reset()
+  {
+    _words.fill(0);
+    _hash = 0;
+  }
+
+  uint64_t hash() const
+  {
+    return _hash;
+  }
+
+  /**
+   * @brief Returns a well distributed 64 bits value (splitmix64 finalizer).
+   */
+  static uint64_t Mix(uint64_t value)
+  {
+    value += 0x9e3779b97f4a7c15ull;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+  }
+
+private:
+  std::array<uint64_t, (N + 63) / 64> _words;
+  uint64_t _seed;
+  uint64_t _hash;
+
+}; // end of class DefineFlags
+
 struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
 
+  static constexpr unsigned int MaxDefines = 128;
+  static constexpr unsigned int MaxLights  = 32;
+
+  using Defines     = DefineFlags<MaxDefines>;
+  using LightsFlags = DefineFlags<MaxLights>;
+
   MaterialDefines();
   virtual ~MaterialDefines();
 
   bool operator[](unsigned int define) const;
-  void resizeLights(unsigned int lightIndex);
   friend std::ostream& operator<<(std::ostream& os,
                                   const MaterialDefines& materialDefines);
 
+  /**
+   * @brief Returns the hash of the defines written by toString(), in constant
+   * time. Equal defines have equal hashes.
+   */
+  uint64_t hash() const;
+
   virtual bool isEqual(MaterialDefines& other) const override;
   virtual void cloneTo(MaterialDefines& other) override;
   virtual void reset() override;
   virtual std::string toString() const override;
 
   // Properties
-  std::vector<bool> defines;
-  std::vector<std::string> _keys;
+  Defines defines;
+  // Names of the defines, shared by all the defines of a material type
+  const std::vector<std::string>* _keys;
 
   std::size_t NUM_BONE_INFLUENCERS;
   std::size_t BonesPerMesh;
 
-  std::vector<bool> lights;
-  std::vector<bool> pointlights;
-  std::vector<bool> dirlights;
-  std::vector<bool> hemilights;
-  std::vector<bool> spotlights;
-  std::vector<bool> shadows;
-  std::vector<bool> shadowvsms;
-  std::vector<bool> shadowpcfs;
+  LightsFlags lights;
+  LightsFlags pointlights;
+  LightsFlags dirlights;
+  LightsFlags hemilights;
+  LightsFlags spotlights;
+  LightsFlags shadows;
+  LightsFlags shadowvsms;
+  LightsFlags shadowpcfs;
 
   bool LIGHTMAPEXCLUDED;
-  std::vector<bool> lightmapexcluded;
-  std::vector<bool> lightmapnospecular;
+  LightsFlags lightmapexcluded;
+  LightsFlags lightmapnospecular;
 
 }; // end of struct MaterialDefines
 
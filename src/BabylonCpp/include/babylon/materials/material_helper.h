@@ -28,6 +28,12 @@ public:
   static void PrepareAttributesForInstances(std::vector<std::string>& attribs,
                                             MaterialDefines& defines,
                                             int INSTANCES = -1);
+  /**
+   * @brief Returns whether the scene, material and light uniform blocks of a
+   * material can be used with the engine.
+   */
+  static bool UseUniformBuffers(Engine* engine,
+                                unsigned int maxSimultaneousLights = 4);
 
   // Bindings
   static bool BindLightShadow(Light* light, Scene* scene, AbstractMesh* mesh,
@@ -37,7 +43,14 @@ public:
                                   unsigned int lightIndex);
   static void BindLights(Scene* scene, AbstractMesh* mesh, Effect* effect,
                          bool specularTerm,
-                         unsigned int maxSimultaneousLights = 4);
+                         unsigned int maxSimultaneousLights = 4,
+                         bool useUniformBuffers = false);
+  /**
+   * @brief Binds the scene, material and light uniform blocks of the effect
+   * to their uniform buffer binding points.
+   */
+  static void BindUniformBlocks(Effect* effect,
+                                unsigned int maxSimultaneousLights = 4);
   static void BindFogParameters(Scene* scene, AbstractMesh* mesh,
                                 Effect* effect);
   static void BindBonesParameters(AbstractMesh* mesh, Effect* effect);
@@ -436,6 +436,8 @@ private:
   PBRMaterialDefines _defines;
   std::unique_ptr<PBRMaterialDefines> _cachedDefines;
   bool _useLogarithmicDepth;
+  // Effect uniform indices of the uniforms set by bind()
+  Int32Array _uniformIndices;
   static Color3 _scaledAlbedo;
   static Color3 _scaledReflectivity;
   static Color3 _scaledEmissive;
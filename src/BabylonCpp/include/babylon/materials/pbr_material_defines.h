@@ -74,6 +74,7 @@ struct BABYLON_SHARED_EXPORT PBRMaterialDefines : public MaterialDefines {
   static constexpr unsigned int METALLICWORKFLOW                = 63;
   static constexpr unsigned int METALLICROUGHNESSGSTOREINALPHA  = 64;
   static constexpr unsigned int METALLICROUGHNESSGSTOREINGREEN  = 65;
+  static constexpr unsigned int UNIFORMBUFFER                   = 66;
 
   PBRMaterialDefines();
   ~PBRMaterialDefines();
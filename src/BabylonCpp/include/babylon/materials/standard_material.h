@@ -79,6 +79,14 @@ protected:
 private:
   bool _shouldUseAlphaFromDiffuseTexture();
   bool _checkCache(Scene* scene, AbstractMesh* mesh, bool useInstances = false);
+  void _buildUniformBuffer();
+  // Write a uniform set by bind() to the material block in uniform buffer
+  // mode when the block holds it, to the effect otherwise
+  void _setMatrix(unsigned int uniform, const Matrix& matrix);
+  void _setFloat2(unsigned int uniform, float x, float y);
+  void _setFloat4(unsigned int uniform, float x, float y, float z, float w);
+  void _setColor3(unsigned int uniform, const Color3& color3);
+  void _setColor4(unsigned int uniform, const Color3& color3, float alpha);
 
 public:
   BaseTexture* diffuseTexture;
@@ -155,6 +163,12 @@ private:
   StandardMaterialDefines _defines;
   std::unique_ptr<StandardMaterialDefines> _cachedDefines;
   bool _useLogarithmicDepth;
+  // Effect uniform indices of the uniforms set by bind()
+  Int32Array _uniformIndices;
+  // Material uniform block, used when the effect has the UNIFORMBUFFER define
+  std::unique_ptr<UniformBuffer> _uniformBuffer;
+  // Block index of the uniforms set by bind(), -1 when not in the block
+  Int32Array _uniformBufferIndices;
 
 }; // end of class StandardMaterial
 
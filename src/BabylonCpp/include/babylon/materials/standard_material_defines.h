@@ -64,6 +64,7 @@ struct BABYLON_SHARED_EXPORT StandardMaterialDefines : public MaterialDefines {
   static constexpr unsigned int SHADOWFULLFLOAT                     = 53;
   static constexpr unsigned int CAMERACOLORGRADING                  = 54;
   static constexpr unsigned int CAMERACOLORCURVES                   = 55;
+  static constexpr unsigned int UNIFORMBUFFER                       = 56;
 
   StandardMaterialDefines();
   ~StandardMaterialDefines();
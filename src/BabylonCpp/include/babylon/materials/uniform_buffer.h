@@ -0,0 +1,113 @@
+#ifndef BABYLON_MATERIALS_UNIFORM_BUFFER_H
+#define BABYLON_MATERIALS_UNIFORM_BUFFER_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Uniform buffer object holding the values of a layout(std140) uniform
+ * block.
+ *
+ * The uniforms are declared once with addUniform(), in the order of the block
+ * members in the shaders, and packed with the std140 alignment rules. The
+ * update methods only write the CPU copy and flag the buffer when a value
+ * changes, update() then uploads the whole block at once, so a block whose
+ * values did not change is never re-uploaded.
+ */
+class BABYLON_SHARED_EXPORT UniformBuffer {
+
+public:
+  // Uniform block binding points
+  static constexpr unsigned int SceneBlockBinding    = 0;
+  static constexpr unsigned int MaterialBlockBinding = 1;
+  /** The light i of a material is bound to LightBlockBinding + i */
+  static constexpr unsigned int LightBlockBinding = 2;
+
+public:
+  UniformBuffer(Engine* engine);
+  ~UniformBuffer();
+
+  /** Properties **/
+  /**
+   * @brief Returns whether the engine supports uniform buffers. When not,
+   * create(), update() and bind() do nothing.
+   */
+  bool useUbo() const;
+  /**
+   * @brief Returns whether the GPU copy is up to date.
+   */
+  bool isSync() const;
+  GL::IGLBuffer* getBuffer();
+  const Float32Array& getData() const;
+  /**
+   * @brief Returns the index of the uniform, to update it without looking up
+   * its name, or -1 when the block has no such uniform.
+   */
+  int getUniformIndex(const std::string& name) const;
+  /**
+   * @brief Returns the offset of the uniform in the block, in floats.
+   */
+  unsigned int getUniformOffset(int uniformIndex) const;
+
+  /** Methods **/
+  /**
+   * @brief Appends a uniform to the layout.
+   * @param size The number of floats: 1 to 4 for float to vec4, 16 for mat4.
+   * @return The index of the uniform.
+   */
+  int addUniform(const std::string& name, unsigned int size);
+  /**
+   * @brief Creates the GPU buffer once the layout is complete.
+   */
+  void create();
+  /**
+   * @brief Uploads the block if one of its values changed since the last
+   * upload.
+   */
+  void update();
+  /**
+   * @brief Binds the buffer to the uniform block binding point.
+   */
+  void bind(unsigned int index);
+  void updateMatrix(const std::string& name, const Matrix& matrix);
+  void updateFloat(const std::string& name, float x);
+  void updateFloat2(const std::string& name, float x, float y);
+  void updateFloat3(const std::string& name, float x, float y, float z);
+  void updateFloat4(const std::string& name, float x, float y, float z,
+                    float w);
+  void updateVector3(const std::string& name, const Vector3& vector3);
+  void updateColor3(const std::string& name, const Color3& color3);
+  void updateColor4(const std::string& name, const Color3& color3,
+                    float alpha);
+  /**
+   * Updates by uniform index, as returned by getUniformIndex()
+   */
+  void updateMatrix(int uniformIndex, const Matrix& matrix);
+  void updateFloat(int uniformIndex, float x);
+  void updateFloat2(int uniformIndex, float x, float y);
+  void updateFloat3(int uniformIndex, float x, float y, float z);
+  void updateFloat4(int uniformIndex, float x, float y, float z, float w);
+  void updateVector3(int uniformIndex, const Vector3& vector3);
+  void updateColor3(int uniformIndex, const Color3& color3);
+  void updateColor4(int uniformIndex, const Color3& color3, float alpha);
+  void dispose();
+
+private:
+  void _updateValues(int uniformIndex, const float* values,
+                     unsigned int count);
+
+private:
+  Engine* _engine;
+  Float32Array _data;
+  std::unordered_map<std::string, int> _uniformIndices;
+  // Offset and size in floats per uniform index
+  std::vector<std::pair<unsigned int, unsigned int>> _uniforms;
+  std::unique_ptr<GL::IGLBuffer> _buffer;
+  bool _needSync;
+
+}; // end of class UniformBuffer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_UNIFORM_BUFFER_H
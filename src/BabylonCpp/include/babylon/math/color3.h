@@ -207,6 +207,13 @@ public:
    */
   static Color3 Lerp(const Color3& start, const Color3& end, float amount);
 
+  /**
+   * @brief Sets the Color3 "result" with the values linearly interpolated of
+   * "amount" between the start Color3 and the end Color3.
+   */
+  static void LerpToRef(const Color3& start, const Color3& end, float amount,
+                        Color3& result);
+
   static Color3 Red();
   static Color3 Green();
   static Color3 Blue();
@@ -413,6 +413,14 @@ public:
   static Matrix Lerp(const Matrix& startValue, const Matrix& endValue,
                      float gradient);
 
+  /**
+   * @brief Sets the Matrix "result" with the interpolated values for
+   * "gradient" (float) between the ones of the matrices "startValue" and
+   * "endValue".
+   */
+  static void LerpToRef(const Matrix& startValue, const Matrix& endValue,
+                        float gradient, Matrix& result);
+
   /**
    * @brief Returns a new Matrix whose values are computed by :
    * - decomposing the the "startValue" and "endValue" matrices into their
@@ -0,0 +1,134 @@
+#ifndef BABYLON_MATH_SIMD_SIMD_BATCH_H
+#define BABYLON_MATH_SIMD_SIMD_BATCH_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+namespace SIMD {
+
+/**
+ * @brief Instruction sets of the batched math kernels, from the slowest to the
+ * fastest.
+ */
+enum class InstructionSet : unsigned int {
+  SCALAR = 0,
+  SSE2   = 1,
+  AVX2   = 2, // With FMA
+  AVX512 = 3  // AVX-512F
+}; // end of enum class InstructionSet
+
+/**
+ * @brief Math kernels processing arrays of matrices and vectors.
+ *
+ * The kernels are compiled for several instruction sets and the fastest one
+ * supported by the CPU and the operating system is selected at runtime with
+ * CPUID, so the library does not need to be compiled with -mavx2.
+ *
+ * Matrices are 16 consecutive floats with the layout of Matrix::m, vectors 3
+ * consecutive floats and quaternions 4 consecutive floats (x, y, z, w). The
+ * results match the ones of the Matrix, Vector3 and Quaternion methods named in
+ * the comments, up to floating point rounding. The result of an element can be
+ * stored in place of its input.
+ */
+struct BABYLON_SHARED_EXPORT SIMDBatch {
+
+  /**
+   * @brief Returns the fastest instruction set supported by the CPU.
+   */
+  static InstructionSet SupportedInstructionSet();
+
+  /**
+   * @brief Returns the instruction set used by the kernels.
+   */
+  static InstructionSet ActiveInstructionSet();
+
+  /**
+   * @brief Selects the instruction set used by the kernels, limited to the
+   * supported one. Meant for testing and benchmarking.
+   */
+  static void SetInstructionSet(InstructionSet instructionSet);
+
+  /**
+   * @brief result[i] = left[i] * right[i], like Matrix::multiplyToArray.
+   */
+  static void MultiplyMatrices(const float* left, const float* right,
+                               float* result, size_t count);
+
+  /**
+   * @brief Transforms count points by the matrix, like
+   * Vector3::TransformCoordinatesToRef.
+   */
+  static void TransformCoordinates(const float* positions, const float* matrix,
+                                   float* result, size_t count);
+
+  /**
+   * @brief Transforms count normals by the matrix, like
+   * Vector3::TransformNormalToRef.
+   */
+  static void TransformNormals(const float* normals, const float* matrix,
+                               float* result, size_t count);
+
+  /**
+   * @brief Transforms each point by its own matrix, as done by the software
+   * skinning.
+   */
+  static void TransformCoordinatesByMatrices(const float* positions,
+                                             const float* matrices,
+                                             float* result, size_t count);
+
+  /**
+   * @brief Transforms each normal by its own matrix.
+   */
+  static void TransformNormalsByMatrices(const float* normals,
+                                         const float* matrices, float* result,
+                                         size_t count);
+
+  /**
+   * @brief Composes count scaling, rotation and translation triplets into
+   * matrices, like Matrix::ComposeToRef.
+   */
+  static void ComposeMatrices(const float* scalings, const float* rotations,
+                              const float* translations, float* result,
+                              size_t count);
+
+  /**
+   * @brief Inverts count matrices, like Matrix::invertToRef.
+   */
+  static void InvertMatrices(const float* matrices, float* result,
+                             size_t count);
+
+  /**
+   * @brief Frustum test of count oriented boxes, like BoundingBox::IsInFrustum
+   * with the 8 corners of each box.
+   *
+   * The boxes are stored as 12 arrays of stride floats: the x, y and z of the
+   * centers, then the x, y and z of the 3 half axes. The planes are 6 (normal
+   * x, y, z, d) quadruplets. Bit i % 32 of visibility[i / 32] is set if box i
+   * intersects the frustum.
+   */
+  static void IntersectFrustum(const float* boxes, size_t stride,
+                               size_t count, const float* planes,
+                               uint32_t* visibility);
+
+  /**
+   * @brief Advances count particles by the time step, like the default
+   * ParticleSystem::updateFunction.
+   *
+   * The particles are stored as 18 arrays of stride floats: the x, y and z of
+   * the positions and of the directions, the r, g, b and a of the colors and of
+   * the color steps, then the angles, angular speeds, ages and life times (see
+   * ParticleStore). The positions move along the directions, the directions
+   * along the gravity (3 floats), the colors along the color steps with alpha
+   * clamped to 0, and the angles along the angular speeds. Bit i % 32 of
+   * dead[i / 32] is set if particle i reached its life time.
+   */
+  static void UpdateParticles(float* particles, size_t stride, size_t count,
+                              float step, const float* gravity,
+                              uint32_t* dead);
+
+}; // end of struct SIMDBatch
+
+} // end of namespace SIMD
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATH_SIMD_SIMD_BATCH_H
@@ -7,16 +7,21 @@ namespace BABYLON {
 
 /**
  * @brief Temporary pre-allocated objects for engine internal use.
+ *
+ * The objects are thread local so that the code using them (e.g. the world
+ * matrix computation) can run on worker threads. They are returned by
+ * accessors since thread local data can not be exported from a shared
+ * library.
  */
 class BABYLON_SHARED_EXPORT Tmp {
 
 public:
-  static std::array<Color3, 3> Color3Array;
-  static std::array<Vector2, 3> Vector2Array;
-  static std::array<Vector3, 9> Vector3Array;
-  static std::array<Vector4, 3> Vector4Array;
-  static std::array<Quaternion, 2> QuaternionArray;
-  static std::array<Matrix, 6> MatrixArray;
+  static std::array<Color3, 3>& Color3Array();
+  static std::array<Vector2, 3>& Vector2Array();
+  static std::array<Vector3, 9>& Vector3Array();
+  static std::array<Vector4, 3>& Vector4Array();
+  static std::array<Quaternion, 2>& QuaternionArray();
+  static std::array<Matrix, 7>& MatrixArray();
 
 }; // end of class Tmp
 
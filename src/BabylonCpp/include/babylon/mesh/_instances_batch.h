@@ -15,6 +15,9 @@ public:
   std::unordered_map<size_t, std::vector<InstancedMesh*>>
     visibleInstances;
   std::unordered_map<size_t, bool> renderSelf;
+  // Sub-meshes of other meshes drawn within the instanced draw of the
+  // sub-mesh being rendered (automatic instancing)
+  std::vector<SubMesh*> batchedSubMeshes;
 
 }; // end of class InstancesBatch
 
@@ -209,7 +209,22 @@ public:
 
   /** Picking **/
   virtual bool _generatePointsArray();
-  virtual PickingInfo* intersects(const Ray& ray, bool fastCheck = true);
+  virtual std::vector<Vector3>& _getPositions();
+  /**
+   * @brief Returns the triangle hierarchy of the geometry used for picking, or
+   * nullptr when the mesh has none.
+   */
+  virtual TriangleBVH* _getTriangleBVH();
+  /**
+   * @brief Checks if the passed ray (in local space) intersects the mesh.
+   * @param ray The ray in the local space of the mesh
+   * @param fastCheck Stops at the first intersection found instead of looking
+   * for the closest one
+   * @return The picking info, with hit set to false if there is no
+   * intersection
+   */
+  virtual std::unique_ptr<PickingInfo> intersects(const Ray& ray,
+                                                  bool fastCheck = true);
   AbstractMesh* clone(const std::string& name, Node* newParent,
                       bool doNotCloneChildren = true);
   void releaseSubMeshes();
@@ -272,6 +287,7 @@ public:
   unsigned int numBoneInfluencers;
   bool useOctreeForRenderingSelection;
   bool useOctreeForPicking;
+  bool useTriangleBVHForPicking;
   bool useOctreeForCollisions;
   unsigned int layerMask;
   bool alwaysSelectAsActiveMesh;
@@ -296,6 +312,7 @@ public:
   int _renderId;
   std::vector<std::unique_ptr<SubMesh>> subMeshes;
   Octree<SubMesh*>* _submeshesOctree;
+  int _selectionTreeProxy;
   std::vector<AbstractMesh*> _intersectionsInProgress;
   bool _unIndexed;
   std::unique_ptr<Matrix> _poseMatrix;
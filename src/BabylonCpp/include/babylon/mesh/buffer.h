@@ -14,6 +14,8 @@ class BABYLON_SHARED_EXPORT Buffer : public IDisposable {
 public:
   Buffer(Engine* engine, const Float32Array& data, bool updatable, int stride,
          bool postponeInternalCreation = false, bool instanced = false);
+  Buffer(Engine* engine, Float32Array&& data, bool updatable, int stride,
+         bool postponeInternalCreation = false, bool instanced = false);
   Buffer(Mesh* mesh, const Float32Array& data, bool updatable, int stride,
          bool postponeInternalCreation = false, bool instanced = false);
   virtual ~Buffer();
@@ -36,6 +38,11 @@ public:
   void update(const Float32Array& data);
   void updateDirectly(const Float32Array& data, int offset);
   void updateDirectly(const Float32Array& data, int offset, size_t vertexCount);
+  /**
+   * Uploads the count floats of data from the offset to the same place in the
+   * buffer and keeps the CPU copy of the data up to date.
+   */
+  void updateRange(const Float32Array& data, size_t offset, size_t count);
   void dispose(bool doNotRecurse = false) override;
 
 private:
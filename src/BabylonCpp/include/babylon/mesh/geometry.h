@@ -52,12 +52,16 @@ public:
   void setAllVerticesData(VertexData* vertexData, bool updatable = false);
   void setVerticesData(unsigned int kind, const Float32Array& data,
                        bool updatable = false, int stride = -1) override;
+  void setVerticesData(unsigned int kind, Float32Array&& data,
+                       bool updatable = false, int stride = -1);
   void setVerticesBuffer(std::unique_ptr<VertexBuffer>&& buffer);
   void updateVerticesDataDirectly(unsigned int kind, const Float32Array& data,
                                   int offset);
   void updateVerticesData(unsigned int kind, const Float32Array& data,
                           bool updateExtends = false,
                           bool makeItUnique  = false) override;
+  void updateVerticesDataRange(unsigned int kind, const Float32Array& data,
+                               size_t offset, size_t count);
   size_t getTotalVertices() const;
   Float32Array getVerticesData(unsigned int kind,
                                bool copyWhenShared = false) override;
@@ -66,6 +70,7 @@ public:
   bool isVerticesDataPresent(unsigned int kind) override;
   Uint32Array getVerticesDataKinds();
   void setIndices(const Uint32Array& indices, int totalVertices = -1) override;
+  void setIndices(Uint32Array&& indices, int totalVertices = -1);
   size_t getTotalIndices();
   Uint32Array getIndices(bool copyWhenShared = false) override;
   GL::IGLBuffer* getIndexBuffer();
@@ -73,6 +78,13 @@ public:
   void applyToMesh(Mesh* mesh);
   void load(Scene* scene, const std::function<void()>& onLoaded = nullptr);
 
+  /**
+   * @brief Returns the triangle hierarchy used for picking, built on first use
+   * from the positions and indices and released when any of them changes.
+   * @return The triangle hierarchy or nullptr when there is nothing to pick.
+   */
+  TriangleBVH* getTriangleBVH();
+
   /**
    * Invert the geometry to move from a right handed system to a left handed
    * one.
@@ -106,6 +118,7 @@ private:
 
 public:
   std::string id;
+  unsigned int uniqueId;
   int delayLoadState;
   std::string delayLoadingFile;
   std::function<void(Geometry* geometry, unsigned int kind)> onGeometryUpdated;
@@ -131,6 +144,7 @@ private:
   Vector2 _boundingBias;
   Uint32Array _delayInfo;
   std::unique_ptr<GL::IGLBuffer> _indexBuffer;
+  std::unique_ptr<TriangleBVH> _triangleBVH;
 
 }; // end of class Geometry
 
@@ -36,7 +36,7 @@ public:
                                bool copyWhenShared = false) override;
   bool isVerticesDataPresent(unsigned int kind) override;
   Uint32Array getIndices(bool copyWhenShared = false) override;
-  std::vector<Vector3> _positions();
+  std::vector<Vector3>& _getPositions() override;
   void refreshBoundingInfo();
   void _preActivate() override;
   void _activate(int renderId) override;
@@ -44,6 +44,7 @@ public:
                        BoundingSphere* boundingSphere = nullptr) override;
   void _syncSubMeshes();
   bool _generatePointsArray() override;
+  TriangleBVH* _getTriangleBVH() override;
 
   /** Clone **/
   InstancedMesh* clone(const std::string& name, Node* newParent,
@@ -340,6 +340,8 @@ public:
    */
   void setVerticesData(unsigned int kind, const Float32Array& data,
                        bool updatable = false, int stride = -1) override;
+  void setVerticesData(unsigned int kind, Float32Array&& data,
+                       bool updatable = false, int stride = -1);
 
   void setVerticesBuffer(std::unique_ptr<VertexBuffer>&& buffer);
 
@@ -373,6 +375,14 @@ public:
                           bool updateExtends = false,
                           bool makeItUnique  = false) override;
 
+  /**
+   * Updates the part of the vertex data `kind` which changed : only the
+   * `count` floats from `offset` are uploaded. The size of `data` must be the
+   * one of the current vertex data.
+   */
+  void updateVerticesDataRange(unsigned int kind, const Float32Array& data,
+                               size_t offset, size_t count);
+
   /**
    * This method updates the vertex positions of an updatable mesh according to
    * the `positionFunction` returned values.
@@ -398,6 +408,7 @@ public:
    * This method creates a new index buffer each call.
    */
   void setIndices(const Uint32Array& indices, int totalVertices = -1) override;
+  void setIndices(Uint32Array&& indices, int totalVertices = -1);
 
   /**
    * Invert the geometry to move from a right handed system to a left handed
@@ -440,6 +451,13 @@ public:
   unregisterAfterRender(const std::function<void(AbstractMesh* mesh)>& func);
 
   _InstancesBatch* _getInstancesRenderList(size_t subMeshId);
+
+  /**
+   * Returns whether the mesh only depends on its world matrix and on shared
+   * state while rendering, so that its sub-meshes can be merged into the
+   * instanced draw of another mesh sharing the same geometry.
+   */
+  bool _isAutoInstancingCandidate();
   void _renderWithInstances(SubMesh* subMesh, int fillMode,
                             _InstancesBatch* batch, Effect* effect,
                             Engine* engine);
@@ -458,6 +476,17 @@ public:
    */
   void render(SubMesh* subMesh, bool enableAlphaMode);
 
+  /**
+   * Renders the sub-mesh together with sub-meshes of other meshes sharing the
+   * same geometry, material and draw range in a single instanced draw call.
+   * The world matrices of the batched sub-meshes are appended to the ones of
+   * the mesh visible instances. Falls back to individual draws when hardware
+   * instancing is not available.
+   */
+  void renderBatched(SubMesh* subMesh,
+                     const std::vector<SubMesh*>& batchedSubMeshes,
+                     bool enableAlphaMode);
+
   /**
    * Returns an array populated with ParticleSystem objects whose the mesh is
    * the emitter.
@@ -518,6 +547,7 @@ public:
   /** Cache **/
   void _resetPointsArrayCache();
   bool _generatePointsArray() override;
+  TriangleBVH* _getTriangleBVH() override;
 
   /** Clone **/
 
@@ -656,11 +686,11 @@ public:
    * @param successCallback optional success callback to be called after the
    * simplification finished processing all settings.
    */
-  /*void
-  simplify(const std::vector<ISimplificationSettings*>& settings,
-           std::function<void(Mesh* mesh, int submeshIndex)>& successCallback,
-           bool parallelProcessing = true, SimplificationType simplificationType
-                                           = SimplificationType::QUADRATIC);*/
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing = true,
+                 SimplificationType simplificationType
+                 = SimplificationType::QUADRATIC,
+                 const std::function<void()>& successCallback = nullptr);
 
   /**
    * Optimization of the mesh's indices, in case a mesh has duplicated vertices.
@@ -1385,8 +1415,6 @@ private:
   std::vector<VertexBuffer*> _delayInfo;
   Int32Array _renderIdForInstances;
   std::unique_ptr<_InstancesBatch> _batchCache;
-  unsigned int _instancesBufferSize;
-  std::unique_ptr<Buffer> _instancesBuffer;
   Float32Array _instancesData;
   size_t _overridenInstanceCount;
   int _preActivateId;
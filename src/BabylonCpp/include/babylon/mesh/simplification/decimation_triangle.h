@@ -4,28 +4,31 @@
 #include <babylon/babylon_global.h>
 
 #include <babylon/math/vector3.h>
-#include <babylon/mesh/simplification/decimation_vertex.h>
 
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Triangle of the decimated mesh.
  */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<int, 3>& vertices,
+                     const std::array<uint32_t, 3>& originalOffsets);
   ~DecimationTriangle();
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  // Collapse error of each edge, and the smallest one
+  std::array<float, 4> error;
   bool deleted;
   bool isDirty;
-  float borderFactor;
-  bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  // Indices of the decimation vertices
+  std::array<int, 3> vertices;
+  // Source vertex of each corner, its non positional attributes are kept when
+  // it is one of the source vertices of the decimation vertex, the closest
+  // source vertex of the decimation vertex is used otherwise
+  std::array<uint32_t, 3> originalOffsets;
 
 }; // end of class DecimationTriangle
 
@@ -9,7 +9,8 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Vertex of the decimated mesh, shared by all the source vertices with
+ * the same position.
  */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
@@ -24,9 +25,11 @@ public:
   Vector3 position;
   int id;
   bool isBorder;
+  // Range of the references to the triangles using this vertex
   int triangleStart;
   int triangleCount;
-  std::vector<float> originalOffsets;
+  // Source vertices at this position
+  std::vector<uint32_t> originalOffsets;
 
 }; // end of class DecimationVertex
 
@@ -11,21 +11,38 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier()
+  {
+  }
+
   /**
    * Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs
-   * async.
+   * The computation runs on the calling thread.
    * @param settings The settings of the simplification, including quality and
    * distance
    * @param successCallback A callback that will be called after the mesh was
    * simplified.
-   * @param errorCallback in case of an error, this callback will be called.
-   * optional.
    */
-  virtual void simplify() = 0;
+  virtual void
+  simplify(const ISimplificationSettings& settings,
+           const std::function<void(Mesh* mesh)>& successCallback)
+    = 0;
+
+  /**
+   * Computes the geometry of the simplified mesh. It only reads the copy of
+   * the mesh geometry taken at construction, so it can run on any thread.
+   */
+  virtual SimplificationMeshData
+  decimate(const ISimplificationSettings& settings) const = 0;
+
+  /**
+   * Creates the simplified mesh from the geometry computed by decimate(), on
+   * the render thread. Returns nullptr if the geometry is empty.
+   */
+  virtual Mesh* createMesh(const SimplificationMeshData& meshData) = 0;
 
 }; // end of class ISimplifier
 
 } // end of namespace BABYLON
 
-#endif // end of BABYLON_MESH_SIMPLIFICATION_ISIMPLIFIER_H
\ No newline at end of file
+#endif // end of BABYLON_MESH_SIMPLIFICATION_ISIMPLIFIER_H
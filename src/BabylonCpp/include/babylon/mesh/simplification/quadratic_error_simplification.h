@@ -2,6 +2,8 @@
 #define BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/mesh/simplification/isimplifier.h>
+#include <babylon/mesh/simplification/simplification_mesh_data.h>
 
 namespace BABYLON {
 
@@ -12,15 +14,55 @@ namespace BABYLON {
  * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html
  * to babylon JS
  * @author RaananW
+ *
+ * Each sub mesh is decimated on its own. Source vertices sharing the same
+ * position are merged for the topology (the optimizeMesh setting is therefore
+ * always applied). The remaining vertices keep the normal, uvs, colors and
+ * skinning data of the source vertices at their position, so texture seams
+ * are preserved.
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
+  /**
+   * @brief Copies the geometry of the mesh, must be called on the render
+   * thread.
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+  /**
+   * @brief Simplifies geometry not bound to a mesh, createMesh() and
+   * simplify() are not available.
+   */
+  QuadraticErrorSimplification(const SimplificationMeshData& meshData);
   ~QuadraticErrorSimplification();
 
+  /** Properties **/
+  const SimplificationMeshData& meshData() const;
+
+  /** Methods **/
+  void
+  simplify(const ISimplificationSettings& settings,
+           const std::function<void(Mesh* mesh)>& successCallback) override;
+  SimplificationMeshData
+  decimate(const ISimplificationSettings& settings) const override;
+  Mesh* createMesh(const SimplificationMeshData& meshData) override;
+
+  /** Statics **/
+  static SimplificationMeshData ReadMeshData(Mesh* mesh);
+
+public:
+  // Number of collapse passes between two rebuilds of the triangle references
+  unsigned int syncIterations;
+  // Growth of the collapse error threshold between the passes
+  float aggressiveness;
+  unsigned int decimationIterations;
+
+private:
+  Mesh* _mesh;
+  SimplificationMeshData _meshData;
+
 }; // end of class QuadraticErrorSimplification
 
 } // end of namespace BABYLON
 
-#endif // end of BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
\ No newline at end of file
+#endif // end of BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
@@ -3,6 +3,8 @@
 
 #include <babylon/babylon_global.h>
 
+#include <babylon/math/vector3.h>
+
 namespace BABYLON {
 
 /**
@@ -16,10 +18,16 @@ public:
   ~QuadraticMatrix();
 
   float det(int a11, int a12, int a13, int a21, int a22, int a23, int a31,
-            int a32, int a33);
+            int a32, int a33) const;
   void addInPlace(const QuadraticMatrix& matrix);
   void addArrayInPlace(const std::array<float, 10>& data);
-  QuadraticMatrix add(const QuadraticMatrix& matrix);
+  QuadraticMatrix add(const QuadraticMatrix& matrix) const;
+
+  /**
+   * @brief Returns the sum of the squared distances between the point and the
+   * planes accumulated in this matrix.
+   */
+  float vertexError(const Vector3& point) const;
 
   static QuadraticMatrix FromData(float a, float b, float c, float d);
   static std::array<float, 10> DataFromNumbers(float a, float b, float c,
@@ -0,0 +1,28 @@
+#ifndef BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_MESH_DATA_H
+#define BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_MESH_DATA_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Copy of the geometry of a mesh, which can be processed outside of the
+ * render thread.
+ */
+struct BABYLON_SHARED_EXPORT SimplificationMeshData {
+  struct SubMeshRange {
+    unsigned int materialIndex;
+    unsigned int indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshRange
+
+  size_t totalVertices = 0;
+  // Vertex data per vertex buffer kind
+  std::map<unsigned int, Float32Array> verticesData;
+  Uint32Array indices;
+  std::vector<SubMeshRange> subMeshes;
+}; // end of struct SimplificationMeshData
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_MESH_DATA_H
@@ -2,12 +2,21 @@
 #define BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/task_group.h>
 #include <babylon/mesh/simplification/isimplification_task.h>
+#include <babylon/mesh/simplification/simplification_mesh_data.h>
 
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Queue of the mesh simplification tasks, processed one after the
+ * other.
+ *
+ * The geometry of the mesh is copied when a task starts, and the levels are
+ * computed by a task of the default thread pool, concurrently on the pool
+ * when the task requests parallel processing. The computed levels are turned
+ * into meshes and added as LOD levels by processResults(), which the scene
+ * calls at the beginning of each frame.
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
 
@@ -19,14 +28,31 @@ public:
   void executeNext();
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Adds the levels computed since the last call to their mesh, and
+   * completes the running task once all its levels are added. Must be called
+   * on the render thread.
+   */
+  void processResults();
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  std::unique_ptr<ISimplifier> getSimplifier(const ISimplificationTask& task);
+  void _decimate(size_t settingIndex);
 
 public:
   bool running;
 
 private:
   std::queue<ISimplificationTask> _simplificationQueue;
+  // Running task
+  ISimplificationTask _task;
+  std::unique_ptr<ISimplifier> _simplifier;
+  size_t _publishedLevels;
+  std::atomic<bool> _cancelled;
+  // Computed levels, with the index of their settings
+  std::mutex _resultsMutex;
+  std::vector<std::pair<size_t, SimplificationMeshData>> _results;
+  TaskGroup _tasks;
 
 }; // end of class SimplificationQueue
 
@@ -59,6 +59,10 @@ public:
                bool updatable, bool postponeInternalCreation = false,
                int stride = -1, bool instanced = false, int offset = -1,
                int size = -1);
+  VertexBuffer(Engine* engine, Float32Array&& data, unsigned int kind,
+               bool updatable, bool postponeInternalCreation = false,
+               int stride = -1, bool instanced = false, int offset = -1,
+               int size = -1);
   VertexBuffer(Engine* engine, Buffer* buffer, unsigned int kind,
                bool updatable, bool postponeInternalCreation = false,
                int stride = -1, bool instanced = false, int offset = -1,
@@ -84,6 +88,7 @@ public:
   void create(const Float32Array& data);
   void update(const Float32Array& data);
   void updateDirectly(const Float32Array& data, int offset);
+  void updateRange(const Float32Array& data, size_t offset, size_t count);
   void dispose(bool doNotRecurse = false) override;
 
 private:
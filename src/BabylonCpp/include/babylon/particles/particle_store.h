@@ -0,0 +1,127 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_STORE_H
+#define BABYLON_PARTICLES_PARTICLE_STORE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed capacity pool of particles stored as structure of arrays.
+ *
+ * Each property of the particles is a contiguous stream of floats, the streams
+ * being 64 bytes aligned and allocated once for the capacity of the particle
+ * system. The live particles are the first size() ones of each stream, a dead
+ * particle is replaced by the last live one.
+ */
+class BABYLON_SHARED_EXPORT ParticleStore {
+
+public:
+  /** Statics **/
+  // Streams, in the order expected by SIMD::SIMDBatch::UpdateParticles
+  static constexpr unsigned int POSITION      = 0;  // x, y, z
+  static constexpr unsigned int DIRECTION     = 3;  // x, y, z
+  static constexpr unsigned int COLOR         = 6;  // r, g, b, a
+  static constexpr unsigned int COLOR_STEP    = 10; // r, g, b, a
+  static constexpr unsigned int ANGLE         = 14;
+  static constexpr unsigned int ANGULAR_SPEED = 15;
+  static constexpr unsigned int AGE           = 16;
+  static constexpr unsigned int LIFE_TIME     = 17;
+  static constexpr unsigned int SIZE          = 18;
+  static constexpr unsigned int STREAM_COUNT  = 19;
+
+  // 11 floats per vertex (x, y, z, r, g, b, a, angle, size, offsetX,
+  // offsetY), 4 vertices per particle
+  static constexpr unsigned int VERTEX_STRIDE = 11;
+
+public:
+  ParticleStore(size_t capacity);
+  ParticleStore(const ParticleStore& other) = delete;
+  ParticleStore& operator=(const ParticleStore& other) = delete;
+  ~ParticleStore();
+
+  /** Properties **/
+  size_t size() const;
+  size_t capacity() const;
+  bool empty() const;
+  bool full() const;
+
+  /**
+   * @brief Returns the stream of the property, holding capacity() floats.
+   */
+  float* stream(unsigned int index);
+  const float* stream(unsigned int index) const;
+
+  /** Methods **/
+
+  /**
+   * @brief Appends a particle.
+   * @return false if the store is full.
+   */
+  bool add(const Particle& particle);
+
+  /**
+   * @brief Appends count uninitialized particles, to be set() afterwards,
+   * limited to the remaining capacity.
+   * @return The number of appended particles.
+   */
+  size_t append(size_t count);
+
+  /**
+   * @brief Copies the particle at the index.
+   */
+  void get(size_t index, Particle& particle) const;
+
+  /**
+   * @brief Replaces the particle at the index.
+   */
+  void set(size_t index, const Particle& particle);
+
+  /**
+   * @brief Removes the particle at the index, the last particle takes its
+   * place.
+   */
+  void remove(size_t index);
+
+  void clear();
+
+  /**
+   * @brief Advances the particles by the time step and removes the ones which
+   * reached their life time.
+   *
+   * With a pool, more than chunkSize particles are advanced in chunks of
+   * chunkSize particles (rounded up to a multiple of 32) in parallel, the dead
+   * ones being removed afterwards on the calling thread.
+   * @return The number of removed particles.
+   */
+  size_t update(float step, const Vector3& gravity, ThreadPool* pool = nullptr,
+                size_t chunkSize = 0);
+
+  /**
+   * @brief Writes the 4 vertices of each live particle to vertexData, which
+   * holds size() * 4 * VERTEX_STRIDE floats.
+   */
+  void fillVertexData(float* vertexData) const;
+
+  /**
+   * @brief Writes the vertices of the particles begin to end to their place
+   * in vertexData, so that ranges can be filled concurrently.
+   */
+  void fillVertexData(float* vertexData, size_t begin, size_t end) const;
+
+private:
+  void _move(size_t from, size_t to);
+  void _removeDead();
+
+private:
+  size_t _capacity;
+  size_t _stride;
+  size_t _size;
+  Float32Array _storage;
+  float* _streams;
+  std::vector<uint32_t> _dead;
+
+}; // end of class ParticleStore
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_STORE_H
@@ -6,7 +6,9 @@
 #include <babylon/core/fast_func.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/math/color4.h>
+#include <babylon/math/matrix.h>
 #include <babylon/math/vector3.h>
+#include <babylon/particles/particle_store.h>
 //#include <babylon/tools/observable.h>
 #include <babylon/tools/observer.h>
 
@@ -28,16 +30,28 @@ public:
   virtual IReflect::Type type() const override;
 
   void setOnDispose(const FastFunc<void()>& callback);
-  void recycleParticle(Particle* particle);
+  void recycleParticle(size_t index);
   size_t getCapacity() const;
+  size_t getActiveCount() const;
   bool isAlive() const;
   bool isStarted() const;
   void start();
   void stop();
-  void _appendParticleVertex(unsigned int index, Particle* particle,
-                             int offsetX, int offsetY);
   void animate();
   size_t render();
+  /**
+   * Phases of animate(), so that the scene can simulate several systems
+   * concurrently: _beginAnimate() and _endAnimate() run on the rendering
+   * thread, _simulate() updates and emits the particles and fills the vertices
+   * and can run on any thread. With a pool, the particles of a chunked system
+   * are processed in chunks of parallelChunkSize in parallel.
+   * @return false from _beginAnimate() if the system is not animated this
+   * frame
+   */
+  bool _beginAnimate();
+  bool _isChunked() const;
+  void _simulate(ThreadPool* pool);
+  void _endAnimate();
   void dispose(bool doNotRecurse = false) override;
   std::vector<Animation*> getAnimations() override;
   ParticleSystem* clone(const std::string& name, Mesh* newEmitter);
@@ -48,6 +62,7 @@ public:
 
 private:
   void _update(int newParticles);
+  void _emit(size_t begin, size_t end, uint64_t stream);
   Effect* _getEffect();
 
 public:
@@ -74,7 +89,9 @@ public:
   Texture* particleTexture;
   unsigned int layerMask;
   // Observable<ParticleSystem> onDisposeObservable;
-  std::function<void(std::vector<Particle*>& particles)> updateFunction;
+  // Advances the particles by the scaled update speed, the default one runs
+  // ParticleStore::update
+  std::function<void(ParticleStore& particles)> updateFunction;
   int blendMode;
   bool forceDepthWrite;
   Vector3 gravity;
@@ -86,6 +103,15 @@ public:
   Color4 color2;
   Color4 colorDead;
   Color4 textureMask;
+  // Seed of the random sequences of the emitted particles, two systems with
+  // the same seed and settings emit the same particles
+  uint64_t randomSeed;
+  // Number of particles above which the update, the emission and the vertices
+  // are processed in chunks on the scene evaluation pool, 0 to never split
+  size_t parallelChunkSize;
+  // Start functions, empty by default to use the random directions and emit
+  // box. When set, they can be called from worker threads with parallel
+  // evaluation
   std::function<void(float emitPower, const Matrix& worldMatrix,
                      Vector3& directionToUpdate, Particle* particle)>
     startDirectionFunction;
@@ -95,30 +121,30 @@ public:
 
 private:
   // Observer<ParticleSystem> _onDisposeObserver;
-  std::vector<Particle*> particles;
+  ParticleStore particles;
   size_t _capacity;
   Scene* _scene;
-  std::vector<Particle*> _stockParticles;
-  int _newPartsExcess;
+  float _newPartsExcess;
   Float32Array _vertexData;
-  Buffer* _vertexBuffer;
-  std::unordered_map<std::string, VertexBuffer*> _vertexBuffers;
+  std::unique_ptr<Buffer> _vertexBuffer;
+  std::unordered_map<std::string, std::unique_ptr<VertexBuffer>> _vertexBuffers;
+  std::unordered_map<std::string, VertexBuffer*> _vertexBufferPtrs;
   std::unique_ptr<GL::IGLBuffer> _indexBuffer;
   Effect* _effect;
   Effect* _customEffect;
   std::string _cachedDefines;
 
-  Color4 _scaledColorStep;
-  Color4 _colorDiff;
-  Vector3 _scaledDirection;
-  Vector3 _scaledGravity;
   int _currentRenderId;
+  int _pendingNewParticles;
+  uint64_t _emittedChunks;
+  Matrix _emitterWorldMatrix;
+  ThreadPool* _simulationPool;
 
   bool _alive;
   bool _started;
   bool _stopped;
-  int _actualFrame;
-  int _scaledUpdateSpeed;
+  float _actualFrame;
+  float _scaledUpdateSpeed;
 
 }; // end of class ParticleSystem
 
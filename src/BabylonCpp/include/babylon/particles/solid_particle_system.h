@@ -117,7 +117,8 @@ public:
    * @param update (default true) if the mesh must be finally updated on
    * this call after all the particle computations.
    */
-  void setParticles(unsigned int start = 0, unsigned int end = 0,
+  void setParticles(unsigned int start = 0,
+                    unsigned int end = std::numeric_limits<unsigned int>::max(),
                     bool update = true);
 
   /**
@@ -197,6 +198,15 @@ public:
    * computing the particle positions.
    */
   void setComputeBoundingBox(bool val);
+  /**
+   * Tells to `setParticles()` to process the particles in chunks on the pool
+   * of the scene parallel evaluation (see Scene::enableParallelEvaluation()),
+   * or not.
+   * Default value : false. `updateParticle()` and `updateParticleVertex()`
+   * are then called concurrently from worker threads, so they must only
+   * modify the particle passed to them.
+   */
+  void setParallelUpdate(bool val);
 
   // getters
   bool computeParticleRotation() const;
@@ -209,6 +219,8 @@ public:
 
   bool computeBoundingBox() const;
 
+  bool parallelUpdate() const;
+
   // =======================================================================
   // Particle behavior logic
   // these following methods may be overwritten by the user to fit his needs
@@ -285,6 +297,14 @@ public:
                                     bool update);
 
 private:
+  // Part of the particles set by a chunk of setParticles()
+  struct UpdateRange {
+    Vector3 minimum;
+    Vector3 maximum;
+    size_t vertexStart;
+    size_t vertexEnd;
+  }; // end of struct UpdateRange
+
   // reset copy
   void _resetCopy();
   // _meshBuilder : inserts the shape model in the global SPS mesh
@@ -307,8 +327,14 @@ private:
   // rebuilds a particle back to its just built status : if needed, recomputes
   // the custom positions and vertices
   void _rebuildParticle(SolidParticle* particle);
-  void _quaternionRotationYPR();
-  void _quaternionToRotationMatrix();
+  // sets the particles start to end - 1 and extends the range by their
+  // vertices, can be called concurrently on distinct particles
+  void _setParticlesRange(unsigned int start, unsigned int end,
+                          UpdateRange& range);
+  static void _quaternionRotationYPR(float yaw, float pitch, float roll,
+                                     Quaternion& quaternion);
+  static void _quaternionToRotationMatrix(const Quaternion& quaternion,
+                                          Matrix& rotMatrix);
 
 public:
   // Members
@@ -381,14 +407,13 @@ private:
   bool _alwaysVisible;
   int _shapeCounter;
   SolidParticle* _copy;
-  std::vector<Vector3> _shape;
-  Float32Array _shapeUV;
   Color4* _color;
   bool _computeParticleColor;
   bool _computeParticleTexture;
   bool _computeParticleRotation;
   bool _computeParticleVertex;
   bool _computeBoundingBox;
+  bool _parallelUpdate;
   Vector3 _cam_axisZ;
   Vector3 _cam_axisY;
   Vector3 _cam_axisX;
@@ -396,7 +421,6 @@ private:
   Vector3 _axisY;
   Vector3 _axisZ;
   TargetCamera* _camera;
-  SolidParticle* _particle;
   Vector3 _camDir;
   Matrix _rotMatrix;
   Matrix _invertMatrix;
@@ -404,26 +428,12 @@ private:
   Quaternion _quaternion;
   Vector3 _vertex;
   Vector3 _normal;
-  float _yaw;
-  float _pitch;
-  float _roll;
-  float _halfroll;
-  float _halfpitch;
-  float _halfyaw;
-  float _sinRoll;
-  float _cosRoll;
-  float _sinPitch;
-  float _cosPitch;
-  float _sinYaw;
-  float _cosYaw;
-  float _w;
   Vector3 _minimum;
   Vector3 _maximum;
   Vector3 _scale;
   Vector3 _translation;
-  Vector3 _minBbox;
-  Vector3 _maxBbox;
   bool _particlesIntersect;
+  std::vector<UpdateRange> _updateRanges;
 
 }; // end of class SolidParticleSystem
 
@@ -0,0 +1,104 @@
+#ifndef BABYLON_RENDERING_RENDER_QUEUE_H
+#define BABYLON_RENDERING_RENDER_QUEUE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Queue of sub meshes ordered by a 64 bits sort key.
+ *
+ * The key encodes, from the most to the least significant bits:
+ * - opaque and alpha test passes: rendering group (4 bits), pass (2 bits),
+ *   material index (17 bits), geometry index (17 bits) and quantized depth (24
+ *   bits), so that state changes are minimized and each state bucket is drawn
+ *   front to back.
+ * - transparent pass: rendering group (4 bits), pass (2 bits), alpha index (16
+ *   bits), inverted quantized depth (24 bits) and material index (18 bits),
+ *   which gives the same order as
+ *   RenderingGroup::defaultTransparentSortCompare.
+ *
+ * The material and geometry unique ids are not packed directly, they would be
+ * truncated and collide in large scenes: they are mapped to dense indices, in
+ * the order they are first pushed since the last clear(), which only saturate
+ * past 131072 (262144 for the transparent pass) different materials or
+ * geometries in a queue.
+ *
+ * The keys are sorted with a stable LSD radix sort, in linear time and
+ * without any comparator call. Byte passes where all the keys share the same
+ * digit are skipped.
+ */
+class BABYLON_SHARED_EXPORT RenderQueue {
+
+public:
+  enum class Pass : uint8_t {
+    OPAQUE_PASS      = 0,
+    ALPHATEST_PASS   = 1,
+    TRANSPARENT_PASS = 2
+  }; // end of enum class Pass
+
+public:
+  RenderQueue();
+  ~RenderQueue();
+
+  /** Properties **/
+  size_t size() const;
+  bool empty() const;
+
+  /**
+   * @brief Returns the sub meshes in key order, valid after sort().
+   */
+  const std::vector<SubMesh*>& subMeshes() const;
+
+  /** Methods **/
+  void clear();
+  void push(uint64_t key, SubMesh* subMesh);
+
+  /**
+   * @brief Computes the key of the sub mesh for the given pass, using the
+   * squared distance between its bounding sphere and the camera as depth and
+   * the dense indices of its material and geometry.
+   */
+  void push(unsigned int renderingGroupId, Pass pass, SubMesh* subMesh,
+            const Vector3& cameraPosition);
+  void sort();
+
+  /** Statics **/
+  static uint64_t OpaqueKey(unsigned int renderingGroupId, Pass pass,
+                            uint32_t materialIndex, uint32_t geometryIndex,
+                            float squaredDepth);
+  static uint64_t TransparentKey(unsigned int renderingGroupId, int alphaIndex,
+                                 float squaredDepth, uint32_t materialIndex);
+
+  /**
+   * @brief Maps a positive depth to 24 bits, preserving its order.
+   */
+  static uint32_t QuantizeDepth(float squaredDepth);
+
+private:
+  struct Entry {
+    uint64_t key;
+    SubMesh* subMesh;
+  }; // end of struct Entry
+
+private:
+  /**
+   * @brief Returns the dense index of the unique id, assigning the next one
+   * on its first use, saturated to maxIndex.
+   */
+  static uint32_t
+  _DenseIndex(std::unordered_map<unsigned int, uint32_t>& indices,
+              unsigned int uniqueId, uint32_t maxIndex);
+
+private:
+  std::vector<Entry> _entries;
+  std::vector<Entry> _scratch;
+  std::vector<SubMesh*> _subMeshes;
+  std::unordered_map<unsigned int, uint32_t> _materialIndices;
+  std::unordered_map<unsigned int, uint32_t> _geometryIndices;
+
+}; // end of class RenderQueue
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_RENDERING_RENDER_QUEUE_H
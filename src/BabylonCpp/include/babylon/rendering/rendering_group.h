@@ -2,6 +2,7 @@
 #define BABYLON_RENDERING_RENDERING_GROUP_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/rendering/render_queue.h>
 
 namespace BABYLON {
 
@@ -49,6 +50,22 @@ public:
   void setTransparentSortCompareFn(
     const std::function<int(SubMesh* a, SubMesh* b)>& value);
 
+  /**
+   * Specifies whether the unsorted opaque and alpha test sub meshes sharing
+   * the same geometry, material and draw range are merged into instanced draw
+   * calls. Requires hardware instancing support.
+   */
+  void setAutoInstancing(bool value);
+
+  /**
+   * Specifies whether the queues without a custom sort function are ordered
+   * with 64 bits sort keys (material, geometry and depth for the opaque and
+   * alpha test queues, alpha index and depth for the transparent one) sorted
+   * with a radix sort, instead of the dispatch order and the default
+   * transparent comparison function.
+   */
+  void setUseSortKeys(bool value);
+
   /**
    * Render all the sub meshes contained in the group.
    * @param customRenderFunction Used to override the default render behaviour
@@ -144,6 +161,33 @@ private:
    */
   static void renderUnsorted(const std::vector<SubMesh*>& subMeshes);
 
+  /**
+   * Renders the submeshes, drawing the ones that can be batched together
+   * (same geometry, material, draw range and mesh rendering state) with a
+   * single instanced draw call per batch.
+   * @param subMeshes The submeshes to render
+   */
+  void renderAutoInstanced(const std::vector<SubMesh*>& subMeshes);
+
+  /**
+   * Renders the submeshes in the order of their sort key.
+   * @param subMeshes The submeshes to render
+   * @param pass The pass of the queue, used to build the keys
+   */
+  void renderSortKeyed(const std::vector<SubMesh*>& subMeshes,
+                       RenderQueue::Pass pass);
+
+  /**
+   * Returns whether the sub mesh can be merged into the instanced draw of an
+   * other sub mesh.
+   */
+  static bool _isBatchable(SubMesh* subMesh);
+
+  /**
+   * Strict weak ordering of the sub meshes on their batching key.
+   */
+  static bool _batchKeyLess(SubMesh* a, SubMesh* b);
+
 public:
   unsigned int index;
   std::function<void()> onBeforeTransparentRendering;
@@ -154,6 +198,12 @@ private:
   std::vector<SubMesh*> _transparentSubMeshes;
   std::vector<SubMesh*> _alphaTestSubMeshes;
   size_t _activeVertices;
+  bool _autoInstancing;
+  bool _useSortKeys;
+  bool _customTransparentSort;
+  RenderQueue _renderQueue;
+  std::vector<SubMesh*> _batchableSubMeshes;
+  std::vector<SubMesh*> _batchedSubMeshes;
 
   std::function<int(SubMesh* a, SubMesh* b)> _opaqueSortCompareFn;
   std::function<int(SubMesh* a, SubMesh* b)> _alphaTestSortCompareFn;
@@ -67,6 +67,27 @@ public:
   void setRenderingAutoClearDepthStencil(unsigned int renderingGroupId,
                                          bool autoClearDepthStencil);
 
+  /**
+   * Specifies whether or not the opaque and alpha test sub meshes of a
+   * rendering group sharing the same geometry and material are automatically
+   * merged into instanced draw calls. Only applies to the queues without a
+   * custom sort function.
+   *
+   * @param renderingGroupId The rendering group id corresponding to its index
+   * @param autoInstancing Batches the compatible sub meshes if true.
+   */
+  void setRenderingAutoInstancing(unsigned int renderingGroupId,
+                                  bool autoInstancing);
+
+  /**
+   * Specifies whether or not the queues of a rendering group without a custom
+   * sort function are ordered with radix sorted 64 bits sort keys.
+   *
+   * @param renderingGroupId The rendering group id corresponding to its index
+   * @param useSortKeys Sorts the sub meshes with sort keys if true.
+   */
+  void setRenderingSortKeys(unsigned int renderingGroupId, bool useSortKeys);
+
 private:
   void _renderParticles(unsigned int index,
                         const std::vector<AbstractMesh*>& activeMeshes);
@@ -86,6 +107,8 @@ private:
   Color4 _clearColor;
 
   std::vector<bool> _autoClearDepthStencil;
+  std::vector<bool> _autoInstancing;
+  std::vector<bool> _useSortKeys;
   std::vector<std::function<int(SubMesh* a, SubMesh* b)>>
     _customOpaqueSortCompareFn;
   std::vector<std::function<int(SubMesh* a, SubMesh* b)>>
@@ -14,16 +14,21 @@ const char* defaultPixelShader
     "#extension GL_EXT_frag_depth : enable\n"
     "#endif\n"
     "\n"
+    "#include<sceneUboDeclaration>\n"
+    "#include<defaultUboDeclaration>\n"
+    "\n"
     "// Constants\n"
     "#define RECIPROCAL_PI2 0.15915494\n"
     "\n"
+    "uniform vec4 vDiffuseColor;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec3 vEyePosition;\n"
     "uniform vec3 vAmbientColor;\n"
-    "uniform vec4 vDiffuseColor;\n"
     "#ifdef SPECULARTERM\n"
     "uniform vec4 vSpecularColor;\n"
     "#endif\n"
     "uniform vec3 vEmissiveColor;\n"
+    "#endif\n"
     "\n"
     "// Input\n"
     "varying vec3 vPositionW;\n"
@@ -49,56 +54,76 @@ const char* defaultPixelShader
     "#ifdef DIFFUSE\n"
     "varying vec2 vDiffuseUV;\n"
     "uniform sampler2D diffuseSampler;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vDiffuseInfos;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef AMBIENT\n"
     "varying vec2 vAmbientUV;\n"
     "uniform sampler2D ambientSampler;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vAmbientInfos;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef OPACITY  \n"
     "varying vec2 vOpacityUV;\n"
     "uniform sampler2D opacitySampler;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vOpacityInfos;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef EMISSIVE\n"
     "varying vec2 vEmissiveUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vEmissiveInfos;\n"
+    "#endif\n"
     "uniform sampler2D emissiveSampler;\n"
     "#endif\n"
     "\n"
     "#ifdef LIGHTMAP\n"
     "varying vec2 vLightmapUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vLightmapInfos;\n"
+    "#endif\n"
     "uniform sampler2D lightmapSampler;\n"
     "#endif\n"
     "\n"
     "#if defined(REFLECTIONMAP_SPHERICAL) || defined(REFLECTIONMAP_PROJECTION) || defined(REFRACTION)\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 view;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef REFRACTION\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec4 vRefractionInfos;\n"
+    "#endif\n"
     "\n"
     "#ifdef REFRACTIONMAP_3D\n"
     "uniform samplerCube refractionCubeSampler;\n"
     "#else\n"
     "uniform sampler2D refraction2DSampler;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 refractionMatrix;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef REFRACTIONFRESNEL\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec4 refractionLeftColor;\n"
     "uniform vec4 refractionRightColor;\n"
     "#endif\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#if defined(SPECULAR) && defined(SPECULARTERM)\n"
     "varying vec2 vSpecularUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vSpecularInfos;\n"
+    "#endif\n"
     "uniform sampler2D specularSampler;\n"
     "#endif\n"
     "\n"
@@ -106,22 +131,30 @@ const char* defaultPixelShader
     "#include<fresnelFunction>\n"
     "\n"
     "#ifdef DIFFUSEFRESNEL\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec4 diffuseLeftColor;\n"
     "uniform vec4 diffuseRightColor;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef OPACITYFRESNEL\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec4 opacityParts;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef EMISSIVEFRESNEL\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec4 emissiveLeftColor;\n"
     "uniform vec4 emissiveRightColor;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "// Reflection\n"
     "#ifdef REFLECTION\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vReflectionInfos;\n"
+    "#endif\n"
     "\n"
     "#ifdef REFLECTIONMAP_3D\n"
     "uniform samplerCube reflectionCubeSampler;\n"
@@ -137,16 +170,20 @@ const char* defaultPixelShader
     "#endif\n"
     "\n"
     "#if defined(REFLECTIONMAP_PLANAR) || defined(REFLECTIONMAP_CUBIC) || defined(REFLECTIONMAP_PROJECTION)\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 reflectionMatrix;\n"
     "#endif\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#include<reflectionFunction>\n"
     "\n"
     "#ifdef REFLECTIONFRESNEL\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec4 reflectionLeftColor;\n"
     "uniform vec4 reflectionRightColor;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#endif\n"
     "\n"
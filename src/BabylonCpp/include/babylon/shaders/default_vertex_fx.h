@@ -6,7 +6,10 @@ namespace BABYLON {
 extern const char* defaultVertexShader;
 
 const char* defaultVertexShader
-  = "// Attributes\n"
+  = "#include<sceneUboDeclaration>\n"
+    "#include<defaultUboDeclaration>\n"
+    "\n"
+    "// Attributes\n"
     "attribute vec3 position;\n"
     "#ifdef NORMAL\n"
     "attribute vec3 normal;\n"
@@ -26,50 +29,66 @@ const char* defaultVertexShader
     "// Uniforms\n"
     "#include<instancesDeclaration>\n"
     "\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 view;\n"
     "uniform mat4 viewProjection;\n"
+    "#endif\n"
     "\n"
     "#ifdef DIFFUSE\n"
     "varying vec2 vDiffuseUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 diffuseMatrix;\n"
     "uniform vec2 vDiffuseInfos;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef AMBIENT\n"
     "varying vec2 vAmbientUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 ambientMatrix;\n"
     "uniform vec2 vAmbientInfos;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef OPACITY\n"
     "varying vec2 vOpacityUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 opacityMatrix;\n"
     "uniform vec2 vOpacityInfos;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef EMISSIVE\n"
     "varying vec2 vEmissiveUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vEmissiveInfos;\n"
     "uniform mat4 emissiveMatrix;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef LIGHTMAP\n"
     "varying vec2 vLightmapUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vLightmapInfos;\n"
     "uniform mat4 lightmapMatrix;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#if defined(SPECULAR) && defined(SPECULARTERM)\n"
     "varying vec2 vSpecularUV;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec2 vSpecularInfos;\n"
     "uniform mat4 specularMatrix;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#ifdef BUMP\n"
     "varying vec2 vBumpUV;\n"
     "uniform vec3 vBumpInfos;\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 bumpMatrix;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#include<pointCloudVertexDeclaration>\n"
     "\n"
@@ -18,11 +18,15 @@ const char* pbrPixelShader
     "#extension GL_EXT_frag_depth : enable\n"
     "#endif\n"
     "\n"
+    "#include<sceneUboDeclaration>\n"
+    "\n"
     "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
     "\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform vec3 vEyePosition;\n"
+    "#endif\n"
     "uniform vec3 vAmbientColor;\n"
     "uniform vec3 vReflectionColor;\n"
     "uniform vec4 vAlbedoColor;\n"
@@ -117,8 +121,10 @@ const char* pbrPixelShader
     "\n"
     "// Refraction Reflection\n"
     "#if defined(REFLECTIONMAP_SPHERICAL) || defined(REFLECTIONMAP_PROJECTION) || defined(REFRACTION)\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 view;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "// Refraction\n"
     "#ifdef REFRACTION\n"
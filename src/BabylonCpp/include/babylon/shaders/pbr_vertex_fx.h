@@ -10,6 +10,8 @@ const char* pbrVertexShader
     "precision highp float;\n"
     "#endif\n"
     "\n"
+    "#include<sceneUboDeclaration>\n"
+    "\n"
     "// Attributes\n"
     "attribute vec3 position;\n"
     "#ifdef NORMAL\n"
@@ -30,8 +32,10 @@ const char* pbrVertexShader
     "// Uniforms\n"
     "#include<instancesDeclaration>\n"
     "\n"
+    "#ifndef UNIFORMBUFFER\n"
     "uniform mat4 view;\n"
     "uniform mat4 viewProjection;\n"
+    "#endif\n"
     "\n"
     "#ifdef ALBEDO\n"
     "varying vec2 vAlbedoUV;\n"
@@ -0,0 +1,48 @@
+﻿#ifndef BABYLON_SHADERS_SHADERS_INCLUDE_DEFAULT_UBO_DECLARATION_FX_H
+#define BABYLON_SHADERS_SHADERS_INCLUDE_DEFAULT_UBO_DECLARATION_FX_H
+
+namespace BABYLON {
+
+extern const char* defaultUboDeclaration;
+
+const char* defaultUboDeclaration
+  = "#ifdef UNIFORMBUFFER\n"
+    "layout(std140) uniform Material {\n"
+    "  vec4 diffuseLeftColor;\n"
+    "  vec4 diffuseRightColor;\n"
+    "  vec4 opacityParts;\n"
+    "  vec4 reflectionLeftColor;\n"
+    "  vec4 reflectionRightColor;\n"
+    "  vec4 refractionLeftColor;\n"
+    "  vec4 refractionRightColor;\n"
+    "  vec4 emissiveLeftColor;\n"
+    "  vec4 emissiveRightColor;\n"
+    "\n"
+    "  vec2 vDiffuseInfos;\n"
+    "  vec2 vAmbientInfos;\n"
+    "  vec2 vOpacityInfos;\n"
+    "  vec2 vReflectionInfos;\n"
+    "  vec2 vEmissiveInfos;\n"
+    "  vec2 vLightmapInfos;\n"
+    "  vec2 vSpecularInfos;\n"
+    "\n"
+    "  mat4 diffuseMatrix;\n"
+    "  mat4 ambientMatrix;\n"
+    "  mat4 opacityMatrix;\n"
+    "  mat4 reflectionMatrix;\n"
+    "  mat4 emissiveMatrix;\n"
+    "  mat4 lightmapMatrix;\n"
+    "  mat4 specularMatrix;\n"
+    "  mat4 bumpMatrix;\n"
+    "  mat4 refractionMatrix;\n"
+    "\n"
+    "  vec4 vRefractionInfos;\n"
+    "  vec4 vSpecularColor;\n"
+    "  vec3 vAmbientColor;\n"
+    "  vec3 vEmissiveColor;\n"
+    "};\n"
+    "#endif\n";
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SHADERS_SHADERS_INCLUDE_DEFAULT_UBO_DECLARATION_FX_H
@@ -7,7 +7,21 @@ extern const char* lightFragmentDeclaration;
 
 const char* lightFragmentDeclaration
   = "#ifdef LIGHT{X}\n"
+    "  #ifdef UNIFORMBUFFER\n"
+    "  layout(std140) uniform Light{X} {\n"
+    "    vec4 vLightData{X};\n"
+    "    vec4 vLightDirection{X};\n"
+    "    vec3 vLightGround{X};\n"
+    "  };\n"
+    "  #else\n"
     "  uniform vec4 vLightData{X};\n"
+    "  #ifdef SPOTLIGHT{X}\n"
+    "  uniform vec4 vLightDirection{X};\n"
+    "  #endif\n"
+    "  #ifdef HEMILIGHT{X}\n"
+    "  uniform vec3 vLightGround{X};\n"
+    "  #endif\n"
+    "  #endif\n"
     "  uniform vec4 vLightDiffuse{X};\n"
     "  #ifdef SPECULARTERM\n"
     "  uniform vec3 vLightSpecular{X};\n"
@@ -21,12 +35,6 @@ const char* lightFragmentDeclaration
     "  #endif\n"
     "  uniform vec3 shadowsInfo{X};\n"
     "  #endif\n"
-    "  #ifdef SPOTLIGHT{X}\n"
-    "  uniform vec4 vLightDirection{X};\n"
-    "  #endif\n"
-    "  #ifdef HEMILIGHT{X}\n"
-    "  uniform vec3 vLightGround{X};\n"
-    "  #endif\n"
     "#endif\n";
 
 } // end of namespace BABYLON
@@ -0,0 +1,21 @@
+﻿#ifndef BABYLON_SHADERS_SHADERS_INCLUDE_SCENE_UBO_DECLARATION_FX_H
+#define BABYLON_SHADERS_SHADERS_INCLUDE_SCENE_UBO_DECLARATION_FX_H
+
+namespace BABYLON {
+
+extern const char* sceneUboDeclaration;
+
+const char* sceneUboDeclaration
+  = "#ifdef UNIFORMBUFFER\n"
+    "#extension GL_ARB_uniform_buffer_object : enable\n"
+    "\n"
+    "layout(std140) uniform Scene {\n"
+    "  mat4 viewProjection;\n"
+    "  mat4 view;\n"
+    "  vec3 vEyePosition;\n"
+    "};\n"
+    "#endif\n";
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SHADERS_SHADERS_INCLUDE_SCENE_UBO_DECLARATION_FX_H
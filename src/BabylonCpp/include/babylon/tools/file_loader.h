@@ -0,0 +1,169 @@
+#ifndef BABYLON_TOOLS_FILE_LOADER_H
+#define BABYLON_TOOLS_FILE_LOADER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/task_group.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Content of a loaded file, either a read-only mapping of a local file
+ * or a buffer holding the content received from an url handler.
+ */
+class BABYLON_SHARED_EXPORT FileData {
+
+public:
+  FileData();
+  FileData(std::string&& buffer);
+  FileData(const FileData&) = delete;
+  FileData& operator=(const FileData&) = delete;
+  ~FileData();
+
+  /** Properties **/
+  const char* data() const;
+  size_t size() const;
+  /**
+   * @brief Returns whether the content is mapped from the file, without copy.
+   */
+  bool isMapped() const;
+
+  /** Methods **/
+  std::string toString() const;
+  /**
+   * @brief Returns the content, moved out of the buffer when it is not
+   * mapped, the buffer being left empty.
+   */
+  std::string releaseString();
+
+  /** Statics **/
+  /**
+   * @brief Maps the local file in memory.
+   * @return The mapped file, or nullptr with error set.
+   */
+  static std::shared_ptr<FileData> Map(const std::string& path,
+                                       std::string& error);
+
+private:
+  std::string _buffer;
+  const char* _mapping;
+  size_t _mappingSize;
+
+}; // end of class FileData
+
+/**
+ * @brief Loads local files and urls, synchronously or on the default thread
+ * pool.
+ *
+ * Local paths, optionally prefixed by "file:", are read in chunks of chunkSize
+ * bytes reporting the progress after each chunk, or mapped in memory when an
+ * array buffer is requested. Other urls are loaded by the handler registered
+ * for their scheme, which streams the content in chunks. The asynchronous
+ * loads run on tasks of the default thread pool, at most maxConcurrentLoads
+ * at a time so that the blocking reads do not hold all its threads; their
+ * progress and completion callbacks are called by processResults(), which the
+ * scene calls at the beginning of each frame.
+ */
+class BABYLON_SHARED_EXPORT FileLoader {
+
+public:
+  using ProgressCallback = std::function<void(size_t loaded, size_t total)>;
+  using LoadCallback     = std::function<void(std::shared_ptr<FileData>)>;
+  using ErrorCallback    = std::function<void(const std::string& error)>;
+  using ChunkCallback
+    = std::function<void(const char* data, size_t size, size_t total)>;
+  /**
+   * Loads the url, passing its content to onChunk as it is received (total 0
+   * when the size is unknown). Returns false with error set on failure.
+   */
+  using UrlHandler = std::function<bool(
+    const std::string& url, const ChunkCallback& onChunk, std::string& error)>;
+
+public:
+  FileLoader(size_t maxConcurrentLoads = 2);
+  FileLoader(const FileLoader&) = delete;
+  FileLoader& operator=(const FileLoader&) = delete;
+  ~FileLoader();
+
+  /** Properties **/
+  /**
+   * @brief Returns the number of asynchronous loads whose callbacks were not
+   * called yet.
+   */
+  size_t pendingCount() const;
+
+  /** Methods **/
+  /**
+   * @brief Registers the handler of the urls of the scheme, e.g. "http". A
+   * null handler unregisters it.
+   */
+  void registerUrlHandler(const std::string& scheme, const UrlHandler& handler);
+  /**
+   * @brief Loads the url on the calling thread.
+   * @param useArrayBuffer Whether to map local files instead of copying them.
+   * @return The content, or nullptr with error set.
+   */
+  std::shared_ptr<FileData> load(const std::string& url,
+                                 const ProgressCallback& onProgress,
+                                 bool useArrayBuffer, std::string& error);
+  /**
+   * @brief Loads the url on the default thread pool, the callbacks are called
+   * by processResults().
+   */
+  void loadAsync(const std::string& url, const LoadCallback& onLoad,
+                 const ProgressCallback& onProgress = nullptr,
+                 const ErrorCallback& onError       = nullptr,
+                 bool useArrayBuffer                = false);
+  /**
+   * @brief Calls the callbacks of the progress made since the last call and of
+   * the completed loads. Must be called on the scene thread.
+   */
+  void processResults();
+
+  /** Statics **/
+  /**
+   * @brief Returns the loader used by Tools::LoadFile and the scene loader.
+   */
+  static FileLoader& Default();
+
+private:
+  struct Job {
+    std::string url;
+    bool useArrayBuffer;
+    LoadCallback onLoad;
+    ProgressCallback onProgress;
+    ErrorCallback onError;
+  }; // end of struct Job
+
+  // Progress of a job, or its completion with its data or its error
+  struct Event {
+    std::shared_ptr<Job> job;
+    bool completed;
+    size_t loaded;
+    size_t total;
+    std::shared_ptr<FileData> data;
+    std::string error;
+  }; // end of struct Event
+
+  UrlHandler _getUrlHandler(const std::string& scheme);
+  void _loadQueuedJobs();
+
+public:
+  size_t chunkSize;
+
+private:
+  size_t _maxConcurrentLoads;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, UrlHandler> _urlHandlers;
+  // Shared with the tasks, under _mutex
+  std::deque<std::shared_ptr<Job>> _jobs;
+  std::vector<Event> _events;
+  size_t _pendingCount;
+  size_t _runningLoads;
+  bool _stop;
+  TaskGroup _tasks;
+
+}; // end of class FileLoader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_FILE_LOADER_H
@@ -6,6 +6,8 @@
 
 namespace BABYLON {
 
+class FileData;
+
 /**
  * @brief Represents the tools class.
  */
@@ -33,11 +35,24 @@ struct BABYLON_SHARED_EXPORT Tools {
             const std::function<void(const Image& img)>& onLoad,
             const std::function<void(const std::string& msg)>& onError,
             bool flipVertically = true);
+  /**
+   * @brief Loads the file on the calling thread and passes its content to
+   * the callback as text.
+   */
   static void
   LoadFile(const std::string& url,
            const std::function<void(const std::string& text)>& callback,
-           const std::function<void()>& progressCallBack = nullptr,
-           bool useArrayBuffer                           = false);
+           const std::function<void()>& progressCallBack = nullptr);
+  /**
+   * @brief Loads the file on the calling thread and passes its content to
+   * the callback without copy, local files being mapped in memory when
+   * useArrayBuffer is true.
+   */
+  static void
+  LoadFile(const std::string& url,
+           const std::function<void(const std::shared_ptr<FileData>& data)>&
+             callback,
+           const std::function<void()>& progressCallBack, bool useArrayBuffer);
   static void CheckExtends(Vector3& v, Vector3& min, Vector3& max);
   static std::string RandomId();
   static void SetImmediate(const std::function<void()>& immediate);
@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -111,7 +112,9 @@ enum {
   number_type,
   string_type,
   array_type,
-  object_type
+  object_type,
+  float32_array_type,
+  uint32_array_type
 #ifdef picojson_USE_INT64
   ,
   int64_type
@@ -127,6 +130,9 @@ class value {
 public:
   typedef std::vector<value> array;
   typedef std::map<std::string, value> object;
+  // Packed numeric arrays, see BABYLON::Json::Parse()
+  typedef std::vector<float> float32_array;
+  typedef std::vector<std::uint32_t> uint32_array;
   union _storage {
     bool boolean_;
     double number_;
@@ -136,6 +142,8 @@ public:
     std::string* string_;
     array* array_;
     object* object_;
+    float32_array* float32_array_;
+    uint32_array* uint32_array_;
   };
 
 protected:
@@ -202,6 +210,8 @@ private:
 
 typedef value::array array;
 typedef value::object object;
+typedef value::float32_array float32_array;
+typedef value::uint32_array uint32_array;
 
 inline value::value() : type_(null_type)
 {
@@ -222,6 +232,8 @@ inline value::value(int type, bool) : type_(type)
     INIT(string_, new std::string());
     INIT(array_, new array());
     INIT(object_, new object());
+    INIT(float32_array_, new float32_array());
+    INIT(uint32_array_, new uint32_array());
 #undef INIT
     default:
       break;
@@ -291,6 +303,8 @@ inline void value::clear()
     DEINIT(string_);
     DEINIT(array_);
     DEINIT(object_);
+    DEINIT(float32_array_);
+    DEINIT(uint32_array_);
 #undef DEINIT
     default:
       break;
@@ -312,6 +326,8 @@ inline value::value(const value& x) : type_(x.type_)
     INIT(string_, new std::string(*x.u_.string_));
     INIT(array_, new array(*x.u_.array_));
     INIT(object_, new object(*x.u_.object_));
+    INIT(float32_array_, new float32_array(*x.u_.float32_array_));
+    INIT(uint32_array_, new uint32_array(*x.u_.uint32_array_));
 #undef INIT
     default:
       u_ = x.u_;
@@ -359,6 +375,8 @@ IS(int64_t, int64)
 IS(std::string, string)
 IS(array, array)
 IS(object, object)
+IS(float32_array, float32_array)
+IS(uint32_array, uint32_array)
 #undef IS
 template <>
 inline bool value::is<double>() const
@@ -389,6 +407,8 @@ GET(bool, u_.boolean_)
 GET(std::string, *u_.string_)
 GET(array, *u_.array_)
 GET(object, *u_.object_)
+GET(float32_array, *u_.float32_array_)
+GET(uint32_array, *u_.uint32_array_)
 #ifdef picojson_USE_INT64
 GET(double,
     (type_ == int64_type && (const_cast<value*>(this)->type_      = number_type,
@@ -412,6 +432,9 @@ SET(bool, boolean, u_.boolean_ = _val;)
 SET(std::string, string, u_.string_ = new std::string(_val);)
 SET(array, array, u_.array_ = new array(_val);)
 SET(object, object, u_.object_ = new object(_val);)
+SET(float32_array, float32_array,
+    u_.float32_array_ = new float32_array(_val);)
+SET(uint32_array, uint32_array, u_.uint32_array_ = new uint32_array(_val);)
 SET(double, number, u_.number_ = _val;)
 #ifdef picojson_USE_INT64
 SET(int64_t, int64, u_.int64_ = _val;)
@@ -430,6 +453,10 @@ SET(int64_t, int64, u_.int64_ = _val;)
 MOVESET(std::string, string, u_.string_ = new std::string(std::move(_val));)
 MOVESET(array, array, u_.array_ = new array(std::move(_val));)
 MOVESET(object, object, u_.object_ = new object(std::move(_val));)
+MOVESET(float32_array, float32_array,
+        u_.float32_array_ = new float32_array(std::move(_val));)
+MOVESET(uint32_array, uint32_array,
+        u_.uint32_array_ = new uint32_array(std::move(_val));)
 #undef MOVESET
 #endif
 
@@ -534,6 +561,8 @@ inline std::string value::to_str() const
     case string_type:
       return *u_.string_;
     case array_type:
+    case float32_array_type:
+    case uint32_array_type:
       return "array";
     case object_type:
       return "object";
@@ -605,6 +634,19 @@ inline std::string value::serialize(bool prettify) const
   return _serialize(prettify ? 0 : -1);
 }
 
+template <typename T, typename Iter>
+void serialize_numbers(const std::vector<T>& numbers, Iter oi)
+{
+  *oi++ = '[';
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    if (i != 0) {
+      *oi++ = ',';
+    }
+    copy(value(static_cast<double>(numbers[i])).to_str(), oi);
+  }
+  *oi++ = ']';
+}
+
 template <typename Iter>
 void value::_indent(Iter oi, int indent)
 {
@@ -674,6 +716,12 @@ void value::_serialize(Iter oi, int indent) const
       *oi++ = '}';
       break;
     }
+    case float32_array_type:
+      serialize_numbers(*u_.float32_array_, oi);
+      break;
+    case uint32_array_type:
+      serialize_numbers(*u_.uint32_array_, oi);
+      break;
     default:
       copy(to_str(), oi);
       break;
@@ -1274,6 +1322,8 @@ inline bool operator==(const value& x, const value& y)
   picojson_CMP(std::string);
   picojson_CMP(array);
   picojson_CMP(object);
+  picojson_CMP(float32_array);
+  picojson_CMP(uint32_array);
 #undef picojson_CMP
   picojson_ASSERT(0);
 #ifdef _MSC_VER
@@ -20,6 +20,7 @@ Animatable::Animatable(Scene* scene, IAnimatable* iTarget, int iFromFrame,
     , _localDelayOffset{-1}
     , _pausedDelay{-1}
     , _paused{false}
+    , _evaluated{false}
     , _scene{scene}
 {
   if (!animations.empty()) {
@@ -147,12 +148,22 @@ void Animatable::stop(const std::string& animationName)
 
 bool Animatable::_animate(const millisecond_t& delay)
 {
+  if (!_evaluate(delay)) {
+    return true;
+  }
+
+  return _endAnimate();
+}
+
+bool Animatable::_evaluate(const millisecond_t& delay)
+{
+  _evaluated = false;
   if (_paused) {
     animationStarted = false;
     if (_pausedDelay == std::chrono::milliseconds(-1)) {
       _pausedDelay = delay;
     }
-    return true;
+    return false;
   }
 
   if (_localDelayOffset == std::chrono::milliseconds(-1)) {
@@ -167,13 +178,29 @@ bool Animatable::_animate(const millisecond_t& delay)
   bool running = false;
 
   for (auto& animation : _animations) {
-    bool isRunning = animation->animate(delay - _localDelayOffset, fromFrame,
-                                        toFrame, loopAnimation, speedRatio);
+    bool isRunning = animation->_evaluate(delay - _localDelayOffset, fromFrame,
+                                          toFrame, loopAnimation, speedRatio);
     running = running || isRunning;
   }
 
   animationStarted = running;
+  _evaluated       = true;
+
+  return true;
+}
+
+bool Animatable::_endAnimate()
+{
+  if (!_evaluated) {
+    return true;
+  }
+  _evaluated = false;
+
+  for (auto& animation : _animations) {
+    animation->_checkEvents();
+  }
 
+  const bool running = animationStarted;
   if (!running) {
     // Remove from active animatables
     _scene->_activeAnimatables.erase(
@@ -17,6 +17,34 @@
 
 namespace BABYLON {
 
+namespace {
+
+// Same as Vector3::LerpToRef and Color3::LerpToRef, on the values of a track
+inline void lerpToRef(const float* start, const float* end, float amount,
+                      float& x, float& y, float& z)
+{
+  x = start[0] + ((end[0] - start[0]) * amount);
+  y = start[1] + ((end[1] - start[1]) * amount);
+  z = start[2] + ((end[2] - start[2]) * amount);
+}
+
+} // end of anonymous namespace
+
+constexpr unsigned int Animation::ANIMATIONTYPE_FLOAT;
+constexpr unsigned int Animation::ANIMATIONTYPE_VECTOR3;
+constexpr unsigned int Animation::ANIMATIONTYPE_QUATERNION;
+constexpr unsigned int Animation::ANIMATIONTYPE_MATRIX;
+constexpr unsigned int Animation::ANIMATIONTYPE_COLOR3;
+constexpr unsigned int Animation::ANIMATIONTYPE_VECTOR2;
+constexpr unsigned int Animation::ANIMATIONTYPE_SIZE;
+constexpr unsigned int Animation::ANIMATIONTYPE_BOOL;
+constexpr unsigned int Animation::ANIMATIONTYPE_INT;
+constexpr unsigned int Animation::ANIMATIONTYPE_STRING;
+constexpr unsigned int Animation::ANIMATIONTYPE_COLOR4;
+constexpr unsigned int Animation::ANIMATIONLOOPMODE_RELATIVE;
+constexpr unsigned int Animation::ANIMATIONLOOPMODE_CYCLE;
+constexpr unsigned int Animation::ANIMATIONLOOPMODE_CONSTANT;
+
 Animation* Animation::_PrepareAnimation(const std::string& name,
                                         const std::string& targetProperty,
                                         size_t framePerSecond, int totalFrame,
@@ -81,18 +109,22 @@ Animation::Animation(const std::string& iName,
                      const std::string& iTargetProperty, size_t iFramePerSecond,
                      int iDataType, unsigned int iLoopMode)
 
-    : name{iName}
+    : _target{nullptr}
+    , name{iName}
     , targetProperty{iTargetProperty}
     , targetPropertyPath{String::split(targetProperty, '.')}
     , framePerSecond{iFramePerSecond}
     , dataType{iDataType}
     , loopMode{iLoopMode}
+    , currentFrame{0}
     , allowMatricesInterpolation{false}
     , blendingSpeed{0.01f}
     , enableBlending{false}
     , _stopped{false}
     , _blendingFactor{0.f}
     , _easingFunction{nullptr}
+    , _keyCursor{0}
+    , _trackDirty{true}
 {
 }
 
@@ -165,6 +197,7 @@ void Animation::deleteRange(const std::string& iName, bool deleteFrames)
                                    return key.frame >= from && key.frame <= to;
                                  }),
                   _keys.end());
+      _trackDirty = true;
     }
     _ranges.erase(iName);
   }
@@ -191,6 +224,8 @@ bool Animation::isStopped() const
 
 std::vector<AnimationKey>& Animation::getKeys()
 {
+  // The keys can be modified through the reference
+  _trackDirty = true;
   return _keys;
 }
 
@@ -285,7 +320,8 @@ std::unique_ptr<Animation> Animation::clone() const
 
 void Animation::setKeys(const std::vector<AnimationKey>& values)
 {
-  _keys = values;
+  _keys       = values;
+  _trackDirty = true;
   _offsetsCache.clear();
   _highLimitsCache.clear();
 }
@@ -295,6 +331,31 @@ AnimationValue Animation::_getKeyValue(const AnimationValue& value) const
   return value;
 }
 
+bool Animation::_findKey(int frame, size_t& key, float& gradient)
+{
+  if (_trackDirty) {
+    _track.set(_keys, dataType);
+    _keyCursor  = 0;
+    _trackDirty = false;
+  }
+
+  if (!_track.findKey(frame, _keyCursor)) {
+    return false;
+  }
+
+  // gradient : percent of currentFrame between the frame inf and the frame
+  // sup
+  key      = _keyCursor;
+  gradient = static_cast<float>(frame - _track.frame(key))
+             / static_cast<float>(_track.frame(key + 1) - _track.frame(key));
+
+  // check for easingFunction and correction of gradient
+  if (_easingFunction != nullptr) {
+    gradient = _easingFunction->ease(gradient);
+  }
+  return true;
+}
+
 AnimationValue Animation::_interpolate(int iCurrentFrame, int repeatCount,
                                        unsigned int iLoopMode,
                                        const AnimationValue& offsetValue,
@@ -307,183 +368,297 @@ AnimationValue Animation::_interpolate(int iCurrentFrame, int repeatCount,
   currentFrame       = iCurrentFrame;
   float _repeatCount = static_cast<float>(repeatCount);
 
-  // Try to get a hash to find the right key
-  int _keysLength = static_cast<int>(_keys.size());
-  int startKey    = std::max(
-    0, std::min(_keysLength - 1,
-                static_cast<int>(
-                  std::floor(_keysLength * (currentFrame - _keys[0].frame)
-                             / (_keys.back().frame - _keys[0].frame))
-                  - 1)));
-
-  if (_keys[static_cast<unsigned int>(startKey)].frame >= currentFrame) {
-    while (startKey - 1 >= 0
-           && _keys[static_cast<unsigned int>(startKey)].frame
-                >= currentFrame) {
-      --startKey;
+  size_t key     = 0;
+  float gradient = 0.f;
+  if (_findKey(currentFrame, key, gradient)) {
+    const auto startValue = _getKeyValue(_keys[key].value);
+    const auto endValue   = _getKeyValue(_keys[key + 1].value);
+
+    auto newVale = _keys[key].value.copy();
+
+    switch (dataType) {
+      // Float
+      case Animation::ANIMATIONTYPE_FLOAT:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            newVale.floatData = floatInterpolateFunction(
+              startValue.floatData, endValue.floatData, gradient);
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.floatData
+              = offsetValue.floatData * _repeatCount
+                + floatInterpolateFunction(startValue.floatData,
+                                           endValue.floatData, gradient);
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      // Quaternion
+      case Animation::ANIMATIONTYPE_QUATERNION:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            newVale.quaternionData = quaternionInterpolateFunction(
+              startValue.quaternionData, endValue.quaternionData, gradient);
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.quaternionData
+              = quaternionInterpolateFunction(startValue.quaternionData,
+                                              endValue.quaternionData,
+                                              gradient)
+                  .add(offsetValue.quaternionData.scale(_repeatCount));
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      // Vector3
+      case Animation::ANIMATIONTYPE_VECTOR3:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            newVale.vector3Data = vector3InterpolateFunction(
+              startValue.vector3Data, endValue.vector3Data, gradient);
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.vector3Data
+              = vector3InterpolateFunction(startValue.vector3Data,
+                                           endValue.vector3Data, gradient)
+                  .add(offsetValue.vector3Data.scale(_repeatCount));
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      // Vector2
+      case Animation::ANIMATIONTYPE_VECTOR2:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            newVale.vector2Data = vector2InterpolateFunction(
+              startValue.vector2Data, endValue.vector2Data, gradient);
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.vector2Data
+              = vector2InterpolateFunction(startValue.vector2Data,
+                                           endValue.vector2Data, gradient)
+                  .add(offsetValue.vector2Data.scale(_repeatCount));
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      // Size
+      case Animation::ANIMATIONTYPE_SIZE:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            newVale.sizeData = sizeInterpolateFunction(
+              startValue.sizeData, endValue.sizeData, gradient);
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.sizeData
+              = sizeInterpolateFunction(startValue.sizeData,
+                                        endValue.sizeData, gradient)
+                  .add(offsetValue.sizeData.scale(_repeatCount));
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      // Color3
+      case Animation::ANIMATIONTYPE_COLOR3:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            newVale.color3Data = color3InterpolateFunction(
+              startValue.color3Data, endValue.color3Data, gradient);
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.color3Data
+              = color3InterpolateFunction(startValue.color3Data,
+                                          endValue.color3Data, gradient)
+                  .add(offsetValue.color3Data.scale(_repeatCount));
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      // Matrix
+      case Animation::ANIMATIONTYPE_MATRIX:
+        switch (loopMode) {
+          case Animation::ANIMATIONLOOPMODE_CYCLE:
+          case Animation::ANIMATIONLOOPMODE_CONSTANT:
+            if (allowMatricesInterpolation) {
+              newVale.matrixData = matrixInterpolateFunction(
+                startValue.matrixData, endValue.matrixData, gradient);
+              return newVale;
+            }
+            newVale.matrixData = startValue.matrixData;
+            return newVale;
+          case Animation::ANIMATIONLOOPMODE_RELATIVE:
+            newVale.matrixData = startValue.matrixData;
+            return newVale;
+          default:
+            break;
+        }
+        break;
+      default:
+        break;
     }
   }
+  return _getKeyValue(_keys.back().value);
+}
 
-  for (size_t key = static_cast<unsigned int>(startKey); key < _keys.size();
-       ++key) {
-    if (_keys[key + 1].frame >= currentFrame) {
+bool Animation::_interpolateBound(int iCurrentFrame, int repeatCount,
+                                  unsigned int iLoopMode,
+                                  const AnimationValue* offsetValue,
+                                  const AnimationValue* highLimitValue)
+{
+  if (_binding.target != _target) {
+    bind();
+  }
+  if (_binding.dataType != dataType
+      || (enableBlending && _blendingFactor <= 1.f)) {
+    return false;
+  }
 
-      const auto startValue = _getKeyValue(_keys[key].value);
-      const auto endValue   = _getKeyValue(_keys[key + 1].value);
+  if (iLoopMode == Animation::ANIMATIONLOOPMODE_CONSTANT && repeatCount > 0) {
+    if (highLimitValue) {
+      _setBoundValue(*highLimitValue);
+    }
+    return true;
+  }
 
-      // gradient : percent of currentFrame between the frame inf and the frame
-      // sup
-      float gradient
-        = static_cast<float>(currentFrame - _keys[key].frame)
-          / static_cast<float>(_keys[key + 1].frame - _keys[key].frame);
+  currentFrame = iCurrentFrame;
 
-      // check for easingFunction and correction of gradient
-      if (_easingFunction != nullptr) {
-        gradient = _easingFunction->ease(gradient);
+  const float _repeatCount = static_cast<float>(repeatCount);
+  size_t key               = 0;
+  float gradient           = 0.f;
+  if (loopMode > Animation::ANIMATIONLOOPMODE_CONSTANT
+      || !_findKey(currentFrame, key, gradient)) {
+    return _setBoundValue(_keys.back().value);
+  }
+
+  // Same interpolation as _interpolate, written in place from the values of
+  // the track
+  const float* startValue = _track.value(key);
+  const float* endValue   = _track.value(key + 1);
+
+  // Without offset, the offset is zero
+  const bool relative = loopMode == Animation::ANIMATIONLOOPMODE_RELATIVE
+                        && offsetValue && offsetValue->dataType == dataType;
+  switch (dataType) {
+    // Float
+    case Animation::ANIMATIONTYPE_FLOAT: {
+      float value
+        = floatInterpolateFunction(startValue[0], endValue[0], gradient);
+      if (relative) {
+        value = offsetValue->floatData * _repeatCount + value;
+      }
+      *_binding.floatValue = value;
+    } break;
+    // Quaternion
+    case Animation::ANIMATIONTYPE_QUATERNION: {
+      Quaternion& value = *_binding.quaternionValue;
+      Quaternion::SlerpToRef(Quaternion(startValue[0], startValue[1],
+                                        startValue[2], startValue[3]),
+                             Quaternion(endValue[0], endValue[1], endValue[2],
+                                        endValue[3]),
+                             gradient, value);
+      if (relative) {
+        value = value.add(offsetValue->quaternionData.scale(_repeatCount));
+      }
+    } break;
+    // Vector3
+    case Animation::ANIMATIONTYPE_VECTOR3: {
+      Vector3& value = *_binding.vector3Value;
+      lerpToRef(startValue, endValue, gradient, value.x, value.y, value.z);
+      if (relative) {
+        value.addInPlace(offsetValue->vector3Data.scale(_repeatCount));
+      }
+    } break;
+    // Color3
+    case Animation::ANIMATIONTYPE_COLOR3: {
+      Color3& value = *_binding.color3Value;
+      lerpToRef(startValue, endValue, gradient, value.r, value.g, value.b);
+      if (relative) {
+        value = value.add(offsetValue->color3Data.scale(_repeatCount));
+      }
+    } break;
+    // Matrix
+    case Animation::ANIMATIONTYPE_MATRIX: {
+      auto& value = _binding.matrixValue->m;
+      if (allowMatricesInterpolation
+          && loopMode != Animation::ANIMATIONLOOPMODE_RELATIVE) {
+        // Same as Matrix::LerpToRef
+        for (unsigned int index = 0; index < 16; ++index) {
+          value[index] = startValue[index] * (1.f - gradient)
+                         + endValue[index] * gradient;
+        }
       }
+      else {
+        std::copy(startValue, startValue + 16, value.begin());
+      }
+    } break;
+    default:
+      return false;
+  }
 
-      auto newVale = _keys[key].value.copy();
+  return true;
+}
 
-      switch (dataType) {
-        // Float
-        case Animation::ANIMATIONTYPE_FLOAT:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale.floatData = floatInterpolateFunction(
-                startValue.floatData, endValue.floatData, gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.floatData
-                = offsetValue.floatData * _repeatCount
-                  + floatInterpolateFunction(startValue.floatData,
-                                             endValue.floatData, gradient);
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Quaternion
-        case Animation::ANIMATIONTYPE_QUATERNION:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale.quaternionData = quaternionInterpolateFunction(
-                startValue.quaternionData, endValue.quaternionData, gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.quaternionData
-                = quaternionInterpolateFunction(startValue.quaternionData,
-                                                endValue.quaternionData,
-                                                gradient)
-                    .add(offsetValue.quaternionData.scale(_repeatCount));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Vector3
-        case Animation::ANIMATIONTYPE_VECTOR3:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale.vector3Data = vector3InterpolateFunction(
-                startValue.vector3Data, endValue.vector3Data, gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.vector3Data
-                = vector3InterpolateFunction(startValue.vector3Data,
-                                             endValue.vector3Data, gradient)
-                    .add(offsetValue.vector3Data.scale(_repeatCount));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Vector2
-        case Animation::ANIMATIONTYPE_VECTOR2:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale.vector2Data = vector2InterpolateFunction(
-                startValue.vector2Data, endValue.vector2Data, gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.vector2Data
-                = vector2InterpolateFunction(startValue.vector2Data,
-                                             endValue.vector2Data, gradient)
-                    .add(offsetValue.vector2Data.scale(_repeatCount));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Size
-        case Animation::ANIMATIONTYPE_SIZE:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale.sizeData = sizeInterpolateFunction(
-                startValue.sizeData, endValue.sizeData, gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.sizeData
-                = sizeInterpolateFunction(startValue.sizeData,
-                                          endValue.sizeData, gradient)
-                    .add(offsetValue.sizeData.scale(_repeatCount));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Color3
-        case Animation::ANIMATIONTYPE_COLOR3:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale.color3Data = color3InterpolateFunction(
-                startValue.color3Data, endValue.color3Data, gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.color3Data
-                = color3InterpolateFunction(startValue.color3Data,
-                                            endValue.color3Data, gradient)
-                    .add(offsetValue.color3Data.scale(_repeatCount));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Matrix
-        case Animation::ANIMATIONTYPE_MATRIX:
-          switch (loopMode) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              if (allowMatricesInterpolation) {
-                newVale.matrixData = matrixInterpolateFunction(
-                  startValue.matrixData, endValue.matrixData, gradient);
-                return newVale;
-              }
-              newVale.matrixData = startValue.matrixData;
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale.matrixData = startValue.matrixData;
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        default:
-          break;
-      }
+bool Animation::_setBoundValue(const AnimationValue& value)
+{
+  if (value.dataType != _binding.dataType) {
+    return false;
+  }
+
+  switch (_binding.dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      *_binding.floatValue = value.floatData;
       break;
-    }
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      *_binding.quaternionValue = value.quaternionData;
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      *_binding.vector3Value = value.vector3Data;
+      break;
+    case Animation::ANIMATIONTYPE_COLOR3:
+      *_binding.color3Value = value.color3Data;
+      break;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      *_binding.matrixValue = value.matrixData;
+      break;
+    default:
+      return false;
   }
-  return _getKeyValue(_keys.back().value);
+
+  return true;
+}
+
+void Animation::bind()
+{
+  _binding = AnimationBinding::Bind(_target, targetPropertyPath);
 }
 
 void Animation::setValue(const AnimationValue& currentValue, bool /*blend*/)
 {
+  // Blending
+  if (enableBlending && _blendingFactor <= 1.f) {
+    return;
+  }
+
+  // Bound field
+  if (_binding.target != _target) {
+    bind();
+  }
+  if (_setBoundValue(currentValue)) {
+    return;
+  }
+
   // Set value
   std::string path;
   any destination;
@@ -503,13 +678,8 @@ void Animation::setValue(const AnimationValue& currentValue, bool /*blend*/)
     destination = _target;
   }
 
-  // Blending
-  if (enableBlending && _blendingFactor <= 1.f) {
-  }
-  else {
-    any newValue = currentValue.getValue();
-    _target->setProperty(destination, path, newValue);
-  }
+  any newValue = currentValue.getValue();
+  _target->setProperty(destination, path, newValue);
 }
 
 void Animation::goToFrame(int frame)
@@ -522,13 +692,24 @@ void Animation::goToFrame(int frame)
     _frame = _keys.back().frame;
   }
 
-  auto currentValue = _interpolate(_frame, 0, loopMode);
+  if (!_interpolateBound(_frame, 0, loopMode, nullptr, nullptr)) {
+    auto currentValue = _interpolate(_frame, 0, loopMode);
 
-  setValue(currentValue);
+    setValue(currentValue);
+  }
 }
 
 bool Animation::animate(millisecond_t delay, float from, float to, bool loop,
                         float speedRatio)
+{
+  const bool returnValue = _evaluate(delay, from, to, loop, speedRatio);
+  _checkEvents();
+
+  return returnValue;
+}
+
+bool Animation::_evaluate(millisecond_t delay, float from, float to, bool loop,
+                          float speedRatio)
 {
   if (this->targetProperty.empty()) {
     _stopped = true;
@@ -539,8 +720,8 @@ bool Animation::animate(millisecond_t delay, float from, float to, bool loop,
 
   // Adding a start key at frame 0 if missing
   if (_keys[0].frame != 0) {
-    _keys.clear();
     _keys.insert(_keys.begin(), AnimationKey(0, _keys[0].value));
+    _trackDirty = true;
   }
 
   // Check limits
@@ -553,17 +734,18 @@ bool Animation::animate(millisecond_t delay, float from, float to, bool loop,
 
   // Compute ratio
   float range = to - from;
-  AnimationValue offsetValue;
   // ratio represents the frame delta between from and to
   float ratio
     = (static_cast<float>(delay.count() * framePerSecond) * speedRatio)
       / 1000.f;
-  AnimationValue highLimitValue;
+  // Only set when not cycling, no value is copied otherwise
+  const AnimationValue* offsetValue    = nullptr;
+  const AnimationValue* highLimitValue = nullptr;
 
   if (ratio > range && !loop) {
     // If we are out of range and not looping get back to caller
     returnValue    = false;
-    highLimitValue = _getKeyValue(_keys.back().value);
+    highLimitValue = &_keys.back().value;
   }
   else {
     // Get max value if required
@@ -606,39 +788,8 @@ bool Animation::animate(millisecond_t delay, float from, float to, bool loop,
         _highLimitsCache[keyOffset] = toValue;
       }
 
-      highLimitValue = _highLimitsCache[keyOffset];
-      offsetValue    = _offsetsCache[keyOffset];
-    }
-  }
-
-  if (offsetValue.dataType == -1) {
-    switch (dataType) {
-      // Float
-      case Animation::ANIMATIONTYPE_FLOAT:
-        offsetValue = AnimationValue(0.f);
-        break;
-      // Quaternion
-      case Animation::ANIMATIONTYPE_QUATERNION:
-        offsetValue = AnimationValue(Quaternion(0.f, 0.f, 0.f, 0.f));
-        break;
-      // Vector3
-      case Animation::ANIMATIONTYPE_VECTOR3:
-        offsetValue = AnimationValue(Vector3::Zero());
-        break;
-      // Vector2
-      case Animation::ANIMATIONTYPE_VECTOR2:
-        offsetValue = AnimationValue(Vector2::Zero());
-        break;
-      // Size
-      case Animation::ANIMATIONTYPE_SIZE:
-        offsetValue = Size::Zero();
-        break;
-      // Color3
-      case Animation::ANIMATIONTYPE_COLOR3:
-        offsetValue = AnimationValue(Color3::Black());
-        break;
-      default:
-        break;
+      highLimitValue = &_highLimitsCache[keyOffset];
+      offsetValue    = &_offsetsCache[keyOffset];
     }
   }
 
@@ -647,23 +798,73 @@ bool Animation::animate(millisecond_t delay, float from, float to, bool loop,
   int _currentFrame
     = returnValue ? static_cast<int>(from + ratio) % static_cast<int>(range) :
                     static_cast<int>(to);
-  AnimationValue currentValue = _interpolate(
-    _currentFrame, repeatCount, loopMode, offsetValue, highLimitValue);
+  if (!_interpolateBound(_currentFrame, repeatCount, loopMode, offsetValue,
+                         highLimitValue)) {
+    AnimationValue offset
+      = offsetValue ? offsetValue->copy() : AnimationValue();
+    if (offset.dataType == -1) {
+      switch (dataType) {
+        // Float
+        case Animation::ANIMATIONTYPE_FLOAT:
+          offset = AnimationValue(0.f);
+          break;
+        // Quaternion
+        case Animation::ANIMATIONTYPE_QUATERNION:
+          offset = AnimationValue(Quaternion(0.f, 0.f, 0.f, 0.f));
+          break;
+        // Vector3
+        case Animation::ANIMATIONTYPE_VECTOR3:
+          offset = AnimationValue(Vector3::Zero());
+          break;
+        // Vector2
+        case Animation::ANIMATIONTYPE_VECTOR2:
+          offset = AnimationValue(Vector2::Zero());
+          break;
+        // Size
+        case Animation::ANIMATIONTYPE_SIZE:
+          offset = Size::Zero();
+          break;
+        // Color3
+        case Animation::ANIMATIONTYPE_COLOR3:
+          offset = AnimationValue(Color3::Black());
+          break;
+        default:
+          break;
+      }
+    }
+    AnimationValue currentValue = _interpolate(
+      _currentFrame, repeatCount, loopMode, offset,
+      highLimitValue ? highLimitValue->copy() : AnimationValue());
+
+    // Set value
+    setValue(currentValue);
+  }
+  if (!returnValue) {
+    _stopped = true;
+  }
+
+  return returnValue;
+}
+
+void Animation::_checkEvents()
+{
+  // Not evaluated
+  if (targetProperty.empty()) {
+    return;
+  }
 
-  // Set value
-  setValue(currentValue);
-  // Check events
   for (unsigned int index = 0; index < _events.size(); ++index) {
     if (currentFrame >= _events[index].frame) {
       AnimationEvent& event = _events[index];
       if (!event.isDone) {
+        event.isDone = true;
+        auto action  = event.action;
         // If event should be done only once, remove it.
         if (event.onlyOnce) {
           _events.erase(_events.begin() + index);
           --index;
         }
-        event.isDone = true;
-        event.action();
+        action();
       } // Don't do anything if the event has already be done.
     }
     else if (_events[index].isDone && !_events[index].onlyOnce) {
@@ -671,11 +872,6 @@ bool Animation::animate(millisecond_t delay, float from, float to, bool loop,
       _events[index].isDone = false;
     }
   }
-  if (!returnValue) {
-    _stopped = true;
-  }
-
-  return returnValue;
 }
 
 Json::object Animation::serialize() const
@@ -0,0 +1,68 @@
+#include <babylon/animations/animation_binding.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimatable.h>
+
+namespace BABYLON {
+
+AnimationBinding::AnimationBinding()
+    : target{nullptr}
+    , dataType{-1}
+    , floatValue{nullptr}
+    , vector3Value{nullptr}
+    , quaternionValue{nullptr}
+    , color3Value{nullptr}
+    , matrixValue{nullptr}
+{
+}
+
+AnimationBinding::~AnimationBinding()
+{
+}
+
+AnimationBinding
+AnimationBinding::Bind(IAnimatable* target,
+                       const std::vector<std::string>& targetPropertyPath)
+{
+  AnimationBinding binding;
+  binding.target = target;
+  if (!target || targetPropertyPath.empty()) {
+    return binding;
+  }
+
+  // Same resolution as Animation::setValue, done once
+  auto property = target->getProperty(targetPropertyPath[0]);
+  for (size_t index = 1; index < targetPropertyPath.size(); ++index) {
+    property = target->getProperty(property, targetPropertyPath[index]);
+  }
+
+  if (property.is<float*>()) {
+    binding.dataType   = Animation::ANIMATIONTYPE_FLOAT;
+    binding.floatValue = property._<float*>();
+  }
+  else if (property.is<Vector3*>()) {
+    binding.dataType     = Animation::ANIMATIONTYPE_VECTOR3;
+    binding.vector3Value = property._<Vector3*>();
+  }
+  else if (property.is<Quaternion*>()) {
+    binding.dataType        = Animation::ANIMATIONTYPE_QUATERNION;
+    binding.quaternionValue = property._<Quaternion*>();
+  }
+  else if (property.is<Color3*>()) {
+    binding.dataType    = Animation::ANIMATIONTYPE_COLOR3;
+    binding.color3Value = property._<Color3*>();
+  }
+  else if (property.is<Matrix*>()) {
+    binding.dataType    = Animation::ANIMATIONTYPE_MATRIX;
+    binding.matrixValue = property._<Matrix*>();
+  }
+
+  return binding;
+}
+
+bool AnimationBinding::isBound() const
+{
+  return dataType != -1;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,115 @@
+#include <babylon/animations/animation_track.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_key.h>
+
+namespace BABYLON {
+
+unsigned int AnimationTrack::Stride(int dataType)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return 1;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return 3;
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      return 4;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+AnimationTrack::AnimationTrack() : _stride{0}
+{
+}
+
+AnimationTrack::~AnimationTrack()
+{
+}
+
+size_t AnimationTrack::size() const
+{
+  return _frames.size();
+}
+
+unsigned int AnimationTrack::stride() const
+{
+  return _stride;
+}
+
+void AnimationTrack::set(const std::vector<AnimationKey>& keys, int dataType)
+{
+  _stride = Stride(dataType);
+  _frames.resize(keys.size());
+  _values.resize(keys.size() * _stride);
+
+  float* value = _values.data();
+  for (size_t index = 0; index < keys.size(); ++index, value += _stride) {
+    const AnimationValue& keyValue = keys[index].value;
+    _frames[index]                 = keys[index].frame;
+    switch (dataType) {
+      case Animation::ANIMATIONTYPE_FLOAT:
+        value[0] = keyValue.floatData;
+        break;
+      case Animation::ANIMATIONTYPE_VECTOR3:
+        value[0] = keyValue.vector3Data.x;
+        value[1] = keyValue.vector3Data.y;
+        value[2] = keyValue.vector3Data.z;
+        break;
+      case Animation::ANIMATIONTYPE_COLOR3:
+        value[0] = keyValue.color3Data.r;
+        value[1] = keyValue.color3Data.g;
+        value[2] = keyValue.color3Data.b;
+        break;
+      case Animation::ANIMATIONTYPE_QUATERNION:
+        value[0] = keyValue.quaternionData.x;
+        value[1] = keyValue.quaternionData.y;
+        value[2] = keyValue.quaternionData.z;
+        value[3] = keyValue.quaternionData.w;
+        break;
+      case Animation::ANIMATIONTYPE_MATRIX:
+        std::copy(keyValue.matrixData.m.begin(), keyValue.matrixData.m.end(),
+                  value);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+bool AnimationTrack::findKey(int frame, size_t& cursor) const
+{
+  const size_t count = _frames.size();
+  if (count < 2 || frame > _frames.back()) {
+    return false;
+  }
+
+  // Key of the previous call or the next one
+  for (size_t key = cursor; key <= cursor + 1 && key + 1 < count; ++key) {
+    if (_frames[key + 1] >= frame && (key == 0 || _frames[key] < frame)) {
+      cursor = key;
+      return true;
+    }
+  }
+
+  // The key preceding the first key, after the first one, at or past the
+  // frame
+  auto it = std::lower_bound(_frames.begin() + 1, _frames.end(), frame);
+  cursor  = static_cast<size_t>(it - _frames.begin()) - 1;
+  return true;
+}
+
+int AnimationTrack::frame(size_t key) const
+{
+  return _frames[key];
+}
+
+const float* AnimationTrack::value(size_t key) const
+{
+  return _values.data() + key * _stride;
+}
+
+} // end of namespace BABYLON
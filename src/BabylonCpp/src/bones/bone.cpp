@@ -248,8 +248,8 @@ void Bone::translate(const Vector3& vec, Space space, AbstractMesh* mesh)
   else {
 
     _skeleton->computeAbsoluteTransforms();
-    auto& tmat = Tmp::MatrixArray[0];
-    auto& tvec = Tmp::Vector3Array[0];
+    auto& tmat = Tmp::MatrixArray()[0];
+    auto& tvec = Tmp::Vector3Array()[0];
 
     if (mesh) {
       tmat.copyFrom(_parent->getAbsoluteTransform());
@@ -288,8 +288,8 @@ void Bone::setPosition(const Vector3& position, Space space, AbstractMesh* mesh)
 
     _skeleton->computeAbsoluteTransforms();
 
-    auto& tmat = Tmp::MatrixArray[0];
-    auto& vec  = Tmp::Vector3Array[0];
+    auto& tmat = Tmp::MatrixArray()[0];
+    auto& vec  = Tmp::Vector3Array()[0];
 
     if (mesh) {
       tmat.copyFrom(_parent->getAbsoluteTransform());
@@ -333,14 +333,14 @@ void Bone::setScale(float x, float y, float z, bool scaleChildren)
 void Bone::scale(float x, float y, float z, bool scaleChildren)
 {
   auto& locMat     = getLocalMatrix();
-  auto& origLocMat = Tmp::MatrixArray[0];
+  auto& origLocMat = Tmp::MatrixArray()[0];
   origLocMat.copyFrom(locMat);
 
-  auto& origLocMatInv = Tmp::MatrixArray[1];
+  auto& origLocMatInv = Tmp::MatrixArray()[1];
   origLocMatInv.copyFrom(origLocMat);
   origLocMatInv.invert();
 
-  auto& scaleMat = Tmp::MatrixArray[2];
+  auto& scaleMat = Tmp::MatrixArray()[2];
   Matrix::FromValuesToRef(x, 0, 0, 0, // M11-M14
                           0, y, 0, 0, // M21-M24
                           0, 0, z, 0, // M31-M34
@@ -390,10 +390,10 @@ void Bone::scale(float x, float y, float z, bool scaleChildren)
 void Bone::setYawPitchRoll(float yaw, float pitch, float roll, Space space,
                            AbstractMesh* mesh)
 {
-  auto& rotMat = Tmp::MatrixArray[0];
+  auto& rotMat = Tmp::MatrixArray()[0];
   Matrix::RotationYawPitchRollToRef(yaw, pitch, roll, rotMat);
 
-  auto& rotMatInv = Tmp::MatrixArray[1];
+  auto& rotMatInv = Tmp::MatrixArray()[1];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
@@ -404,7 +404,7 @@ void Bone::setYawPitchRoll(float yaw, float pitch, float roll, Space space,
 
 void Bone::rotate(Vector3& axis, float amount, Space space, AbstractMesh* mesh)
 {
-  auto& rmat = Tmp::MatrixArray[0];
+  auto& rmat = Tmp::MatrixArray()[0];
   rmat.m[12] = 0;
   rmat.m[13] = 0;
   rmat.m[14] = 0;
@@ -417,9 +417,9 @@ void Bone::rotate(Vector3& axis, float amount, Space space, AbstractMesh* mesh)
 void Bone::setAxisAngle(Vector3& axis, float angle, Space space,
                         AbstractMesh* mesh)
 {
-  auto& rotMat = Tmp::MatrixArray[0];
+  auto& rotMat = Tmp::MatrixArray()[0];
   Matrix::RotationAxisToRef(axis, angle, rotMat);
-  auto& rotMatInv = Tmp::MatrixArray[1];
+  auto& rotMatInv = Tmp::MatrixArray()[1];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
@@ -430,11 +430,11 @@ void Bone::setAxisAngle(Vector3& axis, float angle, Space space,
 void Bone::setRotationMatrix(const Matrix& rotMat, Space space,
                              AbstractMesh* mesh)
 {
-  auto& rotMatInv = Tmp::MatrixArray[0];
+  auto& rotMatInv = Tmp::MatrixArray()[0];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
-  auto& rotMat2 = Tmp::MatrixArray[1];
+  auto& rotMat2 = Tmp::MatrixArray()[1];
   rotMat2.copyFrom(rotMat);
 
   rotMatInv.multiplyToRef(rotMat, rotMat2);
@@ -450,8 +450,8 @@ void Bone::_rotateWithMatrix(const Matrix& rmat, Space space,
   float ly             = lmat.m[13];
   float lz             = lmat.m[14];
   auto parent          = getParent();
-  auto& parentScale    = Tmp::MatrixArray[3];
-  auto& parentScaleInv = Tmp::MatrixArray[4];
+  auto& parentScale    = Tmp::MatrixArray()[3];
+  auto& parentScaleInv = Tmp::MatrixArray()[4];
 
   if (parent) {
     if (space == Space::WORLD) {
@@ -499,13 +499,13 @@ void Bone::_getNegativeRotationToRef(Matrix& rotMatInv, Space space,
                                      AbstractMesh* mesh)
 {
   if (space == Space::WORLD) {
-    auto& scaleMatrix = Tmp::MatrixArray[2];
+    auto& scaleMatrix = Tmp::MatrixArray()[2];
     scaleMatrix.copyFrom(_scaleMatrix);
     rotMatInv.copyFrom(getAbsoluteTransform());
 
     if (mesh) {
       rotMatInv.multiplyToRef(*mesh->getWorldMatrix(), rotMatInv);
-      auto& meshScale = Tmp::MatrixArray[3];
+      auto& meshScale = Tmp::MatrixArray()[3];
       Matrix::ScalingToRef(mesh->scaling().x, mesh->scaling().y,
                            mesh->scaling().z, meshScale);
       scaleMatrix.multiplyToRef(meshScale, scaleMatrix);
@@ -518,11 +518,11 @@ void Bone::_getNegativeRotationToRef(Matrix& rotMatInv, Space space,
   else {
     rotMatInv.copyFrom(getLocalMatrix());
     rotMatInv.invert();
-    auto& scaleMatrix = Tmp::MatrixArray[2];
+    auto& scaleMatrix = Tmp::MatrixArray()[2];
     scaleMatrix.copyFrom(_scaleMatrix);
 
     if (_parent) {
-      auto& pscaleMatrix = Tmp::MatrixArray[3];
+      auto& pscaleMatrix = Tmp::MatrixArray()[3];
       pscaleMatrix.copyFrom(_parent->_scaleMatrix);
       pscaleMatrix.invert();
       pscaleMatrix.multiplyToRef(rotMatInv, rotMatInv);
@@ -569,7 +569,7 @@ void Bone::getPositionToRef(Vector3& result, Space space,
 
     _skeleton->computeAbsoluteTransforms();
 
-    auto& tmat = Tmp::MatrixArray[0];
+    auto& tmat = Tmp::MatrixArray()[0];
 
     if (mesh) {
       tmat.copyFrom(getAbsoluteTransform());
@@ -662,7 +662,7 @@ void Bone::getDirectionToRef(const Vector3& localAxis, Vector3& result,
 {
   _skeleton->computeAbsoluteTransforms();
 
-  auto& mat = Tmp::MatrixArray[0];
+  auto& mat = Tmp::MatrixArray()[0];
 
   mat.copyFrom(getAbsoluteTransform());
 
@@ -688,12 +688,12 @@ void Bone::getRotationToRef(Quaternion& result, Space space, AbstractMesh* mesh)
 {
   if (space == Space::LOCAL) {
 
-    getLocalMatrix().decompose(Tmp::Vector3Array[0], result,
-                               Tmp::Vector3Array[1]);
+    getLocalMatrix().decompose(Tmp::Vector3Array()[0], result,
+                               Tmp::Vector3Array()[1]);
   }
   else {
 
-    auto& mat  = Tmp::MatrixArray[0];
+    auto& mat  = Tmp::MatrixArray()[0];
     auto& amat = getAbsoluteTransform();
 
     if (mesh) {
@@ -701,11 +701,11 @@ void Bone::getRotationToRef(Quaternion& result, Space space, AbstractMesh* mesh)
       auto wmat = mesh->getWorldMatrix();
       amat.multiplyToRef(*wmat, mat);
 
-      mat.decompose(Tmp::Vector3Array[0], result, Tmp::Vector3Array[1]);
+      mat.decompose(Tmp::Vector3Array()[0], result, Tmp::Vector3Array()[1]);
     }
     else {
 
-      amat.decompose(Tmp::Vector3Array[0], result, Tmp::Vector3Array[1]);
+      amat.decompose(Tmp::Vector3Array()[0], result, Tmp::Vector3Array()[1]);
     }
   }
 }
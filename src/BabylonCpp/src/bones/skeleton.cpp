@@ -4,6 +4,7 @@
 #include <babylon/core/json.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
+#include <babylon/math/simd/simd_batch.h>
 #include <babylon/math/tmp.h>
 #include <babylon/mesh/abstract_mesh.h>
 
@@ -237,7 +238,12 @@ void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
                                          const Matrix& initialSkinMatrix,
                                          bool initialSkinMatrixSet)
 {
-  unsigned int index = 0;
+  // The world matrices depend on the parent ones and are updated in order, the
+  // skinning matrices are then computed in one batch
+  const size_t boneCount = bones.size();
+  _invertedAbsoluteTransforms.resize(boneCount * 16);
+  _worldMatrices.resize(boneCount * 16);
+  size_t index = 0;
   for (const auto& bone : bones) {
     Bone* parentBone = bone->getParent();
 
@@ -255,11 +261,21 @@ void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
       }
     }
 
-    bone->getInvertedAbsoluteTransform().multiplyToArray(
-      *bone->getWorldMatrix(), targetMatrix, index * 16);
+    const auto& invertedAbsoluteTransform
+      = bone->getInvertedAbsoluteTransform().m;
+    const auto& worldMatrix = bone->getWorldMatrix()->m;
+    std::copy(invertedAbsoluteTransform.begin(),
+              invertedAbsoluteTransform.end(),
+              _invertedAbsoluteTransforms.begin() + index * 16);
+    std::copy(worldMatrix.begin(), worldMatrix.end(),
+              _worldMatrices.begin() + index * 16);
     ++index;
   }
 
+  SIMD::SIMDBatch::MultiplyMatrices(_invertedAbsoluteTransforms.data(),
+                                    _worldMatrices.data(), targetMatrix.data(),
+                                    boneCount);
+
   _identity.copyToArray(targetMatrix,
                         static_cast<unsigned int>(bones.size()) * 16);
 }
@@ -282,7 +298,7 @@ void Skeleton::prepare()
       // Prepare bones
       for (auto& bone : bones) {
         if (!bone->getParent()) {
-          auto& tmpMatrix = Tmp::MatrixArray[0];
+          auto& tmpMatrix = Tmp::MatrixArray()[0];
           auto& matrix    = bone->getBaseMatrix();
           matrix.multiplyToRef(poseMatrix, tmpMatrix);
           bone->_updateDifferenceMatrix(tmpMatrix);
@@ -2,13 +2,14 @@
 
 #include <babylon/collisions/collider.h>
 #include <babylon/core/logging.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/math/plane.h>
 
 namespace BABYLON {
 
 CollideWorker::CollideWorker(Collider* _collider,
-                             const CollisionCache& collisionCache,
-                             const Vector3& _finalPosition)
+                             CollisionCache& collisionCache,
+                             Vector3& _finalPosition)
     : collider{_collider}
     , collisionsScalingMatrix{Matrix::Zero()}
     , collisionTranformationMatrix{Matrix::Zero()}
@@ -25,7 +26,6 @@ void CollideWorker::collideWithWorld(Vector3& position, Vector3& velocity,
                                      unsigned int maximumRetry,
                                      int excludedMeshUniqueId)
 {
-
   const float closeDistance = 0.01f;
   if (collider->retry >= maximumRetry) {
     finalPosition.copyFrom(position);
@@ -34,21 +34,21 @@ void CollideWorker::collideWithWorld(Vector3& position, Vector3& velocity,
 
   collider->_initialize(position, velocity, closeDistance);
 
-  // Check all meshes
-  std::unordered_map<unsigned int, SerializedMesh>& meshes
-    = _collisionCache.getMeshes();
-
-  if (excludedMeshUniqueId >= 0) {
-    unsigned _excludedMeshUniqueId
-      = static_cast<unsigned>(excludedMeshUniqueId);
-    for (auto& item : meshes) {
-      if (item.first != _excludedMeshUniqueId) {
-        SerializedMesh& mesh = item.second;
-        if (mesh.checkCollisions) {
-          checkCollision(mesh);
-        }
-      }
+  // Check the meshes whose bounds intersect the sweep sphere
+  const float maxRadius
+    = std::max(std::max(collider->radius.x, collider->radius.y),
+               collider->radius.z);
+  _meshIds.clear();
+  _collisionCache.intersectsMeshes(collider->basePointWorld,
+                                   collider->velocityWorldLength + maxRadius,
+                                   _meshIds);
+
+  for (auto uniqueId : _meshIds) {
+    if (excludedMeshUniqueId >= 0
+        && uniqueId == static_cast<unsigned>(excludedMeshUniqueId)) {
+      continue;
     }
+    checkCollision(_collisionCache.getMesh(uniqueId));
   }
 
   if (!collider->collisionFound) {
@@ -109,13 +109,43 @@ void CollideWorker::processCollisionsForSubMeshes(const Matrix& transformMatrix,
 
   SerializedGeometry& meshGeometry
     = _collisionCache.getGeometry(mesh.geometryId);
+
+  // Bounds of the sweep of the unit sphere in collider space, moved to the
+  // local space of the geometry
+  const Vector3 sweepEnd = collider->basePoint.add(collider->velocity);
+  const Vector3 colliderMinimum
+    = Vector3::Minimize(collider->basePoint, sweepEnd)
+        .subtractFromFloats(1.f, 1.f, 1.f);
+  const Vector3 colliderMaximum
+    = Vector3::Maximize(collider->basePoint, sweepEnd)
+        .add(Vector3(1.f, 1.f, 1.f));
+  Matrix invertedTransform = transformMatrix;
+  invertedTransform.invert();
+  Vector3 sweepMinimum(std::numeric_limits<float>::max(),
+                       std::numeric_limits<float>::max(),
+                       std::numeric_limits<float>::max());
+  Vector3 sweepMaximum(std::numeric_limits<float>::lowest(),
+                       std::numeric_limits<float>::lowest(),
+                       std::numeric_limits<float>::lowest());
+  for (unsigned int corner = 0; corner < 8; ++corner) {
+    const Vector3 point(
+      (corner & 1) ? colliderMaximum.x : colliderMinimum.x,
+      (corner & 2) ? colliderMaximum.y : colliderMinimum.y,
+      (corner & 4) ? colliderMaximum.z : colliderMinimum.z);
+    const auto localPoint
+      = Vector3::TransformCoordinates(point, invertedTransform);
+    sweepMinimum.minimizeInPlace(localPoint);
+    sweepMaximum.maximizeInPlace(localPoint);
+  }
+
   for (auto& subMesh : subMeshes) {
     // Bounding test
     if (len > 1 && !checkSubmeshCollision(subMesh)) {
       continue;
     }
 
-    collideForSubMesh(subMesh, transformMatrix, meshGeometry);
+    collideForSubMesh(subMesh, transformMatrix, meshGeometry, sweepMinimum,
+                      sweepMaximum);
     if (collider->collisionFound) {
       collider->collidedMeshId = mesh.uniqueId;
     }
@@ -124,7 +154,9 @@ void CollideWorker::processCollisionsForSubMeshes(const Matrix& transformMatrix,
 
 void CollideWorker::collideForSubMesh(SerializedSubMesh& subMesh,
                                       const Matrix& transformMatrix,
-                                      SerializedGeometry& meshGeometry)
+                                      SerializedGeometry& meshGeometry,
+                                      const Vector3& sweepMinimum,
+                                      const Vector3& sweepMaximum)
 {
   if (meshGeometry.positionsArray.empty()) {
     for (size_t i = 0; i < meshGeometry.positions.size(); i = i + 3) {
@@ -136,7 +168,7 @@ void CollideWorker::collideForSubMesh(SerializedSubMesh& subMesh,
   }
 
   if (subMesh._lastColliderWorldVertices.empty()
-      || subMesh._lastColliderTransformMatrix.equals(transformMatrix)) {
+      || !subMesh._lastColliderTransformMatrix.equals(transformMatrix)) {
     subMesh._lastColliderTransformMatrix = transformMatrix;
     subMesh._lastColliderWorldVertices.clear();
     subMesh._trianglePlanes.clear();
@@ -149,12 +181,22 @@ void CollideWorker::collideForSubMesh(SerializedSubMesh& subMesh,
     }
   }
 
+  // Only the triangles overlapping the sweep are tested, the hierarchy is
+  // kept with the geometry until it is updated
+  if (!meshGeometry.triangleBVH) {
+    meshGeometry.triangleBVH = std::make_shared<TriangleBVH>(
+      meshGeometry.positions, meshGeometry.indices);
+  }
+  _faceIds.clear();
+  meshGeometry.triangleBVH->intersectsBox(
+    sweepMinimum, sweepMaximum, subMesh.indexStart,
+    subMesh.indexStart + subMesh.indexCount, _faceIds);
+
   // Collide
-  collider->_collide(subMesh._trianglePlanes,
-                     subMesh._lastColliderWorldVertices, meshGeometry.indices,
-                     subMesh.indexStart,
-                     subMesh.indexStart + subMesh.indexCount,
-                     subMesh.verticesStart, subMesh.hasMaterial);
+  collider->_collideFaces(subMesh._trianglePlanes,
+                          subMesh._lastColliderWorldVertices,
+                          meshGeometry.indices, _faceIds,
+                          subMesh.verticesStart, subMesh.hasMaterial);
 }
 
 bool CollideWorker::checkSubmeshCollision(const SerializedSubMesh& subMesh)
@@ -11,6 +11,8 @@ Collider::Collider()
     , velocityWorld{Vector3::Zero()}
     , normalizedVelocity{Vector3::Zero()}
     , intersectionPointSet{false}
+    , collidedMesh{nullptr}
+    , collidedMeshId{0}
     , _collisionPoint{Vector3::Zero()}
     , _planeIntersectionPoint{Vector3::Zero()}
     , _tempVector{Vector3::Zero()}
@@ -162,13 +164,15 @@ void Collider::_testTriangle(size_t faceIndex,
   bool embeddedInPlane = false;
 
   if (faceIndex >= trianglePlaneArray.size()) {
-    for (size_t i = trianglePlaneArray.size(); i <= faceIndex; ++i) {
-      trianglePlaneArray.emplace_back(Plane(0.f, 0.f, 0.f, 0.f));
-    }
-    trianglePlaneArray[faceIndex].copyFromPoints(p1, p2, p3);
+    trianglePlaneArray.resize(faceIndex + 1, Plane(0.f, 0.f, 0.f, 0.f));
   }
 
+  // Planes are computed on first use, triangles may be tested out of order
   Plane& trianglePlane = trianglePlaneArray[faceIndex];
+  if (trianglePlane.normal.x == 0.f && trianglePlane.normal.y == 0.f
+      && trianglePlane.normal.z == 0.f) {
+    trianglePlane.copyFromPoints(p1, p2, p3);
+  }
 
   if ((!hasMaterial) && !trianglePlane.isFrontFacingTo(normalizedVelocity, 0)) {
     return;
@@ -356,7 +360,7 @@ void Collider::_testTriangle(size_t faceIndex,
 }
 
 void Collider::_collide(std::vector<Plane>& trianglePlaneArray,
-                        const std::vector<Vector3> pts,
+                        const std::vector<Vector3>& pts,
                         const Uint32Array& indices, size_t indexStart,
                         size_t indexEnd, unsigned int decal, bool hasMaterial)
 {
@@ -369,6 +373,22 @@ void Collider::_collide(std::vector<Plane>& trianglePlaneArray,
   }
 }
 
+void Collider::_collideFaces(std::vector<Plane>& trianglePlaneArray,
+                             const std::vector<Vector3>& pts,
+                             const Uint32Array& indices,
+                             const std::vector<uint32_t>& faceIds,
+                             unsigned int decal, bool hasMaterial)
+{
+  for (auto faceId : faceIds) {
+    const size_t i = faceId * 3;
+    Vector3 p1     = pts[indices[i] - decal];
+    Vector3 p2     = pts[indices[i + 1] - decal];
+    Vector3 p3     = pts[indices[i + 2] - decal];
+
+    _testTriangle(i, trianglePlaneArray, p3, p2, p1, hasMaterial);
+  }
+}
+
 void Collider::_getResponse(Vector3& pos, Vector3& vel)
 {
   pos.addToRef(vel, _destinationPoint);
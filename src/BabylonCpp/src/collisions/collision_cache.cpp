@@ -34,11 +34,25 @@ SerializedMesh& CollisionCache::getMesh(unsigned int id)
 void CollisionCache::addMesh(const SerializedMesh& mesh)
 {
   _meshes[mesh.uniqueId] = mesh;
+  _updateMeshProxy(mesh);
+}
+
+void CollisionCache::addMesh(SerializedMesh&& mesh)
+{
+  const auto uniqueId = mesh.uniqueId;
+  _meshes[uniqueId]   = std::move(mesh);
+  _updateMeshProxy(_meshes[uniqueId]);
 }
 
 void CollisionCache::removeMesh(unsigned int uniqueId)
 {
   _meshes.erase(uniqueId);
+
+  auto it = _meshProxies.find(uniqueId);
+  if (it != _meshProxies.end()) {
+    _meshesTree.destroyProxy(it->second);
+    _meshProxies.erase(it);
+  }
 }
 
 bool CollisionCache::containsGeometry(const std::string& id) const
@@ -56,9 +70,44 @@ void CollisionCache::addGeometry(const SerializedGeometry& geometry)
   _geometries[geometry.id] = geometry;
 }
 
+void CollisionCache::addGeometry(SerializedGeometry&& geometry)
+{
+  const auto id    = geometry.id;
+  _geometries[id] = std::move(geometry);
+}
+
 void CollisionCache::removeGeometry(const std::string& id)
 {
   _geometries.erase(id);
 }
 
+void CollisionCache::intersectsMeshes(
+  const Vector3& sphereCenter, float sphereRadius,
+  std::vector<unsigned int>& uniqueIds) const
+{
+  _meshesTree.intersects(sphereCenter, sphereRadius, uniqueIds);
+}
+
+void CollisionCache::_updateMeshProxy(const SerializedMesh& mesh)
+{
+  auto it = _meshProxies.find(mesh.uniqueId);
+  if (!mesh.checkCollisions) {
+    if (it != _meshProxies.end()) {
+      _meshesTree.destroyProxy(it->second);
+      _meshProxies.erase(it);
+    }
+    return;
+  }
+
+  const auto minimum = Vector3::FromArray(mesh.boxMinimum);
+  const auto maximum = Vector3::FromArray(mesh.boxMaximum);
+  if (it != _meshProxies.end()) {
+    _meshesTree.moveProxy(it->second, minimum, maximum);
+  }
+  else {
+    _meshProxies[mesh.uniqueId]
+      = _meshesTree.createProxy(minimum, maximum, mesh.uniqueId);
+  }
+}
+
 } // end of namespace BABYLON
@@ -107,7 +107,9 @@ void CollisionCoordinatorWorker::getNewPosition(
   if (!_init) {
     return;
   }
-  if (collisionIndex < _collisionsCallbackArray.size()) {
+  // A request is already running for this index
+  if (collisionIndex < _collisionsCallbackArray.size()
+      && _collisionsCallbackArray[collisionIndex]) {
     return;
   }
 
@@ -136,16 +138,17 @@ void CollisionCoordinatorWorker::getNewPosition(
   message.collidePayload = payload;
   message.taskType       = WorkerTaskType::COLLIDE;
 
-  _worker.postMessage(message);
+  _worker.postMessage(std::move(message));
 }
 
 void CollisionCoordinatorWorker::init(Scene* scene)
 {
   _scene = scene;
-  _scene->registerAfterRender([this]() { _afterRender(); });
+  _afterRenderObserver = _scene->onAfterRenderObservable.add(
+    [this](Scene*, const EventState&) { _afterRender(); });
 
   _worker.callbackHandler
-    = [this](const WorkerReply e) { _onMessageFromWorker(e); };
+    = [this](const WorkerReply& e) { _onMessageFromWorker(e); };
 
   BabylonMessage message;
   message.taskType = WorkerTaskType::INIT;
@@ -155,7 +158,7 @@ void CollisionCoordinatorWorker::init(Scene* scene)
 
 void CollisionCoordinatorWorker::destroy()
 {
-  _scene->unregisterAfterRender([this]() { _afterRender(); });
+  _scene->onAfterRenderObservable.remove(_afterRenderObserver);
   _worker.terminate();
 }
 
@@ -168,12 +171,14 @@ void CollisionCoordinatorWorker::onMeshAdded(AbstractMesh* mesh)
 
 void CollisionCoordinatorWorker::onMeshUpdated(AbstractMesh* mesh)
 {
-  _addUpdateMeshesList[mesh->uniqueId]
-    = CollisionCoordinatorWorker::SerializeMesh(mesh);
+  auto serializedMesh = CollisionCoordinatorWorker::SerializeMesh(mesh);
+  std::lock_guard<std::mutex> lock(_updatesMutex);
+  _addUpdateMeshesList[mesh->uniqueId] = std::move(serializedMesh);
 }
 
 void CollisionCoordinatorWorker::onMeshRemoved(AbstractMesh* mesh)
 {
+  std::lock_guard<std::mutex> lock(_updatesMutex);
   _toRemoveMeshesArray.emplace_back(mesh->uniqueId);
 }
 
@@ -186,22 +191,30 @@ void CollisionCoordinatorWorker::onGeometryAdded(Geometry* geometry)
 
 void CollisionCoordinatorWorker::onGeometryUpdated(Geometry* geometry)
 {
-  _addUpdateGeometriesList[geometry->id]
+  auto serializedGeometry
     = CollisionCoordinatorWorker::SerializeGeometry(geometry);
+  std::lock_guard<std::mutex> lock(_updatesMutex);
+  _addUpdateGeometriesList[geometry->id] = std::move(serializedGeometry);
 }
 
 void CollisionCoordinatorWorker::onGeometryDeleted(Geometry* geometry)
 {
+  std::lock_guard<std::mutex> lock(_updatesMutex);
   _toRemoveGeometryArray.emplace_back(geometry->id);
 }
 
 void CollisionCoordinatorWorker::_afterRender()
 {
+  // Replies received during the frame
+  _worker.processReplies();
+
   if (!_init) {
     return;
   }
 
-  if (_toRemoveGeometryArray.empty() && _toRemoveMeshesArray.empty()) {
+  std::lock_guard<std::mutex> lock(_updatesMutex);
+  if (_toRemoveGeometryArray.empty() && _toRemoveMeshesArray.empty()
+      && _addUpdateGeometriesList.empty() && _addUpdateMeshesList.empty()) {
     return;
   }
 
@@ -214,35 +227,16 @@ void CollisionCoordinatorWorker::_afterRender()
 
   ++_runningUpdated;
 
-  UpdatePayload payload;
-  payload.updatedMeshes     = _addUpdateMeshesList;
-  payload.updatedGeometries = _addUpdateGeometriesList;
-  payload.removedGeometries = _toRemoveGeometryArray;
-  payload.removedMeshes     = _toRemoveMeshesArray;
-
+  // The pending lists are handed over to the worker without copy
   BabylonMessage message;
-  message.updatePayload = payload;
-  message.taskType      = WorkerTaskType::UPDATE;
-
-  std::vector<ArrayBufferView> serializable;
-  for (auto item : payload.updatedGeometries) {
-    const std::string& id = item.first;
-    if (std_util::contains(payload.updatedGeometries, id)) {
-      // prepare transferables
-      serializable.emplace_back(
-        ArrayBufferView(message.updatePayload.updatedGeometries[id].indices));
-      serializable.emplace_back(
-        ArrayBufferView(message.updatePayload.updatedGeometries[id].normals));
-      serializable.emplace_back(
-        ArrayBufferView(message.updatePayload.updatedGeometries[id].positions));
-    }
-  }
-
-  _worker.postMessage(message, serializable);
-  _addUpdateMeshesList.clear();
-  _addUpdateGeometriesList.clear();
-  _toRemoveGeometryArray.clear();
-  _toRemoveMeshesArray.clear();
+  message.taskType = WorkerTaskType::UPDATE;
+  auto& payload    = message.updatePayload;
+  payload.updatedMeshes.swap(_addUpdateMeshesList);
+  payload.updatedGeometries.swap(_addUpdateGeometriesList);
+  payload.removedGeometries.swap(_toRemoveGeometryArray);
+  payload.removedMeshes.swap(_toRemoveMeshesArray);
+
+  _worker.postMessage(std::move(message));
 }
 
 void CollisionCoordinatorWorker::_onMessageFromWorker(
@@ -276,12 +270,20 @@ void CollisionCoordinatorWorker::_onMessageFromWorker(
       if (returnPayload.collisionId >= _collisionsCallbackArray.size()) {
         return;
       }
-      //_collisionsCallbackArray[returnPayload.collisionId](
-      //  returnPayload.collisionId,
-      //  Vector3::FromArray(returnPayload.newPosition),
-      //  _scene->getMeshByUniqueID(returnPayload.collidedMeshUniqueId));
-      // cleanup
+      // The callback may post a new request for the same index
+      auto callback = std::move(
+        _collisionsCallbackArray[returnPayload.collisionId]);
       _collisionsCallbackArray[returnPayload.collisionId] = nullptr;
+      if (!callback) {
+        return;
+      }
+      auto newPosition = Vector3::FromArray(returnPayload.newPosition);
+      auto collidedMesh
+        = (returnPayload.collidedMeshUniqueId >= 0) ?
+            _scene->getMeshByUniqueID(
+              static_cast<unsigned int>(returnPayload.collidedMeshUniqueId)) :
+            nullptr;
+      callback(returnPayload.collisionId, newPosition, collidedMesh);
     } break;
   }
 }
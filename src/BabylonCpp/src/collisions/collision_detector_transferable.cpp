@@ -29,18 +29,19 @@ CollisionDetectorTransferable::onInit(const InitPayload& /*payload*/)
 }
 
 WorkerReply
-CollisionDetectorTransferable::onUpdate(const UpdatePayload& payload)
+CollisionDetectorTransferable::onUpdate(UpdatePayload&& payload)
 {
   WorkerReply reply;
   reply.error    = WorkerReplyType::SUCCESS;
   reply.taskType = WorkerTaskType::UPDATE;
 
+  // The serialized data is moved into the cache, not copied
   for (auto& item : payload.updatedGeometries) {
-    _collisionCache->addGeometry(item.second);
+    _collisionCache->addGeometry(std::move(item.second));
   }
 
   for (auto& item : payload.updatedMeshes) {
-    _collisionCache->addMesh(item.second);
+    _collisionCache->addMesh(std::move(item.second));
   }
 
   for (auto& id : payload.removedGeometries) {
@@ -59,17 +60,20 @@ CollisionDetectorTransferable::onCollision(const CollidePayload& payload)
 {
   Vector3 finalPosition = Vector3::Zero();
   // Create a new collider
-  Collider* collider = new Collider();
-  collider->radius   = Vector3::FromArray(payload.collider.radius);
+  Collider collider;
+  collider.radius = Vector3::FromArray(payload.collider.radius);
   // Create new collide worker
-  CollideWorker colliderWorker(collider, *_collisionCache.get(), finalPosition);
+  CollideWorker colliderWorker(&collider, *_collisionCache, finalPosition);
   Vector3 position = Vector3::FromArray(payload.collider.position);
   Vector3 velocity = Vector3::FromArray(payload.collider.velocity);
   colliderWorker.collideWithWorld(position, velocity, payload.maximumRetry,
                                   payload.excludedMeshUniqueId);
   CollisionReplyPayload replyPayload;
-  replyPayload.collidedMeshUniqueId = collider->collidedMeshId,
-  replyPayload.collisionId          = payload.collisionId,
+  // The retry count is only incremented after a collision
+  const bool collided = collider.collisionFound || collider.retry > 0;
+  replyPayload.collidedMeshUniqueId
+    = collided ? static_cast<int>(collider.collidedMeshId) : -1;
+  replyPayload.collisionId          = payload.collisionId;
   replyPayload.newPosition          = finalPosition.asArray();
 
   WorkerReply reply;
@@ -1,40 +1,95 @@
 #include <babylon/collisions/worker.h>
 
-#include <babylon/collisions/babylon_message.h>
-#include <babylon/collisions/worker_reply.h>
-
 namespace BABYLON {
 
-Worker::Worker()
+Worker::Worker() : _running{false}, _terminated{false}
 {
 }
 
 Worker::~Worker()
 {
+  terminate();
 }
 
 void Worker::postMessage(const BabylonMessage& message)
 {
-  switch (message.taskType) {
-    case WorkerTaskType::INIT:
-      callbackHandler(collisionDetector.onInit(message.initPayload));
-      break;
-    case WorkerTaskType::COLLIDE:
-      callbackHandler(collisionDetector.onCollision(message.collidePayload));
-      break;
-    case WorkerTaskType::UPDATE:
-      callbackHandler(collisionDetector.onUpdate(message.updatePayload));
-      break;
+  postMessage(BabylonMessage(message));
+}
+
+void Worker::postMessage(BabylonMessage&& message)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_terminated) {
+      return;
+    }
+
+    _messages.emplace_back(
+      std_util::make_unique<BabylonMessage>(std::move(message)));
+    // The running task processes the message after the previous ones
+    if (_running) {
+      return;
+    }
+    _running = true;
   }
+
+  _tasks.post([this]() { _run(); });
 }
 
-void Worker::postMessage(const BabylonMessage& /*message*/,
-                         const std::vector<ArrayBufferView>& /*serializable*/)
+void Worker::processReplies()
 {
+  WorkerReply reply;
+  while (_replies.tryAndPop(reply)) {
+    if (callbackHandler) {
+      callbackHandler(reply);
+    }
+  }
 }
 
 void Worker::terminate()
 {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_terminated) {
+      return;
+    }
+    _terminated = true;
+  }
+
+  _tasks.wait();
+
+  WorkerReply reply;
+  while (_replies.tryAndPop(reply)) {
+  }
+}
+
+void Worker::_run()
+{
+  while (true) {
+    std::unique_ptr<BabylonMessage> message;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_messages.empty()) {
+        _running = false;
+        return;
+      }
+      message = std::move(_messages.front());
+      _messages.pop_front();
+    }
+
+    switch (message->taskType) {
+      case WorkerTaskType::INIT:
+        _replies.push(collisionDetector.onInit(message->initPayload));
+        break;
+      case WorkerTaskType::COLLIDE:
+        _replies.push(collisionDetector.onCollision(message->collidePayload));
+        break;
+      case WorkerTaskType::UPDATE:
+        _replies.push(
+          collisionDetector.onUpdate(std::move(message->updatePayload)));
+        break;
+    }
+  }
 }
 
 } // end of namespace BABYLON
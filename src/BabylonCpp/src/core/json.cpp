@@ -0,0 +1,164 @@
+#include <babylon/core/json.h>
+
+#include <babylon/core/json_stream_parser.h>
+
+namespace BABYLON {
+namespace Json {
+
+namespace {
+
+/**
+ * @brief Builds the DOM from the events of the stream parser, packing the
+ * arrays of the vertex data.
+ */
+class DomBuilder : public JsonStreamParser::Handler {
+
+public:
+  DomBuilder(Json::value& root) : _root{root}, _packed{nullptr}
+  {
+  }
+
+  void startObject() override
+  {
+    _stack.emplace_back(_add(Json::value(picojson::object_type, false)));
+  }
+
+  void endObject() override
+  {
+    _stack.pop_back();
+  }
+
+  void key(std::string&& name) override
+  {
+    _key = std::move(name);
+  }
+
+  void startArray(size_t numberCount) override
+  {
+    // Only the members of an object are packed, the key tells their meaning
+    if (numberCount > 0 && !_stack.empty()
+        && _stack.back()->is<Json::object>()) {
+      const auto packedType = _getPackedType(_key);
+      if (packedType != picojson::null_type) {
+        _packed = _add(Json::value(packedType, false));
+        if (_packed->is<Json::uint32_array>()) {
+          _packed->get<Json::uint32_array>().reserve(numberCount);
+        }
+        else {
+          _packed->get<Json::float32_array>().reserve(numberCount);
+        }
+        return;
+      }
+    }
+    _stack.emplace_back(_add(Json::value(picojson::array_type, false)));
+  }
+
+  void endArray() override
+  {
+    if (!_packed) {
+      _stack.pop_back();
+      return;
+    }
+
+    _packed = nullptr;
+  }
+
+  void null() override
+  {
+    _add(Json::value());
+  }
+
+  void boolean(bool value) override
+  {
+    _add(Json::value(value));
+  }
+
+  void number(double value) override
+  {
+    if (_packed && _packed->is<Json::uint32_array>()) {
+      _packed->get<Json::uint32_array>().emplace_back(
+        static_cast<uint32_t>(static_cast<int64_t>(value)));
+    }
+    else if (_packed) {
+      _packed->get<Json::float32_array>().emplace_back(
+        static_cast<float>(value));
+    }
+    else {
+      _add(Json::value(value));
+    }
+  }
+
+  void string(std::string&& value) override
+  {
+    Json::value stringValue;
+    stringValue.set<std::string>(std::move(value));
+    _add(std::move(stringValue));
+  }
+
+private:
+  static int _getPackedType(const std::string& key)
+  {
+    static const std::array<const char*, 17> float32Keys{
+      {"positions", "normals", "tangents", "uvs", "uvs2", "uvs3", "uvs4",
+       "uvs5", "uvs6", "uv2s", "uv3s", "uv4s", "uv5s", "uv6s", "colors",
+       "matricesWeights", "matricesWeightsExtra"}};
+    // The matrices indices can hold 4 indices packed in an integer, which a
+    // float would round
+    if (key == "indices" || key == "matricesIndices"
+        || key == "matricesIndicesExtra") {
+      return picojson::uint32_array_type;
+    }
+    for (const auto& float32Key : float32Keys) {
+      if (key == float32Key) {
+        return picojson::float32_array_type;
+      }
+    }
+    return picojson::null_type;
+  }
+
+  Json::value* _add(Json::value&& value)
+  {
+    if (_stack.empty()) {
+      _root = std::move(value);
+      return &_root;
+    }
+
+    auto& parent = *_stack.back();
+    if (parent.is<Json::object>()) {
+      auto& member = parent.get<Json::object>()[_key];
+      member       = std::move(value);
+      return &member;
+    }
+
+    auto& elements = parent.get<Json::array>();
+    elements.emplace_back(std::move(value));
+    return &elements.back();
+  }
+
+private:
+  Json::value& _root;
+  // Open objects and arrays, an array is not resized while one of its
+  // elements is open
+  std::vector<Json::value*> _stack;
+  std::string _key;
+  // Typed array being filled
+  Json::value* _packed;
+
+}; // end of class DomBuilder
+
+} // end of anonymous namespace
+
+std::string Parse(Json::value& parsedData, const char* data, size_t size)
+{
+  parsedData = Json::value();
+  DomBuilder builder(parsedData);
+  JsonStreamParser parser(builder);
+  if (!parser.parse(data, size)) {
+    parsedData = Json::value();
+    return parser.error();
+  }
+  return "";
+}
+
+} // end of namespace Json
+} // end of namespace BABYLON
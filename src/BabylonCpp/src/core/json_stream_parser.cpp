@@ -0,0 +1,458 @@
+#include <babylon/core/json_stream_parser.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace BABYLON {
+
+namespace {
+
+inline bool isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline int hexValue(char c)
+{
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+void appendUtf8(std::string& value, uint32_t codePoint)
+{
+  if (codePoint < 0x80) {
+    value += static_cast<char>(codePoint);
+  }
+  else if (codePoint < 0x800) {
+    value += static_cast<char>(0xC0 | (codePoint >> 6));
+    value += static_cast<char>(0x80 | (codePoint & 0x3F));
+  }
+  else if (codePoint < 0x10000) {
+    value += static_cast<char>(0xE0 | (codePoint >> 12));
+    value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    value += static_cast<char>(0x80 | (codePoint & 0x3F));
+  }
+  else {
+    value += static_cast<char>(0xF0 | (codePoint >> 18));
+    value += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    value += static_cast<char>(0x80 | (codePoint & 0x3F));
+  }
+}
+
+} // end of anonymous namespace
+
+JsonStreamParser::Handler::~Handler()
+{
+}
+
+JsonStreamParser::JsonStreamParser(Handler& handler)
+    : maxDepth{512}
+    , _handler{handler}
+    , _begin{nullptr}
+    , _cursor{nullptr}
+    , _end{nullptr}
+    , _depth{0}
+{
+}
+
+JsonStreamParser::~JsonStreamParser()
+{
+}
+
+const std::string& JsonStreamParser::error() const
+{
+  return _error;
+}
+
+bool JsonStreamParser::parse(const char* data, size_t size)
+{
+  _begin  = data;
+  _cursor = data;
+  _end    = data + size;
+  _depth  = 0;
+  _error.clear();
+
+  if (!_parseValue()) {
+    return false;
+  }
+
+  _skipWhitespace();
+  if (_cursor != _end) {
+    return _fail("Unexpected data after the document");
+  }
+
+  return true;
+}
+
+bool JsonStreamParser::_parseValue()
+{
+  _skipWhitespace();
+  if (_cursor == _end) {
+    return _fail("Unexpected end of the document");
+  }
+
+  switch (*_cursor) {
+    case '{':
+      return _parseObject();
+    case '[':
+      return _parseArray();
+    case '"': {
+      std::string value;
+      if (!_parseString(value)) {
+        return false;
+      }
+      _handler.string(std::move(value));
+      return true;
+    }
+    case 't':
+      if (!_parseLiteral("true")) {
+        return false;
+      }
+      _handler.boolean(true);
+      return true;
+    case 'f':
+      if (!_parseLiteral("false")) {
+        return false;
+      }
+      _handler.boolean(false);
+      return true;
+    case 'n':
+      if (!_parseLiteral("null")) {
+        return false;
+      }
+      _handler.null();
+      return true;
+    default: {
+      double value;
+      if (!_parseNumber(value)) {
+        return false;
+      }
+      _handler.number(value);
+      return true;
+    }
+  }
+}
+
+bool JsonStreamParser::_parseObject()
+{
+  if (++_depth > maxDepth) {
+    return _fail("Maximum nesting depth exceeded");
+  }
+
+  ++_cursor;
+  _handler.startObject();
+
+  _skipWhitespace();
+  if (_cursor != _end && *_cursor == '}') {
+    ++_cursor;
+  }
+  else {
+    while (true) {
+      _skipWhitespace();
+      if (_cursor == _end || *_cursor != '"') {
+        return _fail("Expected a key");
+      }
+      std::string name;
+      if (!_parseString(name)) {
+        return false;
+      }
+      _skipWhitespace();
+      if (_cursor == _end || *_cursor != ':') {
+        return _fail("Expected ':'");
+      }
+      ++_cursor;
+      _handler.key(std::move(name));
+      if (!_parseValue()) {
+        return false;
+      }
+
+      _skipWhitespace();
+      if (_cursor == _end) {
+        return _fail("Unexpected end of the document");
+      }
+      if (*_cursor == '}') {
+        ++_cursor;
+        break;
+      }
+      if (*_cursor != ',') {
+        return _fail("Expected ',' or '}'");
+      }
+      ++_cursor;
+    }
+  }
+
+  _handler.endObject();
+  --_depth;
+  return true;
+}
+
+bool JsonStreamParser::_parseArray()
+{
+  if (++_depth > maxDepth) {
+    return _fail("Maximum nesting depth exceeded");
+  }
+
+  _handler.startArray(_countNumbers());
+  ++_cursor;
+
+  _skipWhitespace();
+  if (_cursor != _end && *_cursor == ']') {
+    ++_cursor;
+  }
+  else {
+    while (true) {
+      if (!_parseValue()) {
+        return false;
+      }
+
+      _skipWhitespace();
+      if (_cursor == _end) {
+        return _fail("Unexpected end of the document");
+      }
+      if (*_cursor == ']') {
+        ++_cursor;
+        break;
+      }
+      if (*_cursor != ',') {
+        return _fail("Expected ',' or ']'");
+      }
+      ++_cursor;
+    }
+  }
+
+  _handler.endArray();
+  --_depth;
+  return true;
+}
+
+bool JsonStreamParser::_parseString(std::string& value)
+{
+  ++_cursor;
+  while (true) {
+    // Copies the unescaped characters at once
+    const char* start = _cursor;
+    while (_cursor != _end && *_cursor != '"' && *_cursor != '\\') {
+      if (static_cast<unsigned char>(*_cursor) < 0x20) {
+        return _fail("Control character in string");
+      }
+      ++_cursor;
+    }
+    value.append(start, static_cast<size_t>(_cursor - start));
+
+    if (_cursor == _end) {
+      return _fail("Unterminated string");
+    }
+    if (*_cursor == '"') {
+      ++_cursor;
+      return true;
+    }
+
+    // Escape sequence
+    if (++_cursor == _end) {
+      return _fail("Unterminated string");
+    }
+    switch (*_cursor++) {
+      case '"':
+        value += '"';
+        break;
+      case '\\':
+        value += '\\';
+        break;
+      case '/':
+        value += '/';
+        break;
+      case 'b':
+        value += '\b';
+        break;
+      case 'f':
+        value += '\f';
+        break;
+      case 'n':
+        value += '\n';
+        break;
+      case 'r':
+        value += '\r';
+        break;
+      case 't':
+        value += '\t';
+        break;
+      case 'u': {
+        const auto readCodeUnit = [this](uint32_t& codeUnit) {
+          if (_end - _cursor < 4) {
+            return false;
+          }
+          codeUnit = 0;
+          for (unsigned int i = 0; i < 4; ++i) {
+            const int digit = hexValue(*_cursor++);
+            if (digit < 0) {
+              return false;
+            }
+            codeUnit = (codeUnit << 4) | static_cast<uint32_t>(digit);
+          }
+          return true;
+        };
+        uint32_t codePoint;
+        if (!readCodeUnit(codePoint)) {
+          return _fail("Invalid unicode escape");
+        }
+        // Surrogate pair
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+          uint32_t low;
+          if (_end - _cursor < 2 || _cursor[0] != '\\' || _cursor[1] != 'u') {
+            return _fail("Invalid unicode surrogate pair");
+          }
+          _cursor += 2;
+          if (!readCodeUnit(low) || low < 0xDC00 || low > 0xDFFF) {
+            return _fail("Invalid unicode surrogate pair");
+          }
+          codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        appendUtf8(value, codePoint);
+        break;
+      }
+      default:
+        return _fail("Invalid escape sequence");
+    }
+  }
+}
+
+bool JsonStreamParser::_parseNumber(double& value)
+{
+  const char* start = _cursor;
+  bool isInteger    = true;
+
+  if (_cursor != _end && *_cursor == '-') {
+    ++_cursor;
+  }
+  if (_cursor == _end || !isDigit(*_cursor)) {
+    return _fail("Invalid value");
+  }
+  if (*_cursor == '0') {
+    ++_cursor;
+  }
+  else {
+    while (_cursor != _end && isDigit(*_cursor)) {
+      ++_cursor;
+    }
+  }
+  if (_cursor != _end && *_cursor == '.') {
+    isInteger = false;
+    ++_cursor;
+    if (_cursor == _end || !isDigit(*_cursor)) {
+      return _fail("Invalid number");
+    }
+    while (_cursor != _end && isDigit(*_cursor)) {
+      ++_cursor;
+    }
+  }
+  if (_cursor != _end && (*_cursor == 'e' || *_cursor == 'E')) {
+    isInteger = false;
+    ++_cursor;
+    if (_cursor != _end && (*_cursor == '+' || *_cursor == '-')) {
+      ++_cursor;
+    }
+    if (_cursor == _end || !isDigit(*_cursor)) {
+      return _fail("Invalid number");
+    }
+    while (_cursor != _end && isDigit(*_cursor)) {
+      ++_cursor;
+    }
+  }
+
+  const auto length = static_cast<size_t>(_cursor - start);
+
+  // Integers of up to 15 digits are exact in a double, e.g. the indices
+  if (isInteger && length <= 15) {
+    const bool negative = (*start == '-');
+    int64_t integer     = 0;
+    for (const char* c = negative ? start + 1 : start; c != _cursor; ++c) {
+      integer = integer * 10 + (*c - '0');
+    }
+    value = static_cast<double>(negative ? -integer : integer);
+    return true;
+  }
+
+  // The input is not null terminated
+  char buffer[64];
+  if (length < sizeof(buffer)) {
+    std::memcpy(buffer, start, length);
+    buffer[length] = '\0';
+    value          = std::strtod(buffer, nullptr);
+  }
+  else {
+    value = std::strtod(std::string(start, length).c_str(), nullptr);
+  }
+
+  return true;
+}
+
+bool JsonStreamParser::_parseLiteral(const char* literal)
+{
+  const size_t length = std::strlen(literal);
+  if (static_cast<size_t>(_end - _cursor) < length
+      || std::memcmp(_cursor, literal, length) != 0) {
+    return _fail("Invalid value");
+  }
+  _cursor += length;
+  return true;
+}
+
+size_t JsonStreamParser::_countNumbers() const
+{
+  // Scans the array from its opening bracket, stopping at the first character
+  // which cannot be part of an array of numbers
+  size_t separators = 0;
+  bool hasDigits    = false;
+  for (const char* c = _cursor + 1; c != _end; ++c) {
+    switch (*c) {
+      case ',':
+        ++separators;
+        break;
+      case ']':
+        return hasDigits ? separators + 1 : 0;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+      case '-':
+      case '+':
+      case '.':
+      case 'e':
+      case 'E':
+        break;
+      default:
+        if (!isDigit(*c)) {
+          return 0;
+        }
+        hasDigits = true;
+        break;
+    }
+  }
+  return 0;
+}
+
+void JsonStreamParser::_skipWhitespace()
+{
+  while (_cursor != _end
+         && (*_cursor == ' ' || *_cursor == '\n' || *_cursor == '\r'
+             || *_cursor == '\t')) {
+    ++_cursor;
+  }
+}
+
+bool JsonStreamParser::_fail(const std::string& message)
+{
+  _error = message + " at offset " + std::to_string(_cursor - _begin);
+  return false;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,44 @@
+#include <babylon/core/task_group.h>
+
+namespace BABYLON {
+
+TaskGroup::TaskGroup(ThreadPool& threadPool)
+    : _threadPool{threadPool}, _pendingCount{0}
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+  wait();
+}
+
+size_t TaskGroup::pendingCount() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pendingCount;
+}
+
+void TaskGroup::post(const ThreadPool::Task& task)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_pendingCount;
+  }
+
+  _threadPool.post([this, task]() {
+    task();
+    // Notified under the lock, the group can be destroyed as soon as wait()
+    // returns
+    std::lock_guard<std::mutex> lock(_mutex);
+    --_pendingCount;
+    _done.notify_all();
+  });
+}
+
+void TaskGroup::wait()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done.wait(lock, [this]() { return _pendingCount == 0; });
+}
+
+} // end of namespace BABYLON
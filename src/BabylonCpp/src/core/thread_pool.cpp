@@ -0,0 +1,182 @@
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+
+namespace {
+// Set on the worker threads, and on the calling thread while it processes
+// chunks
+thread_local bool isInParallelFor = false;
+} // end of anonymous namespace
+
+ThreadPool::ThreadPool(size_t threadCount)
+    : _func{nullptr}
+    , _count{0}
+    , _chunkSize{0}
+    , _chunksCount{0}
+    , _generation{0}
+    , _activeWorkers{0}
+    , _stop{false}
+    , _nextChunk{0}
+    , _completedChunks{0}
+{
+  if (threadCount == 0) {
+    const size_t hardwareThreads = std::thread::hardware_concurrency();
+    threadCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+  }
+
+  _threads.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    _threads.emplace_back(&ThreadPool::_workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _wakeUp.notify_all();
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+}
+
+size_t ThreadPool::threadCount() const
+{
+  return _threads.size();
+}
+
+bool ThreadPool::IsInParallelFor()
+{
+  return isInParallelFor;
+}
+
+ThreadPool& ThreadPool::Default()
+{
+  static ThreadPool threadPool(
+    std::max(std::thread::hardware_concurrency(), 2u) - 1);
+  return threadPool;
+}
+
+void ThreadPool::parallelFor(size_t count, size_t chunkSize,
+                             const ChunkFunction& func)
+{
+  if (count == 0) {
+    return;
+  }
+
+  chunkSize = std::max(chunkSize, static_cast<size_t>(1));
+  if (_threads.empty() || isInParallelFor || count <= chunkSize) {
+    func(0, count);
+    return;
+  }
+
+  std::lock_guard<std::mutex> submitLock(_submitMutex);
+
+  const size_t chunksCount = (count + chunkSize - 1) / chunkSize;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _func        = &func;
+    _count       = count;
+    _chunkSize   = chunkSize;
+    _chunksCount = chunksCount;
+    _nextChunk.store(0);
+    _completedChunks.store(0);
+    ++_generation;
+  }
+  _wakeUp.notify_all();
+
+  isInParallelFor = true;
+  _runChunks(&func, count, chunkSize, chunksCount);
+  isInParallelFor = false;
+
+  // Wait for the chunks still processed by the workers, and for the workers
+  // to release the loop
+  std::unique_lock<std::mutex> lock(_mutex);
+  _finished.wait(lock, [this, chunksCount]() {
+    return _completedChunks.load() == chunksCount && _activeWorkers == 0;
+  });
+  _func = nullptr;
+}
+
+void ThreadPool::post(const Task& task)
+{
+  if (_threads.empty()) {
+    task();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.emplace_back(task);
+  }
+  _wakeUp.notify_one();
+}
+
+void ThreadPool::_workerLoop()
+{
+  isInParallelFor = true;
+
+  uint64_t generation = 0;
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _wakeUp.wait(lock, [this, generation]() {
+      return _stop || _generation != generation || !_tasks.empty();
+    });
+    if (_stop) {
+      return;
+    }
+
+    // The running loop first, then the queued tasks
+    if (_generation == generation || !_func) {
+      generation = _generation;
+      if (!_tasks.empty()) {
+        Task task = std::move(_tasks.front());
+        _tasks.pop_front();
+        lock.unlock();
+
+        // A task is not a loop body, its own loops run in parallel
+        isInParallelFor = false;
+        task();
+        isInParallelFor = true;
+
+        lock.lock();
+      }
+      continue;
+    }
+    generation = _generation;
+
+    // Copy the loop while holding the lock, the caller cannot return before
+    // this worker is done with it
+    const ChunkFunction* func = _func;
+    const size_t count        = _count;
+    const size_t chunkSize    = _chunkSize;
+    const size_t chunksCount  = _chunksCount;
+    ++_activeWorkers;
+    lock.unlock();
+
+    _runChunks(func, count, chunkSize, chunksCount);
+
+    lock.lock();
+    --_activeWorkers;
+    _finished.notify_all();
+  }
+}
+
+void ThreadPool::_runChunks(const ChunkFunction* func, size_t count,
+                            size_t chunkSize, size_t chunksCount)
+{
+  while (true) {
+    const size_t chunk = _nextChunk.fetch_add(1);
+    if (chunk >= chunksCount) {
+      return;
+    }
+
+    const size_t begin = chunk * chunkSize;
+    (*func)(begin, std::min(begin + chunkSize, count));
+    _completedChunks.fetch_add(1);
+  }
+}
+
+} // end of namespace BABYLON
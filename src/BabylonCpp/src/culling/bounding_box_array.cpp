@@ -0,0 +1,98 @@
+#include <babylon/culling/bounding_box_array.h>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/simd/simd_batch.h>
+
+namespace BABYLON {
+
+BoundingBoxArray::BoundingBoxArray() : _size{0}, _capacity{0}
+{
+}
+
+BoundingBoxArray::~BoundingBoxArray()
+{
+}
+
+size_t BoundingBoxArray::size() const
+{
+  return _size;
+}
+
+bool BoundingBoxArray::empty() const
+{
+  return _size == 0;
+}
+
+void BoundingBoxArray::clear()
+{
+  _size = 0;
+}
+
+size_t BoundingBoxArray::add(const BoundingBox& boundingBox)
+{
+  if (_size == _capacity) {
+    _reserve(std::max<size_t>(64, _capacity * 2));
+  }
+
+  // The world center is the one of the world corners, the half axes are the
+  // world matrix axes scaled by the local extend
+  const auto& center     = boundingBox.center;
+  const auto& directions = boundingBox.directions;
+  const auto& extendSize = boundingBox.extendSize;
+  const float values[12]
+    = {center.x,
+       center.y,
+       center.z,
+       directions[0].x * extendSize.x,
+       directions[0].y * extendSize.x,
+       directions[0].z * extendSize.x,
+       directions[1].x * extendSize.y,
+       directions[1].y * extendSize.y,
+       directions[1].z * extendSize.y,
+       directions[2].x * extendSize.z,
+       directions[2].y * extendSize.z,
+       directions[2].z * extendSize.z};
+  for (unsigned int k = 0; k < 12; ++k) {
+    _data[k * _capacity + _size] = values[k];
+  }
+
+  return _size++;
+}
+
+void BoundingBoxArray::isInFrustum(const std::array<Plane, 6>& frustumPlanes,
+                                   std::vector<uint32_t>& visibility) const
+{
+  std::array<float, 24> planes;
+  for (unsigned int p = 0; p < 6; ++p) {
+    const auto& plane = frustumPlanes[p];
+    planes[p * 4 + 0] = plane.normal.x;
+    planes[p * 4 + 1] = plane.normal.y;
+    planes[p * 4 + 2] = plane.normal.z;
+    planes[p * 4 + 3] = plane.d;
+  }
+
+  visibility.resize((_size + 31) / 32);
+  SIMD::SIMDBatch::IntersectFrustum(_data.data(), _capacity, _size,
+                                    planes.data(), visibility.data());
+}
+
+bool BoundingBoxArray::IsVisible(const std::vector<uint32_t>& visibility,
+                                 size_t index)
+{
+  return (visibility[index / 32] & (1u << (index % 32))) != 0;
+}
+
+void BoundingBoxArray::_reserve(size_t capacity)
+{
+  Float32Array data(capacity * 12);
+  for (unsigned int k = 0; k < 12; ++k) {
+    std::copy(_data.begin() + k * _capacity,
+              _data.begin() + k * _capacity + _size,
+              data.begin() + k * capacity);
+  }
+  _data     = std::move(data);
+  _capacity = capacity;
+}
+
+} // end of namespace BABYLON
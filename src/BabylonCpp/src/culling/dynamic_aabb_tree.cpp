@@ -0,0 +1,554 @@
+#include <babylon/culling/dynamic_aabb_tree.h>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/ray.h>
+#include <babylon/math/plane.h>
+#include <babylon/mesh/abstract_mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+
+namespace BABYLON {
+
+template <class T>
+constexpr int DynamicAABBTree<T>::NullNode;
+
+template <class T>
+DynamicAABBTree<T>::DynamicAABBTree(float margin)
+    : _root{NullNode}, _freeList{NullNode}, _proxyCount{0}, _margin{margin}
+{
+}
+
+template <class T>
+DynamicAABBTree<T>::~DynamicAABBTree()
+{
+}
+
+template <class T>
+size_t DynamicAABBTree<T>::size() const
+{
+  return _proxyCount;
+}
+
+template <class T>
+bool DynamicAABBTree<T>::empty() const
+{
+  return _proxyCount == 0;
+}
+
+template <class T>
+int DynamicAABBTree<T>::height() const
+{
+  return (_root == NullNode) ? 0 : _nodes[static_cast<size_t>(_root)].height;
+}
+
+template <class T>
+float DynamicAABBTree<T>::margin() const
+{
+  return _margin;
+}
+
+template <class T>
+int DynamicAABBTree<T>::createProxy(const Vector3& minimum,
+                                    const Vector3& maximum, const T& data)
+{
+  const int proxyId = _allocateNode();
+  auto& node        = _nodes[static_cast<size_t>(proxyId)];
+
+  node.minimum.copyFromFloats(minimum.x - _margin, minimum.y - _margin,
+                              minimum.z - _margin);
+  node.maximum.copyFromFloats(maximum.x + _margin, maximum.y + _margin,
+                              maximum.z + _margin);
+  node.data   = data;
+  node.height = 0;
+
+  _insertLeaf(proxyId);
+  ++_proxyCount;
+
+  return proxyId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::destroyProxy(int proxyId)
+{
+  _removeLeaf(proxyId);
+  _freeNode(proxyId);
+  --_proxyCount;
+}
+
+template <class T>
+bool DynamicAABBTree<T>::moveProxy(int proxyId, const Vector3& minimum,
+                                   const Vector3& maximum)
+{
+  auto& node = _nodes[static_cast<size_t>(proxyId)];
+
+  // Still enclosed by the fat box, and the fat box is not oversized
+  const float maxMargin = 4.f * _margin;
+  if (node.minimum.x <= minimum.x && node.minimum.y <= minimum.y
+      && node.minimum.z <= minimum.z && maximum.x <= node.maximum.x
+      && maximum.y <= node.maximum.y && maximum.z <= node.maximum.z
+      && minimum.x - node.minimum.x <= maxMargin
+      && minimum.y - node.minimum.y <= maxMargin
+      && minimum.z - node.minimum.z <= maxMargin
+      && node.maximum.x - maximum.x <= maxMargin
+      && node.maximum.y - maximum.y <= maxMargin
+      && node.maximum.z - maximum.z <= maxMargin) {
+    return false;
+  }
+
+  _removeLeaf(proxyId);
+
+  auto& leaf = _nodes[static_cast<size_t>(proxyId)];
+  leaf.minimum.copyFromFloats(minimum.x - _margin, minimum.y - _margin,
+                              minimum.z - _margin);
+  leaf.maximum.copyFromFloats(maximum.x + _margin, maximum.y + _margin,
+                              maximum.z + _margin);
+
+  _insertLeaf(proxyId);
+
+  return true;
+}
+
+template <class T>
+T& DynamicAABBTree<T>::getData(int proxyId)
+{
+  return _nodes[static_cast<size_t>(proxyId)].data;
+}
+
+template <class T>
+const Vector3& DynamicAABBTree<T>::getFatMinimum(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].minimum;
+}
+
+template <class T>
+const Vector3& DynamicAABBTree<T>::getFatMaximum(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].maximum;
+}
+
+template <class T>
+void DynamicAABBTree<T>::clear()
+{
+  _nodes.clear();
+  _root       = NullNode;
+  _freeList   = NullNode;
+  _proxyCount = 0;
+}
+
+template <class T>
+void DynamicAABBTree<T>::select(const std::array<Plane, 6>& frustumPlanes,
+                                std::vector<T>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  _stack.clear();
+  _stack.emplace_back(_root);
+
+  while (!_stack.empty()) {
+    const int nodeId = _stack.back();
+    _stack.pop_back();
+    const auto& node = _nodes[static_cast<size_t>(nodeId)];
+
+    // Test the box corners the most (and the least) in front of each plane
+    bool inside = true;
+    bool culled = false;
+    for (const auto& plane : frustumPlanes) {
+      const auto& n = plane.normal;
+      const float farthest
+        = n.x * (n.x >= 0.f ? node.maximum.x : node.minimum.x)
+          + n.y * (n.y >= 0.f ? node.maximum.y : node.minimum.y)
+          + n.z * (n.z >= 0.f ? node.maximum.z : node.minimum.z) + plane.d;
+      if (farthest < 0.f) {
+        culled = true;
+        break;
+      }
+      const float nearest
+        = n.x * (n.x >= 0.f ? node.minimum.x : node.maximum.x)
+          + n.y * (n.y >= 0.f ? node.minimum.y : node.maximum.y)
+          + n.z * (n.z >= 0.f ? node.minimum.z : node.maximum.z) + plane.d;
+      if (nearest < 0.f) {
+        inside = false;
+      }
+    }
+
+    if (culled) {
+      continue;
+    }
+
+    if (inside) {
+      _collectLeaves(nodeId, selection);
+    }
+    else if (node.isLeaf()) {
+      selection.emplace_back(node.data);
+    }
+    else {
+      _stack.emplace_back(node.child1);
+      _stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::intersects(const Vector3& sphereCenter,
+                                    float sphereRadius,
+                                    std::vector<T>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  _stack.clear();
+  _stack.emplace_back(_root);
+
+  while (!_stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(_stack.back())];
+    _stack.pop_back();
+
+    if (!BoundingBox::IntersectsSphere(node.minimum, node.maximum,
+                                       sphereCenter, sphereRadius)) {
+      continue;
+    }
+
+    if (node.isLeaf()) {
+      selection.emplace_back(node.data);
+    }
+    else {
+      _stack.emplace_back(node.child1);
+      _stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::intersectsRay(const Ray& ray,
+                                       std::vector<T>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  _stack.clear();
+  _stack.emplace_back(_root);
+
+  while (!_stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(_stack.back())];
+    _stack.pop_back();
+
+    if (!ray.intersectsBoxMinMax(node.minimum, node.maximum)) {
+      continue;
+    }
+
+    if (node.isLeaf()) {
+      selection.emplace_back(node.data);
+    }
+    else {
+      _stack.emplace_back(node.child1);
+      _stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+int DynamicAABBTree<T>::_allocateNode()
+{
+  if (_freeList == NullNode) {
+    _nodes.emplace_back(Node());
+    _nodes.back().parent = NullNode;
+    _freeList            = static_cast<int>(_nodes.size() - 1);
+  }
+
+  const int nodeId = _freeList;
+  auto& node       = _nodes[static_cast<size_t>(nodeId)];
+  _freeList        = node.parent;
+  node.parent      = NullNode;
+  node.child1      = NullNode;
+  node.child2      = NullNode;
+  node.height      = 0;
+
+  return nodeId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_freeNode(int nodeId)
+{
+  auto& node  = _nodes[static_cast<size_t>(nodeId)];
+  node.parent = _freeList;
+  node.data   = T();
+  node.height = -1;
+  _freeList   = nodeId;
+}
+
+template <class T>
+float DynamicAABBTree<T>::_SurfaceArea(const Vector3& minimum,
+                                       const Vector3& maximum)
+{
+  const float dx = maximum.x - minimum.x;
+  const float dy = maximum.y - minimum.y;
+  const float dz = maximum.z - minimum.z;
+  return 2.f * (dx * dy + dy * dz + dz * dx);
+}
+
+template <class T>
+void DynamicAABBTree<T>::_insertLeaf(int leaf)
+{
+  if (_root == NullNode) {
+    _root                                    = leaf;
+    _nodes[static_cast<size_t>(leaf)].parent = NullNode;
+    return;
+  }
+
+  // Find the best sibling using the surface area heuristic
+  const Vector3 leafMin = _nodes[static_cast<size_t>(leaf)].minimum;
+  const Vector3 leafMax = _nodes[static_cast<size_t>(leaf)].maximum;
+  int index             = _root;
+  while (!_nodes[static_cast<size_t>(index)].isLeaf()) {
+    const auto& node = _nodes[static_cast<size_t>(index)];
+    const float area = _SurfaceArea(node.minimum, node.maximum);
+    const float combinedArea
+      = _SurfaceArea(Vector3::Minimize(node.minimum, leafMin),
+                     Vector3::Maximize(node.maximum, leafMax));
+
+    // Cost of creating a new parent for this node and the new leaf
+    const float cost = 2.f * combinedArea;
+    // Minimum cost of pushing the leaf further down the tree
+    const float inheritanceCost = 2.f * (combinedArea - area);
+
+    float childCosts[2];
+    const int children[2] = {node.child1, node.child2};
+    for (unsigned int i = 0; i < 2; ++i) {
+      const auto& child = _nodes[static_cast<size_t>(children[i])];
+      const float enlargedArea
+        = _SurfaceArea(Vector3::Minimize(child.minimum, leafMin),
+                       Vector3::Maximize(child.maximum, leafMax));
+      childCosts[i] = child.isLeaf() ?
+                        enlargedArea + inheritanceCost :
+                        enlargedArea
+                          - _SurfaceArea(child.minimum, child.maximum)
+                          + inheritanceCost;
+    }
+
+    if (cost < childCosts[0] && cost < childCosts[1]) {
+      break;
+    }
+
+    index = (childCosts[0] < childCosts[1]) ? children[0] : children[1];
+  }
+
+  const int sibling   = index;
+  const int oldParent = _nodes[static_cast<size_t>(sibling)].parent;
+  const int newParent = _allocateNode();
+  {
+    auto& parentNode   = _nodes[static_cast<size_t>(newParent)];
+    const auto& sib    = _nodes[static_cast<size_t>(sibling)];
+    parentNode.parent  = oldParent;
+    parentNode.data    = T();
+    parentNode.minimum = Vector3::Minimize(sib.minimum, leafMin);
+    parentNode.maximum = Vector3::Maximize(sib.maximum, leafMax);
+    parentNode.height  = sib.height + 1;
+    parentNode.child1  = sibling;
+    parentNode.child2  = leaf;
+  }
+
+  if (oldParent != NullNode) {
+    auto& oldParentNode = _nodes[static_cast<size_t>(oldParent)];
+    if (oldParentNode.child1 == sibling) {
+      oldParentNode.child1 = newParent;
+    }
+    else {
+      oldParentNode.child2 = newParent;
+    }
+  }
+  else {
+    _root = newParent;
+  }
+  _nodes[static_cast<size_t>(sibling)].parent = newParent;
+  _nodes[static_cast<size_t>(leaf)].parent    = newParent;
+
+  // Walk back up the tree fixing heights and boxes
+  index = _nodes[static_cast<size_t>(leaf)].parent;
+  while (index != NullNode) {
+    index = _balance(index);
+    _fitNode(index);
+    index = _nodes[static_cast<size_t>(index)].parent;
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::_removeLeaf(int leaf)
+{
+  if (leaf == _root) {
+    _root = NullNode;
+    return;
+  }
+
+  const int parent       = _nodes[static_cast<size_t>(leaf)].parent;
+  const auto& parentNode = _nodes[static_cast<size_t>(parent)];
+  const int grandParent  = parentNode.parent;
+  const int sibling
+    = (parentNode.child1 == leaf) ? parentNode.child2 : parentNode.child1;
+
+  if (grandParent != NullNode) {
+    // Destroy the parent and connect the sibling to the grand parent
+    auto& grandParentNode = _nodes[static_cast<size_t>(grandParent)];
+    if (grandParentNode.child1 == parent) {
+      grandParentNode.child1 = sibling;
+    }
+    else {
+      grandParentNode.child2 = sibling;
+    }
+    _nodes[static_cast<size_t>(sibling)].parent = grandParent;
+    _freeNode(parent);
+
+    int index = grandParent;
+    while (index != NullNode) {
+      index = _balance(index);
+      _fitNode(index);
+      index = _nodes[static_cast<size_t>(index)].parent;
+    }
+  }
+  else {
+    _root                                       = sibling;
+    _nodes[static_cast<size_t>(sibling)].parent = NullNode;
+    _freeNode(parent);
+  }
+
+  _nodes[static_cast<size_t>(leaf)].parent = NullNode;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_fitNode(int nodeId)
+{
+  auto& node         = _nodes[static_cast<size_t>(nodeId)];
+  const auto& child1 = _nodes[static_cast<size_t>(node.child1)];
+  const auto& child2 = _nodes[static_cast<size_t>(node.child2)];
+  node.height        = 1 + std::max(child1.height, child2.height);
+  node.minimum       = Vector3::Minimize(child1.minimum, child2.minimum);
+  node.maximum       = Vector3::Maximize(child1.maximum, child2.maximum);
+}
+
+template <class T>
+int DynamicAABBTree<T>::_balance(int iA)
+{
+  // Performs a left or right rotation if node A is imbalanced
+  auto A = &_nodes[static_cast<size_t>(iA)];
+  if (A->isLeaf() || A->height < 2) {
+    return iA;
+  }
+
+  const int iB = A->child1;
+  const int iC = A->child2;
+  auto B       = &_nodes[static_cast<size_t>(iB)];
+  auto C       = &_nodes[static_cast<size_t>(iC)];
+
+  const int balance = C->height - B->height;
+
+  // Rotate C up
+  if (balance > 1) {
+    const int iF = C->child1;
+    const int iG = C->child2;
+    auto F       = &_nodes[static_cast<size_t>(iF)];
+    auto G       = &_nodes[static_cast<size_t>(iG)];
+
+    // Swap A and C
+    C->child1 = iA;
+    C->parent = A->parent;
+    A->parent = iC;
+
+    // A's old parent should point to C
+    if (C->parent != NullNode) {
+      auto& cParent = _nodes[static_cast<size_t>(C->parent)];
+      if (cParent.child1 == iA) {
+        cParent.child1 = iC;
+      }
+      else {
+        cParent.child2 = iC;
+      }
+    }
+    else {
+      _root = iC;
+    }
+
+    // Rotate
+    if (F->height > G->height) {
+      C->child2 = iF;
+      A->child2 = iG;
+      G->parent = iA;
+    }
+    else {
+      C->child2 = iG;
+      A->child2 = iF;
+      F->parent = iA;
+    }
+    _fitNode(iA);
+    _fitNode(iC);
+
+    return iC;
+  }
+
+  // Rotate B up
+  if (balance < -1) {
+    const int iD = B->child1;
+    const int iE = B->child2;
+    auto D       = &_nodes[static_cast<size_t>(iD)];
+    auto E       = &_nodes[static_cast<size_t>(iE)];
+
+    // Swap A and B
+    B->child1 = iA;
+    B->parent = A->parent;
+    A->parent = iB;
+
+    // A's old parent should point to B
+    if (B->parent != NullNode) {
+      auto& bParent = _nodes[static_cast<size_t>(B->parent)];
+      if (bParent.child1 == iA) {
+        bParent.child1 = iB;
+      }
+      else {
+        bParent.child2 = iB;
+      }
+    }
+    else {
+      _root = iB;
+    }
+
+    // Rotate
+    if (D->height > E->height) {
+      B->child2 = iD;
+      A->child1 = iE;
+      E->parent = iA;
+    }
+    else {
+      B->child2 = iE;
+      A->child1 = iD;
+      D->parent = iA;
+    }
+    _fitNode(iA);
+    _fitNode(iB);
+
+    return iB;
+  }
+
+  return iA;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_collectLeaves(int nodeId,
+                                        std::vector<T>& selection) const
+{
+  // The recursion depth is bounded by the height of the balanced tree
+  const auto& node = _nodes[static_cast<size_t>(nodeId)];
+  if (node.isLeaf()) {
+    selection.emplace_back(node.data);
+  }
+  else {
+    _collectLeaves(node.child1, selection);
+    _collectLeaves(node.child2, selection);
+  }
+}
+
+template class DynamicAABBTree<AbstractMesh*>;
+template class DynamicAABBTree<SubMesh*>;
+template class DynamicAABBTree<unsigned int>;
+
+} // end of namespace BABYLON
@@ -22,7 +22,7 @@ Octree<T>::Octree(
     , _maxDepth{maxDepth}
     , _creationFunc{creationFunc}
 {
-  _selectionContent.resize(1024);
+  _selectionContent.reserve(1024);
 }
 
 template <class T>
@@ -46,21 +46,33 @@ void Octree<T>::addMesh(T& entry)
   }
 }
 
+template <class T>
+void Octree<T>::removeMesh(T& entry)
+{
+  for (auto& block : IOctreeContainer<T>::blocks) {
+    block.removeEntry(entry);
+  }
+
+  dynamicContent.erase(
+    std::remove(dynamicContent.begin(), dynamicContent.end(), entry),
+    dynamicContent.end());
+}
+
 template <class T>
 std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes,
                                   bool allowDuplicate)
 {
   _selectionContent.clear();
 
+  // Entries overlapping several blocks are collected once per block and
+  // deduplicated in a single pass instead of once per visited leaf
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.select(frustumPlanes, _selectionContent, allowDuplicate);
+    block.select(frustumPlanes, _selectionContent, true);
   }
 
-  if (allowDuplicate) {
-    std_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    std_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  std_util::concat(_selectionContent, dynamicContent);
+  if (!allowDuplicate) {
+    _removeDuplicates(_selectionContent);
   }
 
   return _selectionContent;
@@ -73,15 +85,12 @@ std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter,
   _selectionContent.clear();
 
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersects(sphereCenter, sphereRadius, _selectionContent,
-                     allowDuplicate);
+    block.intersects(sphereCenter, sphereRadius, _selectionContent, true);
   }
 
-  if (allowDuplicate) {
-    std_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    std_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  std_util::concat(_selectionContent, dynamicContent);
+  if (!allowDuplicate) {
+    _removeDuplicates(_selectionContent);
   }
 
   return _selectionContent;
@@ -96,11 +105,45 @@ std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
     block.intersectsRay(ray, _selectionContent);
   }
 
-  std_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  std_util::concat(_selectionContent, dynamicContent);
+  _removeDuplicates(_selectionContent);
 
   return _selectionContent;
 }
 
+template <class T>
+void Octree<T>::_removeDuplicates(std::vector<T>& selection)
+{
+  // Sorts the entries with their position to find the first occurrence of
+  // each one, which is kept in place so that the selection order does not
+  // depend on the entry values. The buffers are reused, nothing is allocated
+  // once they reached the size of the selection
+  _sortedSelection.clear();
+  for (size_t i = 0; i < selection.size(); ++i) {
+    _sortedSelection.emplace_back(selection[i], i);
+  }
+  std::sort(_sortedSelection.begin(), _sortedSelection.end(),
+            [](const std::pair<T, size_t>& a, const std::pair<T, size_t>& b) {
+              return std::less<T>()(a.first, b.first)
+                     || (a.first == b.first && a.second < b.second);
+            });
+
+  _firstOccurrences.assign(selection.size(), false);
+  for (size_t i = 0; i < _sortedSelection.size(); ++i) {
+    if (i == 0 || _sortedSelection[i].first != _sortedSelection[i - 1].first) {
+      _firstOccurrences[_sortedSelection[i].second] = true;
+    }
+  }
+
+  size_t count = 0;
+  for (size_t i = 0; i < selection.size(); ++i) {
+    if (_firstOccurrences[i]) {
+      selection[count++] = selection[i];
+    }
+  }
+  selection.resize(count);
+}
+
 template <class T>
 void Octree<T>::_CreateBlocks(
   const Vector3& worldMin, const Vector3& worldMax, std::vector<T>& entries,
@@ -109,6 +152,7 @@ void Octree<T>::_CreateBlocks(
   std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc)
 {
   target.blocks.clear();
+  target.blocks.reserve(8);
   Vector3 blockSize((worldMax.x - worldMin.x) / 2.f,
                     (worldMax.y - worldMin.y) / 2.f,
                     (worldMax.z - worldMin.z) / 2.f);
@@ -123,7 +167,7 @@ void Octree<T>::_CreateBlocks(
         OctreeBlock<T> block(localMin, localMax, maxBlockCapacity,
                              currentDepth + 1, maxDepth, creationFunc);
         block.addEntries(entries);
-        target.blocks.emplace_back(block);
+        target.blocks.emplace_back(std::move(block));
       }
     }
   }
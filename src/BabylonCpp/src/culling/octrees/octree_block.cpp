@@ -90,6 +90,20 @@ void OctreeBlock<T>::addEntries(std::vector<T>& _entries)
   }
 }
 
+template <class T>
+void OctreeBlock<T>::removeEntry(T& entry)
+{
+  if (!IOctreeContainer<T>::blocks.empty()) {
+    for (auto& block : IOctreeContainer<T>::blocks) {
+      block.removeEntry(entry);
+    }
+    return;
+  }
+
+  entries.erase(std::remove(entries.begin(), entries.end(), entry),
+                entries.end());
+}
+
 template <class T>
 void OctreeBlock<T>::select(const std::array<Plane, 6>& frustumPlanes,
                             std::vector<T>& selection, bool allowDuplicate)
@@ -143,7 +157,8 @@ void OctreeBlock<T>::intersectsRay(const Ray& ray, std::vector<T>& selection)
       }
       return;
     }
-    std_util::concat_with_no_duplicates(selection, entries);
+    // Deduplicated once by the octree
+    std_util::concat(selection, entries);
   }
 }
 
@@ -89,6 +89,13 @@ std::ostream& operator<<(std::ostream& os, const Ray& ray)
 // Methods
 bool Ray::intersectsBoxMinMax(const Vector3& minimum,
                               const Vector3& maximum) const
+{
+  float distance = 0.f;
+  return intersectsBoxMinMax(minimum, maximum, distance);
+}
+
+bool Ray::intersectsBoxMinMax(const Vector3& minimum, const Vector3& maximum,
+                              float& distance) const
 {
   float d        = 0.f;
   float maxValue = std::numeric_limits<float>::max();
@@ -171,6 +178,8 @@ bool Ray::intersectsBoxMinMax(const Vector3& minimum,
       return false;
     }
   }
+
+  distance = d;
   return true;
 }
 
@@ -0,0 +1,277 @@
+#include <babylon/culling/triangle_bvh.h>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+
+namespace BABYLON {
+
+constexpr size_t TriangleBVH::MaxTrianglesPerLeaf;
+
+TriangleBVH::TriangleBVH(const Float32Array& positions,
+                         const Uint32Array& indices)
+{
+  const size_t trianglesCount = indices.size() / 3;
+  if (trianglesCount == 0) {
+    return;
+  }
+
+  _faceIds.resize(trianglesCount);
+  std::vector<Vector3> centroids(trianglesCount);
+  for (size_t face = 0; face < trianglesCount; ++face) {
+    _faceIds[face] = static_cast<uint32_t>(face);
+    centroids[face]
+      = Vector3::FromArray(positions, indices[face * 3] * 3)
+          .addInPlace(Vector3::FromArray(positions, indices[face * 3 + 1] * 3))
+          .addInPlace(Vector3::FromArray(positions, indices[face * 3 + 2] * 3))
+          .scaleInPlace(1.f / 3.f);
+  }
+
+  _nodes.reserve(2 * trianglesCount / MaxTrianglesPerLeaf + 1);
+  _build(centroids, 0, static_cast<uint32_t>(trianglesCount));
+
+  // Copy the vertices in hierarchy order
+  _vertices.reserve(trianglesCount * 3);
+  for (auto face : _faceIds) {
+    for (unsigned int i = 0; i < 3; ++i) {
+      _vertices.emplace_back(
+        Vector3::FromArray(positions, indices[face * 3 + i] * 3));
+    }
+  }
+
+  // Children are stored after their parent, so a reverse pass fits the
+  // bounds bottom up
+  for (size_t nodeIndex = _nodes.size(); nodeIndex-- > 0;) {
+    auto& node = _nodes[nodeIndex];
+    if (node.count > 0) {
+      node.minimum = _vertices[node.offset * 3];
+      node.maximum = _vertices[node.offset * 3];
+      for (size_t i = node.offset * 3; i < (node.offset + node.count) * 3;
+           ++i) {
+        node.minimum.minimizeInPlace(_vertices[i]);
+        node.maximum.maximizeInPlace(_vertices[i]);
+      }
+    }
+    else {
+      const auto& left  = _nodes[nodeIndex + 1];
+      const auto& right = _nodes[node.offset];
+      node.minimum      = Vector3::Minimize(left.minimum, right.minimum);
+      node.maximum      = Vector3::Maximize(left.maximum, right.maximum);
+    }
+  }
+}
+
+TriangleBVH::~TriangleBVH()
+{
+}
+
+size_t TriangleBVH::trianglesCount() const
+{
+  return _faceIds.size();
+}
+
+size_t TriangleBVH::nodesCount() const
+{
+  return _nodes.size();
+}
+
+void TriangleBVH::_build(std::vector<Vector3>& centroids, uint32_t start,
+                         uint32_t end)
+{
+  const size_t nodeIndex = _nodes.size();
+  _nodes.emplace_back(Node());
+
+  const uint32_t count = end - start;
+  if (count <= MaxTrianglesPerLeaf) {
+    _nodes[nodeIndex].offset = start;
+    _nodes[nodeIndex].count  = count;
+    return;
+  }
+
+  Vector3 centroidMin(std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::max());
+  Vector3 centroidMax(std::numeric_limits<float>::lowest(),
+                      std::numeric_limits<float>::lowest(),
+                      std::numeric_limits<float>::lowest());
+  for (uint32_t i = start; i < end; ++i) {
+    centroidMin.minimizeInPlace(centroids[i]);
+    centroidMax.maximizeInPlace(centroids[i]);
+  }
+
+  // Median split along the largest centroid extent
+  const Vector3 extent = centroidMax.subtract(centroidMin);
+  const unsigned int axis
+    = (extent.x >= extent.y && extent.x >= extent.z) ?
+        0 :
+        ((extent.y >= extent.z) ? 1 : 2);
+  const auto component = [axis](const Vector3& v) {
+    return (axis == 0) ? v.x : ((axis == 1) ? v.y : v.z);
+  };
+
+  // Sort the face ids and their centroids together
+  std::vector<uint32_t> order(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    order[i] = start + i;
+  }
+  const uint32_t middle = count / 2;
+  std::nth_element(order.begin(), order.begin() + middle, order.end(),
+                   [&centroids, &component](uint32_t a, uint32_t b) {
+                     return component(centroids[a]) < component(centroids[b]);
+                   });
+  std::vector<uint32_t> faceIds(count);
+  std::vector<Vector3> sortedCentroids(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    faceIds[i]         = _faceIds[order[i]];
+    sortedCentroids[i] = centroids[order[i]];
+  }
+  std::copy(faceIds.begin(), faceIds.end(), _faceIds.begin() + start);
+  std::copy(sortedCentroids.begin(), sortedCentroids.end(),
+            centroids.begin() + start);
+
+  _build(centroids, start, start + middle);
+  _nodes[nodeIndex].offset = static_cast<uint32_t>(_nodes.size());
+  _nodes[nodeIndex].count  = 0;
+  _build(centroids, start + middle, end);
+}
+
+std::unique_ptr<IntersectionInfo>
+TriangleBVH::intersectsRay(Ray& ray, size_t indexStart, size_t indexEnd,
+                           bool fastCheck) const
+{
+  std::unique_ptr<IntersectionInfo> intersectInfo = nullptr;
+  if (_nodes.empty()) {
+    return intersectInfo;
+  }
+
+  float closest = std::numeric_limits<float>::max();
+  float entry   = 0.f;
+  if (!ray.intersectsBoxMinMax(_nodes[0].minimum, _nodes[0].maximum, entry)) {
+    return intersectInfo;
+  }
+
+  std::array<std::pair<uint32_t, float>, 64> stack;
+  size_t stackSize  = 0;
+  stack[stackSize++] = std::make_pair(0u, entry);
+
+  while (stackSize > 0) {
+    const auto current = stack[--stackSize];
+    if (current.second > closest) {
+      continue;
+    }
+
+    const auto& node = _nodes[current.first];
+    if (node.count > 0) {
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+        const size_t firstIndex = _faceIds[i] * 3;
+        if (firstIndex < indexStart || firstIndex >= indexEnd) {
+          continue;
+        }
+
+        auto currentIntersectInfo = ray.intersectsTriangle(
+          _vertices[i * 3], _vertices[i * 3 + 1], _vertices[i * 3 + 2]);
+        if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f
+            || currentIntersectInfo->distance >= closest) {
+          continue;
+        }
+
+        closest               = currentIntersectInfo->distance;
+        intersectInfo         = std::move(currentIntersectInfo);
+        intersectInfo->faceId = _faceIds[i];
+
+        if (fastCheck) {
+          return intersectInfo;
+        }
+      }
+      continue;
+    }
+
+    // Push the farthest child first so that the nearest one is visited first
+    const uint32_t left  = current.first + 1;
+    const uint32_t right = node.offset;
+    float leftEntry = 0.f, rightEntry = 0.f;
+    const bool hitLeft = ray.intersectsBoxMinMax(
+      _nodes[left].minimum, _nodes[left].maximum, leftEntry);
+    const bool hitRight = ray.intersectsBoxMinMax(
+      _nodes[right].minimum, _nodes[right].maximum, rightEntry);
+
+    if (hitLeft && hitRight) {
+      if (leftEntry <= rightEntry) {
+        stack[stackSize++] = std::make_pair(right, rightEntry);
+        stack[stackSize++] = std::make_pair(left, leftEntry);
+      }
+      else {
+        stack[stackSize++] = std::make_pair(left, leftEntry);
+        stack[stackSize++] = std::make_pair(right, rightEntry);
+      }
+    }
+    else if (hitLeft) {
+      stack[stackSize++] = std::make_pair(left, leftEntry);
+    }
+    else if (hitRight) {
+      stack[stackSize++] = std::make_pair(right, rightEntry);
+    }
+  }
+
+  return intersectInfo;
+}
+
+void TriangleBVH::intersectsBox(const Vector3& minimum, const Vector3& maximum,
+                                size_t indexStart, size_t indexEnd,
+                                std::vector<uint32_t>& faceIds) const
+{
+  if (_nodes.empty()
+      || !_IntersectsBox(_nodes[0].minimum, _nodes[0].maximum, minimum,
+                         maximum)) {
+    return;
+  }
+
+  std::array<uint32_t, 64> stack;
+  size_t stackSize   = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const uint32_t nodeIndex = stack[--stackSize];
+    const auto& node         = _nodes[nodeIndex];
+    if (node.count > 0) {
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+        const size_t firstIndex = _faceIds[i] * 3;
+        if (firstIndex < indexStart || firstIndex >= indexEnd) {
+          continue;
+        }
+
+        const auto& p0 = _vertices[i * 3];
+        const auto& p1 = _vertices[i * 3 + 1];
+        const auto& p2 = _vertices[i * 3 + 2];
+        if (_IntersectsBox(Vector3::Minimize(Vector3::Minimize(p0, p1), p2),
+                           Vector3::Maximize(Vector3::Maximize(p0, p1), p2),
+                           minimum, maximum)) {
+          faceIds.emplace_back(_faceIds[i]);
+        }
+      }
+      continue;
+    }
+
+    const uint32_t left  = nodeIndex + 1;
+    const uint32_t right = node.offset;
+    if (_IntersectsBox(_nodes[left].minimum, _nodes[left].maximum, minimum,
+                       maximum)) {
+      stack[stackSize++] = left;
+    }
+    if (_IntersectsBox(_nodes[right].minimum, _nodes[right].maximum, minimum,
+                       maximum)) {
+      stack[stackSize++] = right;
+    }
+  }
+}
+
+bool TriangleBVH::_IntersectsBox(const Vector3& minimum1,
+                                 const Vector3& maximum1,
+                                 const Vector3& minimum2,
+                                 const Vector3& maximum2)
+{
+  return minimum1.x <= maximum2.x && maximum1.x >= minimum2.x
+         && minimum1.y <= maximum2.y && maximum1.y >= minimum2.y
+         && minimum1.z <= maximum2.z && maximum1.z >= minimum2.z;
+}
+
+} // end of namespace BABYLON
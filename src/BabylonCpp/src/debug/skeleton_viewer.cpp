@@ -54,13 +54,13 @@ void SkeletonViewer::_getBonePosition(Vector3& position, Bone* bone,
                                       const Matrix& meshMat, float x, float y,
                                       float z) const
 {
-  auto& tmat      = Tmp::MatrixArray[0];
+  auto& tmat      = Tmp::MatrixArray()[0];
   auto parentBone = bone->getParent();
   tmat.copyFrom(bone->getLocalMatrix());
 
   if (!std_util::almost_equal(x, 0.f) || !std_util::almost_equal(y, 0.f)
       || !std_util::almost_equal(z, 0.f)) {
-    auto& tmat2 = Tmp::MatrixArray[1];
+    auto& tmat2 = Tmp::MatrixArray()[1];
     Matrix::IdentityToRef(tmat2);
     tmat2.m[12] = x;
     tmat2.m[13] = y;
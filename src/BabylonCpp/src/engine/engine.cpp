@@ -6,10 +6,14 @@
 #include <babylon/core/string.h>
 #include <babylon/core/time.h>
 #include <babylon/engine/instancing_attribute_info.h>
+#include <babylon/engine/shader_compilation_queue.h>
+#include <babylon/engine/shader_program_cache.h>
 #include <babylon/interfaces/icanvas.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/interfaces/iloading_screen.h>
 #include <babylon/materials/effect.h>
+#include <babylon/materials/effect_includes_shaders_store.h>
+#include <babylon/materials/material_defines.h>
 #include <babylon/math/color3.h>
 #include <babylon/math/color4.h>
 #include <babylon/mesh/vertex_buffer.h>
@@ -46,12 +50,15 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , cullBackFaces{true}
     , renderEvenInBackground{true}
     , enableOfflineSupport{true}
+    , disableUniformBuffers{false}
+    , asyncShaderCompilation{false}
     , _gl{nullptr}
     , _renderingCanvas{canvas}
     , _windowIsBackground{false}
     , _webGLVersion{"1.0"}
     , _badOS{false}
     , _alphaTest{false}
+    , _loadingScreen{nullptr}
     , _videoTextureSupported{false}
     , _renderingQueueLaunched{false}
     , fpsRange{60}
@@ -63,10 +70,15 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , _alphaMode{Engine::ALPHA_DISABLE}
     , _maxTextureChannels{16}
     , _currentProgram{nullptr}
+    , _shaderCompilationQueue{
+        std_util::make_unique<ShaderCompilationQueue>(this)}
+    , _shaderProgramCache{std_util::make_unique<ShaderProgramCache>()}
     , _cachedVertexBuffers{nullptr}
     , _cachedIndexBuffer{nullptr}
     , _cachedEffectForVertexBuffers{nullptr}
     , _currentRenderTarget{nullptr}
+    , _instancesWorldBuffer{nullptr}
+    , _instancesWorldBufferOffset{0}
 {
   // Checks if some of the format renders first to allow the use of webgl
   // inspector.
@@ -134,6 +146,26 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
                             GL::MAX_TEXTURE_MAX_ANISOTROPY_EXT)) :
                           0;
   _caps.instancedArrays              = nullptr;
+  if (std_util::contains(extensions, "GL_ARB_instanced_arrays")
+      || std_util::contains(extensions, "GL_ANGLE_instanced_arrays")) {
+    _instancedArrays.vertexAttribDivisorANGLE
+      = [this](unsigned int index, int divisor) {
+          _gl->vertexAttribDivisor(index, static_cast<unsigned int>(divisor));
+        };
+    _instancedArrays.drawElementsInstancedANGLE
+      = [this](unsigned int mode, int indexCount, unsigned int indexFormat,
+               unsigned int start, int instancesCount) {
+          _gl->drawElementsInstanced(mode, indexCount, indexFormat, start,
+                                     instancesCount);
+        };
+    _instancedArrays.drawArraysInstancedANGLE
+      = [this](unsigned int mode, int verticesStart, int verticesCount,
+               int instancesCount) {
+          _gl->drawArraysInstanced(mode, verticesStart, verticesCount,
+                                   instancesCount);
+        };
+    _caps.instancedArrays = &_instancedArrays;
+  }
   _caps.uintIndices                  = true;
   _caps.fragmentDepthSupported       = true;
   _caps.highPrecisionShaderSupported = true;
@@ -150,6 +182,19 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     = std_util::contains(extensions, "OES_texture_half_float_linear");
   _caps.textureHalfFloatRender = renderToHalfFloat;
 
+  _caps.uniformBuffers
+    = std_util::contains(extensions, "GL_ARB_uniform_buffer_object");
+  _caps.maxFragmentUniformBlocks
+    = _caps.uniformBuffers ?
+        _gl->getParameteri(GL::MAX_FRAGMENT_UNIFORM_BLOCKS) :
+        0;
+
+  _caps.programBinary
+    = std_util::contains(extensions, "GL_ARB_get_program_binary")
+      && (_gl->getParameteri(GL::NUM_PROGRAM_BINARY_FORMATS) > 0);
+  _caps.parallelShaderCompile
+    = std_util::contains(extensions, "GL_KHR_parallel_shader_compile");
+
   GL::IGLShaderPrecisionFormat* highp
     = _gl->getShaderPrecisionFormat(GL::FRAGMENT_SHADER, GL::HIGH_FLOAT);
   _caps.highPrecisionShaderSupported = highp ? highp->precision != 0 : false;
@@ -268,6 +313,43 @@ EngineCapabilities& Engine::getCaps()
   return _caps;
 }
 
+bool Engine::supportsUniformBuffers() const
+{
+  return _caps.uniformBuffers && !disableUniformBuffers;
+}
+
+ShaderCompilationQueue& Engine::getShaderCompilationQueue()
+{
+  return *_shaderCompilationQueue;
+}
+
+ShaderProgramCache& Engine::getShaderProgramCache()
+{
+  return *_shaderProgramCache;
+}
+
+void Engine::setShaderCacheDirectory(const std::string& directory)
+{
+  // The includes are expanded in the cached sources, so the entries written
+  // with other includes are stale
+  std::vector<std::string> includeNames;
+  for (const auto& item : EffectIncludesShadersStore::Shaders) {
+    includeNames.emplace_back(item.first);
+  }
+  std::sort(includeNames.begin(), includeNames.end());
+
+  uint64_t includesHash = ShaderProgramCache::Hash("");
+  for (const auto& includeName : includeNames) {
+    includesHash = ShaderProgramCache::Hash(
+      EffectIncludesShadersStore::Shaders[includeName],
+      ShaderProgramCache::Hash(includeName, includesHash));
+  }
+
+  std::ostringstream version;
+  version << Engine::Version() << "-" << std::hex << includesHash;
+  _shaderProgramCache->setDirectory(directory, version.str());
+}
+
 size_t Engine::drawCalls() const
 {
   return _drawCalls.current();
@@ -758,10 +840,12 @@ void Engine::updateDynamicVertexBuffer(const Engine::GLBufferPtr& vertexBuffer,
     _gl->bufferSubData(GL::ARRAY_BUFFER, offset, vertices);
   }
   else {
-    Float32Array subvector;
-    std::copy(vertices.begin() + _offset, vertices.begin() + _offset + count,
-              std::back_inserter(subvector));
-    _gl->bufferSubData(GL::ARRAY_BUFFER, 0, subvector);
+    // The count floats from the offset are uploaded to the same place
+    Float32Array subvector(vertices.begin() + _offset,
+                           vertices.begin() + _offset + count);
+    _gl->bufferSubData(GL::ARRAY_BUFFER,
+                       static_cast<GL::GLintptr>(_offset * sizeof(float)),
+                       subvector);
   }
 
   _resetVertexBufferBinding();
@@ -943,7 +1027,9 @@ void Engine::bindBuffers(
 
       if (order >= 0) {
         unsigned int _order      = static_cast<unsigned int>(order);
-        const auto& vertexBuffer = vertexBuffers.at(attributes[index]);
+        const auto it            = vertexBuffers.find(attributes[index]);
+        const auto vertexBuffer
+          = (it != vertexBuffers.end()) ? it->second : nullptr;
 
         if (!vertexBuffer) {
           if (_order + 1 <= _vertexAttribArraysEnabled.size()) {
@@ -1003,6 +1089,14 @@ bool Engine::_releaseBuffer(GL::IGLBuffer* buffer)
   --buffer->references;
 
   if (buffer->references == 0) {
+    // A new buffer may reuse the address
+    for (auto& boundBuffer : _currentBoundBuffer) {
+      if (boundBuffer.second == buffer) {
+        boundBuffer.second = nullptr;
+      }
+    }
+    std::replace(_currentUniformBuffers.begin(), _currentUniformBuffers.end(),
+                 buffer, static_cast<GL::IGLBuffer*>(nullptr));
     _gl->deleteBuffer(buffer);
     return true;
   }
@@ -1030,16 +1124,16 @@ void Engine::updateAndBindInstancesBuffer(GL::IGLBuffer* instancesBuffer,
                                           const Float32Array& data,
                                           const Uint32Array& offsetLocations)
 {
-  _gl->bindBuffer(GL::ARRAY_BUFFER, instancesBuffer);
+  bindArrayBuffer(instancesBuffer);
   _gl->bufferSubData(GL::ARRAY_BUFFER, 0, data);
 
   for (unsigned int index = 0; index < 4; ++index) {
     auto& offsetLocation = offsetLocations[index];
-    _gl->enableVertexAttribArray(offsetLocation);
-
-    if (offsetLocation > _vertexAttribArraysEnabled.size()) {
-      _gl->enableVertexAttribArray(offsetLocation);
+    if (offsetLocation >= _vertexAttribArraysEnabled.size()) {
       _vertexAttribArraysEnabled.resize(offsetLocation + 1);
+    }
+    if (!_vertexAttribArraysEnabled[offsetLocation]) {
+      _gl->enableVertexAttribArray(offsetLocation);
       _vertexAttribArraysEnabled[offsetLocation] = true;
     }
 
@@ -1055,7 +1149,7 @@ void Engine::updateAndBindInstancesBuffer(
   GL::IGLBuffer* instancesBuffer, const Float32Array& data,
   const std::vector<InstancingAttributeInfo>& offsetLocations)
 {
-  _gl->bindBuffer(GL::ARRAY_BUFFER, instancesBuffer);
+  bindArrayBuffer(instancesBuffer);
   _gl->bufferSubData(GL::ARRAY_BUFFER, 0, data);
 
   int stride = 0;
@@ -1066,13 +1160,14 @@ void Engine::updateAndBindInstancesBuffer(
   for (size_t i = 0; i < offsetLocations.size(); ++i) {
     const InstancingAttributeInfo& ai = offsetLocations[i];
 
-    if (ai.index > _vertexAttribArraysEnabled.size()) {
-      _gl->enableVertexAttribArray(ai.index);
+    if (ai.index >= _vertexAttribArraysEnabled.size()) {
       _vertexAttribArraysEnabled.resize(ai.index + 1);
+    }
+    if (!_vertexAttribArraysEnabled[ai.index]) {
+      _gl->enableVertexAttribArray(ai.index);
       _vertexAttribArraysEnabled[ai.index] = true;
     }
 
-    _gl->enableVertexAttribArray(ai.index);
     vertexAttribPointer(instancesBuffer, ai.index, ai.attributeSize,
                         ai.attribyteType, ai.normalized, stride, ai.offset);
     _caps.instancedArrays->vertexAttribDivisorANGLE(ai.index, 1);
@@ -1081,6 +1176,70 @@ void Engine::updateAndBindInstancesBuffer(
   }
 }
 
+void Engine::bindInstancesWorldMatrices(const Float32Array& matrices,
+                                        Effect* effect)
+{
+  const size_t byteSize = matrices.size() * 4;
+
+  if (!_instancesWorldBuffer || _instancesWorldBuffer->capacity < byteSize) {
+    // Grow the storage in place, the attribute pointers referencing the
+    // buffer remain valid
+    size_t capacity = 32 * 16 * 4;
+    if (_instancesWorldBuffer) {
+      capacity = _instancesWorldBuffer->capacity * 2;
+    }
+    while (capacity < byteSize) {
+      capacity *= 2;
+    }
+    if (!_instancesWorldBuffer) {
+      _instancesWorldBuffer = _gl->createBuffer();
+    }
+    _instancesWorldBuffer->capacity = static_cast<unsigned int>(capacity);
+    bindArrayBuffer(_instancesWorldBuffer.get());
+    _gl->bufferData(GL::ARRAY_BUFFER, static_cast<GL::GLsizeiptr>(capacity),
+                    GL::DYNAMIC_DRAW);
+    _instancesWorldBufferOffset = 0;
+  }
+  else if (_instancesWorldBufferOffset + byteSize
+           > _instancesWorldBuffer->capacity) {
+    _instancesWorldBufferOffset = 0;
+  }
+
+  auto buffer = _instancesWorldBuffer.get();
+  bindArrayBuffer(buffer);
+  _gl->bufferSubData(GL::ARRAY_BUFFER,
+                     static_cast<GL::GLintptr>(_instancesWorldBufferOffset),
+                     matrices);
+
+  static const std::array<const char*, 4> worldKinds{
+    {VertexBuffer::World0KindChars, VertexBuffer::World1KindChars,
+     VertexBuffer::World2KindChars, VertexBuffer::World3KindChars}};
+  for (unsigned int index = 0; index < 4; ++index) {
+    const int location = effect->getAttributeLocationByName(worldKinds[index]);
+    if (location < 0) {
+      continue;
+    }
+
+    const auto offsetLocation = static_cast<unsigned int>(location);
+    if (offsetLocation >= _vertexAttribArraysEnabled.size()) {
+      _vertexAttribArraysEnabled.resize(offsetLocation + 1);
+    }
+    if (!_vertexAttribArraysEnabled[offsetLocation]) {
+      _gl->enableVertexAttribArray(offsetLocation);
+      _vertexAttribArraysEnabled[offsetLocation] = true;
+    }
+
+    vertexAttribPointer(
+      buffer, offsetLocation, 4, GL::FLOAT, false, 64,
+      static_cast<int>(_instancesWorldBufferOffset + index * 16));
+    _caps.instancedArrays->vertexAttribDivisorANGLE(offsetLocation, 1);
+    _currentInstanceLocations.emplace_back(location);
+    _currentInstanceBuffers.emplace_back(buffer);
+  }
+
+  _instancesWorldBufferOffset += byteSize;
+}
+
 void Engine::applyStates()
 {
   _depthCullingState->apply(*_gl);
@@ -1101,11 +1260,9 @@ void Engine::draw(bool useTriangles, unsigned int indexStart, size_t indexCount,
   unsigned int mult = _uintIndicesCurrentlySet ? 4 : 2;
 
   if (instancesCount) {
-#if 0
     _caps.instancedArrays->drawElementsInstancedANGLE(
-      useTriangles ? GL::TRIANGLES : GL::LINES, indexCount, indexFormat,
-      indexStart * mult, instancesCount);
-#endif
+      useTriangles ? GL::TRIANGLES : GL::LINES, static_cast<int>(indexCount),
+      indexFormat, indexStart * mult, static_cast<int>(instancesCount));
     return;
   }
 
@@ -1149,14 +1306,79 @@ void Engine::drawUnIndexed(bool useTriangles, int verticesStart,
                   static_cast<int>(verticesCount));
 }
 
+// UBOs
+Engine::GLBufferPtr Engine::createUniformBuffer(const Float32Array& elements)
+{
+  auto ubo = _gl->createBuffer();
+  bindUniformBuffer(ubo.get());
+  _gl->bufferData(GL::UNIFORM_BUFFER, elements, GL::STATIC_DRAW);
+  bindUniformBuffer(nullptr);
+  ubo->references = 1;
+  return ubo;
+}
+
+Engine::GLBufferPtr
+Engine::createDynamicUniformBuffer(const Float32Array& elements)
+{
+  auto ubo = _gl->createBuffer();
+  bindUniformBuffer(ubo.get());
+  _gl->bufferData(GL::UNIFORM_BUFFER, elements, GL::DYNAMIC_DRAW);
+  bindUniformBuffer(nullptr);
+  ubo->references = 1;
+  return ubo;
+}
+
+void Engine::updateUniformBuffer(GL::IGLBuffer* uniformBuffer,
+                                 const Float32Array& elements)
+{
+  bindUniformBuffer(uniformBuffer);
+  _gl->bufferSubData(GL::UNIFORM_BUFFER, 0, elements);
+}
+
+void Engine::bindUniformBuffer(GL::IGLBuffer* buffer)
+{
+  bindBuffer(buffer, GL::UNIFORM_BUFFER);
+}
+
+void Engine::bindUniformBufferBase(GL::IGLBuffer* buffer, unsigned int location)
+{
+  if (location >= _currentUniformBuffers.size()) {
+    _currentUniformBuffers.resize(location + 1, nullptr);
+  }
+  else if (_currentUniformBuffers[location] == buffer) {
+    return;
+  }
+
+  _gl->bindBufferBase(GL::UNIFORM_BUFFER, location, buffer);
+  _currentUniformBuffers[location] = buffer;
+  // The generic binding point is changed as well
+  _currentBoundBuffer[GL::UNIFORM_BUFFER] = buffer;
+}
+
+void Engine::bindUniformBlock(GL::IGLProgram* program,
+                              const std::string& blockName, unsigned int index)
+{
+  const auto uniformBlockIndex = _gl->getUniformBlockIndex(program, blockName);
+  if (uniformBlockIndex != GL::INVALID_INDEX) {
+    _gl->uniformBlockBinding(program, uniformBlockIndex, index);
+  }
+}
+
 // Shaders
 void Engine::_releaseEffect(Effect* effect)
 {
   if (std_util::contains(_compiledEffects, effect->_key)) {
-    _compiledEffects.erase(effect->_key);
+    for (auto it = _compiledEffectsByDefines.begin();
+         it != _compiledEffectsByDefines.end();) {
+      it = (it->second.effect == effect) ?
+             _compiledEffectsByDefines.erase(it) :
+             std::next(it);
+    }
     if (effect->getProgram()) {
       _gl->deleteProgram(effect->getProgram());
     }
+    // Destroys the effect
+    _compiledEffects.erase(effect->_key);
   }
 }
 
@@ -1221,6 +1443,38 @@ Effect* Engine::createEffect(
   return _effect;
 }
 
+Effect* Engine::createEffect(
+  const std::string& baseName, const std::vector<std::string>& attributesNames,
+  const std::vector<std::string>& uniformsNames,
+  const std::vector<std::string>& samplers, const MaterialDefines& defines,
+  EffectFallbacks* fallbacks,
+  const std::function<void(const Effect* effect)>& onCompiled,
+  const std::function<void(const Effect* effect, const std::string& errors)>&
+    onError,
+  const std::unordered_map<std::string, unsigned int>& indexParameters)
+{
+  // The hash ignores the names of the defines and can collide, the effects
+  // found by hash are only returned for the same shader name and defines
+  const uint64_t key = defines.hash() ^ std::hash<std::string>()(baseName);
+  auto it            = _compiledEffectsByDefines.find(key);
+  if (it != _compiledEffectsByDefines.end() && it->second.baseName == baseName
+      && defines.isEqual(*it->second.defines)) {
+    return it->second.effect;
+  }
+
+  auto effect = createEffect(baseName, attributesNames, uniformsNames,
+                             samplers, defines.toString(), fallbacks,
+                             onCompiled, onError, indexParameters);
+  if (it == _compiledEffectsByDefines.end()) {
+    auto& entry    = _compiledEffectsByDefines[key];
+    entry.effect   = effect;
+    entry.baseName = baseName;
+    entry.defines  = std_util::make_unique<MaterialDefines>(defines);
+  }
+
+  return effect;
+}
+
 Effect* Engine::createEffectForParticles(
   const std::string& fragmentName,
   const std::vector<std::string>& uniformsNames,
@@ -1247,7 +1501,53 @@ std::unique_ptr<GL::IGLProgram> Engine::createShaderProgram(
   const std::string& vertexCode, const std::string& fragmentCode,
   const std::string& defines, GL::IGLRenderingContext* iGl)
 {
-  auto gl = iGl ? iGl : _gl;
+  uint64_t binaryKey = 0;
+  auto shaderProgram = createShaderProgramAsync(vertexCode, fragmentCode,
+                                                defines, binaryKey, iGl);
+
+  std::string errors;
+  if (!finalizeShaderProgram(shaderProgram, binaryKey, errors, iGl)) {
+    if (!errors.empty()) {
+      BABYLON_LOG_ERROR("Engine", errors);
+      return nullptr;
+    }
+  }
+
+  return shaderProgram;
+}
+
+std::unique_ptr<GL::IGLProgram> Engine::createShaderProgramAsync(
+  const std::string& vertexCode, const std::string& fragmentCode,
+  const std::string& defines, uint64_t& binaryKey,
+  GL::IGLRenderingContext* iGl)
+{
+  auto gl   = iGl ? iGl : _gl;
+  binaryKey = 0;
+
+  // Program binaries are only valid for the driver which produced them
+  const bool useProgramBinary = _caps.programBinary && (gl == _gl)
+                                && !_shaderProgramCache->directory().empty();
+  uint64_t programKey = 0;
+  if (useProgramBinary) {
+    programKey = ShaderProgramCache::Hash(_glVendor + _glRenderer + _glVersion);
+    programKey = ShaderProgramCache::Hash(vertexCode, programKey);
+    programKey = ShaderProgramCache::Hash(fragmentCode, programKey);
+    programKey = ShaderProgramCache::Hash(defines, programKey);
+
+    GL::GLenum binaryFormat;
+    Uint8Array binary;
+    if (_shaderProgramCache->getBinary(programKey, binaryFormat, binary)) {
+      auto shaderProgram = gl->createProgram();
+      gl->programBinary(shaderProgram.get(), binaryFormat, binary);
+      if (gl->getProgramParameter(shaderProgram.get(), GL::LINK_STATUS)) {
+        return shaderProgram;
+      }
+
+      // Rejected binary, e.g. after a driver update
+      gl->deleteProgram(shaderProgram.get());
+      _shaderProgramCache->removeBinary(programKey);
+    }
+  }
 
   auto vertexShader = Engine::CompileShader(gl, vertexCode, "vertex", defines);
   auto fragmentShader
@@ -1257,22 +1557,51 @@ std::unique_ptr<GL::IGLProgram> Engine::createShaderProgram(
   gl->attachShader(shaderProgram, vertexShader);
   gl->attachShader(shaderProgram, fragmentShader);
 
-  bool linked = gl->linkProgram(shaderProgram);
-
-  if (!linked) {
-    const std::string& error = gl->getProgramInfoLog(shaderProgram);
-    if (!error.empty()) {
-      BABYLON_LOG_ERROR("Engine", error);
-      return nullptr;
-    }
+  if (useProgramBinary) {
+    gl->programParameteri(shaderProgram.get(),
+                          GL::PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+    binaryKey = programKey;
   }
 
+  // The status is checked by finalizeShaderProgram(), the attached shaders
+  // are only deleted with the program
+  gl->linkProgram(shaderProgram);
+
   gl->deleteShader(vertexShader);
   gl->deleteShader(fragmentShader);
 
   return shaderProgram;
 }
 
+bool Engine::isShaderProgramCompleted(GL::IGLProgram* program,
+                                      GL::IGLRenderingContext* iGl)
+{
+  auto gl = iGl ? iGl : _gl;
+
+  return !_caps.parallelShaderCompile
+         || gl->getProgramParameter(program, GL::COMPLETION_STATUS_KHR);
+}
+
+bool Engine::finalizeShaderProgram(
+  const std::unique_ptr<GL::IGLProgram>& program, uint64_t binaryKey,
+  std::string& errors, GL::IGLRenderingContext* iGl)
+{
+  auto gl = iGl ? iGl : _gl;
+
+  if (!gl->getProgramParameter(program.get(), GL::LINK_STATUS)) {
+    errors = gl->getProgramInfoLog(program);
+    return false;
+  }
+
+  if (binaryKey != 0) {
+    GL::GLenum binaryFormat = 0;
+    auto binary = gl->getProgramBinary(program.get(), binaryFormat);
+    _shaderProgramCache->setBinary(binaryKey, binaryFormat, binary);
+  }
+
+  return true;
+}
+
 std::unordered_map<std::string, std::unique_ptr<GL::IGLUniformLocation>>
 Engine::getUniforms(GL::IGLProgram* shaderProgram,
                     const std::vector<std::string>& uniformsNames)
@@ -1661,6 +1990,7 @@ void Engine::wipeCaches()
   _cachedVertexBuffers          = nullptr;
   _cachedIndexBuffer            = nullptr;
   _cachedEffectForVertexBuffers = nullptr;
+  _currentUniformBuffers.clear();
 }
 
 void Engine::setSamplingMode(GL::IGLTexture* texture, unsigned int samplingMode)
@@ -2513,11 +2843,18 @@ void Engine::dispose(bool /*doNotRecurse*/)
   // Release audio engine
   // Engine::audioEngine->dispose();
 
-  // Release effects
+  // Release effects, the queued ones are never compiled
+  _shaderCompilationQueue->clear();
   for (auto& pair : _compiledEffects) {
     _gl->deleteProgram(pair.second->getProgram());
   }
 
+  // Release the shared instances buffer
+  if (_instancesWorldBuffer) {
+    _gl->deleteBuffer(_instancesWorldBuffer.get());
+    _instancesWorldBuffer.reset(nullptr);
+  }
+
   // Unbind
   unbindAllAttributes();
 
@@ -2535,7 +2872,9 @@ void Engine::displayLoadingUI()
 
 void Engine::hideLoadingUI()
 {
-  _loadingScreen->hideLoadingUI();
+  if (_loadingScreen) {
+    _loadingScreen->hideLoadingUI();
+  }
 }
 
 ILoadingScreen* Engine::loadingScreen()
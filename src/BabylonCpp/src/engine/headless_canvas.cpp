@@ -0,0 +1,63 @@
+#include <babylon/engine/headless_canvas.h>
+
+#include <babylon/engine/headless_rendering_context.h>
+
+namespace BABYLON {
+
+HeadlessCanvas::HeadlessCanvas(int iWidth, int iHeight)
+    : _headlessContext{nullptr}
+    , _context2d{std_util::make_unique<ICanvasRenderingContext2D>()}
+{
+  auto context      = std_util::make_unique<GL::HeadlessRenderingContext>();
+  _headlessContext  = context.get();
+  _renderingContext = std::move(context);
+
+  setFrameSize(iWidth, iHeight);
+  _boundingClientRect.left   = 0;
+  _boundingClientRect.top    = 0;
+  _boundingClientRect.right  = iWidth;
+  _boundingClientRect.bottom = iHeight;
+  _boundingClientRect.width  = iWidth;
+  _boundingClientRect.height = iHeight;
+}
+
+HeadlessCanvas::~HeadlessCanvas()
+{
+}
+
+ClientRect& HeadlessCanvas::getBoundingClientRect()
+{
+  return _boundingClientRect;
+}
+
+bool HeadlessCanvas::onlyRenderBoundingClientRect() const
+{
+  return false;
+}
+
+bool HeadlessCanvas::initializeContext3d()
+{
+  _initialized = _renderingContext->initialize();
+  return _initialized;
+}
+
+ICanvasRenderingContext2D* HeadlessCanvas::getContext2d()
+{
+  return _context2d.get();
+}
+
+GL::IGLRenderingContext*
+HeadlessCanvas::getContext3d(const EngineOptions& /*options*/)
+{
+  if (!_initialized) {
+    initializeContext3d();
+  }
+  return _renderingContext.get();
+}
+
+GL::HeadlessRenderingContext& HeadlessCanvas::renderingContext()
+{
+  return *_headlessContext;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,1239 @@
+#include <babylon/engine/headless_rendering_context.h>
+
+namespace BABYLON {
+namespace GL {
+
+HeadlessRenderingContext::HeadlessRenderingContext()
+    : _commandLogEnabled{true}
+    , _lastObjectId{0}
+    , _frameCount{0}
+    , _currentProgram{0}
+    , _activeTexture{TEXTURE0}
+    , _scissorBox{{0, 0, 0, 0}}
+{
+  _shaderPrecisionFormat.rangeMin  = 127;
+  _shaderPrecisionFormat.rangeMax  = 127;
+  _shaderPrecisionFormat.precision = 23;
+}
+
+HeadlessRenderingContext::~HeadlessRenderingContext()
+{
+}
+
+// -- Frame bookkeeping --
+
+void HeadlessRenderingContext::newFrame()
+{
+  _lastFrameStats = _frameStats;
+  _frameStats     = HeadlessFrameStats();
+  _commandLog.clear();
+  ++_frameCount;
+}
+
+const HeadlessFrameStats& HeadlessRenderingContext::frameStats() const
+{
+  return _frameStats;
+}
+
+const HeadlessFrameStats& HeadlessRenderingContext::lastFrameStats() const
+{
+  return _lastFrameStats;
+}
+
+size_t HeadlessRenderingContext::frameCount() const
+{
+  return _frameCount;
+}
+
+const std::vector<HeadlessCommand>&
+HeadlessRenderingContext::commandLog() const
+{
+  return _commandLog;
+}
+
+void HeadlessRenderingContext::setCommandLogEnabled(bool enabled)
+{
+  _commandLogEnabled = enabled;
+  if (!_commandLogEnabled) {
+    _commandLog.clear();
+  }
+}
+
+bool HeadlessRenderingContext::commandLogEnabled() const
+{
+  return _commandLogEnabled;
+}
+
+void HeadlessRenderingContext::_record(HeadlessCommandType type, GLenum name,
+                                       GLuint object, GLintptr size)
+{
+  ++_frameStats.commands;
+  if (_commandLogEnabled) {
+    _commandLog.emplace_back(HeadlessCommand{type, name, object, size});
+  }
+}
+
+void HeadlessRenderingContext::_recordState(GLenum name, GLuint value)
+{
+  ++_frameStats.stateChanges;
+  _record(HeadlessCommandType::STATE, name, value);
+}
+
+void HeadlessRenderingContext::_recordUniform(IGLUniformLocation* location,
+                                              size_t byteSize)
+{
+  ++_frameStats.uniformWrites;
+  _record(HeadlessCommandType::UNIFORM, _currentProgram,
+          location ? static_cast<GLuint>(location->value) : 0,
+          static_cast<GLintptr>(byteSize));
+}
+
+void HeadlessRenderingContext::_recordBufferUpload(GLenum target,
+                                                   size_t byteSize)
+{
+  ++_frameStats.bufferUploads;
+  _frameStats.bufferUploadBytes += byteSize;
+  _record(HeadlessCommandType::BUFFER, target, _boundBuffers[target],
+          static_cast<GLintptr>(byteSize));
+}
+
+GLuint HeadlessRenderingContext::_nextObjectId()
+{
+  return ++_lastObjectId;
+}
+
+// -- IGLRenderingContext --
+
+bool HeadlessRenderingContext::initialize()
+{
+  return true;
+}
+
+void HeadlessRenderingContext::backupGLState()
+{
+}
+
+void HeadlessRenderingContext::restoreGLState()
+{
+}
+
+GLenum HeadlessRenderingContext::operator[](const std::string& /*name*/)
+{
+  return 0;
+}
+
+void HeadlessRenderingContext::activeTexture(GLenum texture)
+{
+  _activeTexture = texture;
+  _record(HeadlessCommandType::BIND, TEXTURE0, texture);
+}
+
+void HeadlessRenderingContext::attachShader(
+  const std::unique_ptr<IGLProgram>& program,
+  const std::unique_ptr<IGLShader>& shader)
+{
+  if (!program || !shader) {
+    return;
+  }
+  _attachedShaders[program->value].emplace_back(
+    std_util::make_unique<IGLShader>(shader->value));
+  _record(HeadlessCommandType::PROGRAM, ATTACHED_SHADERS, program->value);
+}
+
+void HeadlessRenderingContext::bindAttribLocation(IGLProgram* program,
+                                                  GLuint index,
+                                                  const std::string& name)
+{
+  if (program) {
+    _attribLocations[program->value][name] = static_cast<GLint>(index);
+  }
+}
+
+void HeadlessRenderingContext::bindBuffer(GLenum target, IGLBuffer* buffer)
+{
+  const GLuint id       = buffer ? buffer->value : 0;
+  _boundBuffers[target] = id;
+  ++_frameStats.bufferBinds;
+  _record(HeadlessCommandType::BIND, target, id);
+}
+
+void HeadlessRenderingContext::bindBufferBase(GLenum target, GLuint index,
+                                              IGLBuffer* buffer)
+{
+  // Also binds the buffer to the generic binding point, like in GL
+  const GLuint id       = buffer ? buffer->value : 0;
+  _boundBuffers[target] = id;
+  ++_frameStats.bufferBinds;
+  _record(HeadlessCommandType::BIND, target, id, index);
+}
+
+void HeadlessRenderingContext::bindFramebuffer(GLenum target,
+                                               IGLFramebuffer* framebuffer)
+{
+  _record(HeadlessCommandType::FRAMEBUFFER, target,
+          framebuffer ? framebuffer->value : 0);
+}
+
+void HeadlessRenderingContext::bindRenderbuffer(
+  GLenum target, const std::unique_ptr<IGLRenderbuffer>& renderbuffer)
+{
+  _record(HeadlessCommandType::FRAMEBUFFER, target,
+          renderbuffer ? renderbuffer->value : 0);
+}
+
+void HeadlessRenderingContext::bindTexture(GLenum target, IGLTexture* texture)
+{
+  ++_frameStats.textureBinds;
+  _record(HeadlessCommandType::BIND, target, texture ? texture->value : 0,
+          static_cast<GLintptr>(_activeTexture - TEXTURE0));
+}
+
+void HeadlessRenderingContext::blendColor(GLclampf /*red*/,
+                                          GLclampf /*green*/,
+                                          GLclampf /*blue*/,
+                                          GLclampf /*alpha*/)
+{
+  _recordState(BLEND_COLOR);
+}
+
+void HeadlessRenderingContext::blendEquation(GLenum mode)
+{
+  _recordState(BLEND_EQUATION, mode);
+}
+
+void HeadlessRenderingContext::blendEquationSeparate(GLenum modeRGB,
+                                                     GLenum /*modeAlpha*/)
+{
+  _recordState(BLEND_EQUATION_RGB, modeRGB);
+}
+
+void HeadlessRenderingContext::blendFunc(GLenum sfactor, GLenum /*dfactor*/)
+{
+  _recordState(BLEND_SRC_RGB, sfactor);
+}
+
+void HeadlessRenderingContext::blendFuncSeparate(GLenum srcRGB,
+                                                 GLenum /*dstRGB*/,
+                                                 GLenum /*srcAlpha*/,
+                                                 GLenum /*dstAlpha*/)
+{
+  _recordState(BLEND_SRC_RGB, srcRGB);
+}
+
+void HeadlessRenderingContext::bufferData(GLenum target, GLsizeiptr size,
+                                          GLenum /*usage*/)
+{
+  _recordBufferUpload(target, static_cast<size_t>(size));
+}
+
+void HeadlessRenderingContext::bufferData(GLenum target,
+                                          const Float32Array& data,
+                                          GLenum /*usage*/)
+{
+  _recordBufferUpload(target, data.size() * sizeof(float));
+}
+
+void HeadlessRenderingContext::bufferData(GLenum target, const Int32Array& data,
+                                          GLenum /*usage*/)
+{
+  _recordBufferUpload(target, data.size() * sizeof(int32_t));
+}
+
+void HeadlessRenderingContext::bufferData(GLenum target,
+                                          const Uint16Array& data,
+                                          GLenum /*usage*/)
+{
+  _recordBufferUpload(target, data.size() * sizeof(uint16_t));
+}
+
+void HeadlessRenderingContext::bufferData(GLenum target,
+                                          const Uint32Array& data,
+                                          GLenum /*usage*/)
+{
+  _recordBufferUpload(target, data.size() * sizeof(uint32_t));
+}
+
+void HeadlessRenderingContext::bufferSubData(GLenum target,
+                                             GLintptr /*offset*/,
+                                             const Float32Array& data)
+{
+  _recordBufferUpload(target, data.size() * sizeof(float));
+}
+
+void HeadlessRenderingContext::bufferSubData(GLenum target,
+                                             GLintptr /*offset*/,
+                                             Int32Array& data)
+{
+  _recordBufferUpload(target, data.size() * sizeof(int32_t));
+}
+
+GLenum HeadlessRenderingContext::checkFramebufferStatus(GLenum /*target*/)
+{
+  return FRAMEBUFFER_COMPLETE;
+}
+
+void HeadlessRenderingContext::clear(GLuint mask)
+{
+  ++_frameStats.clears;
+  _record(HeadlessCommandType::CLEAR, mask);
+}
+
+void HeadlessRenderingContext::clearColor(GLclampf /*red*/, GLclampf /*green*/,
+                                          GLclampf /*blue*/,
+                                          GLclampf /*alpha*/)
+{
+  _recordState(COLOR_CLEAR_VALUE);
+}
+
+void HeadlessRenderingContext::clearDepth(GLclampf /*depth*/)
+{
+  _recordState(DEPTH_CLEAR_VALUE);
+}
+
+void HeadlessRenderingContext::clearStencil(GLint stencil)
+{
+  _recordState(STENCIL_CLEAR_VALUE, static_cast<GLuint>(stencil));
+}
+
+void HeadlessRenderingContext::colorMask(GLboolean red, GLboolean green,
+                                         GLboolean blue, GLboolean alpha)
+{
+  _recordState(COLOR_WRITEMASK,
+               (red ? 1u : 0u) | (green ? 2u : 0u) | (blue ? 4u : 0u)
+                 | (alpha ? 8u : 0u));
+}
+
+void HeadlessRenderingContext::compileShader(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  _record(HeadlessCommandType::PROGRAM, COMPILE_STATUS,
+          shader ? shader->value : 0);
+}
+
+void HeadlessRenderingContext::compressedTexImage2D(
+  GLenum target, GLint /*level*/, GLenum /*internalformat*/, GLint /*width*/,
+  GLint /*height*/, GLint /*border*/, const Uint8Array& pixels)
+{
+  ++_frameStats.textureUploads;
+  _frameStats.textureUploadBytes += pixels.size();
+  _record(HeadlessCommandType::TEXTURE, target, 0,
+          static_cast<GLintptr>(pixels.size()));
+}
+
+void HeadlessRenderingContext::compressedTexSubImage2D(
+  GLenum target, GLint /*level*/, GLint /*xoffset*/, GLint /*yoffset*/,
+  GLint /*width*/, GLint /*height*/, GLenum /*format*/, GLsizeiptr size)
+{
+  ++_frameStats.textureUploads;
+  _frameStats.textureUploadBytes += static_cast<size_t>(size);
+  _record(HeadlessCommandType::TEXTURE, target, 0, size);
+}
+
+void HeadlessRenderingContext::copyTexImage2D(
+  GLenum target, GLint /*level*/, GLenum /*internalformat*/, GLint /*x*/,
+  GLint /*y*/, GLint width, GLint height, GLint /*border*/)
+{
+  _record(HeadlessCommandType::TEXTURE, target, 0,
+          static_cast<GLintptr>(width) * height);
+}
+
+void HeadlessRenderingContext::copyTexSubImage2D(
+  GLenum target, GLint /*level*/, GLint /*xoffset*/, GLint /*yoffset*/,
+  GLint /*x*/, GLint /*y*/, GLint width, GLint height)
+{
+  _record(HeadlessCommandType::TEXTURE, target, 0,
+          static_cast<GLintptr>(width) * height);
+}
+
+std::unique_ptr<IGLBuffer> HeadlessRenderingContext::createBuffer()
+{
+  auto buffer = std_util::make_unique<IGLBuffer>(_nextObjectId());
+  _record(HeadlessCommandType::RESOURCE, ARRAY_BUFFER, buffer->value);
+  return buffer;
+}
+
+std::unique_ptr<IGLFramebuffer> HeadlessRenderingContext::createFramebuffer()
+{
+  auto framebuffer = std_util::make_unique<IGLFramebuffer>(_nextObjectId());
+  _record(HeadlessCommandType::RESOURCE, FRAMEBUFFER, framebuffer->value);
+  return framebuffer;
+}
+
+std::unique_ptr<IGLProgram> HeadlessRenderingContext::createProgram()
+{
+  auto program = std_util::make_unique<IGLProgram>(_nextObjectId());
+  _record(HeadlessCommandType::RESOURCE, CURRENT_PROGRAM, program->value);
+  return program;
+}
+
+std::unique_ptr<IGLRenderbuffer> HeadlessRenderingContext::createRenderbuffer()
+{
+  auto renderbuffer = std_util::make_unique<IGLRenderbuffer>(_nextObjectId());
+  _record(HeadlessCommandType::RESOURCE, RENDERBUFFER, renderbuffer->value);
+  return renderbuffer;
+}
+
+std::unique_ptr<IGLShader> HeadlessRenderingContext::createShader(GLenum type)
+{
+  auto shader = std_util::make_unique<IGLShader>(_nextObjectId());
+  _record(HeadlessCommandType::RESOURCE, type, shader->value);
+  return shader;
+}
+
+std::unique_ptr<IGLTexture> HeadlessRenderingContext::createTexture()
+{
+  auto texture = std_util::make_unique<IGLTexture>(_nextObjectId());
+  _record(HeadlessCommandType::RESOURCE, TEXTURE, texture->value);
+  return texture;
+}
+
+void HeadlessRenderingContext::cullFace(GLenum mode)
+{
+  _recordState(CULL_FACE_MODE, mode);
+}
+
+void HeadlessRenderingContext::deleteBuffer(IGLBuffer* buffer)
+{
+  if (buffer) {
+    _record(HeadlessCommandType::RESOURCE, ARRAY_BUFFER, buffer->value, -1);
+  }
+}
+
+void HeadlessRenderingContext::deleteFramebuffer(
+  const std::unique_ptr<IGLFramebuffer>& framebuffer)
+{
+  if (framebuffer) {
+    _record(HeadlessCommandType::RESOURCE, FRAMEBUFFER, framebuffer->value,
+            -1);
+  }
+}
+
+void HeadlessRenderingContext::deleteProgram(IGLProgram* program)
+{
+  if (!program) {
+    return;
+  }
+  _attachedShaders.erase(program->value);
+  _attribLocations.erase(program->value);
+  _uniformLocations.erase(program->value);
+  _uniformBlockIndices.erase(program->value);
+  if (_currentProgram == program->value) {
+    _currentProgram = 0;
+  }
+  _record(HeadlessCommandType::RESOURCE, CURRENT_PROGRAM, program->value, -1);
+}
+
+void HeadlessRenderingContext::deleteRenderbuffer(
+  const std::unique_ptr<IGLRenderbuffer>& renderbuffer)
+{
+  if (renderbuffer) {
+    _record(HeadlessCommandType::RESOURCE, RENDERBUFFER, renderbuffer->value,
+            -1);
+  }
+}
+
+void HeadlessRenderingContext::deleteShader(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  // The source is kept as long as a program references the shader, the same
+  // way a GL driver only flags attached shaders for deletion.
+  if (shader) {
+    _record(HeadlessCommandType::RESOURCE, SHADER_TYPE, shader->value, -1);
+  }
+}
+
+void HeadlessRenderingContext::deleteTexture(IGLTexture* texture)
+{
+  if (texture) {
+    _record(HeadlessCommandType::RESOURCE, TEXTURE, texture->value, -1);
+  }
+}
+
+void HeadlessRenderingContext::depthFunc(GLenum func)
+{
+  _recordState(DEPTH_FUNC, func);
+}
+
+void HeadlessRenderingContext::depthMask(GLboolean flag)
+{
+  _recordState(DEPTH_WRITEMASK, flag ? 1 : 0);
+}
+
+void HeadlessRenderingContext::depthRange(GLclampf /*zNear*/,
+                                          GLclampf /*zFar*/)
+{
+  _recordState(DEPTH_RANGE);
+}
+
+void HeadlessRenderingContext::detachShader(IGLProgram* program,
+                                            IGLShader* shader)
+{
+  if (!program || !shader) {
+    return;
+  }
+  auto& shaders = _attachedShaders[program->value];
+  shaders.erase(std::remove_if(shaders.begin(), shaders.end(),
+                               [shader](const std::unique_ptr<IGLShader>& s) {
+                                 return s->value == shader->value;
+                               }),
+                shaders.end());
+}
+
+void HeadlessRenderingContext::disable(GLenum cap)
+{
+  _enabledCaps.erase(cap);
+  _recordState(cap, 0);
+}
+
+void HeadlessRenderingContext::disableVertexAttribArray(GLuint index)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, VERTEX_ATTRIB_ARRAY_ENABLED, index,
+          0);
+}
+
+void HeadlessRenderingContext::drawArrays(GLenum mode, GLint /*first*/,
+                                          GLint count)
+{
+  ++_frameStats.drawCalls;
+  _frameStats.drawnElements += static_cast<size_t>(count);
+  _record(HeadlessCommandType::DRAW, mode, _currentProgram, count);
+}
+
+void HeadlessRenderingContext::drawElements(GLenum mode, GLint count,
+                                            GLenum /*type*/,
+                                            GLintptr /*offset*/)
+{
+  ++_frameStats.drawCalls;
+  _frameStats.drawnElements += static_cast<size_t>(count);
+  _record(HeadlessCommandType::DRAW, mode, _currentProgram, count);
+}
+
+void HeadlessRenderingContext::drawArraysInstanced(GLenum mode,
+                                                   GLint /*first*/,
+                                                   GLint count,
+                                                   GLint instanceCount)
+{
+  ++_frameStats.drawCalls;
+  ++_frameStats.instancedDrawCalls;
+  _frameStats.drawnElements += static_cast<size_t>(count * instanceCount);
+  _frameStats.drawnInstances += static_cast<size_t>(instanceCount);
+  _record(HeadlessCommandType::DRAW, mode, _currentProgram,
+          count * instanceCount);
+}
+
+void HeadlessRenderingContext::drawElementsInstanced(GLenum mode, GLint count,
+                                                     GLenum /*type*/,
+                                                     GLintptr /*offset*/,
+                                                     GLint instanceCount)
+{
+  ++_frameStats.drawCalls;
+  ++_frameStats.instancedDrawCalls;
+  _frameStats.drawnElements += static_cast<size_t>(count * instanceCount);
+  _frameStats.drawnInstances += static_cast<size_t>(instanceCount);
+  _record(HeadlessCommandType::DRAW, mode, _currentProgram,
+          count * instanceCount);
+}
+
+void HeadlessRenderingContext::enable(GLenum cap)
+{
+  _enabledCaps.insert(cap);
+  _recordState(cap, 1);
+}
+
+void HeadlessRenderingContext::enableVertexAttribArray(GLuint index)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, VERTEX_ATTRIB_ARRAY_ENABLED, index,
+          1);
+}
+
+void HeadlessRenderingContext::finish()
+{
+}
+
+void HeadlessRenderingContext::flush()
+{
+}
+
+void HeadlessRenderingContext::framebufferRenderbuffer(
+  GLenum /*target*/, GLenum attachment, GLenum /*renderbuffertarget*/,
+  const std::unique_ptr<IGLRenderbuffer>& renderbuffer)
+{
+  _record(HeadlessCommandType::FRAMEBUFFER, attachment,
+          renderbuffer ? renderbuffer->value : 0);
+}
+
+void HeadlessRenderingContext::framebufferTexture2D(GLenum /*target*/,
+                                                    GLenum attachment,
+                                                    GLenum /*textarget*/,
+                                                    IGLTexture* texture,
+                                                    GLint /*level*/)
+{
+  _record(HeadlessCommandType::FRAMEBUFFER, attachment,
+          texture ? texture->value : 0);
+}
+
+void HeadlessRenderingContext::frontFace(GLenum mode)
+{
+  _recordState(FRONT_FACE, mode);
+}
+
+void HeadlessRenderingContext::generateMipmap(GLenum target)
+{
+  _record(HeadlessCommandType::TEXTURE, target);
+}
+
+std::vector<IGLShader*>
+HeadlessRenderingContext::getAttachedShaders(IGLProgram* program)
+{
+  std::vector<IGLShader*> shaders;
+  if (program
+      && (_attachedShaders.find(program->value) != _attachedShaders.end())) {
+    for (auto& shader : _attachedShaders[program->value]) {
+      shaders.emplace_back(shader.get());
+    }
+  }
+  return shaders;
+}
+
+GLint HeadlessRenderingContext::getAttribLocation(IGLProgram* program,
+                                                  const std::string& name)
+{
+  if (!program) {
+    return -1;
+  }
+
+  auto& locations = _attribLocations[program->value];
+  if (!std_util::contains(locations, name)) {
+    locations[name] = static_cast<GLint>(locations.size());
+  }
+  return locations[name];
+}
+
+bool HeadlessRenderingContext::hasExtension(const std::string& /*extension*/)
+{
+  return false;
+}
+
+std::array<int, 3> HeadlessRenderingContext::getScissorBoxParameter()
+{
+  return {{_scissorBox[0], _scissorBox[1], _scissorBox[2]}};
+}
+
+GLint HeadlessRenderingContext::getParameteri(GLenum pname)
+{
+  switch (pname) {
+    case MAX_TEXTURE_IMAGE_UNITS:
+    case MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+    case MAX_VERTEX_TEXTURE_IMAGE_UNITS:
+      return 16;
+    case MAX_TEXTURE_SIZE:
+    case MAX_CUBE_MAP_TEXTURE_SIZE:
+    case MAX_RENDERBUFFER_SIZE:
+      return 16384;
+    case MAX_VERTEX_ATTRIBS:
+      return 16;
+    case MAX_VERTEX_UNIFORM_VECTORS:
+    case MAX_FRAGMENT_UNIFORM_VECTORS:
+      return 1024;
+    case MAX_VARYING_VECTORS:
+      return 32;
+    case MAX_TEXTURE_MAX_ANISOTROPY_EXT:
+      return 16;
+    case CURRENT_PROGRAM:
+      return static_cast<GLint>(_currentProgram);
+    case ACTIVE_TEXTURE:
+      return static_cast<GLint>(_activeTexture);
+    case ARRAY_BUFFER_BINDING:
+      return static_cast<GLint>(_boundBuffers[ARRAY_BUFFER]);
+    case ELEMENT_ARRAY_BUFFER_BINDING:
+      return static_cast<GLint>(_boundBuffers[ELEMENT_ARRAY_BUFFER]);
+    case UNIFORM_BUFFER_BINDING:
+      return static_cast<GLint>(_boundBuffers[UNIFORM_BUFFER]);
+    case MAX_FRAGMENT_UNIFORM_BLOCKS:
+      return 12;
+    case MAX_UNIFORM_BUFFER_BINDINGS:
+      return 36;
+    default:
+      return 0;
+  }
+}
+
+GLfloat HeadlessRenderingContext::getParameterf(GLenum pname)
+{
+  return static_cast<GLfloat>(getParameteri(pname));
+}
+
+std::string HeadlessRenderingContext::getString(GLenum pname)
+{
+  switch (pname) {
+    case VENDOR:
+      return "BabylonCpp";
+    case RENDERER:
+      return "Headless";
+    case VERSION:
+      return "OpenGL ES 2.0 (Headless)";
+    case SHADING_LANGUAGE_VERSION:
+      return "OpenGL ES GLSL ES 1.00";
+    case EXTENSIONS:
+      return "GL_ARB_instanced_arrays GL_ARB_uniform_buffer_object "
+             "GL_KHR_parallel_shader_compile";
+    default:
+      return "";
+  }
+}
+
+GLint HeadlessRenderingContext::getTexParameteri(GLenum /*pname*/)
+{
+  return 0;
+}
+
+GLfloat HeadlessRenderingContext::getTexParameterf(GLenum /*pname*/)
+{
+  return 0.f;
+}
+
+GLenum HeadlessRenderingContext::getError()
+{
+  return 0;
+}
+
+const char* HeadlessRenderingContext::getErrorString(GLenum /*err*/)
+{
+  return "";
+}
+
+GLint HeadlessRenderingContext::getProgramParameter(IGLProgram* program,
+                                                    GLenum pname)
+{
+  switch (pname) {
+    case LINK_STATUS:
+    case VALIDATE_STATUS:
+    case COMPLETION_STATUS_KHR:
+      return 1;
+    case DELETE_STATUS:
+      return 0;
+    case ATTACHED_SHADERS:
+      return (program
+              && (_attachedShaders.find(program->value)
+                  != _attachedShaders.end())) ?
+               static_cast<GLint>(_attachedShaders[program->value].size()) :
+               0;
+    case ACTIVE_ATTRIBUTES:
+      return program ? static_cast<GLint>(
+                         _attribLocations[program->value].size()) :
+                       0;
+    case ACTIVE_UNIFORMS:
+      return program ? static_cast<GLint>(
+                         _uniformLocations[program->value].size()) :
+                       0;
+    default:
+      return 0;
+  }
+}
+
+Uint8Array HeadlessRenderingContext::getProgramBinary(IGLProgram* /*program*/,
+                                                      GLenum& binaryFormat)
+{
+  // No binary format is supported, see NUM_PROGRAM_BINARY_FORMATS
+  binaryFormat = 0;
+  return Uint8Array();
+}
+
+std::string HeadlessRenderingContext::getProgramInfoLog(
+  const std::unique_ptr<IGLProgram>& /*program*/)
+{
+  return "";
+}
+
+any HeadlessRenderingContext::getRenderbufferParameter(GLenum /*target*/,
+                                                       GLenum /*pname*/)
+{
+  return nullptr;
+}
+
+GLint HeadlessRenderingContext::getShaderParameter(
+  const std::unique_ptr<IGLShader>& /*shader*/, GLenum pname)
+{
+  return (pname == COMPILE_STATUS) ? 1 : 0;
+}
+
+IGLShaderPrecisionFormat*
+HeadlessRenderingContext::getShaderPrecisionFormat(GLenum /*shadertype*/,
+                                                   GLenum /*precisiontype*/)
+{
+  return &_shaderPrecisionFormat;
+}
+
+std::string HeadlessRenderingContext::getShaderInfoLog(
+  const std::unique_ptr<IGLShader>& /*shader*/)
+{
+  return "";
+}
+
+std::string HeadlessRenderingContext::getShaderSource(IGLShader* shader)
+{
+  if (shader && (_shaderSources.find(shader->value) != _shaderSources.end())) {
+    return _shaderSources[shader->value];
+  }
+  return "";
+}
+
+GLuint HeadlessRenderingContext::getUniformBlockIndex(
+  IGLProgram* program, const std::string& uniformBlockName)
+{
+  if (!program) {
+    return INVALID_INDEX;
+  }
+
+  auto& indices = _uniformBlockIndices[program->value];
+  if (!std_util::contains(indices, uniformBlockName)) {
+    indices[uniformBlockName] = static_cast<GLuint>(indices.size());
+  }
+  return indices[uniformBlockName];
+}
+
+std::unique_ptr<IGLUniformLocation>
+HeadlessRenderingContext::getUniformLocation(IGLProgram* program,
+                                             const std::string& name)
+{
+  if (!program) {
+    return nullptr;
+  }
+
+  auto& locations = _uniformLocations[program->value];
+  if (!std_util::contains(locations, name)) {
+    locations[name] = static_cast<GLint>(locations.size());
+  }
+  return std_util::make_unique<IGLUniformLocation>(locations[name]);
+}
+
+void HeadlessRenderingContext::hint(GLenum target, GLenum mode)
+{
+  _recordState(target, mode);
+}
+
+GLboolean HeadlessRenderingContext::isBuffer(IGLBuffer* buffer)
+{
+  return buffer != nullptr;
+}
+
+GLboolean HeadlessRenderingContext::isEnabled(GLenum cap)
+{
+  return (_enabledCaps.find(cap) != _enabledCaps.end());
+}
+
+GLboolean HeadlessRenderingContext::isFramebuffer(IGLFramebuffer* framebuffer)
+{
+  return framebuffer != nullptr;
+}
+
+GLboolean
+HeadlessRenderingContext::isProgram(const std::unique_ptr<IGLProgram>& program)
+{
+  return program != nullptr;
+}
+
+GLboolean
+HeadlessRenderingContext::isRenderbuffer(IGLRenderbuffer* renderbuffer)
+{
+  return renderbuffer != nullptr;
+}
+
+GLboolean HeadlessRenderingContext::isShader(IGLShader* shader)
+{
+  return shader != nullptr;
+}
+
+GLboolean HeadlessRenderingContext::isTexture(IGLTexture* texture)
+{
+  return texture != nullptr;
+}
+
+void HeadlessRenderingContext::lineWidth(GLfloat /*width*/)
+{
+  _recordState(LINE_WIDTH);
+}
+
+bool HeadlessRenderingContext::linkProgram(
+  const std::unique_ptr<IGLProgram>& program)
+{
+  if (!program) {
+    return false;
+  }
+  _record(HeadlessCommandType::PROGRAM, LINK_STATUS, program->value);
+  return true;
+}
+
+void HeadlessRenderingContext::pixelStorei(GLenum pname, GLint param)
+{
+  _recordState(pname, static_cast<GLuint>(param));
+}
+
+void HeadlessRenderingContext::polygonOffset(GLfloat /*factor*/,
+                                             GLfloat /*units*/)
+{
+  _recordState(POLYGON_OFFSET_FACTOR);
+}
+
+void HeadlessRenderingContext::programBinary(IGLProgram* program,
+                                             GLenum binaryFormat,
+                                             const Uint8Array& binary)
+{
+  if (!program) {
+    return;
+  }
+  _record(HeadlessCommandType::PROGRAM, binaryFormat, program->value,
+          static_cast<GLintptr>(binary.size()));
+}
+
+void HeadlessRenderingContext::programParameteri(IGLProgram* /*program*/,
+                                                 GLenum pname, GLint value)
+{
+  _recordState(pname, static_cast<GLuint>(value));
+}
+
+void HeadlessRenderingContext::readPixels(GLint /*x*/, GLint /*y*/,
+                                          GLint width, GLint height,
+                                          GLenum /*format*/, GLenum /*type*/,
+                                          Uint8Array& pixels)
+{
+  const size_t byteSize
+    = static_cast<size_t>(std::max(width, 0) * std::max(height, 0) * 4);
+  if (pixels.size() < byteSize) {
+    pixels.resize(byteSize);
+  }
+  std::fill(pixels.begin(), pixels.end(), 0);
+  _record(HeadlessCommandType::FRAMEBUFFER, PACK_ALIGNMENT, 0,
+          static_cast<GLintptr>(byteSize));
+}
+
+void HeadlessRenderingContext::renderbufferStorage(GLenum target,
+                                                   GLenum internalformat,
+                                                   GLint width, GLint height)
+{
+  _record(HeadlessCommandType::FRAMEBUFFER, target, internalformat,
+          static_cast<GLintptr>(width) * height);
+}
+
+void HeadlessRenderingContext::sampleCoverage(GLclampf /*value*/,
+                                              GLboolean invert)
+{
+  _recordState(SAMPLE_COVERAGE, invert ? 1 : 0);
+}
+
+void HeadlessRenderingContext::scissor(GLint x, GLint y, GLint width,
+                                       GLint height)
+{
+  _scissorBox = {{x, y, width, height}};
+  _recordState(SCISSOR_BOX);
+}
+
+void HeadlessRenderingContext::shaderSource(
+  const std::unique_ptr<IGLShader>& shader, const std::string& source)
+{
+  if (shader) {
+    _shaderSources[shader->value] = source;
+    _record(HeadlessCommandType::PROGRAM, SHADER_TYPE, shader->value,
+            static_cast<GLintptr>(source.size()));
+  }
+}
+
+void HeadlessRenderingContext::stencilFunc(GLenum func, GLint /*ref*/,
+                                           GLuint /*mask*/)
+{
+  _recordState(STENCIL_FUNC, func);
+}
+
+void HeadlessRenderingContext::stencilFuncSeparate(GLenum /*face*/,
+                                                   GLenum func, GLint /*ref*/,
+                                                   GLuint /*mask*/)
+{
+  _recordState(STENCIL_FUNC, func);
+}
+
+void HeadlessRenderingContext::stencilMask(GLuint mask)
+{
+  _recordState(STENCIL_WRITEMASK, mask);
+}
+
+void HeadlessRenderingContext::stencilMaskSeparate(GLenum /*face*/,
+                                                   GLuint mask)
+{
+  _recordState(STENCIL_WRITEMASK, mask);
+}
+
+void HeadlessRenderingContext::stencilOp(GLenum fail, GLenum /*zfail*/,
+                                         GLenum /*zpass*/)
+{
+  _recordState(STENCIL_FAIL, fail);
+}
+
+void HeadlessRenderingContext::stencilOpSeparate(GLenum /*face*/, GLenum fail,
+                                                 GLenum /*zfail*/,
+                                                 GLenum /*zpass*/)
+{
+  _recordState(STENCIL_FAIL, fail);
+}
+
+void HeadlessRenderingContext::texImage2D(GLenum target, GLint /*level*/,
+                                          GLint /*internalformat*/,
+                                          GLint width, GLint height,
+                                          GLint /*border*/, GLenum /*format*/,
+                                          GLenum /*type*/,
+                                          const Uint8Array& pixels)
+{
+  const size_t byteSize
+    = pixels.empty() ? static_cast<size_t>(width * height * 4) : pixels.size();
+  ++_frameStats.textureUploads;
+  _frameStats.textureUploadBytes += byteSize;
+  _record(HeadlessCommandType::TEXTURE, target, 0,
+          static_cast<GLintptr>(byteSize));
+}
+
+void HeadlessRenderingContext::texParameterf(GLenum /*target*/, GLenum pname,
+                                             GLfloat /*param*/)
+{
+  _recordState(pname);
+}
+
+void HeadlessRenderingContext::texParameteri(GLenum /*target*/, GLenum pname,
+                                             GLint param)
+{
+  _recordState(pname, static_cast<GLuint>(param));
+}
+
+void HeadlessRenderingContext::texSubImage2D(GLenum target, GLint /*level*/,
+                                             GLint /*xoffset*/,
+                                             GLint /*yoffset*/, GLint width,
+                                             GLint height, GLenum /*format*/,
+                                             GLenum /*type*/, any /*pixels*/)
+{
+  const size_t byteSize = static_cast<size_t>(width * height * 4);
+  ++_frameStats.textureUploads;
+  _frameStats.textureUploadBytes += byteSize;
+  _record(HeadlessCommandType::TEXTURE, target, 0,
+          static_cast<GLintptr>(byteSize));
+}
+
+void HeadlessRenderingContext::uniform1f(IGLUniformLocation* location,
+                                         GLfloat /*x*/)
+{
+  _recordUniform(location, sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform1fv(GL::IGLUniformLocation* uniform,
+                                          const Float32Array& array)
+{
+  _recordUniform(uniform, array.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform1i(IGLUniformLocation* location,
+                                         GLint /*x*/)
+{
+  _recordUniform(location, sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform1iv(IGLUniformLocation* location,
+                                          const Int32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform2f(IGLUniformLocation* location,
+                                         GLfloat /*x*/, GLfloat /*y*/)
+{
+  _recordUniform(location, 2 * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform2fv(IGLUniformLocation* location,
+                                          const Float32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform2i(IGLUniformLocation* location,
+                                         GLint /*x*/, GLint /*y*/)
+{
+  _recordUniform(location, 2 * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform2iv(IGLUniformLocation* location,
+                                          const Int32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform3f(IGLUniformLocation* location,
+                                         GLfloat /*x*/, GLfloat /*y*/,
+                                         GLfloat /*z*/)
+{
+  _recordUniform(location, 3 * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform3fv(IGLUniformLocation* location,
+                                          const Float32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform3i(IGLUniformLocation* location,
+                                         GLint /*x*/, GLint /*y*/,
+                                         GLint /*z*/)
+{
+  _recordUniform(location, 3 * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform3iv(IGLUniformLocation* location,
+                                          const Int32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform4f(IGLUniformLocation* location,
+                                         GLfloat /*x*/, GLfloat /*y*/,
+                                         GLfloat /*z*/, GLfloat /*w*/)
+{
+  _recordUniform(location, 4 * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform4fv(IGLUniformLocation* location,
+                                          const Float32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniform4i(IGLUniformLocation* location,
+                                         GLint /*x*/, GLint /*y*/, GLint /*z*/,
+                                         GLint /*w*/)
+{
+  _recordUniform(location, 4 * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniform4iv(IGLUniformLocation* location,
+                                          const Int32Array& v)
+{
+  _recordUniform(location, v.size() * sizeof(GLint));
+}
+
+void HeadlessRenderingContext::uniformBlockBinding(IGLProgram* program,
+                                                   GLuint /*uniformBlockIndex*/,
+                                                   GLuint uniformBlockBinding)
+{
+  _record(HeadlessCommandType::PROGRAM, UNIFORM_BUFFER_BINDING,
+          program ? program->value : 0, uniformBlockBinding);
+}
+
+void HeadlessRenderingContext::uniformMatrix2fv(IGLUniformLocation* location,
+                                                GLboolean /*transpose*/,
+                                                const Float32Array& value)
+{
+  _recordUniform(location, value.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniformMatrix3fv(IGLUniformLocation* location,
+                                                GLboolean /*transpose*/,
+                                                const Float32Array& value)
+{
+  _recordUniform(location, value.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniformMatrix4fv(IGLUniformLocation* location,
+                                                GLboolean /*transpose*/,
+                                                const Float32Array& value)
+{
+  _recordUniform(location, value.size() * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::uniformMatrix4fv(
+  IGLUniformLocation* location, GLboolean /*transpose*/,
+  const std::array<float, 16>& /*value*/)
+{
+  _recordUniform(location, 16 * sizeof(GLfloat));
+}
+
+void HeadlessRenderingContext::useProgram(IGLProgram* program)
+{
+  _currentProgram = program ? program->value : 0;
+  ++_frameStats.programChanges;
+  _record(HeadlessCommandType::PROGRAM, CURRENT_PROGRAM, _currentProgram);
+}
+
+void HeadlessRenderingContext::validateProgram(IGLProgram* program)
+{
+  _record(HeadlessCommandType::PROGRAM, VALIDATE_STATUS,
+          program ? program->value : 0);
+}
+
+void HeadlessRenderingContext::vertexAttrib1f(GLuint indx, GLfloat /*x*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 1);
+}
+
+void HeadlessRenderingContext::vertexAttrib1fv(GLuint indx,
+                                               Float32Array& /*values*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 1);
+}
+
+void HeadlessRenderingContext::vertexAttrib2f(GLuint indx, GLfloat /*x*/,
+                                              GLfloat /*y*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 2);
+}
+
+void HeadlessRenderingContext::vertexAttrib2fv(GLuint indx,
+                                               Float32Array& /*values*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 2);
+}
+
+void HeadlessRenderingContext::vertexAttrib3f(GLuint indx, GLfloat /*x*/,
+                                              GLfloat /*y*/, GLfloat /*z*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 3);
+}
+
+void HeadlessRenderingContext::vertexAttrib3fv(GLuint indx,
+                                               Float32Array& /*values*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 3);
+}
+
+void HeadlessRenderingContext::vertexAttrib4f(GLuint indx, GLfloat /*x*/,
+                                              GLfloat /*y*/, GLfloat /*z*/,
+                                              GLfloat /*w*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 4);
+}
+
+void HeadlessRenderingContext::vertexAttrib4fv(GLuint indx,
+                                               Float32Array& /*values*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, CURRENT_VERTEX_ATTRIB, indx, 4);
+}
+
+void HeadlessRenderingContext::vertexAttribPointer(GLuint indx, GLint size,
+                                                   GLenum /*type*/,
+                                                   GLboolean /*normalized*/,
+                                                   GLint /*stride*/,
+                                                   GLintptr /*offset*/)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, VERTEX_ATTRIB_ARRAY_POINTER, indx,
+          size);
+}
+
+void HeadlessRenderingContext::vertexAttribDivisor(GLuint index,
+                                                   GLuint divisor)
+{
+  _record(HeadlessCommandType::ATTRIBUTE, VERTEX_ATTRIB_ARRAY_DIVISOR, index,
+          divisor);
+}
+
+void HeadlessRenderingContext::viewport(GLint /*x*/, GLint /*y*/, GLint width,
+                                        GLint height)
+{
+  _recordState(VIEWPORT, static_cast<GLuint>(width * height));
+}
+
+} // end of namespace GL
+} // end of namespace BABYLON
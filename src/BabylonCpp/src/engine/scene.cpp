@@ -11,13 +11,17 @@
 #include <babylon/collisions/collision_coordinator_legacy.h>
 #include <babylon/collisions/collision_coordinator_worker.h>
 #include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/collisions/picking_info.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
 #include <babylon/culling/ray.h>
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/pointer_event_types.h>
+#include <babylon/engine/shader_compilation_queue.h>
 #include <babylon/interfaces/icanvas.h>
 #include <babylon/layer/highlight_layer.h>
 #include <babylon/layer/layer.h>
@@ -30,9 +34,11 @@
 #include <babylon/materials/standard_material.h>
 #include <babylon/materials/textures/procedurals/procedural_texture.h>
 #include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/math/frustum.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/geometry.h>
+#include <babylon/mesh/mesh.h>
 #include <babylon/mesh/simplification/simplification_queue.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
@@ -46,10 +52,25 @@
 #include <babylon/rendering/outline_renderer.h>
 #include <babylon/rendering/rendering_manager.h>
 #include <babylon/sprites/sprite_manager.h>
+#include <babylon/tools/file_loader.h>
 #include <babylon/tools/tools.h>
 
 namespace BABYLON {
 
+namespace {
+// Number of meshes evaluated per task in the parallel evaluation
+const size_t evaluationChunkSize = 32;
+// Result of the first, possibly parallel, part of the evaluation of a mesh
+enum EvaluationState : uint8_t {
+  EVALUATION_BLOCKED,         // Not counted, not evaluated
+  EVALUATION_SKIPPED,         // Not ready or not enabled
+  EVALUATION_HIDDEN,          // Invisible or out of the frustum
+  EVALUATION_SELECTED,        // Visible and in the frustum
+  EVALUATION_FRUSTUM_PENDING, // Frustum test to run on the calling thread
+  EVALUATION_FRUSTUM_BATCHED  // Visible, in the batched frustum test
+};
+} // end of anonymous namespace
+
 microseconds_t Scene::MinDeltaTime = std::chrono::milliseconds(1);
 microseconds_t Scene::MaxDeltaTime = std::chrono::milliseconds(1000);
 
@@ -111,6 +132,9 @@ Scene::Scene(Engine* engine)
     , _transformMatrix{Matrix::Zero()}
     , _frustumPlanesSet{false}
     , _selectionOctree{nullptr}
+    , _selectionTree{nullptr}
+    , _evaluationPool{nullptr}
+    , _deferSelectionTreeUpdates{false}
     , _pointerOverMesh{nullptr}
     , _pointerOverSprite{nullptr}
     , _debugLayer{nullptr}
@@ -133,6 +157,13 @@ Scene::Scene(Engine* engine)
 
   _outlineRenderer = std_util::make_unique<OutlineRenderer>(this);
 
+  // Scene uniform block
+  _sceneUbo = std_util::make_unique<UniformBuffer>(_engine);
+  _sceneUbo->addUniform("viewProjection", 16);
+  _sceneUbo->addUniform("view", 16);
+  _sceneUbo->addUniform("vEyePosition", 3);
+  _sceneUbo->create();
+
   attachControl();
 
   mainSoundTrack = std_util::make_unique<SoundTrack>(this, true);
@@ -220,6 +251,11 @@ void Scene::resetClipPlane()
 void Scene::setMirroredCameraPosition(const Vector3& newPosition)
 {
   _mirroredCameraPosition = std_util::make_unique<Vector3>(newPosition);
+
+  if (_sceneUbo->useUbo()) {
+    _sceneUbo->updateVector3("vEyePosition", newPosition);
+    _sceneUbo->update();
+  }
 }
 
 StandardMaterial* Scene::defaultMaterial()
@@ -355,6 +391,16 @@ PerfCounter& Scene::activeBonesPerfCounter()
   return _activeBones;
 }
 
+size_t Scene::getCulledCandidates() const
+{
+  return _culledCandidates.current();
+}
+
+PerfCounter& Scene::culledCandidatesPerfCounter()
+{
+  return _culledCandidates;
+}
+
 microsecond_t Scene::getLastFrameDuration() const
 {
   return microsecond_t(_lastFrameDuration.current());
@@ -420,6 +466,11 @@ int Scene::getRenderId() const
   return _renderId;
 }
 
+unsigned int Scene::getUniqueId()
+{
+  return _uniqueIdCounter++;
+}
+
 void Scene::incrementRenderId()
 {
   ++_renderId;
@@ -1037,8 +1088,26 @@ void Scene::_animate(const millisecond_t& /*delay*/)
   // Getting time
   auto delay = Time::fpTimeSince<size_t, std::milli>(_animationStartDate);
 
-  for (auto& activeAnimatable : _activeAnimatables) {
-    activeAnimatable->_animate(std::chrono::milliseconds(delay));
+  // The animatables are removed from the active ones when they end
+  _evaluatedAnimatables = _activeAnimatables;
+  if (!_evaluationPool) {
+    for (auto& animatable : _evaluatedAnimatables) {
+      animatable->_animate(std::chrono::milliseconds(delay));
+    }
+    return;
+  }
+
+  // Each animatable evaluates all its animations in one job, the events can
+  // modify the scene and are run afterwards, in order
+  _evaluationPool->parallelFor(
+    _evaluatedAnimatables.size(), evaluationChunkSize,
+    [this, delay](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        _evaluatedAnimatables[i]->_evaluate(std::chrono::milliseconds(delay));
+      }
+    });
+  for (auto& animatable : _evaluatedAnimatables) {
+    animatable->_endAnimate();
   }
 }
 
@@ -1076,6 +1145,23 @@ void Scene::setTransformMatrix(Matrix& view, Matrix& projection)
   else {
     Frustum::GetPlanesToRef(_transformMatrix, _frustumPlanes);
   }
+
+  if (_sceneUbo->useUbo()) {
+    _sceneUbo->updateMatrix("viewProjection", _transformMatrix);
+    _sceneUbo->updateMatrix("view", _viewMatrix);
+    if (_mirroredCameraPosition) {
+      _sceneUbo->updateVector3("vEyePosition", *_mirroredCameraPosition);
+    }
+    else if (activeCamera) {
+      _sceneUbo->updateVector3("vEyePosition", activeCamera->position);
+    }
+    _sceneUbo->update();
+  }
+}
+
+UniformBuffer* Scene::getSceneUniformBuffer()
+{
+  return _sceneUbo.get();
 }
 
 void Scene::addMesh(std::unique_ptr<AbstractMesh>&& newMesh)
@@ -1084,6 +1170,17 @@ void Scene::addMesh(std::unique_ptr<AbstractMesh>&& newMesh)
   auto _newMesh     = newMesh.get();
   meshes.emplace_back(std::move(newMesh));
 
+  // Meshes added after the selection octree was built are always candidates
+  // until the next call to createOrUpdateSelectionOctree
+  if (_selectionOctree) {
+    _selectionOctree->dynamicContent.emplace_back(_newMesh);
+    _meshesAddedSinceOctreeUpdate.emplace_back(_newMesh);
+  }
+
+  if (_selectionTree) {
+    _addToSelectionTree(_newMesh);
+  }
+
   // notify the collision coordinator
   collisionCoordinator->onMeshAdded(_newMesh);
 
@@ -1098,6 +1195,13 @@ int Scene::removeMesh(AbstractMesh* toRemove)
                      return mesh.get() == toRemove;
                    });
   int index = static_cast<int>(it - meshes.begin());
+  if (_selectionOctree) {
+    _selectionOctree->removeMesh(toRemove);
+    std_util::erase(_meshesAddedSinceOctreeUpdate, toRemove);
+  }
+  if (_selectionTree) {
+    _removeFromSelectionTree(toRemove);
+  }
   if (it != meshes.end()) {
     meshes.erase(it);
   }
@@ -1610,10 +1714,13 @@ std::string Scene::uid()
   return _uid;
 }
 
-void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh)
+void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh,
+                             int isInFrustum)
 {
+  // Frustum test not run yet (-1), or run in a batch
   if (mesh->alwaysSelectAsActiveMesh || mesh->subMeshes.size() == 1
-      || subMesh->isInFrustum(_frustumPlanes)) {
+      || ((isInFrustum < 0) ? subMesh->isInFrustum(_frustumPlanes) :
+                              (isInFrustum > 0))) {
     auto material = subMesh->getMaterial();
 
     if (mesh->showSubMeshesBoundingBox) {
@@ -1671,78 +1778,268 @@ void Scene::_evaluateActiveMeshes()
   }
 
   // Meshes
-  std::vector<AbstractMesh*> _meshes;
-
-  if (_selectionOctree) { // Octree
-    _meshes = _selectionOctree->select(_frustumPlanes);
+  if (_selectionTree) { // Selection tree
+    // Meshes outside of the frustum are not evaluated, so the bounds of the
+    // ones that can move are refreshed here to keep the tree up to date
+    if (_evaluationPool) {
+      // The tree is not thread safe, the proxies are moved afterwards
+      _deferSelectionTreeUpdates = true;
+      _computeWorldMatricesInParallel(_selectionTreeMovableMeshes);
+      _deferSelectionTreeUpdates = false;
+      for (auto& mesh : _selectionTreeMovableMeshes) {
+        _updateSelectionTreeProxy(mesh);
+      }
+    }
+    else {
+      for (auto& mesh : _selectionTreeMovableMeshes) {
+        mesh->computeWorldMatrix();
+      }
+    }
+    _selectionTreeContent.clear();
+    _selectionTree->select(_frustumPlanes, _selectionTreeContent);
+    _culledCandidates.addCount(
+      _selectionTree->size() - _selectionTreeContent.size(), false);
+    _evaluationCandidates = _selectionTreeContent;
+    _evaluationCandidates.insert(_evaluationCandidates.end(),
+                                 _selectionTreeAlwaysSelected.begin(),
+                                 _selectionTreeAlwaysSelected.end());
+    _evaluateActiveMeshesInBatch(_evaluationCandidates);
+  }
+  else if (_selectionOctree) { // Octree
+    const auto& selection = _selectionOctree->select(_frustumPlanes, false);
+    if (selection.size() < meshes.size()) {
+      _culledCandidates.addCount(meshes.size() - selection.size(),
+                                       false);
+    }
+    _evaluateActiveMeshesInBatch(selection);
   }
   else { // Full scene traversal
-    _meshes = getMeshes();
+    _evaluationCandidates.clear();
+    for (auto& mesh : meshes) {
+      _evaluationCandidates.emplace_back(mesh.get());
+    }
+    _evaluateActiveMeshesInBatch(_evaluationCandidates);
   }
 
-  for (auto& mesh : meshes) {
-    if (mesh->isBlocked()) {
-      continue;
+  // Particle systems
+  _particlesDuration.beginMonitoring();
+  if (particlesEnabled) {
+    Tools::StartPerformanceCounter("Particles", !particleSystems.empty());
+    for (auto& particleSystem : particleSystems) {
+      if (!particleSystem->isStarted()) {
+        continue;
+      }
+
+      if (particleSystem->emitter && particleSystem->emitter->isEnabled()) {
+        _activeParticleSystems.emplace_back(particleSystem.get());
+      }
     }
+    _animateParticleSystems();
+    Tools::EndPerformanceCounter("Particles", !particleSystems.empty());
+  }
+  _particlesDuration.endMonitoring(false);
+}
 
-    _totalVertices.addCount(mesh->getTotalVertices(), false);
+void Scene::_animateParticleSystems()
+{
+  if (!_evaluationPool) {
+    for (auto& particleSystem : _activeParticleSystems) {
+      particleSystem->animate();
+    }
+    return;
+  }
 
-    if (!mesh->isReady() || !mesh->isEnabled()) {
+  // Large systems are split in chunks over the pool one after the other, the
+  // other ones are simulated concurrently, one system per chunk
+  _concurrentParticleSystems.clear();
+  std::vector<ParticleSystem*> animatedParticleSystems;
+  for (auto& particleSystem : _activeParticleSystems) {
+    if (!particleSystem->_beginAnimate()) {
       continue;
     }
+    animatedParticleSystems.emplace_back(particleSystem);
+    if (particleSystem->_isChunked()) {
+      particleSystem->_simulate(_evaluationPool.get());
+    }
+    else {
+      _concurrentParticleSystems.emplace_back(particleSystem);
+    }
+  }
 
-    mesh->computeWorldMatrix();
-
-    // Intersections
-    if (mesh->actionManager
-        && mesh->actionManager->hasSpecificTriggers(
-             {ActionManager::OnIntersectionEnterTrigger,
-              ActionManager::OnIntersectionExitTrigger})) {
-      if (std::find(_meshesForIntersections.begin(),
-                    _meshesForIntersections.end(), mesh.get())
-          == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh.get());
+  _evaluationPool->parallelFor(
+    _concurrentParticleSystems.size(), 1, [this](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        _concurrentParticleSystems[i]->_simulate(nullptr);
       }
+    });
+
+  // The vertex buffers are uploaded on the rendering thread
+  for (auto& particleSystem : animatedParticleSystems) {
+    particleSystem->_endAnimate();
+  }
+}
+
+void Scene::_evaluateActiveMeshesInBatch(
+  const std::vector<AbstractMesh*>& candidates)
+{
+  _evaluationStates.resize(candidates.size());
+  if (_evaluationPool) {
+    _computeSharedWorldMatrices(candidates);
+
+    _deferSelectionTreeUpdates = true;
+    _evaluationPool->parallelFor(
+      candidates.size(), evaluationChunkSize,
+      [this, &candidates](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          _evaluationStates[i] = _evaluateActiveMeshState(candidates[i]);
+        }
+      });
+    _deferSelectionTreeUpdates = false;
+  }
+  else {
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      _evaluationStates[i] = _evaluateActiveMeshState(candidates[i]);
+    }
+  }
+
+  // The world boxes of the visible candidates are tested against the frustum
+  // in one batch
+  _cullingBoxes.clear();
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (_evaluationStates[i] == EVALUATION_FRUSTUM_BATCHED) {
+      _cullingBoxes.add(candidates[i]->_boundingInfo->boundingBox);
+    }
+  }
+  _cullingBoxes.isInFrustum(_frustumPlanes, _cullingVisibility);
+
+  // LOD selection and activation modify shared state (source meshes of the
+  // instances, skeletons, rendering groups), they are done in candidate order
+  size_t boxIndex = 0;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    auto state = _evaluationStates[i];
+    if (state == EVALUATION_FRUSTUM_BATCHED) {
+      state = BoundingBoxArray::IsVisible(_cullingVisibility, boxIndex++) ?
+                EVALUATION_SELECTED :
+                EVALUATION_HIDDEN;
+    }
+    if (state == EVALUATION_BLOCKED) {
+      continue;
     }
 
-    // Switch to current LOD
-    auto meshLOD = mesh->getLOD(activeCamera);
+    auto mesh = candidates[i];
+    _totalVertices.addCount(mesh->getTotalVertices(), false);
 
-    if (!meshLOD) {
+    if (state == EVALUATION_SKIPPED) {
       continue;
     }
 
-    mesh->_preActivate();
+    int isSelected = (state == EVALUATION_SELECTED) ? 1 : 0;
+    if (state == EVALUATION_FRUSTUM_PENDING) {
+      isSelected = -1;
+    }
+    _selectActiveMesh(mesh, isSelected);
+  }
+}
+
+void Scene::_computeWorldMatricesInParallel(
+  const std::vector<AbstractMesh*>& meshes)
+{
+  _computeSharedWorldMatrices(meshes);
 
-    if (mesh->alwaysSelectAsActiveMesh
-        || ((mesh->isVisible && mesh->visibility > 0)
-            && ((mesh->layerMask & activeCamera->layerMask) != 0)
-            && mesh->isInFrustum(_frustumPlanes))) {
-      _activeMeshes.emplace_back(dynamic_cast<Mesh*>(mesh.get()));
-      activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
-      mesh->_activate(_renderId);
+  _evaluationPool->parallelFor(meshes.size(), evaluationChunkSize,
+                               [&meshes](size_t begin, size_t end) {
+                                 for (size_t i = begin; i < end; ++i) {
+                                   meshes[i]->computeWorldMatrix();
+                                 }
+                               });
+}
 
-      _activeMesh(meshLOD);
+void Scene::_computeSharedWorldMatrices(
+  const std::vector<AbstractMesh*>& meshes)
+{
+  // The camera and the parents are shared between meshes, their world
+  // matrices are computed first so that the workers only read them
+  activeCamera->getWorldMatrix();
+  for (auto& mesh : meshes) {
+    if (mesh->parent()) {
+      mesh->parent()->getWorldMatrix();
     }
   }
+}
 
-  // Particle systems
-  _particlesDuration.beginMonitoring();
-  if (particlesEnabled) {
-    Tools::StartPerformanceCounter("Particles", !particleSystems.empty());
-    for (auto& particleSystem : particleSystems) {
-      if (!particleSystem->isStarted()) {
-        continue;
-      }
+uint8_t Scene::_evaluateActiveMeshState(AbstractMesh* mesh)
+{
+  if (mesh->isBlocked()) {
+    return EVALUATION_BLOCKED;
+  }
 
-      if (particleSystem->emitter && particleSystem->emitter->isEnabled()) {
-        _activeParticleSystems.emplace_back(particleSystem.get());
-        particleSystem->animate();
-      }
+  if (!mesh->isReady() || !mesh->isEnabled()) {
+    return EVALUATION_SKIPPED;
+  }
+
+  mesh->computeWorldMatrix();
+
+  // Loading delayed meshes or geometries on frustum test is not thread safe
+  auto _mesh = dynamic_cast<Mesh*>(mesh);
+  if (_mesh
+      && (_mesh->delayLoadState != Engine::DELAYLOADSTATE_NONE
+          || (_mesh->geometry() && !_mesh->geometry()->isReady()))) {
+    return EVALUATION_FRUSTUM_PENDING;
+  }
+
+  if (mesh->alwaysSelectAsActiveMesh) {
+    return EVALUATION_SELECTED;
+  }
+
+  if (!(mesh->isVisible && mesh->visibility > 0)
+      || ((mesh->layerMask & activeCamera->layerMask) == 0)) {
+    return EVALUATION_HIDDEN;
+  }
+
+  // The bounding sphere test of AbstractMesh::isInFrustum is only a shortcut,
+  // the sphere encloses the box
+  return EVALUATION_FRUSTUM_BATCHED;
+}
+
+bool Scene::_isActiveMeshSelected(AbstractMesh* mesh)
+{
+  return mesh->alwaysSelectAsActiveMesh
+         || ((mesh->isVisible && mesh->visibility > 0)
+             && ((mesh->layerMask & activeCamera->layerMask) != 0)
+             && mesh->isInFrustum(_frustumPlanes));
+}
+
+void Scene::_selectActiveMesh(AbstractMesh* mesh, int isSelected)
+{
+  // Intersections
+  if (mesh->actionManager
+      && mesh->actionManager->hasSpecificTriggers(
+           {ActionManager::OnIntersectionEnterTrigger,
+            ActionManager::OnIntersectionExitTrigger})) {
+    if (std::find(_meshesForIntersections.begin(),
+                  _meshesForIntersections.end(), mesh)
+        == _meshesForIntersections.end()) {
+      _meshesForIntersections.emplace_back(mesh);
     }
-    Tools::EndPerformanceCounter("Particles", !particleSystems.empty());
   }
-  _particlesDuration.endMonitoring(false);
+
+  // Switch to current LOD
+  auto meshLOD = mesh->getLOD(activeCamera);
+
+  if (!meshLOD) {
+    return;
+  }
+
+  mesh->_preActivate();
+
+  // Selection not known yet (-1), or computed by the parallel evaluation
+  if ((isSelected < 0) ? _isActiveMeshSelected(mesh) : (isSelected > 0)) {
+    _activeMeshes.emplace_back(dynamic_cast<Mesh*>(mesh));
+    activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
+    mesh->_activate(_renderId);
+
+    _activeMesh(meshLOD);
+  }
 }
 
 void Scene::_activeMesh(AbstractMesh* mesh)
@@ -1778,20 +2075,35 @@ void Scene::_activeMesh(AbstractMesh* mesh)
 
   if (mesh && !mesh->subMeshes.empty()) {
     // Submeshes Octrees
-    std::vector<SubMesh*> subMeshes;
-
     if (mesh->_submeshesOctree && mesh->useOctreeForRenderingSelection) {
-      subMeshes = mesh->_submeshesOctree->select(_frustumPlanes);
+      const auto& subMeshes
+        = mesh->_submeshesOctree->select(_frustumPlanes, false);
+      if (subMeshes.size() < mesh->subMeshes.size()) {
+        _culledCandidates.addCount(
+          mesh->subMeshes.size() - subMeshes.size(), false);
+      }
+      for (auto& subMesh : subMeshes) {
+        _evaluateSubMesh(subMesh, mesh, -1);
+      }
     }
-    else {
-      subMeshes.reserve(mesh->subMeshes.size());
+    else if (mesh->alwaysSelectAsActiveMesh || mesh->subMeshes.size() == 1) {
       for (auto& subMesh : mesh->subMeshes) {
-        subMeshes.emplace_back(subMesh.get());
+        _evaluateSubMesh(subMesh.get(), mesh, 1);
       }
     }
-
-    for (auto& subMesh : mesh->subMeshes) {
-      _evaluateSubMesh(subMesh.get(), mesh);
+    else {
+      // The sub meshes are tested against the frustum in one batch
+      _subMeshCullingBoxes.clear();
+      for (auto& subMesh : mesh->subMeshes) {
+        _subMeshCullingBoxes.add(subMesh->getBoundingInfo()->boundingBox);
+      }
+      _subMeshCullingBoxes.isInFrustum(_frustumPlanes,
+                                       _subMeshCullingVisibility);
+      for (size_t i = 0; i < mesh->subMeshes.size(); ++i) {
+        _evaluateSubMesh(
+          mesh->subMeshes[i].get(), mesh,
+          BoundingBoxArray::IsVisible(_subMeshCullingVisibility, i) ? 1 : 0);
+      }
     }
   }
 }
@@ -2027,6 +2339,7 @@ void Scene::render()
   _totalVertices.fetchNewFrame();
   _activeIndices.fetchNewFrame();
   _activeBones.fetchNewFrame();
+  _culledCandidates.fetchNewFrame();
   getEngine()->drawCallsPerfCounter().fetchNewFrame();
   _meshesForIntersections.clear();
   resetCachedMaterial();
@@ -2038,9 +2351,18 @@ void Scene::render()
     actionManager->processTrigger(ActionManager::OnEveryFrameTrigger);
   }
 
+  // Files loaded in the background
+  FileLoader::Default().processResults();
+
+  // Effects compiled in the background
+  getEngine()->getShaderCompilationQueue().processResults();
+
   // Simplification Queue
-  if (simplificationQueue && !simplificationQueue->running) {
-    simplificationQueue->executeNext();
+  if (simplificationQueue) {
+    simplificationQueue->processResults();
+    if (!simplificationQueue->running) {
+      simplificationQueue->executeNext();
+    }
   }
 
   // Animations
@@ -2211,6 +2533,7 @@ void Scene::render()
   _activeBones.addCount(0, true);
   _activeIndices.addCount(0, true);
   _activeParticles.addCount(0, true);
+  _culledCandidates.addCount(0, true);
 }
 
 void Scene::_updateAudioParameters()
@@ -2312,6 +2635,7 @@ void Scene::dispose(bool /*doNotRecurse*/)
   skeletons.clear();
 
   _boundingBoxRenderer->dispose();
+  _sceneUbo->dispose();
 
   if (_depthRenderer) {
     _depthRenderer->dispose();
@@ -2441,15 +2765,169 @@ Octree<AbstractMesh*>* Scene::createOrUpdateSelectionOctree(size_t maxCapacity,
 
   auto worldExtends = getWorldExtends();
 
-  // Update octree
-  auto _meshes = getMeshes();
+  // Update octree, dynamic meshes and meshes that must always be selected
+  // are kept out of the blocks and returned with every selection. The meshes
+  // added since the last update were only kept there until now
+  auto& dynamicContent = _selectionOctree->dynamicContent;
+  if (!_meshesAddedSinceOctreeUpdate.empty()) {
+    std::unordered_set<AbstractMesh*> addedMeshes(
+      _meshesAddedSinceOctreeUpdate.begin(),
+      _meshesAddedSinceOctreeUpdate.end());
+    dynamicContent.erase(std::remove_if(dynamicContent.begin(),
+                                        dynamicContent.end(),
+                                        [&addedMeshes](AbstractMesh* mesh) {
+                                          return addedMeshes.count(mesh) > 0;
+                                        }),
+                         dynamicContent.end());
+    _meshesAddedSinceOctreeUpdate.clear();
+  }
+  std::unordered_set<AbstractMesh*> dynamicMeshes(dynamicContent.begin(),
+                                                  dynamicContent.end());
+  std::vector<AbstractMesh*> _meshes;
+  _meshes.reserve(meshes.size());
+  for (auto& mesh : meshes) {
+    if (dynamicMeshes.find(mesh.get()) != dynamicMeshes.end()) {
+      continue;
+    }
+    if (mesh->alwaysSelectAsActiveMesh) {
+      dynamicContent.emplace_back(mesh.get());
+      continue;
+    }
+    _meshes.emplace_back(mesh.get());
+  }
   _selectionOctree->update(worldExtends.min, worldExtends.max, _meshes);
 
   return _selectionOctree;
 }
 
+/** Selection tree **/
+DynamicAABBTree<AbstractMesh*>* Scene::enableSelectionTree(float margin)
+{
+  if (_selectionTree && _selectionTree->margin() == margin) {
+    return _selectionTree.get();
+  }
+
+  disableSelectionTree();
+
+  _selectionTree
+    = std_util::make_unique<DynamicAABBTree<AbstractMesh*>>(margin);
+  for (auto& mesh : meshes) {
+    _addToSelectionTree(mesh.get());
+  }
+
+  return _selectionTree.get();
+}
+
+void Scene::disableSelectionTree()
+{
+  if (!_selectionTree) {
+    return;
+  }
+
+  for (auto& mesh : meshes) {
+    mesh->_selectionTreeProxy = -1;
+  }
+  _selectionTree.reset(nullptr);
+  _selectionTreeContent.clear();
+  _selectionTreeAlwaysSelected.clear();
+  _selectionTreeMovableMeshes.clear();
+}
+
+DynamicAABBTree<AbstractMesh*>* Scene::selectionTree()
+{
+  return _selectionTree.get();
+}
+
+void Scene::_addToSelectionTree(AbstractMesh* mesh)
+{
+  if (mesh->alwaysSelectAsActiveMesh) {
+    _selectionTreeAlwaysSelected.emplace_back(mesh);
+    return;
+  }
+
+  const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+  mesh->_selectionTreeProxy = _selectionTree->createProxy(
+    boundingBox.minimumWorld, boundingBox.maximumWorld, mesh);
+  if (!mesh->isWorldMatrixFrozen()) {
+    _selectionTreeMovableMeshes.emplace_back(mesh);
+  }
+}
+
+void Scene::_removeFromSelectionTree(AbstractMesh* mesh)
+{
+  if (mesh->_selectionTreeProxy != -1) {
+    _selectionTree->destroyProxy(mesh->_selectionTreeProxy);
+    mesh->_selectionTreeProxy = -1;
+    _selectionTreeMovableMeshes.erase(
+      std::remove(_selectionTreeMovableMeshes.begin(),
+                  _selectionTreeMovableMeshes.end(), mesh),
+      _selectionTreeMovableMeshes.end());
+  }
+  else {
+    _selectionTreeAlwaysSelected.erase(
+      std::remove(_selectionTreeAlwaysSelected.begin(),
+                  _selectionTreeAlwaysSelected.end(), mesh),
+      _selectionTreeAlwaysSelected.end());
+  }
+}
+
+void Scene::_updateSelectionTreeProxy(AbstractMesh* mesh)
+{
+  if (!_selectionTree || mesh->_selectionTreeProxy == -1
+      || _deferSelectionTreeUpdates) {
+    return;
+  }
+
+  const auto& boundingBox = mesh->_boundingInfo->boundingBox;
+  _selectionTree->moveProxy(mesh->_selectionTreeProxy,
+                            boundingBox.minimumWorld,
+                            boundingBox.maximumWorld);
+}
+
+void Scene::_updateSelectionTreeMobility(AbstractMesh* mesh)
+{
+  if (!_selectionTree || mesh->_selectionTreeProxy == -1) {
+    return;
+  }
+
+  auto it = std::find(_selectionTreeMovableMeshes.begin(),
+                      _selectionTreeMovableMeshes.end(), mesh);
+  if (mesh->isWorldMatrixFrozen()) {
+    if (it != _selectionTreeMovableMeshes.end()) {
+      _selectionTreeMovableMeshes.erase(it);
+    }
+  }
+  else if (it == _selectionTreeMovableMeshes.end()) {
+    _selectionTreeMovableMeshes.emplace_back(mesh);
+  }
+}
+
+/** Parallel evaluation **/
+void Scene::enableParallelEvaluation(size_t threadCount)
+{
+  _evaluationPool = std_util::make_unique<ThreadPool>(threadCount);
+}
+
+void Scene::disableParallelEvaluation()
+{
+  _evaluationPool.reset(nullptr);
+  _evaluationCandidates.clear();
+  _evaluationStates.clear();
+}
+
+bool Scene::isParallelEvaluationEnabled() const
+{
+  return _evaluationPool != nullptr;
+}
+
+ThreadPool* Scene::getEvaluationPool() const
+{
+  return _evaluationPool.get();
+}
+
 /** Picking **/
-Ray* Scene::createPickingRay(int x, int y, Matrix* world, Camera* camera)
+std::unique_ptr<Ray> Scene::createPickingRay(int x, int y, Matrix* world,
+                                             Camera* camera)
 {
   auto engine = _engine;
 
@@ -2462,7 +2940,6 @@ Ray* Scene::createPickingRay(int x, int y, Matrix* world, Camera* camera)
     camera = activeCamera;
   }
 
-  bool viewportSet    = true;
   auto cameraViewport = camera->viewport;
   auto viewport       = cameraViewport.toGlobal(engine->getRenderWidth(),
                                           engine->getRenderHeight());
@@ -2470,21 +2947,19 @@ Ray* Scene::createPickingRay(int x, int y, Matrix* world, Camera* camera)
   auto identity = Matrix::Identity();
 
   // Moving coordinates to local viewport world
-  float _x = static_cast<float>(x);
-  _x /= static_cast<float>(_engine->getHardwareScalingLevel() - viewport.x);
-  float _y = static_cast<float>(y);
-  _y /= static_cast<float>(
-    _engine->getHardwareScalingLevel()
-    - (_engine->getRenderHeight() - viewport.y - viewport.height));
-  return Ray::CreateNew(_x, _y, static_cast<float>(viewport.width),
-                        static_cast<float>(viewport.height),
-                        world ? *world : identity,
-                        viewportSet ? identity : camera->getViewMatrix(),
-                        camera->getProjectionMatrix())
-    .clone();
-}
-
-Ray* Scene::createPickingRayInCameraSpace(int x, int y, Camera* camera)
+  const float scalingLevel = engine->getHardwareScalingLevel();
+  const float _x = static_cast<float>(x) / scalingLevel - viewport.x;
+  const float _y
+    = static_cast<float>(y) / scalingLevel
+      - (engine->getRenderHeight() - viewport.y - viewport.height);
+  return std_util::make_unique<Ray>(Ray::CreateNew(
+    _x, _y, static_cast<float>(viewport.width),
+    static_cast<float>(viewport.height), world ? *world : identity,
+    camera->getViewMatrix(), camera->getProjectionMatrix()));
+}
+
+std::unique_ptr<Ray> Scene::createPickingRayInCameraSpace(int x, int y,
+                                                          Camera* camera)
 {
   auto engine = _engine;
 
@@ -2503,77 +2978,265 @@ Ray* Scene::createPickingRayInCameraSpace(int x, int y, Camera* camera)
   auto identity = Matrix::Identity();
 
   // Moving coordinates to local viewport world
-  float _x = static_cast<float>(x);
-  _x /= static_cast<float>(_engine->getHardwareScalingLevel() - viewport.x);
-  float _y = static_cast<float>(y);
-  _y /= static_cast<float>(
-    _engine->getHardwareScalingLevel()
-    - (_engine->getRenderHeight() - viewport.y - viewport.height));
-  return Ray::CreateNew(_x, _y, static_cast<float>(viewport.width),
-                        static_cast<float>(viewport.height), identity, identity,
-                        camera->getProjectionMatrix())
-    .clone();
-}
-
-PickingInfo* Scene::_internalPick(
-  const std::function<Ray(const Matrix& world)>& /*rayFunction*/,
-  const std::function<bool(AbstractMesh* mesh)>& /*predicate*/,
-  bool /*fastCheck*/)
+  const float scalingLevel = engine->getHardwareScalingLevel();
+  const float _x = static_cast<float>(x) / scalingLevel - viewport.x;
+  const float _y
+    = static_cast<float>(y) / scalingLevel
+      - (engine->getRenderHeight() - viewport.y - viewport.height);
+  return std_util::make_unique<Ray>(
+    Ray::CreateNew(_x, _y, static_cast<float>(viewport.width),
+                   static_cast<float>(viewport.height), identity, identity,
+                   camera->getProjectionMatrix()));
+}
+
+void Scene::_gatherPickingCandidates(
+  const Ray& worldRay, const std::function<bool(AbstractMesh* mesh)>& predicate,
+  std::vector<std::pair<float, AbstractMesh*>>& candidates)
+{
+  const auto testMesh = [&](AbstractMesh* mesh) {
+    if (predicate) {
+      if (!predicate(mesh)) {
+        return;
+      }
+    }
+    else if (!mesh->isEnabled() || !mesh->isVisible || !mesh->isPickable) {
+      return;
+    }
+
+    // Make sure the world bounds are up to date
+    mesh->getWorldMatrix();
+    if (!mesh->_boundingInfo) {
+      return;
+    }
+
+    const auto& boundingBox = mesh->_boundingInfo->boundingBox;
+    float distance          = 0.f;
+    if (worldRay.intersectsBoxMinMax(boundingBox.minimumWorld,
+                                     boundingBox.maximumWorld, distance)) {
+      candidates.emplace_back(std::make_pair(distance, mesh));
+    }
+  };
+
+  if (_selectionTree) {
+    for (auto& mesh : _selectionTreeMovableMeshes) {
+      mesh->getWorldMatrix();
+    }
+    _selectionTreeContent.clear();
+    _selectionTree->intersectsRay(worldRay, _selectionTreeContent);
+    for (auto& mesh : _selectionTreeContent) {
+      testMesh(mesh);
+    }
+    for (auto& mesh : _selectionTreeAlwaysSelected) {
+      testMesh(mesh);
+    }
+  }
+  else {
+    for (auto& mesh : meshes) {
+      testMesh(mesh.get());
+    }
+  }
+
+  // Box entry distances along the ray, in world units
+  const float directionLength = worldRay.direction.length();
+  for (auto& candidate : candidates) {
+    candidate.first *= directionLength;
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<float, AbstractMesh*>& a,
+               const std::pair<float, AbstractMesh*>& b) {
+              return a.first < b.first;
+            });
+}
+
+std::function<bool(AbstractMesh* mesh)> Scene::_toAbstractMeshPredicate(
+  const std::function<bool(Mesh* mesh)>& predicate)
 {
-  return nullptr;
+  if (!predicate) {
+    return nullptr;
+  }
+
+  // Instances are not meshes and can not be passed to the predicate
+  return [predicate](AbstractMesh* mesh) {
+    auto _mesh = dynamic_cast<Mesh*>(mesh);
+    return _mesh && predicate(_mesh);
+  };
 }
 
-std::vector<PickingInfo*> Scene::_internalMultiPick(
-  const std::function<Ray(const Matrix& world)>& /*rayFunction*/,
-  const std::function<bool(AbstractMesh* mesh)>& /*predicate*/)
+std::unique_ptr<PickingInfo> Scene::_internalPick(
+  const std::function<Ray(const Matrix& world)>& rayFunction,
+  const std::function<bool(AbstractMesh* mesh)>& predicate, bool fastCheck)
 {
-  return std::vector<PickingInfo*>();
+  std::unique_ptr<PickingInfo> pickingInfo = nullptr;
+
+  std::vector<std::pair<float, AbstractMesh*>> candidates;
+  _gatherPickingCandidates(rayFunction(Matrix::Identity()), predicate,
+                           candidates);
+
+  for (auto& candidate : candidates) {
+    // Candidates are sorted, the remaining ones are farther than the hit
+    if (pickingInfo && candidate.first > pickingInfo->distance) {
+      break;
+    }
+
+    auto mesh   = candidate.second;
+    auto ray    = rayFunction(*mesh->getWorldMatrix());
+    auto result = mesh->intersects(ray, fastCheck);
+    if (!result || !result->hit) {
+      continue;
+    }
+
+    if (!fastCheck && pickingInfo
+        && result->distance >= pickingInfo->distance) {
+      continue;
+    }
+
+    pickingInfo = std::move(result);
+
+    if (fastCheck) {
+      break;
+    }
+  }
+
+  return pickingInfo ? std::move(pickingInfo) :
+                       std_util::make_unique<PickingInfo>();
 }
 
-PickingInfo* Scene::_internalPickSprites(
-  const Ray& /*ray*/, const std::function<bool(Sprite* sprite)>& /*predicate*/,
-  bool /*fastCheck*/, Camera* /*camera*/)
+std::vector<std::unique_ptr<PickingInfo>> Scene::_internalMultiPick(
+  const std::function<Ray(const Matrix& world)>& rayFunction,
+  const std::function<bool(AbstractMesh* mesh)>& predicate)
 {
-  return nullptr;
+  std::vector<std::unique_ptr<PickingInfo>> pickingInfos;
+
+  std::vector<std::pair<float, AbstractMesh*>> candidates;
+  _gatherPickingCandidates(rayFunction(Matrix::Identity()), predicate,
+                           candidates);
+
+  for (auto& candidate : candidates) {
+    auto mesh   = candidate.second;
+    auto ray    = rayFunction(*mesh->getWorldMatrix());
+    auto result = mesh->intersects(ray, false);
+    if (!result || !result->hit) {
+      continue;
+    }
+
+    pickingInfos.emplace_back(std::move(result));
+  }
+
+  return pickingInfos;
 }
 
-PickingInfo*
-Scene::pick(int /*x*/, int /*y*/,
-            const std::function<bool(AbstractMesh* mesh)>& /*predicate*/,
-            bool /*fastCheck*/, Camera* /*camera*/)
+std::unique_ptr<PickingInfo> Scene::_internalPickSprites(
+  const Ray& ray, const std::function<bool(Sprite* sprite)>& predicate,
+  bool fastCheck, Camera* camera)
 {
-  return nullptr;
+  std::unique_ptr<PickingInfo> pickingInfo = nullptr;
+
+  if (!camera) {
+    if (!activeCamera) {
+      return std_util::make_unique<PickingInfo>();
+    }
+    camera = activeCamera;
+  }
+
+  for (auto& spriteManager : spriteManagers) {
+    if (!spriteManager->isPickable) {
+      continue;
+    }
+
+    auto result = spriteManager->intersects(ray, camera, predicate, fastCheck);
+    if (!result || !result->hit) {
+      continue;
+    }
+
+    if (!fastCheck && pickingInfo
+        && result->distance >= pickingInfo->distance) {
+      continue;
+    }
+
+    pickingInfo = std::move(result);
+
+    if (fastCheck) {
+      break;
+    }
+  }
+
+  return pickingInfo ? std::move(pickingInfo) :
+                       std_util::make_unique<PickingInfo>();
 }
 
-PickingInfo*
-Scene::pickSprite(int /*x*/, int /*y*/,
-                  const std::function<bool(Sprite* sprite)>& /*predicate*/,
-                  bool /*fastCheck*/, Camera* /*camera*/)
+std::unique_ptr<PickingInfo>
+Scene::pick(int x, int y,
+            const std::function<bool(AbstractMesh* mesh)>& predicate,
+            bool fastCheck, Camera* camera)
 {
-  return nullptr;
+  if (!camera && !activeCamera) {
+    return std_util::make_unique<PickingInfo>();
+  }
+
+  return _internalPick(
+    [this, x, y, camera](const Matrix& world) {
+      Matrix _world = world;
+      return *createPickingRay(x, y, &_world, camera);
+    },
+    predicate, fastCheck);
 }
 
-PickingInfo*
-Scene::pickWithRay(const Ray& /*ray*/,
-                   const std::function<bool(Mesh* mesh)>& /*predicate*/,
-                   bool /*fastCheck*/)
+std::unique_ptr<PickingInfo>
+Scene::pickSprite(int x, int y,
+                  const std::function<bool(Sprite* sprite)>& predicate,
+                  bool fastCheck, Camera* camera)
 {
-  return nullptr;
+  auto ray = createPickingRayInCameraSpace(x, y, camera);
+  if (!ray) {
+    return std_util::make_unique<PickingInfo>();
+  }
+
+  return _internalPickSprites(*ray, predicate, fastCheck, camera);
 }
 
-std::vector<PickingInfo*>
-Scene::multiPick(int /*x*/, int /*y*/,
-                 const std::function<bool(AbstractMesh* mesh)>& /*predicate*/,
-                 Camera* /*camera*/)
+std::unique_ptr<PickingInfo>
+Scene::pickWithRay(const Ray& ray,
+                   const std::function<bool(Mesh* mesh)>& predicate,
+                   bool fastCheck)
 {
-  return std::vector<PickingInfo*>();
+  return _internalPick(
+    [this, &ray](const Matrix& world) {
+      Matrix _world = world;
+      _world.invertToRef(_pickWithRayInverseMatrix);
+      return Ray::Transform(ray, _pickWithRayInverseMatrix);
+    },
+    _toAbstractMeshPredicate(predicate), fastCheck);
 }
 
-std::vector<PickingInfo*>
-Scene::multiPickWithRay(const Ray& /*ray*/,
-                        const std::function<bool(Mesh* mesh)>& /*predicate*/)
+std::vector<std::unique_ptr<PickingInfo>>
+Scene::multiPick(int x, int y,
+                 const std::function<bool(AbstractMesh* mesh)>& predicate,
+                 Camera* camera)
 {
-  return std::vector<PickingInfo*>();
+  if (!camera && !activeCamera) {
+    return std::vector<std::unique_ptr<PickingInfo>>();
+  }
+
+  return _internalMultiPick(
+    [this, x, y, camera](const Matrix& world) {
+      Matrix _world = world;
+      return *createPickingRay(x, y, &_world, camera);
+    },
+    predicate);
+}
+
+std::vector<std::unique_ptr<PickingInfo>>
+Scene::multiPickWithRay(const Ray& ray,
+                        const std::function<bool(Mesh* mesh)>& predicate)
+{
+  return _internalMultiPick(
+    [this, &ray](const Matrix& world) {
+      Matrix _world = world;
+      _world.invertToRef(_pickWithRayInverseMatrix);
+      return Ray::Transform(ray, _pickWithRayInverseMatrix);
+    },
+    _toAbstractMeshPredicate(predicate));
 }
 
 void Scene::setPointerOverMesh(AbstractMesh* /*mesh*/)
@@ -2716,4 +3379,17 @@ void Scene::setRenderingAutoClearDepthStencil(int renderingGroupId,
                                                        autoClearDepthStencil);
 }
 
+void Scene::setRenderingAutoInstancing(int renderingGroupId,
+                                       bool autoInstancing)
+{
+  _renderingManager->setRenderingAutoInstancing(
+    static_cast<unsigned int>(renderingGroupId), autoInstancing);
+}
+
+void Scene::setRenderingSortKeys(int renderingGroupId, bool useSortKeys)
+{
+  _renderingManager->setRenderingSortKeys(
+    static_cast<unsigned int>(renderingGroupId), useSortKeys);
+}
+
 } // end of namespace BABYLON
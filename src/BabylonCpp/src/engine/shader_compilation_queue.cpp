@@ -0,0 +1,190 @@
+#include <babylon/engine/shader_compilation_queue.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/materials/effect.h>
+
+namespace BABYLON {
+
+ShaderCompilationQueue::ShaderCompilationQueue(Engine* engine)
+    : maxCompilationsPerFrame{4}, _engine{engine}
+{
+}
+
+ShaderCompilationQueue::~ShaderCompilationQueue()
+{
+  // The effects not preprocessed yet are dropped
+  clear();
+}
+
+size_t ShaderCompilationQueue::pendingCount() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _preprocessingJobs.size() + _preprocessingEffects.size()
+         + _preprocessedJobs.size() + _compilingJobs.size();
+}
+
+void ShaderCompilationQueue::add(Effect* effect, const std::string& vertexCode,
+                                 const std::string& fragmentCode)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _preprocessingJobs.emplace_back();
+    auto& job        = _preprocessingJobs.back();
+    job.effect       = effect;
+    job.vertexCode   = vertexCode;
+    job.fragmentCode = fragmentCode;
+    job.binaryKey    = 0;
+  }
+  _tasks.post([this]() { _preprocessNext(); });
+}
+
+void ShaderCompilationQueue::remove(Effect* effect)
+{
+  const auto isJobOf = [effect](const Job& job) {
+    return job.effect == effect;
+  };
+
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _preprocessingJobs.erase(std::remove_if(_preprocessingJobs.begin(),
+                                            _preprocessingJobs.end(), isJobOf),
+                             _preprocessingJobs.end());
+    _preprocessed.wait(lock, [this, effect]() {
+      return !std_util::contains(_preprocessingEffects, effect);
+    });
+    _preprocessedJobs.erase(std::remove_if(_preprocessedJobs.begin(),
+                                           _preprocessedJobs.end(), isJobOf),
+                            _preprocessedJobs.end());
+  }
+
+  for (auto it = _compilingJobs.begin(); it != _compilingJobs.end();) {
+    if (isJobOf(*it)) {
+      _deleteProgram(*it);
+      it = _compilingJobs.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void ShaderCompilationQueue::processResults()
+{
+  _processResults(false);
+}
+
+void ShaderCompilationQueue::flush()
+{
+  // The callbacks of the completed effects can queue other effects
+  while (pendingCount() > 0) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _preprocessed.wait(lock, [this]() {
+        return _preprocessingJobs.empty() && _preprocessingEffects.empty();
+      });
+    }
+    _processResults(true);
+  }
+}
+
+void ShaderCompilationQueue::clear()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _preprocessingJobs.clear();
+  }
+  _tasks.wait();
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _preprocessedJobs.clear();
+  }
+  for (auto& job : _compilingJobs) {
+    _deleteProgram(job);
+  }
+  _compilingJobs.clear();
+}
+
+void ShaderCompilationQueue::_preprocessNext()
+{
+  // One task is posted per added effect, the job of a removed effect is no
+  // longer queued
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_preprocessingJobs.empty()) {
+    return;
+  }
+
+  Job job = std::move(_preprocessingJobs.front());
+  _preprocessingJobs.pop_front();
+  _preprocessingEffects.emplace_back(job.effect);
+  lock.unlock();
+
+  job.effect->_preprocessSources(job.vertexCode, job.fragmentCode);
+
+  lock.lock();
+  _preprocessingEffects.erase(std::find(_preprocessingEffects.begin(),
+                                        _preprocessingEffects.end(),
+                                        job.effect));
+  _preprocessedJobs.emplace_back(std::move(job));
+  _preprocessed.notify_all();
+}
+
+void ShaderCompilationQueue::_takePreprocessedJobs()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto& job : _preprocessedJobs) {
+    _compilingJobs.emplace_back(std::move(job));
+  }
+  _preprocessedJobs.clear();
+}
+
+void ShaderCompilationQueue::_processResults(bool wait)
+{
+  _takePreprocessedJobs();
+
+  // Issues a batch of compilations, which the driver may run in parallel
+  size_t compilations = 0;
+  for (auto& job : _compilingJobs) {
+    if (!job.program && (wait || compilations < maxCompilationsPerFrame)) {
+      job.program = _engine->createShaderProgramAsync(
+        job.vertexCode, job.fragmentCode, job.effect->defines, job.binaryKey);
+      ++compilations;
+    }
+  }
+
+  // Completes the effects one at a time, their callbacks can add or remove
+  // effects
+  for (size_t i = 0; i < _compilingJobs.size();) {
+    auto& job = _compilingJobs[i];
+    if (!job.program
+        || (!wait && !_engine->isShaderProgramCompleted(job.program.get()))) {
+      ++i;
+      continue;
+    }
+
+    Job completed = std::move(job);
+    _compilingJobs.erase(_compilingJobs.begin() + static_cast<long>(i));
+
+    std::string errors;
+    if (_engine->finalizeShaderProgram(completed.program, completed.binaryKey,
+                                       errors)) {
+      completed.effect->_setProgram(std::move(completed.program));
+    }
+    else {
+      _deleteProgram(completed);
+      completed.effect->_setCompilationError(errors);
+    }
+  }
+}
+
+void ShaderCompilationQueue::_deleteProgram(Job& job)
+{
+  // The context is released when the engine is disposed
+  if (job.program && _engine->_gl) {
+    _engine->_gl->deleteProgram(job.program.get());
+  }
+  job.program.reset(nullptr);
+}
+
+} // end of namespace BABYLON
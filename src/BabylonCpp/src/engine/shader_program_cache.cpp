@@ -0,0 +1,190 @@
+#include <babylon/engine/shader_program_cache.h>
+
+#include <cstring>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/logging.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Writes the file next to its final path then renames it, so that a
+ * concurrent run never reads a partially written entry.
+ */
+bool writeFileAtomically(const std::string& path, const char* data,
+                         size_t size)
+{
+  const std::string tmpPath = path + ".tmp";
+  {
+    std::ofstream out(tmpPath, std::ios::out | std::ios::binary);
+    if (!out) {
+      return false;
+    }
+    out.write(data, static_cast<std::streamsize>(size));
+    if (!out) {
+      out.close();
+      Filesystem::removeFile(tmpPath);
+      return false;
+    }
+  }
+
+  if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+    Filesystem::removeFile(tmpPath);
+    return false;
+  }
+
+  return true;
+}
+
+} // end of anonymous namespace
+
+constexpr unsigned int ShaderProgramCache::FormatVersion;
+
+ShaderProgramCache::ShaderProgramCache()
+{
+}
+
+ShaderProgramCache::~ShaderProgramCache()
+{
+}
+
+const std::string& ShaderProgramCache::directory() const
+{
+  return _directory;
+}
+
+bool ShaderProgramCache::setDirectory(const std::string& directory,
+                                      const std::string& version)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _directory.clear();
+
+  if (directory.empty()) {
+    return false;
+  }
+
+  const std::string versionDirectory = Filesystem::joinPath<std::string>(
+    directory, "v" + std::to_string(FormatVersion) + "-" + version);
+  for (const auto& path : {directory, versionDirectory}) {
+    if (!Filesystem::isDirectory(path) && !Filesystem::createDirectory(path)) {
+      BABYLON_LOG_WARN("ShaderProgramCache",
+                       "Could not create the shader cache directory ", path);
+      return false;
+    }
+  }
+
+  _directory = versionDirectory;
+  return true;
+}
+
+bool ShaderProgramCache::getSource(uint64_t key, std::string& source)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto it = _sources.find(key);
+  if (it != _sources.end()) {
+    source = it->second;
+    return true;
+  }
+
+  if (_directory.empty()) {
+    return false;
+  }
+
+  const std::string path = _path(key, ".glsl");
+  if (!Filesystem::isFile(path)) {
+    return false;
+  }
+
+  source        = Filesystem::readFileContents(path.c_str());
+  _sources[key] = source;
+  return true;
+}
+
+void ShaderProgramCache::setSource(uint64_t key, const std::string& source)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _sources[key] = source;
+  if (!_directory.empty()) {
+    writeFileAtomically(_path(key, ".glsl"), source.c_str(), source.size());
+  }
+}
+
+bool ShaderProgramCache::getBinary(uint64_t key, GL::GLenum& binaryFormat,
+                                   Uint8Array& binary)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (_directory.empty()) {
+    return false;
+  }
+
+  // The binary format followed by the binary
+  const std::string path = _path(key, ".bin");
+  if (!Filesystem::isFile(path)) {
+    return false;
+  }
+
+  const std::string contents = Filesystem::readFileContents(path.c_str());
+  if (contents.size() <= sizeof(GL::GLenum)) {
+    return false;
+  }
+
+  std::memcpy(&binaryFormat, contents.data(), sizeof(GL::GLenum));
+  binary.assign(contents.begin() + sizeof(GL::GLenum), contents.end());
+  return true;
+}
+
+void ShaderProgramCache::setBinary(uint64_t key, GL::GLenum binaryFormat,
+                                   const Uint8Array& binary)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (_directory.empty() || binary.empty()) {
+    return;
+  }
+
+  std::string contents(sizeof(GL::GLenum) + binary.size(), '\0');
+  std::memcpy(&contents[0], &binaryFormat, sizeof(GL::GLenum));
+  std::memcpy(&contents[sizeof(GL::GLenum)], binary.data(), binary.size());
+  writeFileAtomically(_path(key, ".bin"), contents.c_str(), contents.size());
+}
+
+void ShaderProgramCache::removeBinary(uint64_t key)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (!_directory.empty()) {
+    Filesystem::removeFile(_path(key, ".bin"));
+  }
+}
+
+void ShaderProgramCache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _sources.clear();
+}
+
+uint64_t ShaderProgramCache::Hash(const std::string& data, uint64_t hash)
+{
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 0x100000001b3ull;
+  }
+
+  return hash;
+}
+
+std::string ShaderProgramCache::_path(uint64_t key,
+                                      const char* extension) const
+{
+  std::ostringstream filename;
+  filename << std::hex << std::setw(16) << std::setfill('0') << key
+           << extension;
+  return Filesystem::joinPath<std::string>(_directory, filename.str());
+}
+
+} // end of namespace BABYLON
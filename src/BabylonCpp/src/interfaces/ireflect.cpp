@@ -1,4 +1,7 @@
 #include <babylon/interfaces/ireflect.h>
+
+#include <babylon/bones/bone.h>
+#include <babylon/materials/standard_material.h>
 #include <babylon/mesh/abstract_mesh.h>
 
 namespace BABYLON {
@@ -97,6 +100,35 @@ any IReflect::getProperty(const any& property,
   // IAnimatable
   if (property.is<IReflect*>()) {
     switch (property._<IReflect*>()->type()) {
+      // Bones
+      case Type::BONE:
+        if (targetProperty == "_matrix") {
+          _property = &dynamic_cast<Bone*>(this)->getLocalMatrix();
+        }
+        break;
+      // Materials
+      case Type::MATERIAL:
+      case Type::MULTIMATERIAL:
+      case Type::SHADERMATERIAL:
+      case Type::PBRMATERIAL:
+      case Type::NORMALMATERIAL:
+        if (targetProperty == "alpha") {
+          _property = &dynamic_cast<Material*>(this)->alpha;
+        }
+        break;
+      case Type::STANDARDMATERIAL: {
+        auto material = dynamic_cast<StandardMaterial*>(this);
+        if (auto color3Property
+            = _getColor3Property(material, targetProperty)) {
+          _property = color3Property;
+        }
+        else if (targetProperty == "specularPower") {
+          _property = &material->specularPower;
+        }
+        else if (targetProperty == "alpha") {
+          _property = &material->alpha;
+        }
+      } break;
       // Meshes
       case Type::ABSTRACTMESH:
       case Type::GROUNDMESH:
@@ -111,6 +143,9 @@ any IReflect::getProperty(const any& property,
                  = _getQuaternionProperty(mesh, targetProperty)) {
           _property = quaternionProperty;
         }
+        else if (targetProperty == "visibility") {
+          _property = &mesh->visibility;
+        }
       } break;
       default:
         break;
@@ -174,13 +209,13 @@ any IReflect::getProperty(const any& property,
 
   // Color3
   if (property.is<Color3*>()) {
-    if (targetProperty == "x") {
+    if (targetProperty == "r" || targetProperty == "x") {
       _property = &property._<Color3*>()->r;
     }
-    else if (targetProperty == "y") {
+    else if (targetProperty == "g" || targetProperty == "y") {
       _property = &property._<Color3*>()->g;
     }
-    else if (targetProperty == "z") {
+    else if (targetProperty == "b" || targetProperty == "z") {
       _property = &property._<Color3*>()->b;
     }
     return _property;
@@ -259,4 +294,24 @@ Quaternion* IReflect::_getQuaternionProperty(AbstractMesh* target,
   return quaternionProperty;
 }
 
+Color3* IReflect::_getColor3Property(StandardMaterial* target,
+                                     const std::string& targetProperty)
+{
+  Color3* color3Property = nullptr;
+  if (targetProperty == "diffuseColor") {
+    color3Property = &target->diffuseColor;
+  }
+  else if (targetProperty == "specularColor") {
+    color3Property = &target->specularColor;
+  }
+  else if (targetProperty == "emissiveColor") {
+    color3Property = &target->emissiveColor;
+  }
+  else if (targetProperty == "ambientColor") {
+    color3Property = &target->ambientColor;
+  }
+
+  return color3Property;
+}
+
 } // end of namespace BABYLON
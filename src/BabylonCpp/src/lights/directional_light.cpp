@@ -4,6 +4,7 @@
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/materials/effect.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/mesh/abstract_mesh.h>
 
 namespace BABYLON {
@@ -161,6 +162,26 @@ void DirectionalLight::transferToEffect(Effect* effect,
                     1.f);
 }
 
+void DirectionalLight::transferToUniformBuffer(UniformBuffer* uniformBuffer)
+{
+  if (parent() && parent()->getWorldMatrix()) {
+    if (!_transformedDirection) {
+      _transformedDirection = std_util::make_unique<Vector3>(Vector3::Zero());
+    }
+
+    Vector3::TransformNormalToRef(direction, *parent()->getWorldMatrix(),
+                                  *_transformedDirection);
+    uniformBuffer->updateFloat4("vLightData", _transformedDirection->x,
+                                _transformedDirection->y,
+                                _transformedDirection->z, 1.f);
+
+    return;
+  }
+
+  uniformBuffer->updateFloat4("vLightData", direction.x, direction.y,
+                              direction.z, 1.f);
+}
+
 Matrix* DirectionalLight::_getWorldMatrix()
 {
   if (!_worldMatrix) {
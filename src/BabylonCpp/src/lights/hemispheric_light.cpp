@@ -3,6 +3,7 @@
 #include <babylon/core/json.h>
 #include <babylon/engine/scene.h>
 #include <babylon/materials/effect.h>
+#include <babylon/materials/uniform_buffer.h>
 
 namespace BABYLON {
 
@@ -45,6 +46,14 @@ void HemisphericLight::transferToEffect(
   effect->setColor3(groundColorUniformName, groundColor.scale(intensity));
 }
 
+void HemisphericLight::transferToUniformBuffer(UniformBuffer* uniformBuffer)
+{
+  auto normalizeDirection = Vector3::Normalize(direction);
+  uniformBuffer->updateFloat4("vLightData", normalizeDirection.x,
+                              normalizeDirection.y, normalizeDirection.z, 0.f);
+  uniformBuffer->updateColor3("vLightGround", groundColor.scale(intensity));
+}
+
 Matrix* HemisphericLight::_getWorldMatrix()
 {
   if (!_worldMatrix) {
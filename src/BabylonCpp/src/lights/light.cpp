@@ -7,6 +7,7 @@
 #include <babylon/lights/point_light.h>
 #include <babylon/lights/shadows/shadow_generator.h>
 #include <babylon/lights/spot_light.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/tools/serialization_helper.h>
 
@@ -25,6 +26,8 @@ Light::Light(const std::string& iName, Scene* scene)
     , _shadowGenerator{nullptr}
     , _parentedWorldMatrix{nullptr}
     , _worldMatrix{std_util::make_unique<Matrix>(Matrix::Identity())}
+    , _uniformBuffer{nullptr}
+    , _uniformBufferRenderId{-1}
 {
 }
 
@@ -81,6 +84,31 @@ void Light::transferToEffect(Effect* /*effect*/,
 {
 }
 
+void Light::transferToUniformBuffer(UniformBuffer* /*uniformBuffer*/)
+{
+}
+
+UniformBuffer* Light::getUniformBuffer()
+{
+  auto scene = getScene();
+
+  if (!_uniformBuffer) {
+    _uniformBuffer = std_util::make_unique<UniformBuffer>(scene->getEngine());
+    _uniformBuffer->addUniform("vLightData", 4);
+    _uniformBuffer->addUniform("vLightDirection", 4);
+    _uniformBuffer->addUniform("vLightGround", 3);
+    _uniformBuffer->create();
+  }
+
+  if (_uniformBufferRenderId != scene->getRenderId()) {
+    _uniformBufferRenderId = scene->getRenderId();
+    transferToUniformBuffer(_uniformBuffer.get());
+    _uniformBuffer->update();
+  }
+
+  return _uniformBuffer.get();
+}
+
 Matrix* Light::_getWorldMatrix()
 {
 
@@ -145,6 +173,10 @@ void Light::dispose(bool /*doNotRecurse*/)
     _shadowGenerator = nullptr;
   }
 
+  if (_uniformBuffer) {
+    _uniformBuffer->dispose();
+  }
+
   // Animations
   getScene()->stopAnimation(this);
 
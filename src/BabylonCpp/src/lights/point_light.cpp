@@ -3,6 +3,7 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/engine/scene.h>
 #include <babylon/materials/effect.h>
+#include <babylon/materials/uniform_buffer.h>
 
 namespace BABYLON {
 
@@ -66,6 +67,19 @@ void PointLight::transferToEffect(Effect* effect,
                     0.f);
 }
 
+void PointLight::transferToUniformBuffer(UniformBuffer* uniformBuffer)
+{
+  if (computeTransformedPosition()) {
+    uniformBuffer->updateFloat4("vLightData", transformedPosition->x,
+                                transformedPosition->y, transformedPosition->z,
+                                0.f);
+    return;
+  }
+
+  uniformBuffer->updateFloat4("vLightData", position.x, position.y, position.z,
+                              0.f);
+}
+
 bool PointLight::needCube() const
 {
   return true;
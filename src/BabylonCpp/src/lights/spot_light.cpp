@@ -2,6 +2,7 @@
 
 #include <babylon/cameras/camera.h>
 #include <babylon/materials/effect.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/math/axis.h>
 
 namespace BABYLON {
@@ -119,6 +120,34 @@ void SpotLight::transferToEffect(Effect* effect,
                     std::cos(angle * 0.5f));
 }
 
+void SpotLight::transferToUniformBuffer(UniformBuffer* uniformBuffer)
+{
+  auto normalizeDirection = Vector3::Zero();
+
+  if (computeTransformedPosition()) {
+    if (!_transformedDirection) {
+      _transformedDirection = std_util::make_unique<Vector3>(Vector3::Zero());
+    }
+
+    Vector3::TransformNormalToRef(direction, *parent()->getWorldMatrix(),
+                                  *_transformedDirection);
+
+    uniformBuffer->updateFloat4("vLightData", transformedPosition->x,
+                                transformedPosition->y, transformedPosition->z,
+                                exponent);
+    normalizeDirection = Vector3::Normalize(*_transformedDirection);
+  }
+  else {
+    uniformBuffer->updateFloat4("vLightData", position.x, position.y,
+                                position.z, exponent);
+    normalizeDirection = Vector3::Normalize(direction);
+  }
+
+  uniformBuffer->updateFloat4("vLightDirection", normalizeDirection.x,
+                              normalizeDirection.y, normalizeDirection.z,
+                              std::cos(angle * 0.5f));
+}
+
 Matrix* SpotLight::_getWorldMatrix()
 {
   if (!_worldMatrix) {
@@ -0,0 +1,435 @@
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
+
+#include <babylon/core/json.h>
+#include <babylon/core/logging.h>
+#include <babylon/tools/file_loader.h>
+
+#include <cstring>
+
+namespace BABYLON {
+
+namespace {
+
+const char Magic[4]           = {'B', 'B', 'I', 'N'};
+const uint32_t ByteOrderMark  = 0x01020304;
+const size_t SectionAlignment = 16;
+const size_t MaxDocumentDepth = 512;
+
+struct Header {
+  char magic[4];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint32_t sectionCount;
+  uint64_t documentOffset;
+  uint64_t documentSize;
+}; // end of struct Header
+
+struct SectionEntry {
+  uint64_t offset;
+  uint64_t size;
+}; // end of struct SectionEntry
+
+struct Section {
+  const char* data;
+  size_t size;
+}; // end of struct Section
+
+enum class Tag : uint8_t {
+  NULL_VALUE    = 0,
+  FALSE_VALUE   = 1,
+  TRUE_VALUE    = 2,
+  NUMBER        = 3,
+  STRING        = 4,
+  ARRAY         = 5,
+  OBJECT        = 6,
+  FLOAT32_ARRAY = 7, // Section of packed floats
+  UINT32_ARRAY  = 8  // Section of packed unsigned integers
+}; // end of enum class Tag
+
+class Writer {
+
+public:
+  std::string document;
+  std::vector<Section> sections;
+
+  template <typename T>
+  void write(const T& value)
+  {
+    document.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void writeString(const std::string& value)
+  {
+    write(static_cast<uint32_t>(value.size()));
+    document.append(value);
+  }
+
+  void writeValue(const Json::value& value)
+  {
+    if (value.is<picojson::null>()) {
+      write(Tag::NULL_VALUE);
+    }
+    else if (value.is<bool>()) {
+      write(value.get<bool>() ? Tag::TRUE_VALUE : Tag::FALSE_VALUE);
+    }
+    else if (value.is<double>()) {
+      write(Tag::NUMBER);
+      write(value.get<double>());
+    }
+    else if (value.is<std::string>()) {
+      write(Tag::STRING);
+      writeString(value.get<std::string>());
+    }
+    else if (value.is<Json::array>()) {
+      const auto& elements = value.get<Json::array>();
+      write(Tag::ARRAY);
+      write(static_cast<uint32_t>(elements.size()));
+      for (const auto& element : elements) {
+        writeValue(element);
+      }
+    }
+    else if (value.is<Json::float32_array>()) {
+      writePackedArray(Tag::FLOAT32_ARRAY, value.get<Json::float32_array>());
+    }
+    else if (value.is<Json::uint32_array>()) {
+      writePackedArray(Tag::UINT32_ARRAY, value.get<Json::uint32_array>());
+    }
+    else {
+      const auto& members = value.get<Json::object>();
+      write(Tag::OBJECT);
+      write(static_cast<uint32_t>(members.size()));
+      for (const auto& member : members) {
+        writeString(member.first);
+        writeValue(member.second);
+      }
+    }
+  }
+
+private:
+  template <typename T>
+  void writePackedArray(Tag tag, const std::vector<T>& elements)
+  {
+    write(tag);
+    write(static_cast<uint32_t>(sections.size()));
+    const auto data = reinterpret_cast<const char*>(elements.data());
+    sections.emplace_back(Section{data, elements.size() * sizeof(T)});
+  }
+
+}; // end of class Writer
+
+class Reader {
+
+public:
+  Reader(const char* data, size_t size, const char* document,
+         size_t documentSize, const SectionEntry* sections,
+         uint32_t sectionCount)
+      : _data{data}
+      , _size{size}
+      , _cursor{document}
+      , _end{document + documentSize}
+      , _sections{sections}
+      , _sectionCount{sectionCount}
+  {
+  }
+
+  bool readValue(Json::value& value, size_t depth = 0)
+  {
+    Tag tag;
+    if (depth > MaxDocumentDepth || !read(tag)) {
+      return false;
+    }
+
+    switch (tag) {
+      case Tag::NULL_VALUE:
+        value = Json::value();
+        return true;
+      case Tag::FALSE_VALUE:
+      case Tag::TRUE_VALUE:
+        value = Json::value(tag == Tag::TRUE_VALUE);
+        return true;
+      case Tag::NUMBER: {
+        double number;
+        if (!read(number)) {
+          return false;
+        }
+        value = Json::value(number);
+        return true;
+      }
+      case Tag::STRING: {
+        std::string text;
+        if (!readString(text)) {
+          return false;
+        }
+        value.set<std::string>(std::move(text));
+        return true;
+      }
+      case Tag::ARRAY: {
+        // Each element takes at least a byte
+        uint32_t count;
+        if (!read(count) || count > remaining()) {
+          return false;
+        }
+        Json::array elements(count);
+        for (auto& element : elements) {
+          if (!readValue(element, depth + 1)) {
+            return false;
+          }
+        }
+        value.set<Json::array>(std::move(elements));
+        return true;
+      }
+      case Tag::OBJECT: {
+        uint32_t count;
+        if (!read(count)) {
+          return false;
+        }
+        Json::object members;
+        for (uint32_t i = 0; i < count; ++i) {
+          std::string key;
+          if (!readString(key) || !readValue(members[key], depth + 1)) {
+            return false;
+          }
+        }
+        value.set<Json::object>(std::move(members));
+        return true;
+      }
+      case Tag::FLOAT32_ARRAY:
+        return readPackedArray<Json::float32_array>(value);
+      case Tag::UINT32_ARRAY:
+        return readPackedArray<Json::uint32_array>(value);
+      default:
+        return false;
+    }
+  }
+
+private:
+  size_t remaining() const
+  {
+    return static_cast<size_t>(_end - _cursor);
+  }
+
+  template <typename T>
+  bool read(T& value)
+  {
+    if (remaining() < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, _cursor, sizeof(T));
+    _cursor += sizeof(T);
+    return true;
+  }
+
+  bool readString(std::string& text)
+  {
+    uint32_t length;
+    if (!read(length) || remaining() < length) {
+      return false;
+    }
+    text.assign(_cursor, length);
+    _cursor += length;
+    return true;
+  }
+
+  template <typename T>
+  bool readPackedArray(Json::value& value)
+  {
+    using Element = typename T::value_type;
+    uint32_t index;
+    if (!read(index) || index >= _sectionCount) {
+      return false;
+    }
+
+    const auto& section = _sections[index];
+    if (section.offset > _size || section.size > _size - section.offset
+        || section.size % sizeof(Element) != 0) {
+      return false;
+    }
+
+    // Copied in a single block into the typed array kept by the document
+    T elements(static_cast<size_t>(section.size) / sizeof(Element));
+    std::memcpy(elements.data(), _data + section.offset,
+                static_cast<size_t>(section.size));
+    value.set<T>(std::move(elements));
+    return true;
+  }
+
+private:
+  const char* _data;
+  size_t _size;
+  const char* _cursor;
+  const char* _end;
+  const SectionEntry* _sections;
+  uint32_t _sectionCount;
+
+}; // end of class Reader
+
+size_t align(size_t offset)
+{
+  return (offset + SectionAlignment - 1) & ~(SectionAlignment - 1);
+}
+
+} // end of anonymous namespace
+
+BabylonBinaryFileLoader::BabylonBinaryFileLoader()
+{
+  extensions.mapping.clear();
+  extensions.mapping.emplace(std::make_pair(".babylonbin", true));
+}
+
+BabylonBinaryFileLoader::~BabylonBinaryFileLoader()
+{
+}
+
+bool BabylonBinaryFileLoader::importMesh(
+  const std::vector<std::string>& meshesNames, Scene* scene,
+  const std::string& data, const std::string& rootUrl,
+  std::vector<AbstractMesh*>& meshes,
+  std::vector<ParticleSystem*>& particleSystems,
+  std::vector<Skeleton*>& skeletons)
+{
+  return importMeshData(meshesNames, scene, data.data(), data.size(), rootUrl,
+                        meshes, particleSystems, skeletons);
+}
+
+bool BabylonBinaryFileLoader::load(Scene* scene, const std::string& data,
+                                   const std::string& rootUrl)
+{
+  return loadData(scene, data.data(), data.size(), rootUrl);
+}
+
+bool BabylonBinaryFileLoader::importMeshData(
+  const std::vector<std::string>& meshesNames, Scene* scene, const char* data,
+  size_t size, const std::string& rootUrl, std::vector<AbstractMesh*>& meshes,
+  std::vector<ParticleSystem*>& particleSystems,
+  std::vector<Skeleton*>& skeletons)
+{
+  Json::value parsedData;
+  std::string err = Deserialize(data, size, parsedData);
+  if (!err.empty()) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFileLoader", "importMesh has failed: %s",
+                       err.c_str());
+    return false;
+  }
+
+  return importParsedData(meshesNames, scene, parsedData, rootUrl, meshes,
+                          particleSystems, skeletons);
+}
+
+bool BabylonBinaryFileLoader::loadData(Scene* scene, const char* data,
+                                       size_t size, const std::string& rootUrl)
+{
+  Json::value parsedData;
+  std::string err = Deserialize(data, size, parsedData);
+  if (!err.empty()) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFileLoader", "importScene has failed: %s",
+                       err.c_str());
+    return false;
+  }
+
+  return loadParsedData(scene, parsedData, rootUrl);
+}
+
+std::string BabylonBinaryFileLoader::Serialize(const Json::value& parsedData)
+{
+  Writer writer;
+  writer.writeValue(parsedData);
+
+  Header header;
+  std::memcpy(header.magic, Magic, sizeof(Magic));
+  header.version        = FormatVersion;
+  header.byteOrderMark  = ByteOrderMark;
+  header.sectionCount   = static_cast<uint32_t>(writer.sections.size());
+  header.documentOffset = sizeof(Header)
+                          + writer.sections.size() * sizeof(SectionEntry);
+  header.documentSize = writer.document.size();
+
+  // Sections follow the document, aligned for the typed arrays
+  std::vector<SectionEntry> sectionTable;
+  sectionTable.reserve(writer.sections.size());
+  size_t offset = header.documentOffset + header.documentSize;
+  for (const auto& section : writer.sections) {
+    offset = align(offset);
+    sectionTable.emplace_back(SectionEntry{offset, section.size});
+    offset += section.size;
+  }
+
+  std::string output;
+  output.reserve(offset);
+  output.append(reinterpret_cast<const char*>(&header), sizeof(Header));
+  output.append(reinterpret_cast<const char*>(sectionTable.data()),
+                sectionTable.size() * sizeof(SectionEntry));
+  output.append(writer.document);
+  for (size_t i = 0; i < writer.sections.size(); ++i) {
+    output.resize(static_cast<size_t>(sectionTable[i].offset), '\0');
+    output.append(writer.sections[i].data, writer.sections[i].size);
+  }
+
+  return output;
+}
+
+std::string BabylonBinaryFileLoader::Deserialize(const char* data, size_t size,
+                                                 Json::value& parsedData)
+{
+  Header header;
+  if (size < sizeof(Header)) {
+    return "Truncated header";
+  }
+  std::memcpy(&header, data, sizeof(Header));
+  if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+    return "Not a binary babylon file";
+  }
+  if (header.version != FormatVersion) {
+    return "Unsupported format version " + std::to_string(header.version);
+  }
+  if (header.byteOrderMark != ByteOrderMark) {
+    return "Unsupported byte order";
+  }
+
+  const uint64_t sectionTableSize
+    = static_cast<uint64_t>(header.sectionCount) * sizeof(SectionEntry);
+  if (sizeof(Header) + sectionTableSize > size
+      || header.documentOffset > size
+      || header.documentSize > size - header.documentOffset) {
+    return "Truncated file";
+  }
+
+  std::vector<SectionEntry> sections(header.sectionCount);
+  std::memcpy(sections.data(), data + sizeof(Header),
+              static_cast<size_t>(sectionTableSize));
+
+  Reader reader(data, size, data + header.documentOffset,
+                static_cast<size_t>(header.documentSize), sections.data(),
+                header.sectionCount);
+  if (!reader.readValue(parsedData)) {
+    parsedData = Json::value();
+    return "Invalid document";
+  }
+
+  return "";
+}
+
+std::string BabylonBinaryFileLoader::Convert(const std::string& babylonFilename,
+                                             const std::string& binaryFilename)
+{
+  std::string error;
+  auto data = FileLoader::Default().load(babylonFilename, nullptr, true, error);
+  if (!data) {
+    return error;
+  }
+
+  Json::value parsedData;
+  error = Json::Parse(parsedData, data->data(), data->size());
+  if (!error.empty()) {
+    return error;
+  }
+
+  const auto output = Serialize(parsedData);
+  std::ofstream file(binaryFilename, std::ios::out | std::ios::binary);
+  if (!file.write(output.data(), static_cast<std::streamsize>(output.size()))) {
+    return "Unable to write the file " + binaryFilename;
+  }
+
+  return "";
+}
+
+} // end of namespace BABYLON
@@ -81,14 +81,56 @@ bool BabylonFileLoader::importMesh(
   std::vector<AbstractMesh*>& meshes,
   std::vector<ParticleSystem*>& particleSystems,
   std::vector<Skeleton*>& skeletons)
+{
+  return importMeshData(meshesNames, scene, data.data(), data.size(), rootUrl,
+                        meshes, particleSystems, skeletons);
+}
+
+bool BabylonFileLoader::load(Scene* scene, const std::string& data,
+                             const std::string& rootUrl)
+{
+  return loadData(scene, data.data(), data.size(), rootUrl);
+}
+
+bool BabylonFileLoader::importMeshData(
+  const std::vector<std::string>& meshesNames, Scene* scene, const char* data,
+  size_t size, const std::string& rootUrl, std::vector<AbstractMesh*>& meshes,
+  std::vector<ParticleSystem*>& particleSystems,
+  std::vector<Skeleton*>& skeletons)
+{
+  Json::value parsedData;
+  std::string err = Json::Parse(parsedData, data, size);
+  if (!err.empty()) {
+    BABYLON_LOGF_ERROR("BabylonFileLoader",
+                       "importMesh has failed JSON parse: %s", err.c_str());
+    return false;
+  }
+
+  return importParsedData(meshesNames, scene, parsedData, rootUrl, meshes,
+                          particleSystems, skeletons);
+}
+
+bool BabylonFileLoader::loadData(Scene* scene, const char* data, size_t size,
+                                 const std::string& rootUrl)
 {
   Json::value parsedData;
-  std::string err = Json::Parse(parsedData, data.c_str());
+  std::string err = Json::Parse(parsedData, data, size);
   if (!err.empty()) {
-    std::string log = "importMesh has failed JSON parse";
-    BABYLON_LOGF_ERROR("BabylonFileLoader", "%s", log.c_str());
+    BABYLON_LOGF_ERROR("BabylonFileLoader",
+                       "importScene has failed JSON parse: %s", err.c_str());
     return false;
   }
+
+  return loadParsedData(scene, parsedData, rootUrl);
+}
+
+bool BabylonFileLoader::importParsedData(
+  const std::vector<std::string>& meshesNames, Scene* scene,
+  const Json::value& parsedData, const std::string& rootUrl,
+  std::vector<AbstractMesh*>& meshes,
+  std::vector<ParticleSystem*>& particleSystems,
+  std::vector<Skeleton*>& skeletons)
+{
   std::ostringstream log;
 
   bool fullDetails = SceneLoader::LoggingLevel == SceneLoader::DETAILED_LOGGING;
@@ -294,16 +336,10 @@ bool BabylonFileLoader::importMesh(
   return true;
 }
 
-bool BabylonFileLoader::load(Scene* scene, const std::string& data,
-                             const std::string& rootUrl)
+bool BabylonFileLoader::loadParsedData(Scene* scene,
+                                       const Json::value& parsedData,
+                                       const std::string& rootUrl)
 {
-  Json::value parsedData;
-  std::string err = Json::Parse(parsedData, data.c_str());
-  if (!err.empty()) {
-    std::string log = "importScene has failed JSON parse";
-    BABYLON_LOGF_ERROR("BabylonFileLoader", "%s", log.c_str());
-    return false;
-  }
   std::ostringstream log;
   bool fullDetails = SceneLoader::LoggingLevel == SceneLoader::DETAILED_LOGGING;
 
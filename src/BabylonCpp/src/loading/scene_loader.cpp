@@ -5,11 +5,35 @@
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/loading/iregistered_plugin.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
 #include <babylon/loading/plugins/babylon/babylon_file_loader.h>
-#include <babylon/tools/tools.h>
+#include <babylon/tools/file_loader.h>
 
 namespace BABYLON {
 
+namespace {
+
+std::shared_ptr<FileData>
+loadFile(const std::string& url, const std::function<void()>& progressCallBack,
+         bool useArrayBuffer)
+{
+  // Binary files are memory mapped and passed to the plugin without copy
+  FileLoader::ProgressCallback onProgress = nullptr;
+  if (progressCallBack) {
+    onProgress = [&progressCallBack](size_t, size_t) { progressCallBack(); };
+  }
+
+  std::string error;
+  auto data
+    = FileLoader::Default().load(url, onProgress, useArrayBuffer, error);
+  if (!data) {
+    BABYLON_LOG_ERROR("SceneLoader", error);
+  }
+  return data;
+}
+
+} // end of anonymous namespace
+
 bool SceneLoader::ForceFullSceneLoadingForIncremental = false;
 bool SceneLoader::ShowLoadingScreen                   = true;
 unsigned int SceneLoader::LoggingLevel                = SceneLoader::NO_LOGGING;
@@ -19,9 +43,10 @@ std::unordered_map<std::string, IRegisteredPlugin>
 
 IRegisteredPlugin SceneLoader::_getDefaultPlugin()
 {
-  // Add default plugin
+  // Add default plugins
   if (SceneLoader::_registeredPlugins.empty()) {
     SceneLoader::RegisterPlugin(std::make_shared<BabylonFileLoader>());
+    SceneLoader::RegisterPlugin(std::make_shared<BabylonBinaryFileLoader>());
   }
 
   return SceneLoader::_registeredPlugins[".babylon"];
@@ -30,11 +55,12 @@ IRegisteredPlugin SceneLoader::_getDefaultPlugin()
 IRegisteredPlugin
 SceneLoader::_getPluginForExtension(const std::string& extension)
 {
+  auto defaultPlugin = SceneLoader::_getDefaultPlugin();
   if (std_util::contains(SceneLoader::_registeredPlugins, extension)) {
     return SceneLoader::_registeredPlugins[extension];
   }
 
-  return SceneLoader::_getDefaultPlugin();
+  return defaultPlugin;
 }
 
 IRegisteredPlugin
@@ -73,8 +99,8 @@ void SceneLoader::RegisterPlugin(std::shared_ptr<ISceneLoaderPlugin>&& plugin)
   auto& extensions = plugin->extensions.mapping;
   for (auto& item : extensions) {
     SceneLoader::_registeredPlugins[String::toLowerCase(item.first)] = {
-      std::move(plugin), // plugin
-      item.second        // isBinary
+      plugin,     // plugin
+      item.second // isBinary
     };
   }
 }
@@ -101,13 +127,13 @@ void SceneLoader::ImportMesh(
   auto& plugin         = registeredPlugin.plugin;
   auto& useArrayBuffer = registeredPlugin.isBinary;
 
-  auto importMeshFromData = [&](const std::string& data) {
+  auto importMeshFromData = [&](const char* data, size_t size) {
     std::vector<AbstractMesh*> meshes;
     std::vector<ParticleSystem*> particleSystems;
     std::vector<Skeleton*> skeletons;
 
-    if (!plugin->importMesh(meshesNames, scene, data, rootUrl, meshes,
-                            particleSystems, skeletons)) {
+    if (!plugin->importMeshData(meshesNames, scene, data, size, rootUrl,
+                                meshes, particleSystems, skeletons)) {
       if (onerror) {
         onerror(scene,
                 "Unable to import meshes from " + rootUrl + sceneFilename, "");
@@ -122,13 +148,15 @@ void SceneLoader::ImportMesh(
   };
 
   if (!directLoad.empty()) {
-    importMeshFromData(directLoad);
+    importMeshFromData(directLoad.data(), directLoad.size());
     return;
   }
 
-  Tools::LoadFile(rootUrl + sceneFilename,
-                  [&](const std::string& data) { importMeshFromData(data); },
-                  progressCallBack, useArrayBuffer);
+  auto fileData
+    = loadFile(rootUrl + sceneFilename, progressCallBack, useArrayBuffer);
+  if (fileData) {
+    importMeshFromData(fileData->data(), fileData->size());
+  }
 }
 
 std::unique_ptr<Scene>
@@ -166,8 +194,8 @@ void SceneLoader::Append(const std::string& rootUrl,
     scene->getEngine()->displayLoadingUI();
   }
 
-  auto loadSceneFromData = [&](const std::string& data) {
-    if (!plugin->load(scene, data, rootUrl)) {
+  auto loadSceneFromData = [&](const char* data, size_t size) {
+    if (!plugin->loadData(scene, data, size, rootUrl)) {
       if (onerror) {
         onerror(scene);
       }
@@ -186,14 +214,17 @@ void SceneLoader::Append(const std::string& rootUrl,
 
   if (!directLoad.empty()) {
     // Direct load
-    loadSceneFromData(directLoad);
+    loadSceneFromData(directLoad.data(), directLoad.size());
     return;
   }
 
   // Loading file from disk via input file or drag'n'drop
-  if (String::startsWith(rootUrl, "file:")) {
-    Tools::LoadFile(sceneFilename, loadSceneFromData, progressCallBack,
-                    useArrayBuffer);
+  auto fileData = String::startsWith(rootUrl, "file:") ?
+                    loadFile(sceneFilename, progressCallBack, useArrayBuffer) :
+                    loadFile(rootUrl + sceneFilename, progressCallBack,
+                             useArrayBuffer);
+  if (fileData) {
+    loadSceneFromData(fileData->data(), fileData->size());
   }
 }
 
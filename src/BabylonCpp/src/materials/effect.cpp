@@ -3,6 +3,8 @@
 #include <babylon/core/logging.h>
 #include <babylon/core/string.h>
 #include <babylon/engine/engine.h>
+#include <babylon/engine/shader_compilation_queue.h>
+#include <babylon/engine/shader_program_cache.h>
 #include <babylon/materials/effect_fallbacks.h>
 #include <babylon/materials/effect_includes_shaders_store.h>
 #include <babylon/materials/effect_shaders_store.h>
@@ -29,15 +31,22 @@ Effect::Effect(
     , _uniformsNames{uniformsNames}
     , _samplers{samplers}
     , _isReady{false}
+    , _isQueued{false}
     , _compilationError{""}
     , _attributesNames{attributesNames}
     , _indexParameters{indexParameters}
 {
   std_util::concat(_uniformsNames, samplers);
+  _indexUniforms();
 
   std::string vertexSource   = baseName;
   std::string fragmentSource = baseName;
 
+  if (_engine->asyncShaderCompilation) {
+    _queueEffect(vertexSource, fragmentSource);
+    return;
+  }
+
   _loadVertexShader(vertexSource, [this, &fragmentSource,
                                    &fallbacks](const std::string& vertexCode) {
     _processIncludes(vertexCode, [this, &fragmentSource, &fallbacks](
@@ -72,11 +81,13 @@ Effect::Effect(
     , _uniformsNames{uniformsNames}
     , _samplers{samplers}
     , _isReady{false}
+    , _isQueued{false}
     , _compilationError{""}
     , _attributesNames{attributesNames}
     , _indexParameters{indexParameters}
 {
   std_util::concat(_uniformsNames, samplers);
+  _indexUniforms();
 
   std::string vertexSource   = "";
   std::string fragmentSource = "";
@@ -101,6 +112,11 @@ Effect::Effect(
 
   name = fragmentSource;
 
+  if (_engine->asyncShaderCompilation) {
+    _queueEffect(vertexSource, fragmentSource);
+    return;
+  }
+
   _loadVertexShader(vertexSource, [this, &fragmentSource,
                                    &fallbacks](const std::string& vertexCode) {
     _processIncludes(vertexCode, [this, &fragmentSource, &fallbacks](
@@ -121,6 +137,9 @@ Effect::Effect(
 
 Effect::~Effect()
 {
+  if (_isQueued) {
+    _engine->getShaderCompilationQueue().remove(this);
+  }
 }
 
 bool Effect::isReady() const
@@ -161,16 +180,23 @@ size_t Effect::getAttributesCount()
 
 int Effect::getUniformIndex(const std::string& uniformName)
 {
-  return std_util::index_of(_uniformsNames, uniformName);
+  auto it = _uniformIndices.find(uniformName);
+  return (it != _uniformIndices.end()) ? it->second : -1;
 }
 
 GL::IGLUniformLocation* Effect::getUniform(const std::string& uniformName)
 {
-  if (std_util::contains(_uniforms, uniformName)) {
-    return _uniforms[uniformName].get();
+  return getUniform(getUniformIndex(uniformName));
+}
+
+GL::IGLUniformLocation* Effect::getUniform(int uniformIndex)
+{
+  if (uniformIndex < 0
+      || static_cast<size_t>(uniformIndex) >= _uniformLocations.size()) {
+    return nullptr;
   }
 
-  return nullptr;
+  return _uniformLocations[static_cast<size_t>(uniformIndex)];
 }
 
 std::vector<std::string>& Effect::getSamplers()
@@ -263,6 +289,85 @@ void Effect::_loadFragmentShader(
   Tools::LoadFile(fragmentShaderUrl + ".fragment.fx", callback);
 }
 
+void Effect::_queueEffect(const std::string& vertexSource,
+                          const std::string& fragmentSource)
+{
+  _loadVertexShader(vertexSource, [this, &fragmentSource](
+                                    const std::string& vertexCode) {
+    _loadFragmentShader(fragmentSource, [this, &vertexCode](
+                                          const std::string& fragmentCode) {
+      _isQueued = true;
+      _engine->getShaderCompilationQueue().add(this, vertexCode, fragmentCode);
+    });
+  });
+}
+
+void Effect::_preprocessSources(std::string& vertexCode,
+                                std::string& fragmentCode)
+{
+  _processIncludes(vertexCode, [this, &vertexCode](const std::string& code) {
+    vertexCode = _processPrecision(code);
+  });
+  _processIncludes(fragmentCode,
+                   [this, &fragmentCode](const std::string& code) {
+                     fragmentCode = _processPrecision(code);
+                   });
+}
+
+void Effect::_setProgram(std::unique_ptr<GL::IGLProgram>&& program)
+{
+  _isQueued = false;
+  _program  = std::move(program);
+
+  _uniforms   = _engine->getUniforms(_program.get(), _uniformsNames);
+  _attributes = _engine->getAttributes(_program.get(), _attributesNames);
+
+  _uniformLocations.assign(_uniformsNames.size(), nullptr);
+  for (size_t index = 0; index < _uniformsNames.size(); ++index) {
+    auto it = _uniforms.find(_uniformsNames[index]);
+    if (it != _uniforms.end()) {
+      _uniformLocations[index] = it->second.get();
+    }
+  }
+
+  for (unsigned int index = 0; index < _samplers.size(); ++index) {
+    auto sampler = getUniform(_samplers[index]);
+    if (!sampler) {
+      _samplers.erase(_samplers.begin() + index,
+                      _samplers.begin() + index + 1);
+      --index;
+    }
+  }
+
+  _engine->bindSamplers(this);
+
+  for (const auto& uniformBlockBinding : _uniformBlockBindings) {
+    _engine->bindUniformBlock(_program.get(), uniformBlockBinding.first,
+                              uniformBlockBinding.second);
+  }
+
+  _compilationError.clear();
+  _isReady = true;
+  if (onCompiled) {
+    onCompiled(this);
+  }
+}
+
+void Effect::_setCompilationError(const std::string& errors)
+{
+  _isQueued         = false;
+  _compilationError = errors;
+
+  BABYLON_LOG_ERROR("Effect", "Unable to compile effect: ");
+  BABYLON_LOGF_ERROR("Effect", "Defines: %s", defines.c_str());
+  BABYLON_LOGF_ERROR("Effect", "Error: %s", _compilationError.c_str());
+  _dumpShadersName();
+
+  if (onError) {
+    onError(this, _compilationError);
+  }
+}
+
 void Effect::_dumpShadersName()
 {
   BABYLON_LOG_ERROR("Materials::Effect", "Vertex shader:", name);
@@ -273,6 +378,20 @@ void Effect::_processIncludes(
   const std::string& sourceCode,
   const std::function<void(const std::string& data)>& callback)
 {
+  // The expansion only depends on the source and on the index parameters
+  auto& shaderProgramCache = _engine->getShaderProgramCache();
+  uint64_t sourceKey       = ShaderProgramCache::Hash(sourceCode);
+  for (const auto& indexParameter : _indexParameters) {
+    sourceKey ^= ShaderProgramCache::Hash(
+      indexParameter.first + "=" + std::to_string(indexParameter.second));
+  }
+
+  std::string processedCode;
+  if (shaderProgramCache.getSource(sourceKey, processedCode)) {
+    callback(processedCode);
+    return;
+  }
+
   std::ostringstream returnValue;
   auto lines = String::split(sourceCode, '\n');
   std::regex regex;
@@ -292,9 +411,11 @@ void Effect::_processIncludes(
       continue;
     }
 
-    if (std_util::contains(EffectIncludesShadersStore::Shaders, includeFile)) {
+    // Lookups only, the sources can be preprocessed on worker threads
+    auto include = EffectIncludesShadersStore::Shaders.find(includeFile);
+    if (include != EffectIncludesShadersStore::Shaders.end()) {
       // Substitution
-      auto includeContent = EffectIncludesShadersStore::Shaders[includeFile];
+      auto includeContent = include->second;
       // Instanced includes
       regex = std::regex("#include<(.+)>\\[(.*)]");
       if (std::regex_search(line, match, regex) && (match.size() == 3)) {
@@ -311,7 +432,7 @@ void Effect::_processIncludes(
 
             if ((!String::isDigit(maxIndex))
                 && std_util::contains(_indexParameters, maxIndex)) {
-              maxIndex = std::to_string(_indexParameters[maxIndex]);
+              maxIndex = std::to_string(_indexParameters.at(maxIndex));
             }
 
             if (String::isDigit(minIndex) && String::isDigit(maxIndex)) {
@@ -336,7 +457,9 @@ void Effect::_processIncludes(
     }
   }
 
-  callback(returnValue.str());
+  processedCode = returnValue.str();
+  shaderProgramCache.setSource(sourceKey, processedCode);
+  callback(processedCode);
 }
 
 std::string Effect::_processPrecision(const std::string& source)
@@ -375,28 +498,8 @@ void Effect::_prepareEffect(const std::string& vertexSourceCode,
   auto _fragmentSourceCode = _processPrecision(fragmentSourceCode);
 
   try {
-    _program = engine->createShaderProgram(_vertexSourceCode,
-                                           _fragmentSourceCode, iDefines);
-
-    _uniforms   = engine->getUniforms(_program.get(), _uniformsNames);
-    _attributes = engine->getAttributes(_program.get(), attributesNames);
-
-    for (unsigned int index = 0; index < _samplers.size(); ++index) {
-      auto sampler = getUniform(_samplers[index]);
-      if (!sampler) {
-        _samplers.erase(_samplers.begin() + index,
-                        _samplers.begin() + index + 1);
-        --index;
-      }
-    }
-
-    engine->bindSamplers(this);
-
-    _compilationError.clear();
-    _isReady = true;
-    if (onCompiled) {
-      onCompiled(this);
-    }
+    _setProgram(engine->createShaderProgram(_vertexSourceCode,
+                                            _fragmentSourceCode, iDefines));
   }
   catch (const std::exception& e) {
     _compilationError = e.what();
@@ -459,104 +562,72 @@ void Effect::setTextureFromPostProcess(const std::string& channel,
                                      postProcess);
 }
 
-bool Effect::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+void Effect::_indexUniforms()
 {
-  bool changed = false;
-  if (!std_util::contains(_valueCache, uniformName)) {
-    changed                  = true;
-    _valueCache[uniformName] = Float32Array(16);
+  _uniformIndices.clear();
+  for (size_t index = 0; index < _uniformsNames.size(); ++index) {
+    // The first occurrence wins, as with a linear search
+    _uniformIndices.emplace(_uniformsNames[index], static_cast<int>(index));
   }
 
-  Float32Array matrixElements(matrix.m.begin(), matrix.m.end());
-  if (_valueCache[uniformName] != matrixElements) {
-    changed                  = true;
-    _valueCache[uniformName] = matrixElements;
-  }
-
-  return changed;
+  _valueCache.assign(_uniformsNames.size() * 16, 0.f);
+  _valueCacheSizes.assign(_uniformsNames.size(), 0);
 }
 
-bool Effect::_cacheFloat2(const std::string& uniformName, float x, float y)
+bool Effect::_cacheValues(int uniformIndex, const float* values,
+                          unsigned int count)
 {
-  if (!std_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y};
-    return true;
+  if (uniformIndex < 0) {
+    return false;
   }
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!std_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!std_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  const auto index = static_cast<size_t>(uniformIndex);
+  float* cache     = &_valueCache[index * 16];
+  if (_valueCacheSizes[index] == count
+      && std::memcmp(cache, values, count * sizeof(float)) == 0) {
+    return false;
   }
 
-  return changed;
+  std::memcpy(cache, values, count * sizeof(float));
+  _valueCacheSizes[index] = static_cast<unsigned char>(count);
+
+  return true;
 }
 
-bool Effect::_cacheFloat3(const std::string& uniformName, float x, float y,
-                          float z)
+void Effect::_clearCache(int uniformIndex)
 {
-  if (!std_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z};
-    return true;
-  }
-
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!std_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!std_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!std_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+  if (uniformIndex >= 0) {
+    _valueCacheSizes[static_cast<size_t>(uniformIndex)] = 0;
   }
+}
 
-  return changed;
+bool Effect::_cacheMatrix(int uniformIndex, const Matrix& matrix)
+{
+  return _cacheValues(uniformIndex, matrix.m.data(), 16);
 }
 
-bool Effect::_cacheFloat4(const std::string& uniformName, float x, float y,
-                          float z, float w)
+bool Effect::_cacheFloat2(int uniformIndex, float x, float y)
 {
-  if (!std_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z, w};
-    return true;
-  }
+  const float values[2] = {x, y};
+  return _cacheValues(uniformIndex, values, 2);
+}
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!std_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!std_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!std_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
-  }
-  if (!std_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
-  }
+bool Effect::_cacheFloat3(int uniformIndex, float x, float y, float z)
+{
+  const float values[3] = {x, y, z};
+  return _cacheValues(uniformIndex, values, 3);
+}
 
-  return changed;
+bool Effect::_cacheFloat4(int uniformIndex, float x, float y, float z, float w)
+{
+  const float values[4] = {x, y, z, w};
+  return _cacheValues(uniformIndex, values, 4);
 }
 
 Effect& Effect::setIntArray(const std::string& uniformName,
                             const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setIntArray(getUniform(uniformName), array);
 
   return *this;
@@ -565,7 +636,7 @@ Effect& Effect::setIntArray(const std::string& uniformName,
 Effect& Effect::setIntArray2(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setIntArray2(getUniform(uniformName), array);
 
   return *this;
@@ -574,7 +645,7 @@ Effect& Effect::setIntArray2(const std::string& uniformName,
 Effect& Effect::setIntArray3(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setIntArray3(getUniform(uniformName), array);
 
   return *this;
@@ -583,7 +654,7 @@ Effect& Effect::setIntArray3(const std::string& uniformName,
 Effect& Effect::setIntArray4(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setIntArray4(getUniform(uniformName), array);
 
   return *this;
@@ -592,7 +663,7 @@ Effect& Effect::setIntArray4(const std::string& uniformName,
 Effect& Effect::setFloatArray(const std::string& uniformName,
                               const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setFloatArray(getUniform(uniformName), array);
 
   return *this;
@@ -601,7 +672,7 @@ Effect& Effect::setFloatArray(const std::string& uniformName,
 Effect& Effect::setFloatArray2(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setFloatArray2(getUniform(uniformName), array);
 
   return *this;
@@ -610,7 +681,7 @@ Effect& Effect::setFloatArray2(const std::string& uniformName,
 Effect& Effect::setFloatArray3(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setFloatArray3(getUniform(uniformName), array);
 
   return *this;
@@ -619,7 +690,7 @@ Effect& Effect::setFloatArray3(const std::string& uniformName,
 Effect& Effect::setFloatArray4(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setFloatArray4(getUniform(uniformName), array);
 
   return *this;
@@ -628,7 +699,7 @@ Effect& Effect::setFloatArray4(const std::string& uniformName,
 Effect& Effect::setArray(const std::string& uniformName,
                          std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setArray(getUniform(uniformName), array);
 
   return *this;
@@ -637,7 +708,7 @@ Effect& Effect::setArray(const std::string& uniformName,
 Effect& Effect::setArray2(const std::string& uniformName,
                           std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setArray2(getUniform(uniformName), array);
 
   return *this;
@@ -646,7 +717,7 @@ Effect& Effect::setArray2(const std::string& uniformName,
 Effect& Effect::setArray3(const std::string& uniformName,
                           std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setArray3(getUniform(uniformName), array);
 
   return *this;
@@ -655,7 +726,7 @@ Effect& Effect::setArray3(const std::string& uniformName,
 Effect& Effect::setArray4(const std::string& uniformName,
                           std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setArray4(getUniform(uniformName), array);
 
   return *this;
@@ -664,25 +735,18 @@ Effect& Effect::setArray4(const std::string& uniformName,
 Effect& Effect::setMatrices(const std::string& uniformName,
                             Float32Array matrices)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrices(getUniform(uniformName), matrices);
-
-  return *this;
+  return setMatrices(getUniformIndex(uniformName), matrices);
 }
 
 Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    _engine->setMatrix(getUniform(uniformName), matrix);
-  }
-
-  return *this;
+  return setMatrix(getUniformIndex(uniformName), matrix);
 }
 
 Effect& Effect::setMatrix3x3(const std::string& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setMatrix3x3(getUniform(uniformName), matrix);
 
   return *this;
@@ -691,7 +755,7 @@ Effect& Effect::setMatrix3x3(const std::string& uniformName,
 Effect& Effect::setMatrix2x2(const std::string& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
+  _clearCache(getUniformIndex(uniformName));
   _engine->setMatrix2x2(getUniform(uniformName), matrix);
 
   return *this;
@@ -699,111 +763,181 @@ Effect& Effect::setMatrix2x2(const std::string& uniformName,
 
 Effect& Effect::setFloat(const std::string& uniformName, float value)
 {
-  if (std_util::contains(_valueCache, uniformName)
-      && std_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return *this;
-  }
+  return setFloat(getUniformIndex(uniformName), value);
+}
+
+Effect& Effect::setBool(const std::string& uniformName, bool _bool)
+{
+  return setBool(getUniformIndex(uniformName), _bool);
+}
+
+Effect& Effect::setVector2(const std::string& uniformName,
+                           const Vector2& vector2)
+{
+  return setVector2(getUniformIndex(uniformName), vector2);
+}
+
+Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
+{
+  return setFloat2(getUniformIndex(uniformName), x, y);
+}
+
+Effect& Effect::setVector3(const std::string& uniformName,
+                           const Vector3& vector3)
+{
+  return setVector3(getUniformIndex(uniformName), vector3);
+}
+
+Effect& Effect::setFloat3(const std::string& uniformName, float x, float y,
+                          float z)
+{
+  return setFloat3(getUniformIndex(uniformName), x, y, z);
+}
+
+Effect& Effect::setVector4(const std::string& uniformName,
+                           const Vector4& vector4)
+{
+  return setVector4(getUniformIndex(uniformName), vector4);
+}
+
+Effect& Effect::setFloat4(const std::string& uniformName, float x, float y,
+                          float z, float w)
+{
+  return setFloat4(getUniformIndex(uniformName), x, y, z, w);
+}
+
+Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
+{
+  return setColor3(getUniformIndex(uniformName), color3);
+}
 
-  _valueCache[uniformName] = {value};
+Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3,
+                          float alpha)
+{
+  return setColor4(getUniformIndex(uniformName), color3, alpha);
+}
 
-  _engine->setFloat(getUniform(uniformName), value);
+Effect& Effect::setMatrices(int uniformIndex, const Float32Array& matrices)
+{
+  _clearCache(uniformIndex);
+  _engine->setMatrices(getUniform(uniformIndex), matrices);
 
   return *this;
 }
 
-Effect& Effect::setBool(const std::string& uniformName, bool _bool)
+Effect& Effect::setMatrix(int uniformIndex, const Matrix& matrix)
 {
-  if (std_util::contains(_valueCache, uniformName)
-      && std_util::almost_equal(_valueCache[uniformName][0],
-                                _bool ? 1.f : 0.f)) {
-    return *this;
+  if (_cacheMatrix(uniformIndex, matrix)) {
+    _engine->setMatrix(getUniform(uniformIndex), matrix);
   }
 
-  _valueCache[uniformName] = {_bool ? 1.f : 0.f};
+  return *this;
+}
 
-  _engine->setBool(getUniform(uniformName), _bool ? 1 : 0);
+Effect& Effect::setFloat(int uniformIndex, float value)
+{
+  if (_cacheValues(uniformIndex, &value, 1)) {
+    _engine->setFloat(getUniform(uniformIndex), value);
+  }
 
   return *this;
 }
 
-Effect& Effect::setVector2(const std::string& uniformName,
-                           const Vector2& vector2)
+Effect& Effect::setBool(int uniformIndex, bool _bool)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    _engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y);
+  const float value = _bool ? 1.f : 0.f;
+  if (_cacheValues(uniformIndex, &value, 1)) {
+    _engine->setBool(getUniform(uniformIndex), _bool ? 1 : 0);
   }
 
   return *this;
 }
 
-Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
+Effect& Effect::setVector2(int uniformIndex, const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    _engine->setFloat2(getUniform(uniformName), x, y);
+  if (_cacheFloat2(uniformIndex, vector2.x, vector2.y)) {
+    _engine->setFloat2(getUniform(uniformIndex), vector2.x, vector2.y);
   }
 
   return *this;
 }
 
-Effect& Effect::setVector3(const std::string& uniformName,
-                           const Vector3& vector3)
+Effect& Effect::setFloat2(int uniformIndex, float x, float y)
+{
+  if (_cacheFloat2(uniformIndex, x, y)) {
+    _engine->setFloat2(getUniform(uniformIndex), x, y);
+  }
+
+  return *this;
+}
+
+Effect& Effect::setVector3(int uniformIndex, const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    _engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y,
+  if (_cacheFloat3(uniformIndex, vector3.x, vector3.y, vector3.z)) {
+    _engine->setFloat3(getUniform(uniformIndex), vector3.x, vector3.y,
                        vector3.z);
   }
 
   return *this;
 }
 
-Effect& Effect::setFloat3(const std::string& uniformName, float x, float y,
-                          float z)
+Effect& Effect::setFloat3(int uniformIndex, float x, float y, float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    _engine->setFloat3(getUniform(uniformName), x, y, z);
+  if (_cacheFloat3(uniformIndex, x, y, z)) {
+    _engine->setFloat3(getUniform(uniformIndex), x, y, z);
   }
 
   return *this;
 }
 
-Effect& Effect::setVector4(const std::string& uniformName,
-                           const Vector4& vector4)
+Effect& Effect::setVector4(int uniformIndex, const Vector4& vector4)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    _engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z,
-                       vector4.w);
+  if (_cacheFloat4(uniformIndex, vector4.x, vector4.y, vector4.z, vector4.w)) {
+    _engine->setFloat4(getUniform(uniformIndex), vector4.x, vector4.y,
+                       vector4.z, vector4.w);
   }
 
   return *this;
 }
 
-Effect& Effect::setFloat4(const std::string& uniformName, float x, float y,
-                          float z, float w)
+Effect& Effect::setFloat4(int uniformIndex, float x, float y, float z, float w)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    _engine->setFloat4(getUniform(uniformName), x, y, z, w);
+  if (_cacheFloat4(uniformIndex, x, y, z, w)) {
+    _engine->setFloat4(getUniform(uniformIndex), x, y, z, w);
   }
 
   return *this;
 }
 
-Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
+Effect& Effect::setColor3(int uniformIndex, const Color3& color3)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    _engine->setColor3(getUniform(uniformName), color3);
+  if (_cacheFloat3(uniformIndex, color3.r, color3.g, color3.b)) {
+    _engine->setColor3(getUniform(uniformIndex), color3);
   }
 
   return *this;
 }
 
-Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3,
-                          float alpha)
+Effect& Effect::setColor4(int uniformIndex, const Color3& color3, float alpha)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    _engine->setColor4(getUniform(uniformName), color3, alpha);
+  if (_cacheFloat4(uniformIndex, color3.r, color3.g, color3.b, alpha)) {
+    _engine->setColor4(getUniform(uniformIndex), color3, alpha);
   }
 
   return *this;
 }
 
+void Effect::bindUniformBlock(const std::string& blockName, unsigned int index)
+{
+  auto it = _uniformBlockBindings.find(blockName);
+  if (it != _uniformBlockBindings.end() && it->second == index) {
+    return;
+  }
+
+  _uniformBlockBindings[blockName] = index;
+  if (_program) {
+    _engine->bindUniformBlock(_program.get(), blockName, index);
+  }
+}
+
 } // end of namespace BABYLON
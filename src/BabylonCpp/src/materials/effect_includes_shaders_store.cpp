@@ -12,6 +12,7 @@
 #include <babylon/shaders/shadersinclude/color_curves_definition_fx.h>
 #include <babylon/shaders/shadersinclude/color_grading_fx.h>
 #include <babylon/shaders/shadersinclude/color_grading_definition_fx.h>
+#include <babylon/shaders/shadersinclude/default_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/fog_fragment_fx.h>
 #include <babylon/shaders/shadersinclude/fog_fragment_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/fog_vertex_fx.h>
@@ -34,6 +35,7 @@
 #include <babylon/shaders/shadersinclude/point_cloud_vertex_fx.h>
 #include <babylon/shaders/shadersinclude/point_cloud_vertex_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/reflection_function_fx.h>
+#include <babylon/shaders/shadersinclude/scene_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/shadows_fragment_functions_fx.h>
 #include <babylon/shaders/shadersinclude/shadows_vertex_fx.h>
 #include <babylon/shaders/shadersinclude/shadows_vertex_declaration_fx.h>
@@ -53,6 +55,7 @@ std::unordered_map<std::string, const char*> EffectIncludesShadersStore::Shaders
    {"colorCurvesDefinition", colorCurvesDefinition},
    {"colorGrading", colorGrading},
    {"colorGradingDefinition", colorGradingDefinition},
+   {"defaultUboDeclaration", defaultUboDeclaration},
    {"fogFragment", fogFragment},
    {"fogFragmentDeclaration", fogFragmentDeclaration},
    {"fogVertex", fogVertex},
@@ -75,6 +78,7 @@ std::unordered_map<std::string, const char*> EffectIncludesShadersStore::Shaders
    {"pointCloudVertex", pointCloudVertex},
    {"pointCloudVertexDeclaration", pointCloudVertexDeclaration},
    {"reflectionFunction", reflectionFunction},
+   {"sceneUboDeclaration", sceneUboDeclaration},
    {"shadowsFragmentFunctions", shadowsFragmentFunctions},
    {"shadowsVertex", shadowsVertex},
    {"shadowsVertexDeclaration", shadowsVertexDeclaration}
@@ -12,6 +12,7 @@ namespace BABYLON {
 
 Material::Material(const std::string& iName, Scene* scene, bool /*doNotAdd*/)
     : id{iName}
+    , uniqueId{scene->getUniqueId()}
     , name{iName}
     , checkReadyOnEveryCall{false}
     , checkReadyOnlyOnce{false}
@@ -2,44 +2,74 @@
 
 namespace BABYLON {
 
-MaterialDefines::MaterialDefines()
-    : NUM_BONE_INFLUENCERS{0}, BonesPerMesh{0}, LIGHTMAPEXCLUDED{false}
+namespace {
+
+// Seeds of the flag keys, one per set of flags
+enum MaterialDefinesSeed : uint64_t {
+  DEFINES_SEED              = 0x100,
+  LIGHTS_SEED               = 0x200,
+  POINTLIGHTS_SEED          = 0x300,
+  DIRLIGHTS_SEED            = 0x400,
+  HEMILIGHTS_SEED           = 0x500,
+  SPOTLIGHTS_SEED           = 0x600,
+  SHADOWS_SEED              = 0x700,
+  SHADOWVSMS_SEED           = 0x800,
+  SHADOWPCFS_SEED           = 0x900,
+  LIGHTMAPEXCLUDED_SEED     = 0xA00,
+  LIGHTMAPNOSPECULAR_SEED   = 0xB00,
+  NUM_BONE_INFLUENCERS_SEED = 0xC00,
+  BONESPERMESH_SEED         = 0x1000000
+};
+
+const std::vector<std::string> noKeys;
+
+void writeLightDefines(std::ostream& os, const char* name,
+                       const MaterialDefines::LightsFlags& flags)
 {
+  for (unsigned int i = 0; i < flags.size(); ++i) {
+    if (flags[i]) {
+      os << "#define " << name << i << "\n";
+    }
+  }
 }
 
-MaterialDefines::~MaterialDefines()
+} // end of anonymous namespace
+
+MaterialDefines::MaterialDefines()
+    : defines{DEFINES_SEED}
+    , _keys{&noKeys}
+    , NUM_BONE_INFLUENCERS{0}
+    , BonesPerMesh{0}
+    , lights{LIGHTS_SEED}
+    , pointlights{POINTLIGHTS_SEED}
+    , dirlights{DIRLIGHTS_SEED}
+    , hemilights{HEMILIGHTS_SEED}
+    , spotlights{SPOTLIGHTS_SEED}
+    , shadows{SHADOWS_SEED}
+    , shadowvsms{SHADOWVSMS_SEED}
+    , shadowpcfs{SHADOWPCFS_SEED}
+    , LIGHTMAPEXCLUDED{false}
+    , lightmapexcluded{LIGHTMAPEXCLUDED_SEED}
+    , lightmapnospecular{LIGHTMAPNOSPECULAR_SEED}
 {
 }
 
-bool MaterialDefines::operator[](unsigned int define) const
+MaterialDefines::~MaterialDefines()
 {
-  return (define < defines.size()) ? defines[define] : false;
 }
 
-void MaterialDefines::resizeLights(unsigned int lightIndex)
+bool MaterialDefines::operator[](unsigned int define) const
 {
-  if (lightIndex >= lights.size()) {
-    for (size_t i = lights.size(); i <= lightIndex; ++i) {
-      lights.emplace_back(false);
-      pointlights.emplace_back(false);
-      dirlights.emplace_back(false);
-      hemilights.emplace_back(false);
-      spotlights.emplace_back(false);
-      shadows.emplace_back(false);
-      shadowvsms.emplace_back(false);
-      shadowpcfs.emplace_back(false);
-      lightmapexcluded.emplace_back(false);
-      lightmapnospecular.emplace_back(false);
-    }
-  }
+  return defines.test(define);
 }
 
 std::ostream& operator<<(std::ostream& os,
                          const MaterialDefines& materialDefines)
 {
-  for (size_t i = 0; i < materialDefines.defines.size(); ++i) {
+  const auto& keys = *materialDefines._keys;
+  for (unsigned int i = 0; i < keys.size(); ++i) {
     if (materialDefines.defines[i]) {
-      os << "#define " << materialDefines._keys[i] << "\n";
+      os << "#define " << keys[i] << "\n";
     }
   }
 
@@ -47,138 +77,42 @@ std::ostream& operator<<(std::ostream& os,
      << "\n";
   os << "#define BonesPerMesh " << materialDefines.BonesPerMesh << "\n";
 
-  for (size_t i = 0; i < materialDefines.lights.size(); ++i) {
-    if (materialDefines.lights[i]) {
-      os << "#define LIGHT" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.pointlights.size(); ++i) {
-    if (materialDefines.pointlights[i]) {
-      os << "#define POINTLIGHT" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.dirlights.size(); ++i) {
-    if (materialDefines.dirlights[i]) {
-      os << "#define DIRLIGHT" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.hemilights.size(); ++i) {
-    if (materialDefines.hemilights[i]) {
-      os << "#define HEMILIGHT" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.spotlights.size(); ++i) {
-    if (materialDefines.spotlights[i]) {
-      os << "#define SPOTLIGHT" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.shadows.size(); ++i) {
-    if (materialDefines.shadows[i]) {
-      os << "#define SHADOW" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.shadowvsms.size(); ++i) {
-    if (materialDefines.shadowvsms[i]) {
-      os << "#define SHADOWVSM" << i << "\n";
-    }
-  }
-
-  for (size_t i = 0; i < materialDefines.shadowpcfs.size(); ++i) {
-    if (materialDefines.shadowpcfs[i]) {
-      os << "#define SHADOWPCF" << i << "\n";
-    }
-  }
+  writeLightDefines(os, "LIGHT", materialDefines.lights);
+  writeLightDefines(os, "POINTLIGHT", materialDefines.pointlights);
+  writeLightDefines(os, "DIRLIGHT", materialDefines.dirlights);
+  writeLightDefines(os, "HEMILIGHT", materialDefines.hemilights);
+  writeLightDefines(os, "SPOTLIGHT", materialDefines.spotlights);
+  writeLightDefines(os, "SHADOW", materialDefines.shadows);
+  writeLightDefines(os, "SHADOWVSM", materialDefines.shadowvsms);
+  writeLightDefines(os, "SHADOWPCF", materialDefines.shadowpcfs);
 
   return os;
 }
 
-bool MaterialDefines::isEqual(MaterialDefines& other) const
+uint64_t MaterialDefines::hash() const
 {
-  if ((defines.size() != other.defines.size())
-      || (_keys.size() != other._keys.size())
-      || (lights.size() != other.lights.size())
-      || (pointlights.size() != other.pointlights.size())
-      || (dirlights.size() != other.dirlights.size())
-      || (hemilights.size() != other.hemilights.size())
-      || (spotlights.size() != other.spotlights.size())
-      || (shadows.size() != other.shadows.size())
-      || (shadowvsms.size() != other.shadowvsms.size())
-      || (shadowpcfs.size() != other.shadowpcfs.size())) {
-    return false;
-  }
+  return defines.hash() ^ lights.hash() ^ pointlights.hash()
+         ^ dirlights.hash() ^ hemilights.hash() ^ spotlights.hash()
+         ^ shadows.hash() ^ shadowvsms.hash() ^ shadowpcfs.hash()
+         ^ Defines::Mix(NUM_BONE_INFLUENCERS_SEED + NUM_BONE_INFLUENCERS)
+         ^ Defines::Mix(BONESPERMESH_SEED + BonesPerMesh);
+}
 
-  if ((NUM_BONE_INFLUENCERS != other.NUM_BONE_INFLUENCERS)
-      || (BonesPerMesh != other.BonesPerMesh)) {
+bool MaterialDefines::isEqual(MaterialDefines& other) const
+{
+  if (hash() != other.hash()) {
     return false;
   }
 
-  for (size_t i = 0; i < defines.size(); ++i) {
-    if (defines[i] != other.defines[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < _keys.size(); ++i) {
-    if (_keys[i] != other._keys[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < lights.size(); ++i) {
-    if (lights[i] != other.lights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < pointlights.size(); ++i) {
-    if (pointlights[i] != other.pointlights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < dirlights.size(); ++i) {
-    if (dirlights[i] != other.dirlights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < hemilights.size(); ++i) {
-    if (hemilights[i] != other.hemilights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < spotlights.size(); ++i) {
-    if (spotlights[i] != other.spotlights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadows.size(); ++i) {
-    if (shadows[i] != other.shadows[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadowvsms.size(); ++i) {
-    if (shadowvsms[i] != other.shadowvsms[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadowpcfs.size(); ++i) {
-    if (shadowpcfs[i] != other.shadowpcfs[i]) {
-      return false;
-    }
-  }
-
-  return true;
+  return (_keys == other._keys)
+         && (NUM_BONE_INFLUENCERS == other.NUM_BONE_INFLUENCERS)
+         && (BonesPerMesh == other.BonesPerMesh)
+         && (defines == other.defines) && (lights == other.lights)
+         && (pointlights == other.pointlights)
+         && (dirlights == other.dirlights) && (hemilights == other.hemilights)
+         && (spotlights == other.spotlights) && (shadows == other.shadows)
+         && (shadowvsms == other.shadowvsms)
+         && (shadowpcfs == other.shadowpcfs);
 }
 
 void MaterialDefines::cloneTo(MaterialDefines& other)
@@ -201,21 +135,21 @@ void MaterialDefines::cloneTo(MaterialDefines& other)
 
 void MaterialDefines::reset()
 {
-  for (size_t i = 0; i < defines.size(); ++i) {
-    defines[i] = false;
-  }
+  defines.reset();
 
   NUM_BONE_INFLUENCERS = 0;
   BonesPerMesh         = 0;
 
-  lights.clear();
-  pointlights.clear();
-  dirlights.clear();
-  hemilights.clear();
-  spotlights.clear();
-  shadows.clear();
-  shadowvsms.clear();
-  shadowpcfs.clear();
+  lights.reset();
+  pointlights.reset();
+  dirlights.reset();
+  hemilights.reset();
+  spotlights.reset();
+  shadows.reset();
+  shadowvsms.reset();
+  shadowpcfs.reset();
+  lightmapexcluded.reset();
+  lightmapnospecular.reset();
 }
 
 std::string MaterialDefines::toString() const
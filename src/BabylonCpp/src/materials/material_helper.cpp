@@ -2,6 +2,7 @@
 
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/lights/ishadow_light.h>
 #include <babylon/lights/light.h>
@@ -10,6 +11,7 @@
 #include <babylon/materials/effect_fallbacks.h>
 #include <babylon/materials/material_defines.h>
 #include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/math/plane.h>
 #include <babylon/math/tmp.h>
 #include <babylon/mesh/abstract_mesh.h>
@@ -27,7 +29,6 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
   bool needNormals        = false;
   bool needShadows        = false;
   bool lightmapMode       = false;
-  defines.resizeLights(maxSimultaneousLights - 1);
 
   for (auto& light : scene->lights) {
 
@@ -225,6 +226,18 @@ void MaterialHelper::PrepareAttributesForInstances(
   }
 }
 
+bool MaterialHelper::UseUniformBuffers(Engine* engine,
+                                       unsigned int maxSimultaneousLights)
+{
+  if (!engine->supportsUniformBuffers()) {
+    return false;
+  }
+
+  // The scene and material blocks, plus one block per light
+  const auto fragmentBlocks = 2 + static_cast<int>(maxSimultaneousLights);
+  return fragmentBlocks <= engine->getCaps().maxFragmentUniformBlocks;
+}
+
 bool MaterialHelper::BindLightShadow(Light* light, Scene* scene,
                                      AbstractMesh* mesh,
                                      unsigned int lightIndex, Effect* effect,
@@ -290,7 +303,8 @@ void MaterialHelper::BindLightProperties(Light* light, Effect* effect,
 
 void MaterialHelper::BindLights(Scene* scene, AbstractMesh* mesh,
                                 Effect* effect, bool specularTerm,
-                                unsigned int maxSimultaneousLights)
+                                unsigned int maxSimultaneousLights,
+                                bool useUniformBuffers)
 {
   unsigned int lightIndex    = 0;
   bool depthValuesAlreadySet = false;
@@ -303,16 +317,23 @@ void MaterialHelper::BindLights(Scene* scene, AbstractMesh* mesh,
       continue;
     }
 
-    BindLightProperties(light.get(), effect, lightIndex);
+    if (useUniformBuffers) {
+      light->getUniformBuffer()->bind(UniformBuffer::LightBlockBinding
+                                      + lightIndex);
+    }
+    else {
+      BindLightProperties(light.get(), effect, lightIndex);
+    }
 
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    light->diffuse.scaleToRef(light->intensity, Tmp::Color3Array[0]);
-    effect->setColor4("vLightDiffuse" + lightIndexStr, Tmp::Color3Array[0],
+    light->diffuse.scaleToRef(light->intensity, Tmp::Color3Array()[0]);
+    effect->setColor4("vLightDiffuse" + lightIndexStr, Tmp::Color3Array()[0],
                       light->range);
     if (specularTerm) {
-      light->specular.scaleToRef(light->intensity, Tmp::Color3Array[1]);
-      effect->setColor3("vLightSpecular" + lightIndexStr, Tmp::Color3Array[1]);
+      light->specular.scaleToRef(light->intensity, Tmp::Color3Array()[1]);
+      effect->setColor3("vLightSpecular" + lightIndexStr,
+                        Tmp::Color3Array()[1]);
     }
 
     // Shadows
@@ -369,4 +390,15 @@ void MaterialHelper::BindClipPlane(Effect* effect, Scene* scene)
   }
 }
 
+void MaterialHelper::BindUniformBlocks(Effect* effect,
+                                       unsigned int maxSimultaneousLights)
+{
+  effect->bindUniformBlock("Scene", UniformBuffer::SceneBlockBinding);
+  effect->bindUniformBlock("Material", UniformBuffer::MaterialBlockBinding);
+  for (unsigned int i = 0; i < maxSimultaneousLights; ++i) {
+    effect->bindUniformBlock("Light" + std::to_string(i),
+                             UniformBuffer::LightBlockBinding + i);
+  }
+}
+
 } // end of namespace BABYLON
@@ -16,6 +16,7 @@
 #include <babylon/materials/textures/hdr_cube_texture.h>
 #include <babylon/materials/textures/refraction_texture.h>
 #include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/math/spherical_polynomial.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/mesh.h>
@@ -23,6 +24,82 @@
 
 namespace BABYLON {
 
+namespace {
+
+// The uniforms set by bind(), resolved to indices once per effect
+enum PBRMaterialUniform : unsigned int {
+  WORLD,
+  VIEWPROJECTION,
+  OPACITYPARTS,
+  EMISSIVELEFTCOLOR,
+  EMISSIVERIGHTCOLOR,
+  VALBEDOINFOS,
+  ALBEDOMATRIX,
+  VAMBIENTINFOS,
+  AMBIENTMATRIX,
+  VOPACITYINFOS,
+  OPACITYMATRIX,
+  REFLECTIONMATRIX,
+  VREFLECTIONINFOS,
+  VSPHERICALX,
+  VSPHERICALY,
+  VSPHERICALZ,
+  VSPHERICALXX,
+  VSPHERICALYY,
+  VSPHERICALZZ,
+  VSPHERICALXY,
+  VSPHERICALYZ,
+  VSPHERICALZX,
+  VEMISSIVEINFOS,
+  EMISSIVEMATRIX,
+  VLIGHTMAPINFOS,
+  LIGHTMAPMATRIX,
+  VREFLECTIVITYINFOS,
+  REFLECTIVITYMATRIX,
+  VBUMPINFOS,
+  BUMPMATRIX,
+  REFRACTIONMATRIX,
+  VREFRACTIONINFOS,
+  VMICROSURFACETEXTURELODS,
+  POINTSIZE,
+  VEYEPOSITION,
+  VAMBIENTCOLOR,
+  VREFLECTIVITYCOLOR,
+  VEMISSIVECOLOR,
+  VREFLECTIONCOLOR,
+  VALBEDOCOLOR,
+  VIEW,
+  VLIGHTINGINTENSITY,
+  VOVERLOADEDSHADOWINTENSITY,
+  VCAMERAINFOS,
+  VOVERLOADEDINTENSITY,
+  VOVERLOADEDAMBIENT,
+  VOVERLOADEDALBEDO,
+  VOVERLOADEDREFLECTIVITY,
+  VOVERLOADEDEMISSIVE,
+  VOVERLOADEDREFLECTION,
+  VOVERLOADEDMICROSURFACE,
+  UNIFORM_COUNT
+};
+
+const std::array<const char*, UNIFORM_COUNT> pbrMaterialUniforms{{
+  "world", "viewProjection", "opacityParts", "emissiveLeftColor",
+  "emissiveRightColor", "vAlbedoInfos", "albedoMatrix", "vAmbientInfos",
+  "ambientMatrix", "vOpacityInfos", "opacityMatrix", "reflectionMatrix",
+  "vReflectionInfos", "vSphericalX", "vSphericalY", "vSphericalZ",
+  "vSphericalXX", "vSphericalYY", "vSphericalZZ", "vSphericalXY",
+  "vSphericalYZ", "vSphericalZX", "vEmissiveInfos", "emissiveMatrix",
+  "vLightmapInfos", "lightmapMatrix", "vReflectivityInfos",
+  "reflectivityMatrix", "vBumpInfos", "bumpMatrix", "refractionMatrix",
+  "vRefractionInfos", "vMicrosurfaceTextureLods", "pointSize", "vEyePosition",
+  "vAmbientColor", "vReflectivityColor", "vEmissiveColor", "vReflectionColor",
+  "vAlbedoColor", "view", "vLightingIntensity", "vOverloadedShadowIntensity",
+  "vCameraInfos", "vOverloadedIntensity", "vOverloadedAmbient",
+  "vOverloadedAlbedo", "vOverloadedReflectivity", "vOverloadedEmissive",
+  "vOverloadedReflection", "vOverloadedMicroSurface"}};
+
+} // end of anonymous namespace
+
 Color3 PBRMaterial::_scaledAlbedo       = Color3();
 Color3 PBRMaterial::_scaledReflectivity = Color3();
 Color3 PBRMaterial::_scaledEmissive     = Color3();
@@ -110,6 +187,7 @@ PBRMaterial::PBRMaterial(const std::string& _name, Scene* scene)
     , _globalAmbientColor{Color3(0.f, 0.f, 0.f)}
     , _tempColor{Color3(0.f, 0.f, 0.f)}
     , _renderId{-1}
+    , _cachedDefines{new PBRMaterialDefines()}
     , _useLogarithmicDepth{false}
     , _myScene{nullptr}
     , _myShadowGenerator{nullptr}
@@ -235,7 +313,13 @@ void PBRMaterial::BindLights(Scene* scene, AbstractMesh* mesh, Effect* effect,
       continue;
     }
 
-    MaterialHelper::BindLightProperties(light.get(), effect, lightIndex);
+    if (defines[PMD::UNIFORMBUFFER]) {
+      light->getUniformBuffer()->bind(UniformBuffer::LightBlockBinding
+                                      + lightIndex);
+    }
+    else {
+      MaterialHelper::BindLightProperties(light.get(), effect, lightIndex);
+    }
 
     const std::string lightIndexStr = std::to_string(lightIndex);
 
@@ -548,6 +632,11 @@ bool PBRMaterial::isReady(AbstractMesh* mesh, bool useInstances)
     _defines.defines[PMD::CAMERACOLORCURVES] = true;
   }
 
+  // Only the scene and light blocks, the material uniforms stay plain
+  if (MaterialHelper::UseUniformBuffers(engine, maxSimultaneousLights)) {
+    _defines.defines[PMD::UNIFORMBUFFER] = true;
+  }
+
   if ((!std_util::almost_equal(overloadedShadeIntensity, 1.f))
       || (!std_util::almost_equal(overloadedShadowIntensity, 1.f))) {
     _defines.defines[PMD::OVERLOADEDSHADOWVALUES] = true;
@@ -730,8 +819,6 @@ bool PBRMaterial::isReady(AbstractMesh* mesh, bool useInstances)
     MaterialHelper::PrepareAttributesForInstances(attribs, _defines,
                                                   PMD::INSTANCES);
 
-    std::string join = _defines.toString();
-
     std::vector<std::string> uniforms{"world",
                                       "view",
                                       "viewProjection",
@@ -805,8 +892,17 @@ bool PBRMaterial::isReady(AbstractMesh* mesh, bool useInstances)
       {"maxSimultaneousLights", maxSimultaneousLights}};
 
     _effect = scene->getEngine()->createEffect(
-      "pbr", attribs, uniforms, samplers, join, fallbacks.get(), onCompiled,
-      onError, indexParameters);
+      "pbr", attribs, uniforms, samplers, _defines, fallbacks.get(),
+      onCompiled, onError, indexParameters);
+
+    _uniformIndices.resize(UNIFORM_COUNT);
+    for (unsigned int i = 0; i < UNIFORM_COUNT; ++i) {
+      _uniformIndices[i] = _effect->getUniformIndex(pbrMaterialUniforms[i]);
+    }
+
+    if (_defines[PMD::UNIFORMBUFFER]) {
+      MaterialHelper::BindUniformBlocks(_effect, maxSimultaneousLights);
+    }
   }
   if (!_effect->isReady()) {
     return false;
@@ -842,7 +938,7 @@ void PBRMaterial::unbind()
 
 void PBRMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _effect->setMatrix("world", world);
+  _effect->setMatrix(_uniformIndices[WORLD], world);
 }
 
 void PBRMaterial::bind(Matrix* world, Mesh* mesh)
@@ -856,12 +952,20 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
   MaterialHelper::BindBonesParameters(mesh, _effect);
 
   if (_myScene->getCachedMaterial() != this) {
-    _effect->setMatrix("viewProjection", _myScene->getTransformMatrix());
+    // The scene block holds the view projection and the eye position
+    if (_defines[PMD::UNIFORMBUFFER]) {
+      _myScene->getSceneUniformBuffer()->bind(
+        UniformBuffer::SceneBlockBinding);
+    }
+    else {
+      _effect->setMatrix(_uniformIndices[VIEWPROJECTION],
+                         _myScene->getTransformMatrix());
+    }
 
     if (StandardMaterial::FresnelEnabled) {
       if (opacityFresnelParameters && opacityFresnelParameters->isEnabled) {
         _effect->setColor4(
-          "opacityParts",
+          _uniformIndices[OPACITYPARTS],
           Color3(opacityFresnelParameters->leftColor.toLuminance(),
                  opacityFresnelParameters->rightColor.toLuminance(),
                  opacityFresnelParameters->bias),
@@ -869,10 +973,10 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
       }
 
       if (emissiveFresnelParameters && emissiveFresnelParameters->isEnabled) {
-        _effect->setColor4("emissiveLeftColor",
+        _effect->setColor4(_uniformIndices[EMISSIVELEFTCOLOR],
                            emissiveFresnelParameters->leftColor,
                            emissiveFresnelParameters->power);
-        _effect->setColor4("emissiveRightColor",
+        _effect->setColor4(_uniformIndices[EMISSIVERIGHTCOLOR],
                            emissiveFresnelParameters->rightColor,
                            emissiveFresnelParameters->bias);
       }
@@ -883,29 +987,30 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
       if (albedoTexture && StandardMaterial::DiffuseTextureEnabled) {
         _effect->setTexture("albedoSampler", albedoTexture);
 
-        _effect->setFloat2("vAlbedoInfos",
+        _effect->setFloat2(_uniformIndices[VALBEDOINFOS],
                            static_cast<float>(albedoTexture->coordinatesIndex),
                            albedoTexture->level);
-        _effect->setMatrix("albedoMatrix", *albedoTexture->getTextureMatrix());
+        _effect->setMatrix(_uniformIndices[ALBEDOMATRIX],
+                           *albedoTexture->getTextureMatrix());
       }
 
       if (ambientTexture && StandardMaterial::AmbientTextureEnabled) {
         _effect->setTexture("ambientSampler", ambientTexture);
 
-        _effect->setFloat3("vAmbientInfos",
+        _effect->setFloat3(_uniformIndices[VAMBIENTINFOS],
                            static_cast<float>(ambientTexture->coordinatesIndex),
                            ambientTexture->level, ambientTextureStrength);
-        _effect->setMatrix("ambientMatrix",
+        _effect->setMatrix(_uniformIndices[AMBIENTMATRIX],
                            *ambientTexture->getTextureMatrix());
       }
 
       if (opacityTexture && StandardMaterial::OpacityTextureEnabled) {
         _effect->setTexture("opacitySampler", opacityTexture);
 
-        _effect->setFloat2("vOpacityInfos",
+        _effect->setFloat2(_uniformIndices[VOPACITYINFOS],
                            static_cast<float>(opacityTexture->coordinatesIndex),
                            opacityTexture->level);
-        _effect->setMatrix("opacityMatrix",
+        _effect->setMatrix(_uniformIndices[OPACITYMATRIX],
                            *opacityTexture->getTextureMatrix());
       }
 
@@ -921,46 +1026,47 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
           _effect->setTexture("reflection2DSampler", reflectionTexture);
         }
 
-        _effect->setMatrix("reflectionMatrix",
+        _effect->setMatrix(_uniformIndices[REFLECTIONMATRIX],
                            *reflectionTexture->getReflectionTextureMatrix());
-        _effect->setFloat2("vReflectionInfos", reflectionTexture->level, 0.f);
+        _effect->setFloat2(_uniformIndices[VREFLECTIONINFOS],
+                           reflectionTexture->level, 0.f);
 
         if (_defines[PMD::USESPHERICALFROMREFLECTIONMAP]) {
           HDRCubeTexture* hdrCubeTexture
             = dynamic_cast<HDRCubeTexture*>(reflectionTexture);
-          _effect->setFloat3("vSphericalX",
+          _effect->setFloat3(_uniformIndices[VSPHERICALX],
                              hdrCubeTexture->sphericalPolynomial->x.x,
                              hdrCubeTexture->sphericalPolynomial->x.y,
                              hdrCubeTexture->sphericalPolynomial->x.z);
-          _effect->setFloat3("vSphericalY",
+          _effect->setFloat3(_uniformIndices[VSPHERICALY],
                              hdrCubeTexture->sphericalPolynomial->y.x,
                              hdrCubeTexture->sphericalPolynomial->y.y,
                              hdrCubeTexture->sphericalPolynomial->y.z);
-          _effect->setFloat3("vSphericalZ",
+          _effect->setFloat3(_uniformIndices[VSPHERICALZ],
                              hdrCubeTexture->sphericalPolynomial->z.x,
                              hdrCubeTexture->sphericalPolynomial->z.y,
                              hdrCubeTexture->sphericalPolynomial->z.z);
-          _effect->setFloat3("vSphericalXX",
+          _effect->setFloat3(_uniformIndices[VSPHERICALXX],
                              hdrCubeTexture->sphericalPolynomial->xx.x,
                              hdrCubeTexture->sphericalPolynomial->xx.y,
                              hdrCubeTexture->sphericalPolynomial->xx.z);
-          _effect->setFloat3("vSphericalYY",
+          _effect->setFloat3(_uniformIndices[VSPHERICALYY],
                              hdrCubeTexture->sphericalPolynomial->yy.x,
                              hdrCubeTexture->sphericalPolynomial->yy.y,
                              hdrCubeTexture->sphericalPolynomial->yy.z);
-          _effect->setFloat3("vSphericalZZ",
+          _effect->setFloat3(_uniformIndices[VSPHERICALZZ],
                              hdrCubeTexture->sphericalPolynomial->zz.x,
                              hdrCubeTexture->sphericalPolynomial->zz.y,
                              hdrCubeTexture->sphericalPolynomial->zz.z);
-          _effect->setFloat3("vSphericalXY",
+          _effect->setFloat3(_uniformIndices[VSPHERICALXY],
                              hdrCubeTexture->sphericalPolynomial->xy.x,
                              hdrCubeTexture->sphericalPolynomial->xy.y,
                              hdrCubeTexture->sphericalPolynomial->xy.z);
-          _effect->setFloat3("vSphericalYZ",
+          _effect->setFloat3(_uniformIndices[VSPHERICALYZ],
                              hdrCubeTexture->sphericalPolynomial->yz.x,
                              hdrCubeTexture->sphericalPolynomial->yz.y,
                              hdrCubeTexture->sphericalPolynomial->yz.z);
-          _effect->setFloat3("vSphericalZX",
+          _effect->setFloat3(_uniformIndices[VSPHERICALZX],
                              hdrCubeTexture->sphericalPolynomial->zx.x,
                              hdrCubeTexture->sphericalPolynomial->zx.y,
                              hdrCubeTexture->sphericalPolynomial->zx.z);
@@ -971,10 +1077,10 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
         _effect->setTexture("emissiveSampler", emissiveTexture);
 
         _effect->setFloat2(
-          "vEmissiveInfos",
+          _uniformIndices[VEMISSIVEINFOS],
           static_cast<float>(emissiveTexture->coordinatesIndex),
           emissiveTexture->level);
-        _effect->setMatrix("emissiveMatrix",
+        _effect->setMatrix(_uniformIndices[EMISSIVEMATRIX],
                            *emissiveTexture->getTextureMatrix());
       }
 
@@ -982,10 +1088,10 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
         _effect->setTexture("lightmapSampler", lightmapTexture);
 
         _effect->setFloat2(
-          "vLightmapInfos",
+          _uniformIndices[VLIGHTMAPINFOS],
           static_cast<float>(lightmapTexture->coordinatesIndex),
           lightmapTexture->level);
-        _effect->setMatrix("lightmapMatrix",
+        _effect->setMatrix(_uniformIndices[LIGHTMAPMATRIX],
                            *lightmapTexture->getTextureMatrix());
       }
 
@@ -994,20 +1100,20 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
           _effect->setTexture("reflectivitySampler", metallicTexture);
 
           _effect->setFloat2(
-            "vReflectivityInfos",
+            _uniformIndices[VREFLECTIVITYINFOS],
             static_cast<float>(metallicTexture->coordinatesIndex),
             metallicTexture->level);
-          _effect->setMatrix("reflectivityMatrix",
+          _effect->setMatrix(_uniformIndices[REFLECTIVITYMATRIX],
                              *metallicTexture->getTextureMatrix());
         }
         else if (reflectivityTexture) {
           _effect->setTexture("reflectivitySampler", reflectivityTexture);
 
           _effect->setFloat2(
-            "vReflectivityInfos",
+            _uniformIndices[VREFLECTIVITYINFOS],
             static_cast<float>(reflectivityTexture->coordinatesIndex),
             reflectivityTexture->level);
-          _effect->setMatrix("reflectivityMatrix",
+          _effect->setMatrix(_uniformIndices[REFLECTIVITYMATRIX],
                              *reflectivityTexture->getTextureMatrix());
         }
       }
@@ -1016,10 +1122,11 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
           && StandardMaterial::BumpTextureEnabled && !disableBumpMap) {
         _effect->setTexture("bumpSampler", bumpTexture);
 
-        _effect->setFloat3("vBumpInfos",
+        _effect->setFloat3(_uniformIndices[VBUMPINFOS],
                            static_cast<float>(bumpTexture->coordinatesIndex),
                            1.f / bumpTexture->level, parallaxScaleBias);
-        _effect->setMatrix("bumpMatrix", *bumpTexture->getTextureMatrix());
+        _effect->setMatrix(_uniformIndices[BUMPMATRIX],
+                           *bumpTexture->getTextureMatrix());
       }
 
       if (refractionTexture && StandardMaterial::RefractionTextureEnabled) {
@@ -1033,7 +1140,7 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
         }
         else {
           _effect->setTexture("refraction2DSampler", refractionTexture);
-          _effect->setMatrix("refractionMatrix",
+          _effect->setMatrix(_uniformIndices[REFRACTIONMATRIX],
                              *refractionTexture->getReflectionTextureMatrix());
 
           RefractionTexture* _refractionTexture
@@ -1042,13 +1149,13 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
             depth = _refractionTexture->depth;
           }
         }
-        _effect->setFloat4("vRefractionInfos", refractionTexture->level,
-                           indexOfRefraction, depth,
+        _effect->setFloat4(_uniformIndices[VREFRACTIONINFOS],
+                           refractionTexture->level, indexOfRefraction, depth,
                            invertRefractionY ? -1.f : 1.f);
       }
 
       if ((reflectionTexture || refractionTexture)) {
-        _effect->setFloat2("vMicrosurfaceTextureLods",
+        _effect->setFloat2(_uniformIndices[VMICROSURFACETEXTURELODS],
                            _microsurfaceTextureLods.x,
                            _microsurfaceTextureLods.y);
       }
@@ -1064,7 +1171,7 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
 
     // Point size
     if (pointsCloud()) {
-      _effect->setFloat("pointSize", pointSize);
+      _effect->setFloat(_uniformIndices[POINTSIZE], pointSize);
     }
 
     // Colors
@@ -1074,28 +1181,33 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
     convertColorToLinearSpaceToRef(reflectivityColor,
                                    PBRMaterial::_scaledReflectivity);
 
-    _effect->setVector3("vEyePosition", _myScene->_mirroredCameraPosition ?
-                                          *_myScene->_mirroredCameraPosition :
-                                          _myScene->activeCamera->position);
-    _effect->setColor3("vAmbientColor", _globalAmbientColor);
-    _effect->setColor4("vReflectivityColor", PBRMaterial::_scaledReflectivity,
-                       microSurface);
+    if (!_defines[PMD::UNIFORMBUFFER]) {
+      _effect->setVector3(_uniformIndices[VEYEPOSITION],
+                          _myScene->_mirroredCameraPosition ?
+                            *_myScene->_mirroredCameraPosition :
+                            _myScene->activeCamera->position);
+    }
+    _effect->setColor3(_uniformIndices[VAMBIENTCOLOR], _globalAmbientColor);
+    _effect->setColor4(_uniformIndices[VREFLECTIVITYCOLOR],
+                       PBRMaterial::_scaledReflectivity, microSurface);
 
     // GAMMA CORRECTION.
     convertColorToLinearSpaceToRef(emissiveColor, PBRMaterial::_scaledEmissive);
-    _effect->setColor3("vEmissiveColor", PBRMaterial::_scaledEmissive);
+    _effect->setColor3(_uniformIndices[VEMISSIVECOLOR],
+                       PBRMaterial::_scaledEmissive);
 
     // GAMMA CORRECTION.
     convertColorToLinearSpaceToRef(reflectionColor,
                                    PBRMaterial::_scaledReflection);
-    _effect->setColor3("vReflectionColor", PBRMaterial::_scaledReflection);
+    _effect->setColor3(_uniformIndices[VREFLECTIONCOLOR],
+                       PBRMaterial::_scaledReflection);
   }
 
   if (_myScene->getCachedMaterial() != this || !isFrozen()) {
     // GAMMA CORRECTION.
     convertColorToLinearSpaceToRef(albedoColor, PBRMaterial::_scaledAlbedo);
-    _effect->setColor4("vAlbedoColor", PBRMaterial::_scaledAlbedo,
-                       alpha * mesh->visibility);
+    _effect->setColor4(_uniformIndices[VALBEDOCOLOR],
+                       PBRMaterial::_scaledAlbedo, alpha * mesh->visibility);
 
     // Lights
     if (_myScene->lightsEnabled && !disableLighting) {
@@ -1105,10 +1217,11 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
     }
 
     // View
-    if ((_myScene->fogEnabled && mesh->applyFog
-         && _myScene->fogMode != Scene::FOGMODE_NONE)
-        || reflectionTexture) {
-      _effect->setMatrix("view", _myScene->getViewMatrix());
+    if (((_myScene->fogEnabled && mesh->applyFog
+          && _myScene->fogMode != Scene::FOGMODE_NONE)
+         || reflectionTexture)
+        && !_defines[PMD::UNIFORMBUFFER]) {
+      _effect->setMatrix(_uniformIndices[VIEW], _myScene->getViewMatrix());
     }
 
     // Fog
@@ -1119,15 +1232,16 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
     _lightingInfos.z = environmentIntensity;
     _lightingInfos.w = specularIntensity;
 
-    _effect->setVector4("vLightingIntensity", _lightingInfos);
+    _effect->setVector4(_uniformIndices[VLIGHTINGINTENSITY], _lightingInfos);
 
     _overloadedShadowInfos.x = overloadedShadowIntensity;
     _overloadedShadowInfos.y = overloadedShadeIntensity;
-    _effect->setVector4("vOverloadedShadowIntensity", _overloadedShadowInfos);
+    _effect->setVector4(_uniformIndices[VOVERLOADEDSHADOWINTENSITY],
+                        _overloadedShadowInfos);
 
     _cameraInfos.x = cameraExposure;
     _cameraInfos.y = cameraContrast;
-    _effect->setVector4("vCameraInfos", _cameraInfos);
+    _effect->setVector4(_uniformIndices[VCAMERAINFOS], _cameraInfos);
 
     if (cameraColorCurves) {
       ColorCurves::Bind(*cameraColorCurves, _effect);
@@ -1137,23 +1251,25 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
     _overloadedIntensity.y = overloadedAlbedoIntensity;
     _overloadedIntensity.z = overloadedReflectivityIntensity;
     _overloadedIntensity.w = overloadedEmissiveIntensity;
-    _effect->setVector4("vOverloadedIntensity", _overloadedIntensity);
+    _effect->setVector4(_uniformIndices[VOVERLOADEDINTENSITY],
+                        _overloadedIntensity);
 
     convertColorToLinearSpaceToRef(overloadedAmbient, _tempColor);
-    _effect->setColor3("vOverloadedAmbient", _tempColor);
+    _effect->setColor3(_uniformIndices[VOVERLOADEDAMBIENT], _tempColor);
     convertColorToLinearSpaceToRef(overloadedAlbedo, _tempColor);
-    _effect->setColor3("vOverloadedAlbedo", _tempColor);
+    _effect->setColor3(_uniformIndices[VOVERLOADEDALBEDO], _tempColor);
     convertColorToLinearSpaceToRef(overloadedReflectivity, _tempColor);
-    _effect->setColor3("vOverloadedReflectivity", _tempColor);
+    _effect->setColor3(_uniformIndices[VOVERLOADEDREFLECTIVITY], _tempColor);
     convertColorToLinearSpaceToRef(overloadedEmissive, _tempColor);
-    _effect->setColor3("vOverloadedEmissive", _tempColor);
+    _effect->setColor3(_uniformIndices[VOVERLOADEDEMISSIVE], _tempColor);
     convertColorToLinearSpaceToRef(overloadedReflection, _tempColor);
-    _effect->setColor3("vOverloadedReflection", _tempColor);
+    _effect->setColor3(_uniformIndices[VOVERLOADEDREFLECTION], _tempColor);
 
     _overloadedMicroSurface.x = overloadedMicroSurface;
     _overloadedMicroSurface.y = overloadedMicroSurfaceIntensity;
     _overloadedMicroSurface.z = overloadedReflectionIntensity;
-    _effect->setVector3("vOverloadedMicroSurface", _overloadedMicroSurface);
+    _effect->setVector3(_uniformIndices[VOVERLOADEDMICROSURFACE],
+                        _overloadedMicroSurface);
 
     // Log. depth
     MaterialHelper::BindLogDepth(_defines.defines[PMD::LOGARITHMICDEPTH],
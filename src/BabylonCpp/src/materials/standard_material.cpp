@@ -19,6 +19,7 @@
 #include <babylon/materials/textures/color_grading_texture.h>
 #include <babylon/materials/textures/refraction_texture.h>
 #include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/materials/uniform_buffer.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
@@ -26,6 +27,96 @@
 
 namespace BABYLON {
 
+namespace {
+
+// The uniforms set by bind(), resolved to indices once per effect
+enum StandardMaterialUniform : unsigned int {
+  WORLD,
+  VIEWPROJECTION,
+  DIFFUSELEFTCOLOR,
+  DIFFUSERIGHTCOLOR,
+  OPACITYPARTS,
+  REFLECTIONLEFTCOLOR,
+  REFLECTIONRIGHTCOLOR,
+  REFRACTIONLEFTCOLOR,
+  REFRACTIONRIGHTCOLOR,
+  EMISSIVELEFTCOLOR,
+  EMISSIVERIGHTCOLOR,
+  VDIFFUSEINFOS,
+  DIFFUSEMATRIX,
+  VAMBIENTINFOS,
+  AMBIENTMATRIX,
+  VOPACITYINFOS,
+  OPACITYMATRIX,
+  REFLECTIONMATRIX,
+  VREFLECTIONINFOS,
+  VEMISSIVEINFOS,
+  EMISSIVEMATRIX,
+  VLIGHTMAPINFOS,
+  LIGHTMAPMATRIX,
+  VSPECULARINFOS,
+  SPECULARMATRIX,
+  VBUMPINFOS,
+  BUMPMATRIX,
+  REFRACTIONMATRIX,
+  VREFRACTIONINFOS,
+  POINTSIZE,
+  VEYEPOSITION,
+  VAMBIENTCOLOR,
+  VSPECULARCOLOR,
+  VEMISSIVECOLOR,
+  VDIFFUSECOLOR,
+  VIEW,
+  UNIFORM_COUNT
+};
+
+const std::array<const char*, UNIFORM_COUNT> standardMaterialUniforms{{
+  "world", "viewProjection", "diffuseLeftColor", "diffuseRightColor",
+  "opacityParts", "reflectionLeftColor", "reflectionRightColor",
+  "refractionLeftColor", "refractionRightColor", "emissiveLeftColor",
+  "emissiveRightColor", "vDiffuseInfos", "diffuseMatrix", "vAmbientInfos",
+  "ambientMatrix", "vOpacityInfos", "opacityMatrix", "reflectionMatrix",
+  "vReflectionInfos", "vEmissiveInfos", "emissiveMatrix", "vLightmapInfos",
+  "lightmapMatrix", "vSpecularInfos", "specularMatrix", "vBumpInfos",
+  "bumpMatrix", "refractionMatrix", "vRefractionInfos", "pointSize",
+  "vEyePosition", "vAmbientColor", "vSpecularColor", "vEmissiveColor",
+  "vDiffuseColor", "view"}};
+
+// The members of the Material uniform block with their number of floats, in
+// the order of the defaultUboDeclaration shader include
+const std::array<std::pair<StandardMaterialUniform, unsigned int>, 29>
+  materialBlockUniforms{{{DIFFUSELEFTCOLOR, 4},
+                         {DIFFUSERIGHTCOLOR, 4},
+                         {OPACITYPARTS, 4},
+                         {REFLECTIONLEFTCOLOR, 4},
+                         {REFLECTIONRIGHTCOLOR, 4},
+                         {REFRACTIONLEFTCOLOR, 4},
+                         {REFRACTIONRIGHTCOLOR, 4},
+                         {EMISSIVELEFTCOLOR, 4},
+                         {EMISSIVERIGHTCOLOR, 4},
+                         {VDIFFUSEINFOS, 2},
+                         {VAMBIENTINFOS, 2},
+                         {VOPACITYINFOS, 2},
+                         {VREFLECTIONINFOS, 2},
+                         {VEMISSIVEINFOS, 2},
+                         {VLIGHTMAPINFOS, 2},
+                         {VSPECULARINFOS, 2},
+                         {DIFFUSEMATRIX, 16},
+                         {AMBIENTMATRIX, 16},
+                         {OPACITYMATRIX, 16},
+                         {REFLECTIONMATRIX, 16},
+                         {EMISSIVEMATRIX, 16},
+                         {LIGHTMAPMATRIX, 16},
+                         {SPECULARMATRIX, 16},
+                         {BUMPMATRIX, 16},
+                         {REFRACTIONMATRIX, 16},
+                         {VREFRACTIONINFOS, 4},
+                         {VSPECULARCOLOR, 4},
+                         {VAMBIENTCOLOR, 3},
+                         {VEMISSIVECOLOR, 3}}};
+
+} // end of anonymous namespace
+
 bool StandardMaterial::DiffuseTextureEnabled      = true;
 bool StandardMaterial::AmbientTextureEnabled      = true;
 bool StandardMaterial::OpacityTextureEnabled      = true;
@@ -492,6 +583,10 @@ bool StandardMaterial::isReady(AbstractMesh* mesh, bool useInstances)
     _defines.defines[SMD::CAMERACOLORCURVES] = true;
   }
 
+  if (MaterialHelper::UseUniformBuffers(engine, maxSimultaneousLights)) {
+    _defines.defines[SMD::UNIFORMBUFFER] = true;
+  }
+
   // Point size
   if (pointsCloud() || scene->forcePointsCloud) {
     _defines.defines[SMD::POINTSIZE] = true;
@@ -677,7 +772,6 @@ bool StandardMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
     // Legacy browser patch
     std::string shaderName = "default";
-    std::string join       = _defines.toString();
     std::vector<std::string> uniforms{"world",
                                       "view",
                                       "viewProjection",
@@ -739,8 +833,19 @@ bool StandardMaterial::isReady(AbstractMesh* mesh, bool useInstances)
       {"maxSimultaneousLights", maxSimultaneousLights - 1}};
 
     _effect = scene->getEngine()->createEffect(
-      shaderName, attribs, uniforms, samplers, join, fallbacks.get(),
+      shaderName, attribs, uniforms, samplers, _defines, fallbacks.get(),
       onCompiled, onError, indexParameters);
+
+    _uniformIndices.resize(UNIFORM_COUNT);
+    for (unsigned int i = 0; i < UNIFORM_COUNT; ++i) {
+      _uniformIndices[i]
+        = _effect->getUniformIndex(standardMaterialUniforms[i]);
+    }
+
+    if (_defines[SMD::UNIFORMBUFFER]) {
+      MaterialHelper::BindUniformBlocks(_effect, maxSimultaneousLights);
+      _buildUniformBuffer();
+    }
   }
   if (!_effect->isReady()) {
     return false;
@@ -776,7 +881,7 @@ void StandardMaterial::unbind()
 
 void StandardMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _effect->setMatrix("world", world);
+  _effect->setMatrix(_uniformIndices[WORLD], world);
 }
 
 void StandardMaterial::bind(Matrix* world, Mesh* mesh)
@@ -790,55 +895,55 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
   MaterialHelper::BindBonesParameters(mesh, _effect);
 
   if (scene->getCachedMaterial() != this) {
-    _effect->setMatrix("viewProjection", scene->getTransformMatrix());
+    // The scene block holds the view projection and the eye position
+    if (_defines[SMD::UNIFORMBUFFER]) {
+      scene->getSceneUniformBuffer()->bind(UniformBuffer::SceneBlockBinding);
+    }
+    else {
+      _effect->setMatrix(_uniformIndices[VIEWPROJECTION],
+                         scene->getTransformMatrix());
+    }
 
     if (StandardMaterial::FresnelEnabled) {
       // Fresnel
       if (diffuseFresnelParameters && diffuseFresnelParameters->isEnabled) {
-        _effect->setColor4("diffuseLeftColor",
-                           diffuseFresnelParameters->leftColor,
-                           diffuseFresnelParameters->power);
-        _effect->setColor4("diffuseRightColor",
-                           diffuseFresnelParameters->rightColor,
-                           diffuseFresnelParameters->bias);
+        _setColor4(DIFFUSELEFTCOLOR, diffuseFresnelParameters->leftColor,
+                   diffuseFresnelParameters->power);
+        _setColor4(DIFFUSERIGHTCOLOR, diffuseFresnelParameters->rightColor,
+                   diffuseFresnelParameters->bias);
       }
 
       if (opacityFresnelParameters && opacityFresnelParameters->isEnabled) {
-        _effect->setColor4(
-          "opacityParts",
-          Color3(opacityFresnelParameters->leftColor.toLuminance(),
-                 opacityFresnelParameters->rightColor.toLuminance(),
-                 opacityFresnelParameters->bias),
-          static_cast<float>(opacityFresnelParameters->power));
+        _setColor4(OPACITYPARTS,
+                   Color3(opacityFresnelParameters->leftColor.toLuminance(),
+                          opacityFresnelParameters->rightColor.toLuminance(),
+                          opacityFresnelParameters->bias),
+                   static_cast<float>(opacityFresnelParameters->power));
       }
 
       if (reflectionFresnelParameters
           && reflectionFresnelParameters->isEnabled) {
-        _effect->setColor4("reflectionLeftColor",
-                           reflectionFresnelParameters->leftColor,
-                           reflectionFresnelParameters->power);
-        _effect->setColor4("reflectionRightColor",
-                           reflectionFresnelParameters->rightColor,
-                           reflectionFresnelParameters->bias);
+        _setColor4(REFLECTIONLEFTCOLOR, reflectionFresnelParameters->leftColor,
+                   reflectionFresnelParameters->power);
+        _setColor4(REFLECTIONRIGHTCOLOR,
+                   reflectionFresnelParameters->rightColor,
+                   reflectionFresnelParameters->bias);
       }
 
       if (refractionFresnelParameters
           && refractionFresnelParameters->isEnabled) {
-        _effect->setColor4("refractionLeftColor",
-                           refractionFresnelParameters->leftColor,
-                           refractionFresnelParameters->power);
-        _effect->setColor4("refractionRightColor",
-                           refractionFresnelParameters->rightColor,
-                           refractionFresnelParameters->bias);
+        _setColor4(REFRACTIONLEFTCOLOR, refractionFresnelParameters->leftColor,
+                   refractionFresnelParameters->power);
+        _setColor4(REFRACTIONRIGHTCOLOR,
+                   refractionFresnelParameters->rightColor,
+                   refractionFresnelParameters->bias);
       }
 
       if (emissiveFresnelParameters && emissiveFresnelParameters->isEnabled) {
-        _effect->setColor4("emissiveLeftColor",
-                           emissiveFresnelParameters->leftColor,
-                           emissiveFresnelParameters->power);
-        _effect->setColor4("emissiveRightColor",
-                           emissiveFresnelParameters->rightColor,
-                           emissiveFresnelParameters->bias);
+        _setColor4(EMISSIVELEFTCOLOR, emissiveFresnelParameters->leftColor,
+                   emissiveFresnelParameters->power);
+        _setColor4(EMISSIVERIGHTCOLOR, emissiveFresnelParameters->rightColor,
+                   emissiveFresnelParameters->bias);
       }
     }
 
@@ -847,31 +952,28 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
       if (diffuseTexture && StandardMaterial::DiffuseTextureEnabled) {
         _effect->setTexture("diffuseSampler", diffuseTexture);
 
-        _effect->setFloat2("vDiffuseInfos",
-                           static_cast<float>(diffuseTexture->coordinatesIndex),
-                           diffuseTexture->level);
-        _effect->setMatrix("diffuseMatrix",
-                           *diffuseTexture->getTextureMatrix());
+        _setFloat2(VDIFFUSEINFOS,
+                   static_cast<float>(diffuseTexture->coordinatesIndex),
+                   diffuseTexture->level);
+        _setMatrix(DIFFUSEMATRIX, *diffuseTexture->getTextureMatrix());
       }
 
       if (ambientTexture && StandardMaterial::AmbientTextureEnabled) {
         _effect->setTexture("ambientSampler", ambientTexture);
 
-        _effect->setFloat2("vAmbientInfos",
-                           static_cast<float>(ambientTexture->coordinatesIndex),
-                           ambientTexture->level);
-        _effect->setMatrix("ambientMatrix",
-                           *ambientTexture->getTextureMatrix());
+        _setFloat2(VAMBIENTINFOS,
+                   static_cast<float>(ambientTexture->coordinatesIndex),
+                   ambientTexture->level);
+        _setMatrix(AMBIENTMATRIX, *ambientTexture->getTextureMatrix());
       }
 
       if (opacityTexture && StandardMaterial::OpacityTextureEnabled) {
         _effect->setTexture("opacitySampler", opacityTexture);
 
-        _effect->setFloat2("vOpacityInfos",
-                           static_cast<float>(opacityTexture->coordinatesIndex),
-                           opacityTexture->level);
-        _effect->setMatrix("opacityMatrix",
-                           *opacityTexture->getTextureMatrix());
+        _setFloat2(VOPACITYINFOS,
+                   static_cast<float>(opacityTexture->coordinatesIndex),
+                   opacityTexture->level);
+        _setMatrix(OPACITYMATRIX, *opacityTexture->getTextureMatrix());
       }
 
       if (reflectionTexture && StandardMaterial::ReflectionTextureEnabled) {
@@ -882,53 +984,46 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
           _effect->setTexture("reflection2DSampler", reflectionTexture);
         }
 
-        _effect->setMatrix("reflectionMatrix",
-                           *reflectionTexture->getReflectionTextureMatrix());
-        _effect->setFloat2("vReflectionInfos", reflectionTexture->level,
-                           roughness);
+        _setMatrix(REFLECTIONMATRIX,
+                   *reflectionTexture->getReflectionTextureMatrix());
+        _setFloat2(VREFLECTIONINFOS, reflectionTexture->level, roughness);
       }
 
       if (emissiveTexture && StandardMaterial::EmissiveTextureEnabled) {
         _effect->setTexture("emissiveSampler", emissiveTexture);
 
-        _effect->setFloat2(
-          "vEmissiveInfos",
-          static_cast<float>(emissiveTexture->coordinatesIndex),
-          emissiveTexture->level);
-        _effect->setMatrix("emissiveMatrix",
-                           *emissiveTexture->getTextureMatrix());
+        _setFloat2(VEMISSIVEINFOS,
+                   static_cast<float>(emissiveTexture->coordinatesIndex),
+                   emissiveTexture->level);
+        _setMatrix(EMISSIVEMATRIX, *emissiveTexture->getTextureMatrix());
       }
 
       if (lightmapTexture && StandardMaterial::LightmapTextureEnabled) {
         _effect->setTexture("lightmapSampler", lightmapTexture);
 
-        _effect->setFloat2(
-          "vLightmapInfos",
-          static_cast<float>(lightmapTexture->coordinatesIndex),
-          lightmapTexture->level);
-        _effect->setMatrix("lightmapMatrix",
-                           *lightmapTexture->getTextureMatrix());
+        _setFloat2(VLIGHTMAPINFOS,
+                   static_cast<float>(lightmapTexture->coordinatesIndex),
+                   lightmapTexture->level);
+        _setMatrix(LIGHTMAPMATRIX, *lightmapTexture->getTextureMatrix());
       }
 
       if (specularTexture && StandardMaterial::SpecularTextureEnabled) {
         _effect->setTexture("specularSampler", specularTexture);
 
-        _effect->setFloat2(
-          "vSpecularInfos",
-          static_cast<float>(specularTexture->coordinatesIndex),
-          specularTexture->level);
-        _effect->setMatrix("specularMatrix",
-                           *specularTexture->getTextureMatrix());
+        _setFloat2(VSPECULARINFOS,
+                   static_cast<float>(specularTexture->coordinatesIndex),
+                   specularTexture->level);
+        _setMatrix(SPECULARMATRIX, *specularTexture->getTextureMatrix());
       }
 
       if (bumpTexture && scene->getEngine()->getCaps().standardDerivatives
           && StandardMaterial::BumpTextureEnabled) {
         _effect->setTexture("bumpSampler", bumpTexture);
 
-        _effect->setFloat2("vBumpInfos",
-                           static_cast<float>(bumpTexture->coordinatesIndex),
-                           1.f / bumpTexture->level);
-        _effect->setMatrix("bumpMatrix", *bumpTexture->getTextureMatrix());
+        _setFloat2(VBUMPINFOS,
+                   static_cast<float>(bumpTexture->coordinatesIndex),
+                   1.f / bumpTexture->level);
+        _setMatrix(BUMPMATRIX, *bumpTexture->getTextureMatrix());
       }
 
       if (refractionTexture && StandardMaterial::RefractionTextureEnabled) {
@@ -938,8 +1033,8 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
         }
         else {
           _effect->setTexture("refraction2DSampler", refractionTexture);
-          _effect->setMatrix("refractionMatrix",
-                             *refractionTexture->getReflectionTextureMatrix());
+          _setMatrix(REFRACTIONMATRIX,
+                     *refractionTexture->getReflectionTextureMatrix());
 
           RefractionTexture* _refractionTexture
             = dynamic_cast<RefractionTexture*>(refractionTexture);
@@ -947,9 +1042,8 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
             depth = _refractionTexture->depth;
           }
         }
-        _effect->setFloat4("vRefractionInfos", refractionTexture->level,
-                           indexOfRefraction, depth,
-                           invertRefractionY ? -1 : 1);
+        _setFloat4(VREFRACTIONINFOS, refractionTexture->level,
+                   indexOfRefraction, depth, invertRefractionY ? -1 : 1);
       }
       if (cameraColorGradingTexture
           && StandardMaterial::ColorGradingTextureEnabled) {
@@ -962,39 +1056,51 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
 
     // Point size
     if (pointsCloud()) {
-      _effect->setFloat("pointSize", pointSize);
+      _effect->setFloat(_uniformIndices[POINTSIZE], pointSize);
     }
 
     // Colors
     scene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
 
-    _effect->setVector3("vEyePosition", scene->_mirroredCameraPosition ?
-                                          *scene->_mirroredCameraPosition :
-                                          scene->activeCamera->position);
-    _effect->setColor3("vAmbientColor", _globalAmbientColor);
+    if (!_defines[SMD::UNIFORMBUFFER]) {
+      _effect->setVector3(_uniformIndices[VEYEPOSITION],
+                          scene->_mirroredCameraPosition ?
+                            *scene->_mirroredCameraPosition :
+                            scene->activeCamera->position);
+    }
+    _setColor3(VAMBIENTCOLOR, _globalAmbientColor);
 
     if (_defines[SMD::SPECULARTERM]) {
-      _effect->setColor4("vSpecularColor", specularColor, specularPower);
+      _setColor4(VSPECULARCOLOR, specularColor, specularPower);
+    }
+    _setColor3(VEMISSIVECOLOR, emissiveColor);
+
+    // Material block, only uploaded when one of its values changed
+    if (_defines[SMD::UNIFORMBUFFER]) {
+      _uniformBuffer->update();
+      _uniformBuffer->bind(UniformBuffer::MaterialBlockBinding);
     }
-    _effect->setColor3("vEmissiveColor", emissiveColor);
   }
 
   if (scene->getCachedMaterial() != this || !isFrozen()) {
     // Diffuse
-    _effect->setColor4("vDiffuseColor", diffuseColor, alpha * mesh->visibility);
+    _effect->setColor4(_uniformIndices[VDIFFUSECOLOR], diffuseColor,
+                       alpha * mesh->visibility);
 
     // Lights
     if (scene->lightsEnabled && !disableLighting) {
       MaterialHelper::BindLights(scene, mesh, _effect,
                                  _defines.defines[SMD::SPECULARTERM],
-                                 maxSimultaneousLights);
+                                 maxSimultaneousLights,
+                                 _defines.defines[SMD::UNIFORMBUFFER]);
     }
 
     // View
-    if ((scene->fogEnabled && mesh->applyFog
-         && scene->fogMode != scene->FOGMODE_NONE)
-        || reflectionTexture || refractionTexture) {
-      _effect->setMatrix("view", scene->getViewMatrix());
+    if (((scene->fogEnabled && mesh->applyFog
+          && scene->fogMode != scene->FOGMODE_NONE)
+         || reflectionTexture || refractionTexture)
+        && !_defines[SMD::UNIFORMBUFFER]) {
+      _effect->setMatrix(_uniformIndices[VIEW], scene->getViewMatrix());
     }
 
     // Fog
@@ -1013,6 +1119,75 @@ void StandardMaterial::bind(Matrix* world, Mesh* mesh)
   Material::bind(world, mesh);
 }
 
+void StandardMaterial::_buildUniformBuffer()
+{
+  if (_uniformBuffer) {
+    return;
+  }
+
+  _uniformBuffer = std::unique_ptr<UniformBuffer>(
+    new UniformBuffer(getScene()->getEngine()));
+  _uniformBufferIndices.assign(UNIFORM_COUNT, -1);
+  for (const auto& uniform : materialBlockUniforms) {
+    _uniformBufferIndices[uniform.first] = _uniformBuffer->addUniform(
+      standardMaterialUniforms[uniform.first], uniform.second);
+  }
+  _uniformBuffer->create();
+}
+
+void StandardMaterial::_setMatrix(unsigned int uniform, const Matrix& matrix)
+{
+  if (_defines[SMD::UNIFORMBUFFER] && _uniformBufferIndices[uniform] >= 0) {
+    _uniformBuffer->updateMatrix(_uniformBufferIndices[uniform], matrix);
+  }
+  else {
+    _effect->setMatrix(_uniformIndices[uniform], matrix);
+  }
+}
+
+void StandardMaterial::_setFloat2(unsigned int uniform, float x, float y)
+{
+  if (_defines[SMD::UNIFORMBUFFER] && _uniformBufferIndices[uniform] >= 0) {
+    _uniformBuffer->updateFloat2(_uniformBufferIndices[uniform], x, y);
+  }
+  else {
+    _effect->setFloat2(_uniformIndices[uniform], x, y);
+  }
+}
+
+void StandardMaterial::_setFloat4(unsigned int uniform, float x, float y,
+                                  float z, float w)
+{
+  if (_defines[SMD::UNIFORMBUFFER] && _uniformBufferIndices[uniform] >= 0) {
+    _uniformBuffer->updateFloat4(_uniformBufferIndices[uniform], x, y, z, w);
+  }
+  else {
+    _effect->setFloat4(_uniformIndices[uniform], x, y, z, w);
+  }
+}
+
+void StandardMaterial::_setColor3(unsigned int uniform, const Color3& color3)
+{
+  if (_defines[SMD::UNIFORMBUFFER] && _uniformBufferIndices[uniform] >= 0) {
+    _uniformBuffer->updateColor3(_uniformBufferIndices[uniform], color3);
+  }
+  else {
+    _effect->setColor3(_uniformIndices[uniform], color3);
+  }
+}
+
+void StandardMaterial::_setColor4(unsigned int uniform, const Color3& color3,
+                                  float alpha)
+{
+  if (_defines[SMD::UNIFORMBUFFER] && _uniformBufferIndices[uniform] >= 0) {
+    _uniformBuffer->updateColor4(_uniformBufferIndices[uniform], color3,
+                                 alpha);
+  }
+  else {
+    _effect->setColor4(_uniformIndices[uniform], color3, alpha);
+  }
+}
+
 std::vector<IAnimatable*> StandardMaterial::getAnimatables()
 {
   std::vector<IAnimatable*> results;
@@ -1106,6 +1281,10 @@ void StandardMaterial::dispose(bool forceDisposeEffect,
     }
   }
 
+  if (_uniformBuffer) {
+    _uniformBuffer->dispose();
+  }
+
   Material::dispose(forceDisposeEffect, forceDisposeTextures);
 }
 
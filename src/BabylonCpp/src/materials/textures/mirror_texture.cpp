@@ -28,9 +28,11 @@ MirrorTexture::MirrorTexture(const std::string& iName, const ISize& size,
   };
 
   onAfterRender = [&]() {
+    // Reset the mirrored position first, the eye position of the scene
+    // uniform block is refreshed with the transform matrix
+    scene->_mirroredCameraPosition.reset(nullptr);
     scene->setTransformMatrix(_savedViewMatrix, scene->getProjectionMatrix());
     scene->getEngine()->cullBackFaces = true;
-    scene->_mirroredCameraPosition.reset(nullptr);
     scene->resetClipPlane();
   };
 }
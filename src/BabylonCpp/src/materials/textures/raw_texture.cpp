@@ -8,7 +8,7 @@ namespace BABYLON {
 RawTexture::RawTexture(const Uint8Array& data, int width, int height,
                        int iFormat, Scene* scene, bool generateMipMaps,
                        bool invertY, unsigned int samplingMode)
-    : Texture{nullptr, scene, !generateMipMaps, invertY}
+    : Texture{"", scene, !generateMipMaps, invertY}
     , format{iFormat}
     , wrapU{Texture::CLAMP_ADDRESSMODE}
     , wrapV{Texture::CLAMP_ADDRESSMODE}
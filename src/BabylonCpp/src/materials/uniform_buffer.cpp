@@ -0,0 +1,223 @@
+#include <babylon/materials/uniform_buffer.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/math/color3.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+UniformBuffer::UniformBuffer(Engine* engine)
+    : _engine{engine}, _buffer{nullptr}, _needSync{false}
+{
+}
+
+UniformBuffer::~UniformBuffer()
+{
+  dispose();
+}
+
+bool UniformBuffer::useUbo() const
+{
+  return _engine->supportsUniformBuffers();
+}
+
+bool UniformBuffer::isSync() const
+{
+  return !_needSync;
+}
+
+GL::IGLBuffer* UniformBuffer::getBuffer()
+{
+  return _buffer.get();
+}
+
+const Float32Array& UniformBuffer::getData() const
+{
+  return _data;
+}
+
+int UniformBuffer::getUniformIndex(const std::string& name) const
+{
+  auto it = _uniformIndices.find(name);
+  return (it == _uniformIndices.end()) ? -1 : it->second;
+}
+
+unsigned int UniformBuffer::getUniformOffset(int uniformIndex) const
+{
+  return _uniforms[static_cast<size_t>(uniformIndex)].first;
+}
+
+int UniformBuffer::addUniform(const std::string& name, unsigned int size)
+{
+  auto it = _uniformIndices.find(name);
+  if (it != _uniformIndices.end()) {
+    return it->second;
+  }
+
+  // std140: scalars and vec2 are aligned on their size, vec3, vec4 and
+  // matrix columns on 4 floats
+  const size_t alignment = (size <= 2) ? size : 4;
+  if (_data.size() % alignment != 0) {
+    _data.resize(_data.size() + alignment - _data.size() % alignment, 0.f);
+  }
+
+  const int uniformIndex = static_cast<int>(_uniforms.size());
+  _uniforms.emplace_back(static_cast<unsigned int>(_data.size()), size);
+  _uniformIndices[name] = uniformIndex;
+  _data.resize(_data.size() + size, 0.f);
+
+  return uniformIndex;
+}
+
+void UniformBuffer::create()
+{
+  if (_buffer) {
+    return;
+  }
+
+  // The block size is rounded up to a vec4
+  if (_data.size() % 4 != 0) {
+    _data.resize(_data.size() + 4 - _data.size() % 4, 0.f);
+  }
+
+  if (!useUbo() || _data.empty()) {
+    return;
+  }
+
+  _buffer   = _engine->createDynamicUniformBuffer(_data);
+  _needSync = false;
+}
+
+void UniformBuffer::update()
+{
+  if (!_buffer || !_needSync) {
+    return;
+  }
+
+  _engine->updateUniformBuffer(_buffer.get(), _data);
+  _needSync = false;
+}
+
+void UniformBuffer::bind(unsigned int index)
+{
+  if (!_buffer) {
+    return;
+  }
+
+  _engine->bindUniformBufferBase(_buffer.get(), index);
+}
+
+void UniformBuffer::_updateValues(int uniformIndex, const float* values,
+                                  unsigned int count)
+{
+  if (uniformIndex < 0) {
+    return;
+  }
+
+  const auto& uniform = _uniforms[static_cast<size_t>(uniformIndex)];
+  float* data         = &_data[uniform.first];
+  count               = std::min(count, uniform.second);
+  if (std::memcmp(data, values, count * sizeof(float)) != 0) {
+    std::memcpy(data, values, count * sizeof(float));
+    _needSync = true;
+  }
+}
+
+void UniformBuffer::updateMatrix(const std::string& name, const Matrix& matrix)
+{
+  updateMatrix(getUniformIndex(name), matrix);
+}
+
+void UniformBuffer::updateFloat(const std::string& name, float x)
+{
+  updateFloat(getUniformIndex(name), x);
+}
+
+void UniformBuffer::updateFloat2(const std::string& name, float x, float y)
+{
+  updateFloat2(getUniformIndex(name), x, y);
+}
+
+void UniformBuffer::updateFloat3(const std::string& name, float x, float y,
+                                 float z)
+{
+  updateFloat3(getUniformIndex(name), x, y, z);
+}
+
+void UniformBuffer::updateFloat4(const std::string& name, float x, float y,
+                                 float z, float w)
+{
+  updateFloat4(getUniformIndex(name), x, y, z, w);
+}
+
+void UniformBuffer::updateVector3(const std::string& name,
+                                  const Vector3& vector3)
+{
+  updateVector3(getUniformIndex(name), vector3);
+}
+
+void UniformBuffer::updateColor3(const std::string& name, const Color3& color3)
+{
+  updateColor3(getUniformIndex(name), color3);
+}
+
+void UniformBuffer::updateColor4(const std::string& name, const Color3& color3,
+                                 float alpha)
+{
+  updateColor4(getUniformIndex(name), color3, alpha);
+}
+
+void UniformBuffer::updateMatrix(int uniformIndex, const Matrix& matrix)
+{
+  _updateValues(uniformIndex, matrix.m.data(), 16);
+}
+
+void UniformBuffer::updateFloat(int uniformIndex, float x)
+{
+  _updateValues(uniformIndex, &x, 1);
+}
+
+void UniformBuffer::updateFloat2(int uniformIndex, float x, float y)
+{
+  const float values[2] = {x, y};
+  _updateValues(uniformIndex, values, 2);
+}
+
+void UniformBuffer::updateFloat3(int uniformIndex, float x, float y, float z)
+{
+  const float values[3] = {x, y, z};
+  _updateValues(uniformIndex, values, 3);
+}
+
+void UniformBuffer::updateFloat4(int uniformIndex, float x, float y, float z,
+                                 float w)
+{
+  const float values[4] = {x, y, z, w};
+  _updateValues(uniformIndex, values, 4);
+}
+
+void UniformBuffer::updateVector3(int uniformIndex, const Vector3& vector3)
+{
+  updateFloat3(uniformIndex, vector3.x, vector3.y, vector3.z);
+}
+
+void UniformBuffer::updateColor3(int uniformIndex, const Color3& color3)
+{
+  updateFloat3(uniformIndex, color3.r, color3.g, color3.b);
+}
+
+void UniformBuffer::updateColor4(int uniformIndex, const Color3& color3,
+                                 float alpha)
+{
+  updateFloat4(uniformIndex, color3.r, color3.g, color3.b, alpha);
+}
+
+void UniformBuffer::dispose()
+{
+  if (_buffer && _engine->_releaseBuffer(_buffer.get())) {
+    _buffer.reset(nullptr);
+  }
+}
+
+} // end of namespace BABYLON
@@ -318,6 +318,14 @@ Color3 Color3::Lerp(const Color3& start, const Color3& end, float amount)
   return Color3(r, g, b);
 }
 
+void Color3::LerpToRef(const Color3& start, const Color3& end, float amount,
+                       Color3& result)
+{
+  result.r = start.r + ((end.r - start.r) * amount);
+  result.g = start.g + ((end.g - start.g) * amount);
+  result.b = start.b + ((end.b - start.b) * amount);
+}
+
 Color3 Color3::Red()
 {
   return Color3(1.f, 0.f, 0.f);
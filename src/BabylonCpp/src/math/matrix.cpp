@@ -477,9 +477,9 @@ bool Matrix::decompose(Vector3& scale, Quaternion& rotation,
     m[0] / scale.x, m[1] / scale.x, m[2] / scale.x, 0.f,  //
     m[4] / scale.y, m[5] / scale.y, m[6] / scale.y, 0.f,  //
     m[8] / scale.z, m[9] / scale.z, m[10] / scale.z, 0.f, //
-    0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray[0]);
+    0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray()[0]);
 
-  Quaternion::FromRotationMatrixToRef(Tmp::MatrixArray[0], rotation);
+  Quaternion::FromRotationMatrixToRef(Tmp::MatrixArray()[0], rotation);
 
   return true;
 }
@@ -700,11 +700,11 @@ void Matrix::ComposeToRef(const Vector3& scale, Quaternion& rotation,
   Matrix::FromValuesToRef(scale.x, 0.f, 0.f, 0.f, //
                           0.f, scale.y, 0.f, 0.f, //
                           0.f, 0.f, scale.z, 0.f, //
-                          0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray[1]);
+                          0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray()[1]);
 
-  rotation.toRotationMatrix(Tmp::MatrixArray[0]);
+  rotation.toRotationMatrix(Tmp::MatrixArray()[0]);
 
-  Tmp::MatrixArray[1].multiplyToRef(Tmp::MatrixArray[0], result);
+  Tmp::MatrixArray()[1].multiplyToRef(Tmp::MatrixArray()[0], result);
 
   result.setTranslation(translation);
 }
@@ -946,12 +946,18 @@ Matrix Matrix::Lerp(const Matrix& startValue, const Matrix& endValue,
 {
   Matrix result = Matrix::Zero();
 
+  Matrix::LerpToRef(startValue, endValue, gradient, result);
+
+  return result;
+}
+
+void Matrix::LerpToRef(const Matrix& startValue, const Matrix& endValue,
+                       float gradient, Matrix& result)
+{
   for (unsigned int index = 0; index < 16; ++index) {
     result.m[index]
       = startValue.m[index] * (1.f - gradient) + endValue.m[index] * gradient;
   }
-
-  return result;
 }
 
 Matrix Matrix::DecomposeLerp(Matrix& startValue, Matrix& endValue,
@@ -0,0 +1,1354 @@
+#include <babylon/math/simd/simd_batch.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)               \
+  || defined(_M_IX86)
+#define BABYLON_SIMD_BATCH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define BABYLON_SIMD_BATCH_X86 0
+#endif
+
+// The kernels of each instruction set are compiled for it with function
+// attributes, the rest of the library keeps the default target
+#if defined(__GNUC__) || defined(__clang__)
+#define BABYLON_TARGET_SSE2 __attribute__((target("sse2")))
+#define BABYLON_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define BABYLON_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+#define BABYLON_TARGET_SSE2
+#define BABYLON_TARGET_AVX2
+#define BABYLON_TARGET_AVX512
+#endif
+
+/**
+ * Inverse of the matrices whose elements are e[0..15], written to r[0..15],
+ * with the formula of Matrix::invertToRef. V is float, or a vector type
+ * holding the same element of several matrices.
+ */
+#define BABYLON_SIMD_INVERT(V, e, r)                                           \
+  {                                                                            \
+    const V l17 = e[10] * e[15] - e[11] * e[14];                               \
+    const V l18 = e[9] * e[15] - e[11] * e[13];                                \
+    const V l19 = e[9] * e[14] - e[10] * e[13];                                \
+    const V l20 = e[8] * e[15] - e[11] * e[12];                                \
+    const V l21 = e[8] * e[14] - e[10] * e[12];                                \
+    const V l22 = e[8] * e[13] - e[9] * e[12];                                 \
+    const V l23 = e[5] * l17 - e[6] * l18 + e[7] * l19;                        \
+    const V l24 = -(e[4] * l17 - e[6] * l20 + e[7] * l21);                     \
+    const V l25 = e[4] * l18 - e[5] * l20 + e[7] * l22;                        \
+    const V l26 = -(e[4] * l19 - e[5] * l21 + e[6] * l22);                     \
+    const V l27                                                                \
+      = V(1.f) / (e[0] * l23 + e[1] * l24 + e[2] * l25 + e[3] * l26);          \
+    const V l28 = e[6] * e[15] - e[7] * e[14];                                 \
+    const V l29 = e[5] * e[15] - e[7] * e[13];                                 \
+    const V l30 = e[5] * e[14] - e[6] * e[13];                                 \
+    const V l31 = e[4] * e[15] - e[7] * e[12];                                 \
+    const V l32 = e[4] * e[14] - e[6] * e[12];                                 \
+    const V l33 = e[4] * e[13] - e[5] * e[12];                                 \
+    const V l34 = e[6] * e[11] - e[7] * e[10];                                 \
+    const V l35 = e[5] * e[11] - e[7] * e[9];                                  \
+    const V l36 = e[5] * e[10] - e[6] * e[9];                                  \
+    const V l37 = e[4] * e[11] - e[7] * e[8];                                  \
+    const V l38 = e[4] * e[10] - e[6] * e[8];                                  \
+    const V l39 = e[4] * e[9] - e[5] * e[8];                                   \
+    r[0]        = l23 * l27;                                                   \
+    r[4]        = l24 * l27;                                                   \
+    r[8]        = l25 * l27;                                                   \
+    r[12]       = l26 * l27;                                                   \
+    r[1]        = -(e[1] * l17 - e[2] * l18 + e[3] * l19) * l27;               \
+    r[5]        = (e[0] * l17 - e[2] * l20 + e[3] * l21) * l27;                \
+    r[9]        = -(e[0] * l18 - e[1] * l20 + e[3] * l22) * l27;               \
+    r[13]       = (e[0] * l19 - e[1] * l21 + e[2] * l22) * l27;                \
+    r[2]        = (e[1] * l28 - e[2] * l29 + e[3] * l30) * l27;                \
+    r[6]        = -(e[0] * l28 - e[2] * l31 + e[3] * l32) * l27;               \
+    r[10]       = (e[0] * l29 - e[1] * l31 + e[3] * l33) * l27;                \
+    r[14]       = -(e[0] * l30 - e[1] * l32 + e[2] * l33) * l27;               \
+    r[3]        = -(e[1] * l34 - e[2] * l35 + e[3] * l36) * l27;               \
+    r[7]        = (e[0] * l34 - e[2] * l37 + e[3] * l38) * l27;                \
+    r[11]       = -(e[0] * l35 - e[1] * l37 + e[3] * l39) * l27;               \
+    r[15]       = (e[0] * l36 - e[1] * l38 + e[2] * l39) * l27;                \
+  }
+
+/**
+ * Scaling * rotation matrix with the translation set, written to r[0..15],
+ * like Matrix::ComposeToRef.
+ */
+#define BABYLON_SIMD_COMPOSE(V, sx, sy, sz, qx, qy, qz, qw, tx, ty, tz, r)    \
+  {                                                                            \
+    const V zero(0.f);                                                         \
+    const V one(1.f);                                                          \
+    const V two(2.f);                                                          \
+    const V xx = qx * qx;                                                      \
+    const V yy = qy * qy;                                                      \
+    const V zz = qz * qz;                                                      \
+    const V xy = qx * qy;                                                      \
+    const V zw = qz * qw;                                                      \
+    const V zx = qz * qx;                                                      \
+    const V yw = qy * qw;                                                      \
+    const V yz = qy * qz;                                                      \
+    const V xw = qx * qw;                                                      \
+    r[0]       = sx * (one - two * (yy + zz));                                 \
+    r[1]       = sx * (two * (xy + zw));                                       \
+    r[2]       = sx * (two * (zx - yw));                                       \
+    r[3]       = zero;                                                         \
+    r[4]       = sy * (two * (xy - zw));                                       \
+    r[5]       = sy * (one - two * (zz + xx));                                 \
+    r[6]       = sy * (two * (yz + xw));                                       \
+    r[7]       = zero;                                                         \
+    r[8]       = sz * (two * (zx + yw));                                       \
+    r[9]       = sz * (two * (yz - xw));                                       \
+    r[10]      = sz * (one - two * (yy + xx));                                 \
+    r[11]      = zero;                                                         \
+    r[12]      = tx;                                                           \
+    r[13]      = ty;                                                           \
+    r[14]      = tz;                                                           \
+    r[15]      = one;                                                          \
+  }
+
+/**
+ * Signed distance to the plane p[0..3] of the corner farthest along its normal
+ * of the boxes with the center b[0..2] and the half axes b[3..11]. The boxes
+ * are out of the frustum if it is negative for one of the planes.
+ */
+#define BABYLON_SIMD_MAX_PLANE_DISTANCE(b, p)                                  \
+  (p[0] * b[0] + p[1] * b[1] + p[2] * b[2] + p[3]                              \
+   + absolute(p[0] * b[3] + p[1] * b[4] + p[2] * b[5])                         \
+   + absolute(p[0] * b[6] + p[1] * b[7] + p[2] * b[8])                         \
+   + absolute(p[0] * b[9] + p[1] * b[10] + p[2] * b[11]))
+
+/**
+ * Particles whose streams are s[0..17] (see SIMDBatch::UpdateParticles)
+ * advanced by step, g[0..2] being the gravity times step. The dead particles
+ * are advanced too, they are removed afterwards.
+ */
+#define BABYLON_SIMD_UPDATE_PARTICLES(V, s, step, g)                           \
+  {                                                                            \
+    for (unsigned int k = 0; k < 3; ++k) {                                     \
+      s[k]     = s[k] + s[3 + k] * step;                                       \
+      s[3 + k] = s[3 + k] + g[k];                                              \
+    }                                                                          \
+    for (unsigned int k = 6; k < 10; ++k) {                                    \
+      s[k] = s[k] + s[4 + k] * step;                                           \
+    }                                                                          \
+    s[9]  = maximum(s[9], V(0.f));                                             \
+    s[14] = s[14] + s[15] * step;                                              \
+    s[16] = s[16] + step;                                                      \
+  }
+
+namespace BABYLON {
+namespace SIMD {
+
+namespace {
+
+using MultiplyFunction   = void (*)(const float*, const float*, float*, size_t);
+using TransformFunction  = void (*)(const float*, const float*, float*, size_t);
+using ComposeFunction    = void (*)(const float*, const float*, const float*,
+                                 float*, size_t);
+using InvertFunction     = void (*)(const float*, float*, size_t);
+using IntersectFunction  = void (*)(const float*, size_t, size_t, size_t,
+                                   const float*, uint32_t*);
+using UpdateFunction     = void (*)(float*, size_t, size_t, size_t, float,
+                                const float*, uint32_t*);
+
+// Streams written by BABYLON_SIMD_UPDATE_PARTICLES
+const unsigned int updatedParticleStreams[]
+  = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 16};
+
+struct Kernels {
+  MultiplyFunction multiplyMatrices;
+  TransformFunction transformCoordinates;
+  TransformFunction transformNormals;
+  TransformFunction transformCoordinatesByMatrices;
+  TransformFunction transformNormalsByMatrices;
+  ComposeFunction composeMatrices;
+  InvertFunction invertMatrices;
+  // Boxes begin to end, begin is a multiple of the boxes processed at once
+  IntersectFunction intersectFrustum;
+  // Particles begin to end, begin is a multiple of the particles processed at
+  // once
+  UpdateFunction updateParticles;
+}; // end of struct Kernels
+
+/** Scalar **/
+
+void multiplyMatricesScalar(const float* left, const float* right,
+                            float* result, size_t count)
+{
+  float r[16];
+  for (size_t i = 0; i < count; ++i, left += 16, right += 16, result += 16) {
+    for (unsigned int row = 0; row < 16; row += 4) {
+      for (unsigned int column = 0; column < 4; ++column) {
+        r[row + column] = left[row + 0] * right[column + 0]
+                          + left[row + 1] * right[column + 4]
+                          + left[row + 2] * right[column + 8]
+                          + left[row + 3] * right[column + 12];
+      }
+    }
+    std::copy(r, r + 16, result);
+  }
+}
+
+inline void transformCoordinateScalar(const float* position, const float* m,
+                                      float* result)
+{
+  const float x  = position[0];
+  const float y  = position[1];
+  const float z  = position[2];
+  const float rx = x * m[0] + y * m[4] + z * m[8] + m[12];
+  const float ry = x * m[1] + y * m[5] + z * m[9] + m[13];
+  const float rz = x * m[2] + y * m[6] + z * m[10] + m[14];
+  const float rw = x * m[3] + y * m[7] + z * m[11] + m[15];
+  result[0]      = rx / rw;
+  result[1]      = ry / rw;
+  result[2]      = rz / rw;
+}
+
+inline void transformNormalScalar(const float* normal, const float* m,
+                                  float* result)
+{
+  const float x = normal[0];
+  const float y = normal[1];
+  const float z = normal[2];
+  result[0]     = x * m[0] + y * m[4] + z * m[8];
+  result[1]     = x * m[1] + y * m[5] + z * m[9];
+  result[2]     = x * m[2] + y * m[6] + z * m[10];
+}
+
+void transformCoordinatesScalar(const float* positions, const float* matrix,
+                                float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    transformCoordinateScalar(positions + i * 3, matrix, result + i * 3);
+  }
+}
+
+void transformNormalsScalar(const float* normals, const float* matrix,
+                            float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    transformNormalScalar(normals + i * 3, matrix, result + i * 3);
+  }
+}
+
+void transformCoordinatesByMatricesScalar(const float* positions,
+                                          const float* matrices, float* result,
+                                          size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    transformCoordinateScalar(positions + i * 3, matrices + i * 16,
+                              result + i * 3);
+  }
+}
+
+void transformNormalsByMatricesScalar(const float* normals,
+                                      const float* matrices, float* result,
+                                      size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    transformNormalScalar(normals + i * 3, matrices + i * 16, result + i * 3);
+  }
+}
+
+void composeMatricesScalar(const float* scalings, const float* rotations,
+                           const float* translations, float* result,
+                           size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const float* s = scalings + i * 3;
+    const float* q = rotations + i * 4;
+    const float* t = translations + i * 3;
+    float* r       = result + i * 16;
+    BABYLON_SIMD_COMPOSE(float, s[0], s[1], s[2], q[0], q[1], q[2], q[3], t[0],
+                         t[1], t[2], r)
+  }
+}
+
+void invertMatricesScalar(const float* matrices, float* result, size_t count)
+{
+  float e[16];
+  float r[16];
+  for (size_t i = 0; i < count; ++i, matrices += 16, result += 16) {
+    std::copy(matrices, matrices + 16, e);
+    BABYLON_SIMD_INVERT(float, e, r)
+    std::copy(r, r + 16, result);
+  }
+}
+
+inline float absolute(float value)
+{
+  return std::abs(value);
+}
+
+inline float maximum(float a, float b)
+{
+  return std::max(a, b);
+}
+
+void intersectFrustumScalar(const float* boxes, size_t stride, size_t begin,
+                            size_t end, const float* planes,
+                            uint32_t* visibility)
+{
+  float b[12];
+  for (size_t i = begin; i < end; ++i) {
+    for (unsigned int k = 0; k < 12; ++k) {
+      b[k] = boxes[k * stride + i];
+    }
+    bool visible = true;
+    for (unsigned int k = 0; k < 24 && visible; k += 4) {
+      const float* p = planes + k;
+      visible        = !(BABYLON_SIMD_MAX_PLANE_DISTANCE(b, p) < 0.f);
+    }
+    if (visible) {
+      visibility[i / 32] |= 1u << (i % 32);
+    }
+  }
+}
+
+void updateParticlesScalar(float* particles, size_t stride, size_t begin,
+                           size_t end, float step, const float* gravity,
+                           uint32_t* dead)
+{
+  const float g[3] = {gravity[0] * step, gravity[1] * step, gravity[2] * step};
+  float s[18];
+  for (size_t i = begin; i < end; ++i) {
+    for (unsigned int k = 0; k < 18; ++k) {
+      s[k] = particles[k * stride + i];
+    }
+    BABYLON_SIMD_UPDATE_PARTICLES(float, s, step, g)
+    for (unsigned int k : updatedParticleStreams) {
+      particles[k * stride + i] = s[k];
+    }
+    if (s[16] >= s[17]) {
+      dead[i / 32] |= 1u << (i % 32);
+    }
+  }
+}
+
+const Kernels scalarKernels
+  = {multiplyMatricesScalar,           transformCoordinatesScalar,
+     transformNormalsScalar,           transformCoordinatesByMatricesScalar,
+     transformNormalsByMatricesScalar, composeMatricesScalar,
+     invertMatricesScalar,             intersectFrustumScalar,
+     updateParticlesScalar};
+
+#if BABYLON_SIMD_BATCH_X86
+
+/** SSE2, one matrix row or one vector per register **/
+
+struct F4 {
+  BABYLON_TARGET_SSE2 F4() : v{_mm_setzero_ps()}
+  {
+  }
+  BABYLON_TARGET_SSE2 F4(__m128 value) : v{value}
+  {
+  }
+  BABYLON_TARGET_SSE2 explicit F4(float value) : v{_mm_set1_ps(value)}
+  {
+  }
+  __m128 v;
+}; // end of struct F4
+
+BABYLON_TARGET_SSE2 inline F4 operator+(const F4& a, const F4& b)
+{
+  return _mm_add_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_SSE2 inline F4 operator-(const F4& a, const F4& b)
+{
+  return _mm_sub_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_SSE2 inline F4 operator*(const F4& a, const F4& b)
+{
+  return _mm_mul_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_SSE2 inline F4 operator/(const F4& a, const F4& b)
+{
+  return _mm_div_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_SSE2 inline F4 operator-(const F4& a)
+{
+  return _mm_xor_ps(a.v, _mm_set1_ps(-0.f));
+}
+
+BABYLON_TARGET_SSE2 inline F4 absolute(const F4& a)
+{
+  return _mm_andnot_ps(_mm_set1_ps(-0.f), a.v);
+}
+
+BABYLON_TARGET_SSE2 inline F4 maximum(const F4& a, const F4& b)
+{
+  return _mm_max_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_SSE2 inline void storeVector3SSE2(float* result, __m128 v)
+{
+  _mm_storel_pi(reinterpret_cast<__m64*>(result), v);
+  _mm_store_ss(result + 2, _mm_movehl_ps(v, v));
+}
+
+// Row of the product of a matrix row by the matrix with rows b0 to b3
+BABYLON_TARGET_SSE2 inline __m128 multiplyRowSSE2(__m128 a, __m128 b0,
+                                                  __m128 b1, __m128 b2,
+                                                  __m128 b3)
+{
+  __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, 0x00), b0);
+  r        = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, 0x55), b1));
+  r        = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, 0xAA), b2));
+  return _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, 0xFF), b3));
+}
+
+// e[k] = element k of the 4 matrices
+BABYLON_TARGET_SSE2 inline void loadMatricesSSE2(const float* matrices, F4* e)
+{
+  for (unsigned int row = 0; row < 16; row += 4) {
+    __m128 c0 = _mm_loadu_ps(matrices + row);
+    __m128 c1 = _mm_loadu_ps(matrices + 16 + row);
+    __m128 c2 = _mm_loadu_ps(matrices + 32 + row);
+    __m128 c3 = _mm_loadu_ps(matrices + 48 + row);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    e[row + 0] = c0;
+    e[row + 1] = c1;
+    e[row + 2] = c2;
+    e[row + 3] = c3;
+  }
+}
+
+BABYLON_TARGET_SSE2 inline void storeMatricesSSE2(const F4* r, float* result)
+{
+  for (unsigned int row = 0; row < 16; row += 4) {
+    __m128 c0 = r[row + 0].v;
+    __m128 c1 = r[row + 1].v;
+    __m128 c2 = r[row + 2].v;
+    __m128 c3 = r[row + 3].v;
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(result + row, c0);
+    _mm_storeu_ps(result + 16 + row, c1);
+    _mm_storeu_ps(result + 32 + row, c2);
+    _mm_storeu_ps(result + 48 + row, c3);
+  }
+}
+
+BABYLON_TARGET_SSE2 void multiplyMatricesSSE2(const float* left,
+                                              const float* right,
+                                              float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i, left += 16, right += 16, result += 16) {
+    const __m128 b0 = _mm_loadu_ps(right + 0);
+    const __m128 b1 = _mm_loadu_ps(right + 4);
+    const __m128 b2 = _mm_loadu_ps(right + 8);
+    const __m128 b3 = _mm_loadu_ps(right + 12);
+    const __m128 a0 = _mm_loadu_ps(left + 0);
+    const __m128 a1 = _mm_loadu_ps(left + 4);
+    const __m128 a2 = _mm_loadu_ps(left + 8);
+    const __m128 a3 = _mm_loadu_ps(left + 12);
+    _mm_storeu_ps(result + 0, multiplyRowSSE2(a0, b0, b1, b2, b3));
+    _mm_storeu_ps(result + 4, multiplyRowSSE2(a1, b0, b1, b2, b3));
+    _mm_storeu_ps(result + 8, multiplyRowSSE2(a2, b0, b1, b2, b3));
+    _mm_storeu_ps(result + 12, multiplyRowSSE2(a3, b0, b1, b2, b3));
+  }
+}
+
+BABYLON_TARGET_SSE2 inline __m128 transformSSE2(const float* vector,
+                                                const float* m, bool point)
+{
+  __m128 r = _mm_mul_ps(_mm_set1_ps(vector[0]), _mm_loadu_ps(m + 0));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vector[1]), _mm_loadu_ps(m + 4)));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vector[2]), _mm_loadu_ps(m + 8)));
+  if (point) {
+    r = _mm_add_ps(r, _mm_loadu_ps(m + 12));
+    r = _mm_div_ps(r, _mm_shuffle_ps(r, r, 0xFF));
+  }
+  return r;
+}
+
+BABYLON_TARGET_SSE2 void transformCoordinatesSSE2(const float* positions,
+                                                  const float* matrix,
+                                                  float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    storeVector3SSE2(result + i * 3,
+                     transformSSE2(positions + i * 3, matrix, true));
+  }
+}
+
+BABYLON_TARGET_SSE2 void transformNormalsSSE2(const float* normals,
+                                              const float* matrix,
+                                              float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    storeVector3SSE2(result + i * 3,
+                     transformSSE2(normals + i * 3, matrix, false));
+  }
+}
+
+BABYLON_TARGET_SSE2 void
+transformCoordinatesByMatricesSSE2(const float* positions,
+                                   const float* matrices, float* result,
+                                   size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    storeVector3SSE2(result + i * 3,
+                     transformSSE2(positions + i * 3, matrices + i * 16, true));
+  }
+}
+
+BABYLON_TARGET_SSE2 void transformNormalsByMatricesSSE2(const float* normals,
+                                                        const float* matrices,
+                                                        float* result,
+                                                        size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    storeVector3SSE2(result + i * 3,
+                     transformSSE2(normals + i * 3, matrices + i * 16, false));
+  }
+}
+
+BABYLON_TARGET_SSE2 void composeMatricesSSE2(const float* scalings,
+                                             const float* rotations,
+                                             const float* translations,
+                                             float* result, size_t count)
+{
+  for (; count >= 4; count -= 4, scalings += 12, rotations += 16,
+                     translations += 12, result += 64) {
+    const float* s = scalings;
+    const float* t = translations;
+    __m128 qx      = _mm_loadu_ps(rotations + 0);
+    __m128 qy      = _mm_loadu_ps(rotations + 4);
+    __m128 qz      = _mm_loadu_ps(rotations + 8);
+    __m128 qw      = _mm_loadu_ps(rotations + 12);
+    _MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+    F4 r[16];
+    BABYLON_SIMD_COMPOSE(
+      F4, F4(_mm_setr_ps(s[0], s[3], s[6], s[9])),
+      F4(_mm_setr_ps(s[1], s[4], s[7], s[10])),
+      F4(_mm_setr_ps(s[2], s[5], s[8], s[11])), F4(qx), F4(qy), F4(qz),
+      F4(qw), F4(_mm_setr_ps(t[0], t[3], t[6], t[9])),
+      F4(_mm_setr_ps(t[1], t[4], t[7], t[10])),
+      F4(_mm_setr_ps(t[2], t[5], t[8], t[11])), r)
+    storeMatricesSSE2(r, result);
+  }
+  composeMatricesScalar(scalings, rotations, translations, result, count);
+}
+
+BABYLON_TARGET_SSE2 void invertMatricesSSE2(const float* matrices,
+                                            float* result, size_t count)
+{
+  for (; count >= 4; count -= 4, matrices += 64, result += 64) {
+    F4 e[16];
+    F4 r[16];
+    loadMatricesSSE2(matrices, e);
+    BABYLON_SIMD_INVERT(F4, e, r)
+    storeMatricesSSE2(r, result);
+  }
+  invertMatricesScalar(matrices, result, count);
+}
+
+BABYLON_TARGET_SSE2 void intersectFrustumSSE2(const float* boxes,
+                                              size_t stride, size_t begin,
+                                              size_t end, const float* planes,
+                                              uint32_t* visibility)
+{
+  F4 p[24];
+  for (unsigned int k = 0; k < 24; ++k) {
+    p[k] = F4(planes[k]);
+  }
+  size_t i = begin;
+  for (; i + 4 <= end; i += 4) {
+    F4 b[12];
+    for (unsigned int k = 0; k < 12; ++k) {
+      b[k] = _mm_loadu_ps(boxes + k * stride + i);
+    }
+    int outside = 0;
+    for (unsigned int k = 0; k < 24; k += 4) {
+      const F4* plane = p + k;
+      outside |= _mm_movemask_ps(_mm_cmplt_ps(
+        BABYLON_SIMD_MAX_PLANE_DISTANCE(b, plane).v, _mm_setzero_ps()));
+    }
+    visibility[i / 32] |= static_cast<uint32_t>(~outside & 0xF) << (i % 32);
+  }
+  intersectFrustumScalar(boxes, stride, i, end, planes, visibility);
+}
+
+BABYLON_TARGET_SSE2 void updateParticlesSSE2(float* particles, size_t stride,
+                                             size_t begin, size_t end,
+                                             float step, const float* gravity,
+                                             uint32_t* dead)
+{
+  const F4 t(step);
+  const F4 g[3] = {F4(gravity[0] * step), F4(gravity[1] * step),
+                   F4(gravity[2] * step)};
+  size_t i      = begin;
+  for (; i + 4 <= end; i += 4) {
+    F4 s[18];
+    for (unsigned int k = 0; k < 18; ++k) {
+      s[k] = _mm_loadu_ps(particles + k * stride + i);
+    }
+    BABYLON_SIMD_UPDATE_PARTICLES(F4, s, t, g)
+    for (unsigned int k : updatedParticleStreams) {
+      _mm_storeu_ps(particles + k * stride + i, s[k].v);
+    }
+    dead[i / 32] |= static_cast<uint32_t>(
+                      _mm_movemask_ps(_mm_cmpge_ps(s[16].v, s[17].v)))
+                    << (i % 32);
+  }
+  updateParticlesScalar(particles, stride, i, end, step, gravity, dead);
+}
+
+const Kernels sse2Kernels
+  = {multiplyMatricesSSE2,           transformCoordinatesSSE2,
+     transformNormalsSSE2,           transformCoordinatesByMatricesSSE2,
+     transformNormalsByMatricesSSE2, composeMatricesSSE2,
+     invertMatricesSSE2,             intersectFrustumSSE2,
+     updateParticlesSSE2};
+
+/** AVX2, two matrix rows or two vectors per register **/
+
+struct F8 {
+  BABYLON_TARGET_AVX2 F8() : v{_mm256_setzero_ps()}
+  {
+  }
+  BABYLON_TARGET_AVX2 F8(__m256 value) : v{value}
+  {
+  }
+  BABYLON_TARGET_AVX2 explicit F8(float value) : v{_mm256_set1_ps(value)}
+  {
+  }
+  __m256 v;
+}; // end of struct F8
+
+BABYLON_TARGET_AVX2 inline F8 operator+(const F8& a, const F8& b)
+{
+  return _mm256_add_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX2 inline F8 operator-(const F8& a, const F8& b)
+{
+  return _mm256_sub_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX2 inline F8 operator*(const F8& a, const F8& b)
+{
+  return _mm256_mul_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX2 inline F8 operator/(const F8& a, const F8& b)
+{
+  return _mm256_div_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX2 inline F8 operator-(const F8& a)
+{
+  return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f));
+}
+
+BABYLON_TARGET_AVX2 inline F8 absolute(const F8& a)
+{
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v);
+}
+
+BABYLON_TARGET_AVX2 inline F8 maximum(const F8& a, const F8& b)
+{
+  return _mm256_max_ps(a.v, b.v);
+}
+
+// Low and high 128 bits lanes
+BABYLON_TARGET_AVX2 inline __m256 combineAVX2(__m128 low, __m128 high)
+{
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+}
+
+// 4x4 transposition in each 128 bits lane
+BABYLON_TARGET_AVX2 inline void transposeAVX2(__m256& c0, __m256& c1,
+                                              __m256& c2, __m256& c3)
+{
+  const __m256 t0 = _mm256_unpacklo_ps(c0, c1);
+  const __m256 t1 = _mm256_unpacklo_ps(c2, c3);
+  const __m256 t2 = _mm256_unpackhi_ps(c0, c1);
+  const __m256 t3 = _mm256_unpackhi_ps(c2, c3);
+  c0              = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+  c1              = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+  c2              = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  c3              = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// e[k] = element k of the 8 matrices
+BABYLON_TARGET_AVX2 inline void loadMatricesAVX2(const float* matrices, F8* e)
+{
+  for (unsigned int row = 0; row < 16; row += 4) {
+    __m256 c0 = combineAVX2(_mm_loadu_ps(matrices + row),
+                            _mm_loadu_ps(matrices + 64 + row));
+    __m256 c1 = combineAVX2(_mm_loadu_ps(matrices + 16 + row),
+                            _mm_loadu_ps(matrices + 80 + row));
+    __m256 c2 = combineAVX2(_mm_loadu_ps(matrices + 32 + row),
+                            _mm_loadu_ps(matrices + 96 + row));
+    __m256 c3 = combineAVX2(_mm_loadu_ps(matrices + 48 + row),
+                            _mm_loadu_ps(matrices + 112 + row));
+    transposeAVX2(c0, c1, c2, c3);
+    e[row + 0] = c0;
+    e[row + 1] = c1;
+    e[row + 2] = c2;
+    e[row + 3] = c3;
+  }
+}
+
+BABYLON_TARGET_AVX2 inline void storeMatricesAVX2(const F8* r, float* result)
+{
+  for (unsigned int row = 0; row < 16; row += 4) {
+    __m256 c[4] = {r[row + 0].v, r[row + 1].v, r[row + 2].v, r[row + 3].v};
+    transposeAVX2(c[0], c[1], c[2], c[3]);
+    for (unsigned int j = 0; j < 4; ++j) {
+      _mm_storeu_ps(result + j * 16 + row, _mm256_castps256_ps128(c[j]));
+      _mm_storeu_ps(result + (j + 4) * 16 + row,
+                    _mm256_extractf128_ps(c[j], 1));
+    }
+  }
+}
+
+BABYLON_TARGET_AVX2 void multiplyMatricesAVX2(const float* left,
+                                              const float* right,
+                                              float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i, left += 16, right += 16, result += 16) {
+    // Rows of the right matrix, in both lanes
+    const __m256 b0
+      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right + 0));
+    const __m256 b1
+      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right + 4));
+    const __m256 b2
+      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right + 8));
+    const __m256 b3
+      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right + 12));
+    const __m256 a01 = _mm256_loadu_ps(left + 0);
+    const __m256 a23 = _mm256_loadu_ps(left + 8);
+
+    __m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+    r01        = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0x55), b1, r01);
+    r01        = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xAA), b2, r01);
+    r01        = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xFF), b3, r01);
+    __m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), b0);
+    r23        = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0x55), b1, r23);
+    r23        = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xAA), b2, r23);
+    r23        = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xFF), b3, r23);
+    _mm256_storeu_ps(result + 0, r01);
+    _mm256_storeu_ps(result + 8, r23);
+  }
+}
+
+// Transforms two vectors with the matrices whose rows are m0 to m3
+BABYLON_TARGET_AVX2 inline void transformAVX2(const float* vectors,
+                                              float* result, __m256 m0,
+                                              __m256 m1, __m256 m2, __m256 m3,
+                                              bool point)
+{
+  const __m256 x
+    = combineAVX2(_mm_set1_ps(vectors[0]), _mm_set1_ps(vectors[3]));
+  const __m256 y
+    = combineAVX2(_mm_set1_ps(vectors[1]), _mm_set1_ps(vectors[4]));
+  const __m256 z
+    = combineAVX2(_mm_set1_ps(vectors[2]), _mm_set1_ps(vectors[5]));
+  __m256 r = _mm256_mul_ps(z, m2);
+  if (point) {
+    r = _mm256_add_ps(r, m3);
+  }
+  r = _mm256_fmadd_ps(y, m1, r);
+  r = _mm256_fmadd_ps(x, m0, r);
+  if (point) {
+    r = _mm256_div_ps(r, _mm256_permute_ps(r, 0xFF));
+  }
+  storeVector3SSE2(result, _mm256_castps256_ps128(r));
+  storeVector3SSE2(result + 3, _mm256_extractf128_ps(r, 1));
+}
+
+BABYLON_TARGET_AVX2 void transformAVX2(const float* vectors,
+                                       const float* matrix, float* result,
+                                       size_t count, bool point)
+{
+  const __m256 m0
+    = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 0));
+  const __m256 m1
+    = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 4));
+  const __m256 m2
+    = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 8));
+  const __m256 m3
+    = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 12));
+  for (; count >= 2; count -= 2, vectors += 6, result += 6) {
+    transformAVX2(vectors, result, m0, m1, m2, m3, point);
+  }
+  if (count) {
+    storeVector3SSE2(result, transformSSE2(vectors, matrix, point));
+  }
+}
+
+BABYLON_TARGET_AVX2 void transformByMatricesAVX2(const float* vectors,
+                                                 const float* matrices,
+                                                 float* result, size_t count,
+                                                 bool point)
+{
+  for (; count >= 2;
+       count -= 2, vectors += 6, matrices += 32, result += 6) {
+    transformAVX2(vectors, result,
+                  combineAVX2(_mm_loadu_ps(matrices + 0),
+                              _mm_loadu_ps(matrices + 16)),
+                  combineAVX2(_mm_loadu_ps(matrices + 4),
+                              _mm_loadu_ps(matrices + 20)),
+                  combineAVX2(_mm_loadu_ps(matrices + 8),
+                              _mm_loadu_ps(matrices + 24)),
+                  combineAVX2(_mm_loadu_ps(matrices + 12),
+                              _mm_loadu_ps(matrices + 28)),
+                  point);
+  }
+  if (count) {
+    storeVector3SSE2(result, transformSSE2(vectors, matrices, point));
+  }
+}
+
+BABYLON_TARGET_AVX2 void transformCoordinatesAVX2(const float* positions,
+                                                  const float* matrix,
+                                                  float* result, size_t count)
+{
+  transformAVX2(positions, matrix, result, count, true);
+}
+
+BABYLON_TARGET_AVX2 void transformNormalsAVX2(const float* normals,
+                                              const float* matrix,
+                                              float* result, size_t count)
+{
+  transformAVX2(normals, matrix, result, count, false);
+}
+
+BABYLON_TARGET_AVX2 void
+transformCoordinatesByMatricesAVX2(const float* positions,
+                                   const float* matrices, float* result,
+                                   size_t count)
+{
+  transformByMatricesAVX2(positions, matrices, result, count, true);
+}
+
+BABYLON_TARGET_AVX2 void transformNormalsByMatricesAVX2(const float* normals,
+                                                        const float* matrices,
+                                                        float* result,
+                                                        size_t count)
+{
+  transformByMatricesAVX2(normals, matrices, result, count, false);
+}
+
+BABYLON_TARGET_AVX2 void composeMatricesAVX2(const float* scalings,
+                                             const float* rotations,
+                                             const float* translations,
+                                             float* result, size_t count)
+{
+  const __m256i index3 = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+  for (; count >= 8; count -= 8, scalings += 24, rotations += 32,
+                     translations += 24, result += 128) {
+    __m256 qx = combineAVX2(_mm_loadu_ps(rotations + 0),
+                            _mm_loadu_ps(rotations + 16));
+    __m256 qy = combineAVX2(_mm_loadu_ps(rotations + 4),
+                            _mm_loadu_ps(rotations + 20));
+    __m256 qz = combineAVX2(_mm_loadu_ps(rotations + 8),
+                            _mm_loadu_ps(rotations + 24));
+    __m256 qw = combineAVX2(_mm_loadu_ps(rotations + 12),
+                            _mm_loadu_ps(rotations + 28));
+    transposeAVX2(qx, qy, qz, qw);
+    F8 r[16];
+    BABYLON_SIMD_COMPOSE(
+      F8, F8(_mm256_i32gather_ps(scalings + 0, index3, 4)),
+      F8(_mm256_i32gather_ps(scalings + 1, index3, 4)),
+      F8(_mm256_i32gather_ps(scalings + 2, index3, 4)), F8(qx), F8(qy),
+      F8(qz), F8(qw), F8(_mm256_i32gather_ps(translations + 0, index3, 4)),
+      F8(_mm256_i32gather_ps(translations + 1, index3, 4)),
+      F8(_mm256_i32gather_ps(translations + 2, index3, 4)), r)
+    storeMatricesAVX2(r, result);
+  }
+  composeMatricesSSE2(scalings, rotations, translations, result, count);
+}
+
+BABYLON_TARGET_AVX2 void invertMatricesAVX2(const float* matrices,
+                                            float* result, size_t count)
+{
+  for (; count >= 8; count -= 8, matrices += 128, result += 128) {
+    F8 e[16];
+    F8 r[16];
+    loadMatricesAVX2(matrices, e);
+    BABYLON_SIMD_INVERT(F8, e, r)
+    storeMatricesAVX2(r, result);
+  }
+  invertMatricesSSE2(matrices, result, count);
+}
+
+BABYLON_TARGET_AVX2 void intersectFrustumAVX2(const float* boxes,
+                                              size_t stride, size_t begin,
+                                              size_t end, const float* planes,
+                                              uint32_t* visibility)
+{
+  F8 p[24];
+  for (unsigned int k = 0; k < 24; ++k) {
+    p[k] = F8(planes[k]);
+  }
+  size_t i = begin;
+  for (; i + 8 <= end; i += 8) {
+    F8 b[12];
+    for (unsigned int k = 0; k < 12; ++k) {
+      b[k] = _mm256_loadu_ps(boxes + k * stride + i);
+    }
+    int outside = 0;
+    for (unsigned int k = 0; k < 24; k += 4) {
+      const F8* plane = p + k;
+      outside |= _mm256_movemask_ps(
+        _mm256_cmp_ps(BABYLON_SIMD_MAX_PLANE_DISTANCE(b, plane).v,
+                      _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+    visibility[i / 32] |= static_cast<uint32_t>(~outside & 0xFF) << (i % 32);
+  }
+  intersectFrustumSSE2(boxes, stride, i, end, planes, visibility);
+}
+
+BABYLON_TARGET_AVX2 void updateParticlesAVX2(float* particles, size_t stride,
+                                             size_t begin, size_t end,
+                                             float step, const float* gravity,
+                                             uint32_t* dead)
+{
+  const F8 t(step);
+  const F8 g[3] = {F8(gravity[0] * step), F8(gravity[1] * step),
+                   F8(gravity[2] * step)};
+  size_t i      = begin;
+  for (; i + 8 <= end; i += 8) {
+    F8 s[18];
+    for (unsigned int k = 0; k < 18; ++k) {
+      s[k] = _mm256_loadu_ps(particles + k * stride + i);
+    }
+    BABYLON_SIMD_UPDATE_PARTICLES(F8, s, t, g)
+    for (unsigned int k : updatedParticleStreams) {
+      _mm256_storeu_ps(particles + k * stride + i, s[k].v);
+    }
+    dead[i / 32] |= static_cast<uint32_t>(_mm256_movemask_ps(
+                      _mm256_cmp_ps(s[16].v, s[17].v, _CMP_GE_OQ)))
+                    << (i % 32);
+  }
+  updateParticlesSSE2(particles, stride, i, end, step, gravity, dead);
+}
+
+const Kernels avx2Kernels
+  = {multiplyMatricesAVX2,           transformCoordinatesAVX2,
+     transformNormalsAVX2,           transformCoordinatesByMatricesAVX2,
+     transformNormalsByMatricesAVX2, composeMatricesAVX2,
+     invertMatricesAVX2,             intersectFrustumAVX2,
+     updateParticlesAVX2};
+
+/** AVX-512, one matrix or four vectors per register **/
+
+struct F16 {
+  BABYLON_TARGET_AVX512 F16() : v{_mm512_setzero_ps()}
+  {
+  }
+  BABYLON_TARGET_AVX512 F16(__m512 value) : v{value}
+  {
+  }
+  BABYLON_TARGET_AVX512 explicit F16(float value) : v{_mm512_set1_ps(value)}
+  {
+  }
+  __m512 v;
+}; // end of struct F16
+
+BABYLON_TARGET_AVX512 inline F16 operator+(const F16& a, const F16& b)
+{
+  return _mm512_add_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX512 inline F16 operator-(const F16& a, const F16& b)
+{
+  return _mm512_sub_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX512 inline F16 operator*(const F16& a, const F16& b)
+{
+  return _mm512_mul_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX512 inline F16 operator/(const F16& a, const F16& b)
+{
+  return _mm512_div_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX512 inline F16 operator-(const F16& a)
+{
+  return _mm512_sub_ps(_mm512_setzero_ps(), a.v);
+}
+
+BABYLON_TARGET_AVX512 inline F16 absolute(const F16& a)
+{
+  return _mm512_abs_ps(a.v);
+}
+
+BABYLON_TARGET_AVX512 inline F16 maximum(const F16& a, const F16& b)
+{
+  return _mm512_max_ps(a.v, b.v);
+}
+
+BABYLON_TARGET_AVX512 inline __m512 broadcastRowAVX512(const float* row)
+{
+  return _mm512_broadcast_f32x4(_mm_loadu_ps(row));
+}
+
+BABYLON_TARGET_AVX512 void multiplyMatricesAVX512(const float* left,
+                                                  const float* right,
+                                                  float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i, left += 16, right += 16, result += 16) {
+    const __m512 b0 = broadcastRowAVX512(right + 0);
+    const __m512 b1 = broadcastRowAVX512(right + 4);
+    const __m512 b2 = broadcastRowAVX512(right + 8);
+    const __m512 b3 = broadcastRowAVX512(right + 12);
+    const __m512 a  = _mm512_loadu_ps(left);
+    __m512 r        = _mm512_mul_ps(_mm512_permute_ps(a, 0x00), b0);
+    r               = _mm512_fmadd_ps(_mm512_permute_ps(a, 0x55), b1, r);
+    r               = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xAA), b2, r);
+    r               = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xFF), b3, r);
+    _mm512_storeu_ps(result, r);
+  }
+}
+
+BABYLON_TARGET_AVX512 void transformAVX512(const float* vectors,
+                                           const float* matrix, float* result,
+                                           size_t count, bool point)
+{
+  const __m512 m0 = broadcastRowAVX512(matrix + 0);
+  const __m512 m1 = broadcastRowAVX512(matrix + 4);
+  const __m512 m2 = broadcastRowAVX512(matrix + 8);
+  const __m512 m3 = broadcastRowAVX512(matrix + 12);
+  // Coordinates of the 4 vectors spread over their 128 bits lanes, and back
+  const __m512i xIndex
+    = _mm512_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3, 6, 6, 6, 6, 9, 9, 9, 9);
+  const __m512i yIndex = _mm512_add_epi32(xIndex, _mm512_set1_epi32(1));
+  const __m512i zIndex = _mm512_add_epi32(xIndex, _mm512_set1_epi32(2));
+  const __m512i packIndex
+    = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0, 0, 0, 0);
+  const __mmask16 mask = 0x0FFF;
+  for (; count >= 4; count -= 4, vectors += 12, result += 12) {
+    const __m512 v = _mm512_maskz_loadu_ps(mask, vectors);
+    __m512 r       = _mm512_mul_ps(_mm512_permutexvar_ps(zIndex, v), m2);
+    if (point) {
+      r = _mm512_add_ps(r, m3);
+    }
+    r = _mm512_fmadd_ps(_mm512_permutexvar_ps(yIndex, v), m1, r);
+    r = _mm512_fmadd_ps(_mm512_permutexvar_ps(xIndex, v), m0, r);
+    if (point) {
+      r = _mm512_div_ps(r, _mm512_permute_ps(r, 0xFF));
+    }
+    _mm512_mask_storeu_ps(result, mask, _mm512_permutexvar_ps(packIndex, r));
+  }
+  transformAVX2(vectors, matrix, result, count, point);
+}
+
+BABYLON_TARGET_AVX512 void transformCoordinatesAVX512(const float* positions,
+                                                      const float* matrix,
+                                                      float* result,
+                                                      size_t count)
+{
+  transformAVX512(positions, matrix, result, count, true);
+}
+
+BABYLON_TARGET_AVX512 void transformNormalsAVX512(const float* normals,
+                                                  const float* matrix,
+                                                  float* result, size_t count)
+{
+  transformAVX512(normals, matrix, result, count, false);
+}
+
+BABYLON_TARGET_AVX512 void composeMatricesAVX512(const float* scalings,
+                                                 const float* rotations,
+                                                 const float* translations,
+                                                 float* result, size_t count)
+{
+  const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+                                         12, 13, 14, 15);
+  const __m512i index3  = _mm512_mullo_epi32(lane, _mm512_set1_epi32(3));
+  const __m512i index4  = _mm512_slli_epi32(lane, 2);
+  const __m512i index16 = _mm512_slli_epi32(lane, 4);
+  for (; count >= 16; count -= 16, scalings += 48, rotations += 64,
+                      translations += 48, result += 256) {
+    F16 r[16];
+    BABYLON_SIMD_COMPOSE(
+      F16, F16(_mm512_i32gather_ps(index3, scalings + 0, 4)),
+      F16(_mm512_i32gather_ps(index3, scalings + 1, 4)),
+      F16(_mm512_i32gather_ps(index3, scalings + 2, 4)),
+      F16(_mm512_i32gather_ps(index4, rotations + 0, 4)),
+      F16(_mm512_i32gather_ps(index4, rotations + 1, 4)),
+      F16(_mm512_i32gather_ps(index4, rotations + 2, 4)),
+      F16(_mm512_i32gather_ps(index4, rotations + 3, 4)),
+      F16(_mm512_i32gather_ps(index3, translations + 0, 4)),
+      F16(_mm512_i32gather_ps(index3, translations + 1, 4)),
+      F16(_mm512_i32gather_ps(index3, translations + 2, 4)), r)
+    for (unsigned int k = 0; k < 16; ++k) {
+      _mm512_i32scatter_ps(result + k, index16, r[k].v, 4);
+    }
+  }
+  composeMatricesAVX2(scalings, rotations, translations, result, count);
+}
+
+BABYLON_TARGET_AVX512 void invertMatricesAVX512(const float* matrices,
+                                                float* result, size_t count)
+{
+  const __m512i index16 = _mm512_slli_epi32(
+    _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+    4);
+  for (; count >= 16; count -= 16, matrices += 256, result += 256) {
+    F16 e[16];
+    F16 r[16];
+    for (unsigned int k = 0; k < 16; ++k) {
+      e[k] = _mm512_i32gather_ps(index16, matrices + k, 4);
+    }
+    BABYLON_SIMD_INVERT(F16, e, r)
+    for (unsigned int k = 0; k < 16; ++k) {
+      _mm512_i32scatter_ps(result + k, index16, r[k].v, 4);
+    }
+  }
+  invertMatricesAVX2(matrices, result, count);
+}
+
+BABYLON_TARGET_AVX512 void intersectFrustumAVX512(const float* boxes,
+                                                  size_t stride, size_t begin,
+                                                  size_t end,
+                                                  const float* planes,
+                                                  uint32_t* visibility)
+{
+  F16 p[24];
+  for (unsigned int k = 0; k < 24; ++k) {
+    p[k] = F16(planes[k]);
+  }
+  size_t i = begin;
+  for (; i + 16 <= end; i += 16) {
+    F16 b[12];
+    for (unsigned int k = 0; k < 12; ++k) {
+      b[k] = _mm512_loadu_ps(boxes + k * stride + i);
+    }
+    __mmask16 outside = 0;
+    for (unsigned int k = 0; k < 24; k += 4) {
+      const F16* plane = p + k;
+      outside |= _mm512_cmp_ps_mask(BABYLON_SIMD_MAX_PLANE_DISTANCE(b, plane).v,
+                                    _mm512_setzero_ps(), _CMP_LT_OQ);
+    }
+    visibility[i / 32] |= static_cast<uint32_t>(~outside & 0xFFFF)
+                          << (i % 32);
+  }
+  intersectFrustumAVX2(boxes, stride, i, end, planes, visibility);
+}
+
+BABYLON_TARGET_AVX512 void updateParticlesAVX512(float* particles,
+                                                 size_t stride, size_t begin,
+                                                 size_t end, float step,
+                                                 const float* gravity,
+                                                 uint32_t* dead)
+{
+  const F16 t(step);
+  const F16 g[3] = {F16(gravity[0] * step), F16(gravity[1] * step),
+                    F16(gravity[2] * step)};
+  size_t i       = begin;
+  for (; i + 16 <= end; i += 16) {
+    F16 s[18];
+    for (unsigned int k = 0; k < 18; ++k) {
+      s[k] = _mm512_loadu_ps(particles + k * stride + i);
+    }
+    BABYLON_SIMD_UPDATE_PARTICLES(F16, s, t, g)
+    for (unsigned int k : updatedParticleStreams) {
+      _mm512_storeu_ps(particles + k * stride + i, s[k].v);
+    }
+    dead[i / 32] |= static_cast<uint32_t>(
+                      _mm512_cmp_ps_mask(s[16].v, s[17].v, _CMP_GE_OQ))
+                    << (i % 32);
+  }
+  updateParticlesAVX2(particles, stride, i, end, step, gravity, dead);
+}
+
+// Per vector matrices gain nothing from the wider registers
+const Kernels avx512Kernels
+  = {multiplyMatricesAVX512,         transformCoordinatesAVX512,
+     transformNormalsAVX512,         transformCoordinatesByMatricesAVX2,
+     transformNormalsByMatricesAVX2, composeMatricesAVX512,
+     invertMatricesAVX512,           intersectFrustumAVX512,
+     updateParticlesAVX512};
+
+void cpuid(unsigned int leaf, unsigned int subLeaf,
+           std::array<unsigned int, 4>& registers)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  int values[4];
+  __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+  for (unsigned int i = 0; i < 4; ++i) {
+    registers[i] = static_cast<unsigned int>(values[i]);
+  }
+#else
+  __cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2],
+                registers[3]);
+#endif
+}
+
+// Register states enabled by the operating system
+uint64_t xgetbv()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  return _xgetbv(0);
+#else
+  unsigned int eax = 0;
+  unsigned int edx = 0;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+InstructionSet detectInstructionSet()
+{
+  std::array<unsigned int, 4> registers; // eax, ebx, ecx, edx
+  cpuid(0, 0, registers);
+  const unsigned int maxLeaf = registers[0];
+  if (maxLeaf < 1) {
+    return InstructionSet::SCALAR;
+  }
+
+  cpuid(1, 0, registers);
+  const bool sse2    = (registers[3] & (1u << 26)) != 0;
+  const bool fma     = (registers[2] & (1u << 12)) != 0;
+  const bool osxsave = (registers[2] & (1u << 27)) != 0;
+  const bool avx     = (registers[2] & (1u << 28)) != 0;
+  if (!sse2) {
+    return InstructionSet::SCALAR;
+  }
+  if (!fma || !osxsave || !avx || maxLeaf < 7) {
+    return InstructionSet::SSE2;
+  }
+
+  // XMM and YMM states, then opmask, ZMM0-15 upper halves and ZMM16-31
+  const uint64_t xcr0 = xgetbv();
+  if ((xcr0 & 0x06) != 0x06) {
+    return InstructionSet::SSE2;
+  }
+  cpuid(7, 0, registers);
+  const bool avx2    = (registers[1] & (1u << 5)) != 0;
+  const bool avx512f = (registers[1] & (1u << 16)) != 0;
+  if (!avx2) {
+    return InstructionSet::SSE2;
+  }
+  if (avx512f && (xcr0 & 0xE6) == 0xE6) {
+    return InstructionSet::AVX512;
+  }
+  return InstructionSet::AVX2;
+}
+
+const Kernels* const kernelsTable[]
+  = {&scalarKernels, &sse2Kernels, &avx2Kernels, &avx512Kernels};
+
+#else
+
+InstructionSet detectInstructionSet()
+{
+  return InstructionSet::SCALAR;
+}
+
+const Kernels* const kernelsTable[]
+  = {&scalarKernels, &scalarKernels, &scalarKernels, &scalarKernels};
+
+#endif // end of BABYLON_SIMD_BATCH_X86
+
+std::atomic<unsigned int>& activeInstructionSet()
+{
+  static std::atomic<unsigned int> instructionSet{
+    static_cast<unsigned int>(SIMDBatch::SupportedInstructionSet())};
+  return instructionSet;
+}
+
+const Kernels& kernels()
+{
+  return *kernelsTable[activeInstructionSet().load(std::memory_order_relaxed)];
+}
+
+} // end of anonymous namespace
+
+InstructionSet SIMDBatch::SupportedInstructionSet()
+{
+  static const InstructionSet supportedInstructionSet = detectInstructionSet();
+  return supportedInstructionSet;
+}
+
+InstructionSet SIMDBatch::ActiveInstructionSet()
+{
+  return static_cast<InstructionSet>(activeInstructionSet().load());
+}
+
+void SIMDBatch::SetInstructionSet(InstructionSet instructionSet)
+{
+  activeInstructionSet().store(
+    std::min(static_cast<unsigned int>(instructionSet),
+             static_cast<unsigned int>(SupportedInstructionSet())));
+}
+
+void SIMDBatch::MultiplyMatrices(const float* left, const float* right,
+                                 float* result, size_t count)
+{
+  kernels().multiplyMatrices(left, right, result, count);
+}
+
+void SIMDBatch::TransformCoordinates(const float* positions,
+                                     const float* matrix, float* result,
+                                     size_t count)
+{
+  kernels().transformCoordinates(positions, matrix, result, count);
+}
+
+void SIMDBatch::TransformNormals(const float* normals, const float* matrix,
+                                 float* result, size_t count)
+{
+  kernels().transformNormals(normals, matrix, result, count);
+}
+
+void SIMDBatch::TransformCoordinatesByMatrices(const float* positions,
+                                               const float* matrices,
+                                               float* result, size_t count)
+{
+  kernels().transformCoordinatesByMatrices(positions, matrices, result, count);
+}
+
+void SIMDBatch::TransformNormalsByMatrices(const float* normals,
+                                           const float* matrices,
+                                           float* result, size_t count)
+{
+  kernels().transformNormalsByMatrices(normals, matrices, result, count);
+}
+
+void SIMDBatch::ComposeMatrices(const float* scalings, const float* rotations,
+                                const float* translations, float* result,
+                                size_t count)
+{
+  kernels().composeMatrices(scalings, rotations, translations, result, count);
+}
+
+void SIMDBatch::InvertMatrices(const float* matrices, float* result,
+                               size_t count)
+{
+  kernels().invertMatrices(matrices, result, count);
+}
+
+void SIMDBatch::IntersectFrustum(const float* boxes, size_t stride,
+                                 size_t count, const float* planes,
+                                 uint32_t* visibility)
+{
+  std::fill(visibility, visibility + (count + 31) / 32, 0u);
+  kernels().intersectFrustum(boxes, stride, 0, count, planes, visibility);
+}
+
+void SIMDBatch::UpdateParticles(float* particles, size_t stride, size_t count,
+                                float step, const float* gravity,
+                                uint32_t* dead)
+{
+  std::fill(dead, dead + (count + 31) / 32, 0u);
+  kernels().updateParticles(particles, stride, 0, count, step, gravity, dead);
+}
+
+} // end of namespace SIMD
+} // end of namespace BABYLON
@@ -840,7 +840,7 @@ Vector3 Vector3::RotationFromAxis(Vector3& axis1, Vector3& axis2,
 void Vector3::RotationFromAxisToRef(Vector3& axis1, Vector3& axis2,
                                     Vector3& axis3, Vector3& ref)
 {
-  auto& quat = Tmp::QuaternionArray[0];
+  auto& quat = Tmp::QuaternionArray()[0];
   Quaternion::RotationQuaternionFromAxisToRef(axis1, axis2, axis3, quat);
   quat.toEulerAnglesToRef(ref);
 }
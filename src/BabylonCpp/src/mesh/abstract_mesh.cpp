@@ -4,9 +4,12 @@
 #include <babylon/bones/bone.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/collisions/picking_info.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engine/engine.h>
 #include <babylon/lights/light.h>
 #include <babylon/lights/shadows/shadow_generator.h>
@@ -58,6 +61,7 @@ AbstractMesh::AbstractMesh(const std::string& _name, Scene* scene)
     , numBoneInfluencers{4}
     , useOctreeForRenderingSelection{true}
     , useOctreeForPicking{true}
+    , useTriangleBVHForPicking{true}
     , useOctreeForCollisions{true}
     , layerMask{0x0FFFFFFF}
     , alwaysSelectAsActiveMesh{false}
@@ -75,6 +79,7 @@ AbstractMesh::AbstractMesh(const std::string& _name, Scene* scene)
     , _isDisposed{false}
     , _renderId{0}
     , _submeshesOctree{nullptr}
+    , _selectionTreeProxy{-1}
     , _unIndexed{false}
     , _onCollideObserver{nullptr}
     , _onCollisionPositionChangeObserver{nullptr}
@@ -386,12 +391,18 @@ void AbstractMesh::freezeWorldMatrix()
   _isWorldMatrixFrozen = false;
   computeWorldMatrix(true);
   _isWorldMatrixFrozen = true;
+  if (_selectionTreeProxy != -1) {
+    getScene()->_updateSelectionTreeMobility(this);
+  }
 }
 
 void AbstractMesh::unfreezeWorldMatrix()
 {
   _isWorldMatrixFrozen = false;
   computeWorldMatrix(true);
+  if (_selectionTreeProxy != -1) {
+    getScene()->_updateSelectionTreeMobility(this);
+  }
 }
 
 bool AbstractMesh::isWorldMatrixFrozen()
@@ -593,6 +604,10 @@ void AbstractMesh::_updateBoundingInfo()
   _boundingInfo->update(worldMatrixFromCache());
 
   _updateSubMeshesBoundingInfo(worldMatrixFromCache());
+
+  if (_selectionTreeProxy != -1) {
+    getScene()->_updateSelectionTreeProxy(this);
+  }
 }
 
 void AbstractMesh::_updateSubMeshesBoundingInfo(Matrix& matrix)
@@ -627,10 +642,13 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
   _currentRenderId          = getScene()->getRenderId();
   _isDirty                  = false;
 
+  auto& tmpMatrices = Tmp::MatrixArray();
+  auto& tmpVectors  = Tmp::Vector3Array();
+
   // Scaling
   Matrix::ScalingToRef(_scaling.x * scalingDeterminant,
                        _scaling.y * scalingDeterminant,
-                       _scaling.z * scalingDeterminant, Tmp::MatrixArray[1]);
+                       _scaling.z * scalingDeterminant, tmpMatrices[1]);
 
   // Rotation
 
@@ -645,12 +663,12 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
   }
 
   if (_rotationQuaternionSet) {
-    _rotationQuaternion.toRotationMatrix(Tmp::MatrixArray[0]);
+    _rotationQuaternion.toRotationMatrix(tmpMatrices[0]);
     _cache.rotationQuaternion.copyFrom(_rotationQuaternion);
   }
   else {
     Matrix::RotationYawPitchRollToRef(rotation().y, rotation().x, rotation().z,
-                                      Tmp::MatrixArray[0]);
+                                      tmpMatrices[0]);
     _cache.rotation.copyFrom(rotation());
   }
 
@@ -667,23 +685,23 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
       Matrix::TranslationToRef(_position.x + cameraGlobalPosition.x,
                                _position.y + cameraGlobalPosition.y,
                                _position.z + cameraGlobalPosition.z,
-                               Tmp::MatrixArray[2]);
+                               tmpMatrices[2]);
     }
   }
   else {
     Matrix::TranslationToRef(_position.x, _position.y, _position.z,
-                             Tmp::MatrixArray[2]);
+                             tmpMatrices[2]);
   }
 
   // Composing transformations
-  _pivotMatrix.multiplyToRef(Tmp::MatrixArray[1], Tmp::MatrixArray[4]);
-  Tmp::MatrixArray[4].multiplyToRef(Tmp::MatrixArray[0], Tmp::MatrixArray[5]);
+  _pivotMatrix.multiplyToRef(tmpMatrices[1], tmpMatrices[4]);
+  tmpMatrices[4].multiplyToRef(tmpMatrices[0], tmpMatrices[5]);
 
   // Billboarding
   if (billboardMode != AbstractMesh::BILLBOARDMODE_NONE
       && getScene()->activeCamera) {
-    Tmp::Vector3Array[0].copyFrom(_position);
-    Vector3 localPosition = Tmp::Vector3Array[0];
+    tmpVectors[0].copyFrom(_position);
+    Vector3 localPosition = tmpVectors[0];
 
     if (parent() && parent()->getWorldMatrix()) {
       _markSyncedWithParent();
@@ -691,16 +709,15 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
       Matrix parentMatrix;
       if (_meshToBoneReferal) {
         parent()->getWorldMatrix()->multiplyToRef(
-          *_meshToBoneReferal->getWorldMatrix(), Tmp::MatrixArray[6]);
-        parentMatrix = Tmp::MatrixArray[6];
+          *_meshToBoneReferal->getWorldMatrix(), tmpMatrices[6]);
+        parentMatrix = tmpMatrices[6];
       }
       else {
         parentMatrix = *parent()->getWorldMatrix();
       }
 
-      Vector3::TransformNormalToRef(localPosition, parentMatrix,
-                                    Tmp::Vector3Array[1]);
-      localPosition = Tmp::Vector3Array[1];
+      Vector3::TransformNormalToRef(localPosition, parentMatrix, tmpVectors[1]);
+      localPosition = tmpVectors[1];
     }
 
     Vector3 zero = getScene()->activeCamera->globalPosition();
@@ -710,7 +727,7 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
       if (parentMesh) {
         localPosition.addInPlace(parentMesh->_position);
         Matrix::TranslationToRef(localPosition.x, localPosition.y,
-                                 localPosition.z, Tmp::MatrixArray[2]);
+                                 localPosition.z, tmpMatrices[2]);
       }
     }
 
@@ -727,19 +744,17 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
       }
     }
 
-    Matrix::LookAtLHToRef(localPosition, zero, Vector3::Up(),
-                          Tmp::MatrixArray[3]);
-    Tmp::MatrixArray[3].m[12]     = Tmp::MatrixArray[3].m[13]
-      = Tmp::MatrixArray[3].m[14] = 0.f;
+    Matrix::LookAtLHToRef(localPosition, zero, Vector3::Up(), tmpMatrices[3]);
+    tmpMatrices[3].m[12] = tmpMatrices[3].m[13] = tmpMatrices[3].m[14] = 0.f;
 
-    Tmp::MatrixArray[3].invert();
+    tmpMatrices[3].invert();
 
-    Tmp::MatrixArray[5].multiplyToRef(Tmp::MatrixArray[3], _localWorld);
-    _rotateYByPI.multiplyToRef(_localWorld, Tmp::MatrixArray[5]);
+    tmpMatrices[5].multiplyToRef(tmpMatrices[3], _localWorld);
+    _rotateYByPI.multiplyToRef(_localWorld, tmpMatrices[5]);
   }
 
   // Local world
-  Tmp::MatrixArray[5].multiplyToRef(Tmp::MatrixArray[2], _localWorld);
+  tmpMatrices[5].multiplyToRef(tmpMatrices[2], _localWorld);
 
   // Parent
   if (parent() && parent()->getWorldMatrix()
@@ -747,10 +762,9 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
     _markSyncedWithParent();
 
     if (_meshToBoneReferal) {
-      _localWorld.multiplyToRef(*parent()->getWorldMatrix(),
-                                Tmp::MatrixArray[6]);
-      Tmp::MatrixArray[6].multiplyToRef(*_meshToBoneReferal->getWorldMatrix(),
-                                        *_worldMatrix);
+      _localWorld.multiplyToRef(*parent()->getWorldMatrix(), tmpMatrices[6]);
+      tmpMatrices[6].multiplyToRef(*_meshToBoneReferal->getWorldMatrix(),
+                                   *_worldMatrix);
     }
     else {
       _localWorld.multiplyToRef(*parent()->getWorldMatrix(), *_worldMatrix);
@@ -995,8 +1009,13 @@ AbstractMesh::createOrUpdateSubmeshesOctree(size_t maxCapacity, size_t maxDepth)
   computeWorldMatrix(true);
 
   // Update octree
-  // BoundingBox& bbox = getBoundingInfo()->boundingBox;
-  //_submeshesOctree->update(bbox.minimumWorld, bbox.maximumWorld, subMeshes);
+  std::vector<SubMesh*> _subMeshes;
+  _subMeshes.reserve(subMeshes.size());
+  for (auto& subMesh : subMeshes) {
+    _subMeshes.emplace_back(subMesh.get());
+  }
+  auto& bbox = getBoundingInfo()->boundingBox;
+  _submeshesOctree->update(bbox.minimumWorld, bbox.maximumWorld, _subMeshes);
 
   return _submeshesOctree;
 }
@@ -1082,56 +1101,121 @@ bool AbstractMesh::_generatePointsArray()
   return false;
 }
 
-PickingInfo* AbstractMesh::intersects(const Ray& /*ray*/, bool /*fastCheck*/)
+std::vector<Vector3>& AbstractMesh::_getPositions()
 {
-  /*var pickingInfo = new PickingInfo();
+  return _positions;
+}
 
-  if (!subMeshes || !_boundingInfo
-      || !ray.intersectsSphere(_boundingInfo.boundingSphere)
-      || !ray.intersectsBox(_boundingInfo.boundingBox)) {
-    return pickingInfo;
-  }
+TriangleBVH* AbstractMesh::_getTriangleBVH()
+{
+  return nullptr;
+}
 
-  if (!_generatePointsArray()) {
+std::unique_ptr<PickingInfo> AbstractMesh::intersects(const Ray& ray,
+                                                      bool fastCheck)
+{
+  auto pickingInfo = std_util::make_unique<PickingInfo>();
+
+  if (subMeshes.empty() || !_boundingInfo
+      || !ray.intersectsSphere(_boundingInfo->boundingSphere)
+      || !ray.intersectsBox(_boundingInfo->boundingBox)) {
     return pickingInfo;
   }
 
-  var intersectInfo : IntersectionInfo = null;
-
-  // Octrees
-  var subMeshes : SubMesh[];
-  var len : number;
+  Ray localRay = ray;
+  std::unique_ptr<IntersectionInfo> intersectInfo = nullptr;
+
+  auto bvh = useTriangleBVHForPicking ? _getTriangleBVH() : nullptr;
+  if (bvh) {
+    // Index range covered by the submeshes, a single query is enough when
+    // they cover it without gaps
+    size_t indexStart = std::numeric_limits<size_t>::max();
+    size_t indexEnd   = 0;
+    size_t indexCount = 0;
+    for (const auto& subMesh : subMeshes) {
+      const size_t subMeshStart = subMesh->indexStart;
+      indexStart = std::min(indexStart, subMeshStart);
+      indexEnd   = std::max(indexEnd, subMeshStart + subMesh->indexCount);
+      indexCount += subMesh->indexCount;
+    }
 
-  if (_submeshesOctree && useOctreeForPicking) {
-    var worldRay      = Ray.Transform(ray, getWorldMatrix());
-    var intersections = _submeshesOctree.intersectsRay(worldRay);
+    if (indexCount == indexEnd - indexStart) {
+      intersectInfo
+        = bvh->intersectsRay(localRay, indexStart, indexEnd, fastCheck);
+    }
+    else {
+      for (const auto& subMesh : subMeshes) {
+        auto currentIntersectInfo = bvh->intersectsRay(
+          localRay, subMesh->indexStart,
+          subMesh->indexStart + subMesh->indexCount, fastCheck);
+        if (currentIntersectInfo
+            && (fastCheck || !intersectInfo
+                || currentIntersectInfo->distance < intersectInfo->distance)) {
+          intersectInfo = std::move(currentIntersectInfo);
+          if (fastCheck) {
+            break;
+          }
+        }
+      }
+    }
 
-    len       = intersections.length;
-    subMeshes = intersections.data;
+    // Submesh containing the picked face
+    if (intersectInfo) {
+      const size_t firstIndex = intersectInfo->faceId * 3;
+      for (size_t index = 0; index < subMeshes.size(); ++index) {
+        const auto& subMesh = subMeshes[index];
+        if (firstIndex >= subMesh->indexStart
+            && firstIndex < subMesh->indexStart + subMesh->indexCount) {
+          intersectInfo->subMeshId = static_cast<int>(index);
+          break;
+        }
+      }
+    }
   }
   else {
-    subMeshes = subMeshes;
-    len       = subMeshes.length;
-  }
-
-  for (var index = 0; index < len; index++) {
-    var subMesh = subMeshes[index];
-
-    // Bounding test
-    if (len > 1 && !subMesh.canIntersects(ray))
-      continue;
+    if (!_generatePointsArray()) {
+      return pickingInfo;
+    }
 
-    var currentIntersectInfo
-      = subMesh.intersects(ray, _positions, getIndices(), fastCheck);
+    // Octrees
+    std::vector<SubMesh*> _subMeshes;
+    if (_submeshesOctree && useOctreeForPicking) {
+      auto worldRay = Ray::Transform(ray, *getWorldMatrix());
+      _subMeshes    = _submeshesOctree->intersectsRay(worldRay);
+    }
+    else {
+      _subMeshes.reserve(subMeshes.size());
+      for (const auto& subMesh : subMeshes) {
+        _subMeshes.emplace_back(subMesh.get());
+      }
+    }
 
-    if (currentIntersectInfo) {
-      if (fastCheck || !intersectInfo
-          || currentIntersectInfo.distance < intersectInfo.distance) {
-        intersectInfo           = currentIntersectInfo;
-        intersectInfo.subMeshId = index;
+    const auto& positions = _getPositions();
+    const auto indices    = getIndices();
+    for (auto subMesh : _subMeshes) {
+      // Bounding test
+      if (_subMeshes.size() > 1 && !subMesh->canIntersects(localRay)) {
+        continue;
+      }
 
-        if (fastCheck) {
-          break;
+      auto currentIntersectInfo
+        = subMesh->intersects(localRay, positions, indices, fastCheck);
+
+      if (currentIntersectInfo) {
+        if (fastCheck || !intersectInfo
+            || currentIntersectInfo->distance < intersectInfo->distance) {
+          intersectInfo = std::move(currentIntersectInfo);
+          auto it       = std::find_if(
+            subMeshes.begin(), subMeshes.end(),
+            [subMesh](const std::unique_ptr<SubMesh>& item) {
+              return item.get() == subMesh;
+            });
+          intersectInfo->subMeshId
+            = static_cast<int>(it - subMeshes.begin());
+
+          if (fastCheck) {
+            break;
+          }
         }
       }
     }
@@ -1139,29 +1223,25 @@ PickingInfo* AbstractMesh::intersects(const Ray& /*ray*/, bool /*fastCheck*/)
 
   if (intersectInfo) {
     // Get picked point
-    var world          = getWorldMatrix();
-    var worldOrigin    = Vector3.TransformCoordinates(ray.origin, world);
-    var direction      = ray.direction.clone();
-    direction          = direction.scale(intersectInfo.distance);
-    var worldDirection = Vector3.TransformNormal(direction, world);
-
-    var pickedPoint = worldOrigin.add(worldDirection);
+    const auto& world   = *getWorldMatrix();
+    const auto worldOrigin = Vector3::TransformCoordinates(ray.origin, world);
+    const auto worldDirection = Vector3::TransformNormal(
+      ray.direction.scale(intersectInfo->distance), world);
+    const auto pickedPoint = worldOrigin.add(worldDirection);
 
     // Return result
-    pickingInfo.hit         = true;
-    pickingInfo.distance    = Vector3.Distance(worldOrigin, pickedPoint);
-    pickingInfo.pickedPoint = pickedPoint;
-    pickingInfo.pickedMesh  = this;
-    pickingInfo.bu          = intersectInfo.bu;
-    pickingInfo.bv          = intersectInfo.bv;
-    pickingInfo.faceId      = intersectInfo.faceId;
-    pickingInfo.subMeshId   = intersectInfo.subMeshId;
-    return pickingInfo;
+    pickingInfo->hit         = true;
+    pickingInfo->distance    = Vector3::Distance(worldOrigin, pickedPoint);
+    pickingInfo->pickedPoint = pickedPoint;
+    pickingInfo->pickedMesh  = this;
+    pickingInfo->bu          = intersectInfo->bu;
+    pickingInfo->bv          = intersectInfo->bv;
+    pickingInfo->faceId = static_cast<unsigned int>(intersectInfo->faceId);
+    pickingInfo->subMeshId
+      = static_cast<unsigned int>(intersectInfo->subMeshId);
   }
 
-  return pickingInfo;*/
-
-  return nullptr;
+  return pickingInfo;
 }
 
 AbstractMesh* AbstractMesh::clone(const std::string& /*name*/,
@@ -1298,7 +1378,7 @@ void AbstractMesh::setPivotPoint(const Vector3& point, const Space& space)
   auto wm = getWorldMatrix();
 
   if (space == Space::WORLD) {
-    auto& tmat = Tmp::MatrixArray[0];
+    auto& tmat = Tmp::MatrixArray()[0];
     wm->invertToRef(tmat);
     _point = Vector3::TransformCoordinates(_point, tmat);
   }
@@ -10,9 +10,16 @@ namespace BABYLON {
 
 Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
                int stride, bool postponeInternalCreation, bool instanced)
+    : Buffer(engine, Float32Array(data), updatable, stride,
+             postponeInternalCreation, instanced)
+{
+}
+
+Buffer::Buffer(Engine* engine, Float32Array&& data, bool updatable, int stride,
+               bool postponeInternalCreation, bool instanced)
     : _engine{engine}
     , _buffer{nullptr}
-    , _data{data}
+    , _data{std::move(data)}
     , _updatable{updatable}
     , _strideSize{stride}
     , _instanced{instanced}
@@ -159,6 +166,31 @@ void Buffer::updateDirectly(const Float32Array& data, int offset,
   }
 }
 
+void Buffer::updateRange(const Float32Array& data, size_t offset,
+                         size_t count)
+{
+  if (!_buffer) {
+    // the whole data is uploaded on creation
+    create(data);
+    return;
+  }
+
+  if (!_updatable || count == 0) {
+    return;
+  }
+
+  _engine->updateDynamicVertexBuffer(_buffer, data, static_cast<int>(offset),
+                                     static_cast<int>(count));
+  if (_data.size() == data.size()) {
+    std::copy(data.begin() + static_cast<long>(offset),
+              data.begin() + static_cast<long>(offset + count),
+              _data.begin() + static_cast<long>(offset));
+  }
+  else {
+    _data = data;
+  }
+}
+
 void Buffer::dispose(bool /*doNotRecurse*/)
 {
   if (!_buffer) {
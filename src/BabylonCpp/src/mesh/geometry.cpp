@@ -2,6 +2,7 @@
 
 #include <babylon/core/json.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/interfaces/igl_rendering_context.h>
@@ -17,6 +18,7 @@ namespace BABYLON {
 Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
                    bool updatable, Mesh* mesh)
     : id{iId}
+    , uniqueId{scene->getUniqueId()}
     , delayLoadState{Engine::DELAYLOADSTATE_NONE}
     , _scene{scene}
     , _engine{scene->getEngine()}
@@ -25,6 +27,7 @@ Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
     , _extendSet{false}
     , _hasBoundingBias{false}
     , _indexBuffer{nullptr}
+    , _triangleBVH{nullptr}
 {
   _meshes.clear();
   // Init vertex buffer cache
@@ -119,9 +122,15 @@ void Geometry::setAllVerticesData(VertexData* vertexData, bool updatable)
 
 void Geometry::setVerticesData(unsigned int kind, const Float32Array& data,
                                bool updatable, int stride)
+{
+  setVerticesData(kind, Float32Array(data), updatable, stride);
+}
+
+void Geometry::setVerticesData(unsigned int kind, Float32Array&& data,
+                               bool updatable, int stride)
 {
   auto buffer = std_util::make_unique<VertexBuffer>(
-    _engine, data, kind, updatable, _meshes.empty(), stride);
+    _engine, std::move(data), kind, updatable, _meshes.empty(), stride);
 
   setVerticesBuffer(std::move(buffer));
 }
@@ -190,6 +199,24 @@ void Geometry::updateVerticesData(unsigned int kind, const Float32Array& data,
   notifyUpdate(kind);
 }
 
+void Geometry::updateVerticesDataRange(unsigned int kind,
+                                       const Float32Array& data, size_t offset,
+                                       size_t count)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+
+  if (!vertexBuffer) {
+    return;
+  }
+
+  vertexBuffer->updateRange(data, offset, count);
+
+  if (kind == VertexBuffer::PositionKind) {
+    updateBoundingInfo(false, data);
+  }
+  notifyUpdate(kind);
+}
+
 void Geometry::updateBoundingInfo(bool updateExtends, const Float32Array& data)
 {
   if (updateExtends) {
@@ -295,12 +322,17 @@ Uint32Array Geometry::getVerticesDataKinds()
 }
 
 void Geometry::setIndices(const Uint32Array& indices, int totalVertices)
+{
+  setIndices(Uint32Array(indices), totalVertices);
+}
+
+void Geometry::setIndices(Uint32Array&& indices, int totalVertices)
 {
   if (_indexBuffer) {
     _engine->_releaseBuffer(_indexBuffer.get());
   }
 
-  _indices = indices;
+  _indices = std::move(indices);
   if (!_meshes.empty() && !_indices.empty()) {
     _indexBuffer
       = std::unique_ptr<GL::IGLBuffer>(_engine->createIndexBuffer(_indices));
@@ -458,11 +490,33 @@ void Geometry::_applyToMesh(Mesh* mesh)
 
 void Geometry::notifyUpdate(unsigned int kind)
 {
+  // Positions or indices changed
+  if (kind == VertexBuffer::PositionKind) {
+    _triangleBVH.reset(nullptr);
+    for (auto& mesh : _meshes) {
+      mesh->_resetPointsArrayCache();
+    }
+  }
+
   if (onGeometryUpdated) {
     onGeometryUpdated(this, kind);
   }
 }
 
+TriangleBVH* Geometry::getTriangleBVH()
+{
+  if (!_triangleBVH) {
+    if (!isReady() || _indices.empty()
+        || !isVerticesDataPresent(VertexBuffer::PositionKind)) {
+      return nullptr;
+    }
+    _triangleBVH = std_util::make_unique<TriangleBVH>(
+      getVerticesData(VertexBuffer::PositionKind), _indices);
+  }
+
+  return _triangleBVH.get();
+}
+
 void Geometry::load(Scene* scene, const std::function<void()>& onLoaded)
 {
   if (delayLoadState == Engine::DELAYLOADSTATE_LOADING) {
@@ -540,6 +594,7 @@ void Geometry::dispose(bool /*doNotRecurse*/)
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _triangleBVH.reset(nullptr);
 
   delayLoadState = Engine::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
@@ -634,7 +689,9 @@ void Geometry::ImportGeometry(const Json::value& parsedGeometry, Mesh* mesh)
            && parsedGeometry.contains("indices")) {
     Float32Array parsedPositions
       = Json::ToArray<float>(parsedGeometry, "positions");
-    mesh->setVerticesData(VertexBuffer::PositionKind, parsedPositions, false);
+    const size_t positionCount = parsedPositions.size() / 3;
+    mesh->setVerticesData(VertexBuffer::PositionKind,
+                          std::move(parsedPositions), false);
     mesh->setVerticesData(VertexBuffer::NormalKind,
                           Json::ToArray<float>(parsedGeometry, "normals"),
                           false);
@@ -679,7 +736,7 @@ void Geometry::ImportGeometry(const Json::value& parsedGeometry, Mesh* mesh)
         = Json::ToArray<float>(parsedGeometry, "colors");
       mesh->setVerticesData(
         VertexBuffer::ColorKind,
-        Color4::CheckColors4(parsedColors, parsedPositions.size() / 3), false);
+        Color4::CheckColors4(parsedColors, positionCount), false);
     }
 
     if (parsedGeometry.contains("matricesIndicesExtra")) {
@@ -138,15 +138,15 @@ void GroundMesh::_initHeightQuads()
 void GroundMesh::_computeHeightQuads()
 {
   auto positions = getVerticesData(VertexBuffer::PositionKind);
-  auto v1        = Tmp::Vector3Array[3];
-  auto v2        = Tmp::Vector3Array[2];
-  auto v3        = Tmp::Vector3Array[1];
-  auto v4        = Tmp::Vector3Array[0];
-  auto v1v2      = Tmp::Vector3Array[4];
-  auto v1v3      = Tmp::Vector3Array[5];
-  auto v1v4      = Tmp::Vector3Array[6];
-  auto norm1     = Tmp::Vector3Array[7];
-  auto norm2     = Tmp::Vector3Array[8];
+  auto v1        = Tmp::Vector3Array()[3];
+  auto v2        = Tmp::Vector3Array()[2];
+  auto v3        = Tmp::Vector3Array()[1];
+  auto v4        = Tmp::Vector3Array()[0];
+  auto v1v2      = Tmp::Vector3Array()[4];
+  auto v1v3      = Tmp::Vector3Array()[5];
+  auto v1v4      = Tmp::Vector3Array()[6];
+  auto norm1     = Tmp::Vector3Array()[7];
+  auto norm2     = Tmp::Vector3Array()[8];
   size_t i       = 0;
   size_t j       = 0;
   size_t k       = 0;
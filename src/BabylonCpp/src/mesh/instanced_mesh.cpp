@@ -90,7 +90,7 @@ Uint32Array InstancedMesh::getIndices(bool /*copyWhenShared*/)
   return _sourceMesh->getIndices();
 }
 
-std::vector<Vector3> InstancedMesh::_positions()
+std::vector<Vector3>& InstancedMesh::_getPositions()
 {
   return _sourceMesh->_positions;
 }
@@ -148,6 +148,11 @@ bool InstancedMesh::_generatePointsArray()
   return _sourceMesh->_generatePointsArray();
 }
 
+TriangleBVH* InstancedMesh::_getTriangleBVH()
+{
+  return _sourceMesh->_getTriangleBVH();
+}
+
 InstancedMesh* InstancedMesh::clone(const std::string& /*iNname*/,
                                     Node* newParent, bool doNotCloneChildren)
 {
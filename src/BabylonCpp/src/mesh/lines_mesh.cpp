@@ -107,8 +107,9 @@ void LinesMesh::_draw(SubMesh* subMesh, int /*fillMode*/,
   engine->draw(false, subMesh->indexStart, subMesh->indexCount);
 }
 
-PickingInfo* LinesMesh::intersects(const Ray& /*ray*/, bool /*fastCheck*/)
+TriangleBVH* LinesMesh::_getTriangleBVH()
 {
+  // Segments are picked with the intersection threshold
   return nullptr;
 }
 
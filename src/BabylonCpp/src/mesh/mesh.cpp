@@ -16,6 +16,7 @@
 #include <babylon/materials/material.h>
 #include <babylon/materials/multi_material.h>
 #include <babylon/math/matrix.h>
+#include <babylon/math/simd/simd_batch.h>
 #include <babylon/math/vector2.h>
 #include <babylon/mesh/_instances_batch.h>
 #include <babylon/mesh/_visible_instances.h>
@@ -24,6 +25,7 @@
 #include <babylon/mesh/instanced_mesh.h>
 #include <babylon/mesh/mesh_builder.h>
 #include <babylon/mesh/mesh_lod_level.h>
+#include <babylon/mesh/simplification/simplification_queue.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/mesh/vertex_data.h>
 #include <babylon/mesh/vertex_data_options.h>
@@ -42,7 +44,6 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , _geometry{nullptr}
     , _onBeforeDrawObserver{nullptr}
     , _batchCache{std_util::make_unique<_InstancesBatch>()}
-    , _instancesBufferSize{32 * 16 * 4} // maximum of 32 instances
     , _overridenInstanceCount{0}
     , _preActivateId{-1}
     , _sideOrientation{Mesh::DEFAULTSIDE}
@@ -512,6 +513,17 @@ void Mesh::setVerticesData(unsigned int kind, const Float32Array& data,
   }
 }
 
+void Mesh::setVerticesData(unsigned int kind, Float32Array&& data,
+                           bool updatable, int stride)
+{
+  if (!_geometry) {
+    // The data are moved into the vertex buffer of a new geometry
+    Geometry::New(Geometry::RandomId(), getScene(), nullptr, updatable, this);
+  }
+
+  _geometry->setVerticesData(kind, std::move(data), updatable, stride);
+}
+
 void Mesh::setVerticesBuffer(std::unique_ptr<VertexBuffer>&& buffer)
 {
   if (!_geometry) {
@@ -538,6 +550,16 @@ void Mesh::updateVerticesData(unsigned int kind, const Float32Array& data,
   }
 }
 
+void Mesh::updateVerticesDataRange(unsigned int kind,
+                                   const Float32Array& data, size_t offset,
+                                   size_t count)
+{
+  if (!_geometry) {
+    return;
+  }
+  _geometry->updateVerticesDataRange(kind, data, offset, count);
+}
+
 void Mesh::updateMeshPositions(
   std::function<void(Float32Array& positions)> positionFunction,
   bool computeNormals)
@@ -579,6 +601,16 @@ void Mesh::setIndices(const Uint32Array& indices, int totalVertices)
   }
 }
 
+void Mesh::setIndices(Uint32Array&& indices, int totalVertices)
+{
+  if (!_geometry) {
+    setIndices(static_cast<const Uint32Array&>(indices), totalVertices);
+  }
+  else {
+    _geometry->setIndices(std::move(indices), totalVertices);
+  }
+}
+
 void Mesh::toLeftHanded()
 {
   if (!_geometry) {
@@ -690,6 +722,7 @@ _InstancesBatch* Mesh::_getInstancesRenderList(size_t subMeshId)
   _batchCache->mustReturn                  = false;
   _batchCache->renderSelf[subMeshId]       = isEnabled() && isVisible;
   _batchCache->visibleInstances[subMeshId] = std::vector<InstancedMesh*>();
+  _batchCache->batchedSubMeshes.clear();
 
   if (_visibleInstances) {
     auto currentRenderId_ = scene->getRenderId();
@@ -728,72 +761,59 @@ _InstancesBatch* Mesh::_getInstancesRenderList(size_t subMeshId)
   return _batchCache.get();
 }
 
+bool Mesh::_isAutoInstancingCandidate()
+{
+  return type() == IReflect::Type::MESH && _geometry && !_unIndexed
+         && !skeleton() && instances.empty() && !renderOutline
+         && !renderOverlay && (_overridenInstanceCount == 0)
+         && !onBeforeRenderObservable.hasObservers()
+         && !onAfterRenderObservable.hasObservers()
+         && !onBeforeDrawObservable.hasObservers();
+}
+
 void Mesh::_renderWithInstances(SubMesh* subMesh, int fillMode,
                                 _InstancesBatch* batch, Effect* effect,
                                 Engine* engine)
 {
-  if (batch->visibleInstances.find(subMesh->_id)
-      == batch->visibleInstances.end())
-    return;
+  const auto& visibleInstances = batch->visibleInstances[subMesh->_id];
+  const auto& batchedSubMeshes = batch->batchedSubMeshes;
+  const size_t matricesCount
+    = 1 + visibleInstances.size() + batchedSubMeshes.size();
 
-  std::vector<InstancedMesh*> visibleInstances
-    = batch->visibleInstances[subMesh->_id];
-  size_t matricesCount = visibleInstances.size() + 1;
-  size_t bufferSize    = matricesCount * 16 * 4;
-
-  auto currentInstancesBufferSize = _instancesBufferSize;
-
-  while (_instancesBufferSize < bufferSize) {
-    _instancesBufferSize *= 2;
-  }
-
-  if (_instancesData.empty()
-      || currentInstancesBufferSize != _instancesBufferSize) {
-    _instancesData = Float32Array(_instancesBufferSize / 4);
-  }
+  // The staging array only grows, it is shrunk back to the used size without
+  // releasing its storage
+  _instancesData.resize(matricesCount * 16);
 
   unsigned int offset         = 0;
   unsigned int instancesCount = 0;
 
-  auto world = getWorldMatrix();
   if (batch->renderSelf[subMesh->_id]) {
-    world->copyToArray(_instancesData, offset);
+    getWorldMatrix()->copyToArray(_instancesData, offset);
     offset += 16;
-    instancesCount++;
+    ++instancesCount;
   }
 
-  if (!visibleInstances.empty()) {
-    for (size_t instanceIndex = 0; instanceIndex < visibleInstances.size();
-         ++instanceIndex) {
-      InstancedMesh* instance = visibleInstances[instanceIndex];
-      instance->getWorldMatrix()->copyToArray(_instancesData, offset);
-      offset += 16;
-      ++instancesCount;
-    }
+  for (auto& instance : visibleInstances) {
+    instance->getWorldMatrix()->copyToArray(_instancesData, offset);
+    offset += 16;
+    ++instancesCount;
   }
 
-  if (!_instancesBuffer || currentInstancesBufferSize != _instancesBufferSize) {
-    if (_instancesBuffer) {
-      _instancesBuffer->dispose();
-    }
-
-    _instancesBuffer = std_util::make_unique<Buffer>(engine, _instancesData,
-                                                     true, 16, false, true);
-
-    setVerticesBuffer(
-      _instancesBuffer->createVertexBuffer(VertexBuffer::World0Kind, 0, 4));
-    setVerticesBuffer(
-      _instancesBuffer->createVertexBuffer(VertexBuffer::World1Kind, 4, 4));
-    setVerticesBuffer(
-      _instancesBuffer->createVertexBuffer(VertexBuffer::World2Kind, 8, 4));
-    setVerticesBuffer(
-      _instancesBuffer->createVertexBuffer(VertexBuffer::World3Kind, 12, 4));
+  for (auto& batchedSubMesh : batchedSubMeshes) {
+    batchedSubMesh->getMesh()->getWorldMatrix()->copyToArray(_instancesData,
+                                                            offset);
+    offset += 16;
+    ++instancesCount;
   }
-  else {
-    _instancesBuffer->updateDirectly(_instancesData, 0, instancesCount);
+
+  if (instancesCount == 0) {
+    return;
   }
-  engine->bindBuffers(_geometry->getVertexBuffers(),
-                      _geometry->getIndexBuffer(), effect);
+  _instancesData.resize(offset);
+
+  // The geometry buffers are already bound by _bind(), only the world
+  // matrices are bound as per instance attributes
+  engine->bindInstancesWorldMatrices(_instancesData, effect);
 
   _draw(subMesh, fillMode, instancesCount);
 
@@ -840,15 +860,38 @@ void Mesh::_processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
 }
 
 void Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
+{
+  renderBatched(subMesh, std::vector<SubMesh*>(), enableAlphaMode);
+}
+
+void Mesh::renderBatched(SubMesh* subMesh,
+                         const std::vector<SubMesh*>& batchedSubMeshes,
+                         bool enableAlphaMode)
 {
   auto scene = getScene();
 
+  // Automatic instancing: draw the batched sub-meshes one by one when the
+  // instanced variant of the effect is not available (yet)
+  if (!batchedSubMeshes.empty()) {
+    auto material = subMesh->getMaterial();
+    if (!scene->getEngine()->getCaps().instancedArrays || !material
+        || !material->isReady(this, true)) {
+      render(subMesh, enableAlphaMode);
+      for (auto& batchedSubMesh : batchedSubMeshes) {
+        batchedSubMesh->getRenderingMesh()->render(batchedSubMesh,
+                                                   enableAlphaMode);
+      }
+      return;
+    }
+  }
+
   // Managing instances
   auto batch = _getInstancesRenderList(subMesh->_id);
 
   if (batch->mustReturn) {
     return;
   }
+  batch->batchedSubMeshes = batchedSubMeshes;
 
   // Checking geometry state
   if (!_geometry || _geometry->getVertexBuffers().empty()
@@ -861,9 +904,8 @@ void Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
   auto engine = scene->getEngine();
   auto hardwareInstancedRendering
     = (engine->getCaps().instancedArrays != nullptr)
-      && (batch->visibleInstances.find(subMesh->_id)
-          != batch->visibleInstances.end())
-      && (!batch->visibleInstances[subMesh->_id].empty());
+      && ((!batch->visibleInstances[subMesh->_id].empty())
+          || (!batchedSubMeshes.empty()));
 
   // Material
   auto effectiveMaterial = subMesh->getMaterial();
@@ -1128,7 +1170,7 @@ bool Mesh::_generatePointsArray()
     return false;
   }
 
-  _positions.resize(data.size());
+  _positions.reserve(data.size() / 3);
   for (unsigned int index = 0; index < data.size(); index += 3) {
     _positions.emplace_back(Vector3::FromArray(data, index));
   }
@@ -1136,6 +1178,11 @@ bool Mesh::_generatePointsArray()
   return true;
 }
 
+TriangleBVH* Mesh::_getTriangleBVH()
+{
+  return _geometry ? _geometry->getTriangleBVH() : nullptr;
+}
+
 Mesh* Mesh::clone(const std::string& iName, Node* newParent,
                   bool doNotCloneChildren, bool clonePhysicsImpostor)
 {
@@ -1149,12 +1196,6 @@ void Mesh::dispose(bool /*doNotRecurse*/)
     _geometry->releaseForMesh(this, true);
   }
 
-  // Instances
-  if (_instancesBuffer) {
-    _instancesBuffer->dispose();
-    _instancesBuffer.reset(nullptr);
-  }
-
   for (auto& instance : instances) {
     instance->dispose();
   }
@@ -1441,15 +1482,21 @@ void Mesh::synchronizeInstances()
   }
 }
 
-/*void Mesh::simplify(
-  const std::vector<ISimplificationSettings*>& settings,
-  bool parallelProcessing, SimplificationType simplificationType,
-  std::function<void(Mesh* mesh, int submeshIndex)>& successCallback)
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings,
+                     bool parallelProcessing,
+                     SimplificationType simplificationType,
+                     const std::function<void()>& successCallback)
 {
-  settings(nullptr);
-  std::cout << parallelProcessing << simplificationType;
-  successCallback(nullptr, 0);
-}*/
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.simplificationType = simplificationType;
+  task.mesh               = this;
+  task.successCallback    = successCallback;
+  task.parallelProcessing = parallelProcessing;
+  getScene()->simplificationQueue->addTask(task);
+
+  return *this;
+}
 
 void Mesh::optimizeIndices(
   const std::function<void(Mesh* mesh)>& successCallback)
@@ -2104,58 +2151,52 @@ Mesh* Mesh::applySkeleton(Skeleton* skeleton)
     = needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) :
                    Float32Array();
 
-  auto skeletonMatrices = skeleton->getTransformMatrices(this);
-
-  auto tempVector3 = Vector3::Zero();
-  Matrix finalMatrix;
-  Matrix tempMatrix;
-
-  unsigned int matWeightIdx = 0;
-  unsigned int inf;
-  float weight;
-  for (unsigned int index = 0; index < positionsData.size();
-       index += 3, matWeightIdx += 4) {
-    for (inf = 0; inf < 4; ++inf) {
-      weight = matricesWeightsData[matWeightIdx + inf];
-      if (weight > 0.f) {
-        Matrix::FromFloat32ArrayToRefScaled(
-          skeletonMatrices,
-          static_cast<unsigned>(matricesIndicesData[matWeightIdx + inf]) * 16,
-          weight, tempMatrix);
-        finalMatrix.addToSelf(tempMatrix);
-      }
-      else {
+  const auto& skeletonMatrices = skeleton->getTransformMatrices(this);
+
+  // Adds the bone matrices of the 4 influences starting at matWeightIdx
+  const auto blend = [&skeletonMatrices](
+    float* finalMatrix, const Float32Array& matricesIndices,
+    const Float32Array& matricesWeights, size_t matWeightIdx) {
+    for (unsigned int inf = 0; inf < 4; ++inf) {
+      const float weight = matricesWeights[matWeightIdx + inf];
+      if (weight <= 0.f) {
         break;
       }
+      const float* boneMatrix
+        = &skeletonMatrices[static_cast<unsigned>(
+                              matricesIndices[matWeightIdx + inf])
+                            * 16];
+      for (unsigned int i = 0; i < 16; ++i) {
+        finalMatrix[i] += boneMatrix[i] * weight;
+      }
     }
-    if (needExtras) {
-      for (inf = 0; inf < 4; ++inf) {
-        weight = matricesWeightsExtraData[matWeightIdx + inf];
-        if (weight > 0.f) {
-          Matrix::FromFloat32ArrayToRefScaled(
-            skeletonMatrices,
-            static_cast<unsigned>(matricesIndicesExtraData[matWeightIdx + inf])
-              * 16,
-            weight, tempMatrix);
-          finalMatrix.addToSelf(tempMatrix);
-        }
-        else {
-          break;
-        }
+  };
+
+  // The matrices of a block of vertices are blended, then the vertices of the
+  // block are transformed in one batch
+  static constexpr size_t blockSize = 64;
+  std::array<float, blockSize * 16> finalMatrices;
+  const size_t vertexCount = positionsData.size() / 3;
+  for (size_t blockStart = 0; blockStart < vertexCount;
+       blockStart += blockSize) {
+    const size_t count = std::min(blockSize, vertexCount - blockStart);
+    std::fill(finalMatrices.begin(), finalMatrices.begin() + count * 16, 0.f);
+    for (size_t i = 0; i < count; ++i) {
+      const size_t matWeightIdx = (blockStart + i) * 4;
+      blend(&finalMatrices[i * 16], matricesIndicesData, matricesWeightsData,
+            matWeightIdx);
+      if (needExtras) {
+        blend(&finalMatrices[i * 16], matricesIndicesExtraData,
+              matricesWeightsExtraData, matWeightIdx);
       }
     }
 
-    Vector3::TransformCoordinatesFromFloatsToRef(
-      _sourcePositions[index], _sourcePositions[index + 1],
-      _sourcePositions[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(positionsData, index);
-
-    Vector3::TransformNormalFromFloatsToRef(
-      _sourceNormals[index], _sourceNormals[index + 1],
-      _sourceNormals[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(normalsData, index);
-
-    finalMatrix.reset();
+    SIMD::SIMDBatch::TransformCoordinatesByMatrices(
+      &_sourcePositions[blockStart * 3], finalMatrices.data(),
+      &positionsData[blockStart * 3], count);
+    SIMD::SIMDBatch::TransformNormalsByMatrices(
+      &_sourceNormals[blockStart * 3], finalMatrices.data(),
+      &normalsData[blockStart * 3], count);
   }
 
   updateVerticesData(VertexBuffer::PositionKind, positionsData);
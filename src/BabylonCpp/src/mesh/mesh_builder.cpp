@@ -88,10 +88,10 @@ Mesh* MeshBuilder::CreateRibbon(const std::string& name, RibbonOptions& options,
     Vector3::FromFloatsToRef(std::numeric_limits<float>::max(),
                              std::numeric_limits<float>::max(),
                              std::numeric_limits<float>::max(),
-                             Tmp::Vector3Array[0]); // minimum
+                             Tmp::Vector3Array()[0]); // minimum
     Vector3::FromFloatsToRef(
       -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(),
-      -std::numeric_limits<float>::max(), Tmp::Vector3Array[1]);
+      -std::numeric_limits<float>::max(), Tmp::Vector3Array()[1]);
     auto positionFunction = [&](Float32Array& positions) {
       auto minlg     = pathArray[0].size();
       unsigned int i = 0;
@@ -107,23 +107,23 @@ Mesh* MeshBuilder::CreateRibbon(const std::string& name, RibbonOptions& options,
             positions[i]     = path[j].x;
             positions[i + 1] = path[j].y;
             positions[i + 2] = path[j].z;
-            if (path[j].x < Tmp::Vector3Array[0].x) {
-              Tmp::Vector3Array[0].x = path[j].x;
+            if (path[j].x < Tmp::Vector3Array()[0].x) {
+              Tmp::Vector3Array()[0].x = path[j].x;
             }
-            if (path[j].x > Tmp::Vector3Array[1].x) {
-              Tmp::Vector3Array[1].x = path[j].x;
+            if (path[j].x > Tmp::Vector3Array()[1].x) {
+              Tmp::Vector3Array()[1].x = path[j].x;
             }
-            if (path[j].y < Tmp::Vector3Array[0].y) {
-              Tmp::Vector3Array[0].y = path[j].y;
+            if (path[j].y < Tmp::Vector3Array()[0].y) {
+              Tmp::Vector3Array()[0].y = path[j].y;
             }
-            if (path[j].y > Tmp::Vector3Array[1].y) {
-              Tmp::Vector3Array[1].y = path[j].y;
+            if (path[j].y > Tmp::Vector3Array()[1].y) {
+              Tmp::Vector3Array()[1].y = path[j].y;
             }
-            if (path[j].z < Tmp::Vector3Array[0].z) {
-              Tmp::Vector3Array[0].z = path[j].z;
+            if (path[j].z < Tmp::Vector3Array()[0].z) {
+              Tmp::Vector3Array()[0].z = path[j].z;
             }
-            if (path[j].z > Tmp::Vector3Array[1].z) {
-              Tmp::Vector3Array[1].z = path[j].z;
+            if (path[j].z > Tmp::Vector3Array()[1].z) {
+              Tmp::Vector3Array()[1].z = path[j].z;
             }
             ++j;
             i += 3;
@@ -140,7 +140,7 @@ Mesh* MeshBuilder::CreateRibbon(const std::string& name, RibbonOptions& options,
     auto positions = instance->getVerticesData(VertexBuffer::PositionKind);
     positionFunction(positions);
     instance->setBoundingInfo(
-      BoundingInfo(Tmp::Vector3Array[0], Tmp::Vector3Array[1]));
+      BoundingInfo(Tmp::Vector3Array()[0], Tmp::Vector3Array()[1]));
     instance->getBoundingInfo()->update(*instance->_worldMatrix);
     instance->updateVerticesData(VertexBuffer::PositionKind, positions, false,
                                  false);
@@ -546,7 +546,7 @@ Mesh* MeshBuilder::CreateTube(const std::string& name, TubeOptions& options,
     auto rad = 0.f;
     Vector3 normal;
     Vector3 rotated;
-    Matrix rotationMatrix = Tmp::MatrixArray[0];
+    Matrix rotationMatrix = Tmp::MatrixArray()[0];
     unsigned int index
       = (_cap == Mesh::NO_CAP || _cap == Mesh::CAP_END) ? 0 : 2;
     circlePaths.resize(_path.size() + index + 2);
@@ -903,7 +903,7 @@ Mesh* MeshBuilder::_ExtrudeShapeGeneric(
         auto scl    = _custom ? _scaleFunction : returnScale;
         unsigned int index
           = (_cap == Mesh::NO_CAP || _cap == Mesh::CAP_END) ? 0 : 2;
-        auto& rotationMatrix = Tmp::MatrixArray[0];
+        auto& rotationMatrix = Tmp::MatrixArray()[0];
         shapePaths.resize(_curve.size());
 
         for (unsigned int i = 0; i < _curve.size(); ++i) {
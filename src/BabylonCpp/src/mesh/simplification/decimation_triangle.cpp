@@ -3,8 +3,13 @@
 namespace BABYLON {
 
 DecimationTriangle::DecimationTriangle(
-  const std::vector<DecimationVertex>& _vertices)
-    : vertices{_vertices}
+  const std::array<int, 3>& _vertices,
+  const std::array<uint32_t, 3>& _originalOffsets)
+    : error{{0.f, 0.f, 0.f, 0.f}}
+    , deleted{false}
+    , isDirty{false}
+    , vertices{_vertices}
+    , originalOffsets{_originalOffsets}
 {
 }
 
@@ -12,4 +17,4 @@ DecimationTriangle::~DecimationTriangle()
 {
 }
 
-} // end of namespace BABYLON
\ No newline at end of file
+} // end of namespace BABYLON
@@ -5,7 +5,7 @@ namespace BABYLON {
 DecimationVertex::DecimationVertex(const Vector3& _position, int _id)
     : position{_position},
       id{_id},
-      isBorder{true},
+      isBorder{false},
       triangleStart{0},
       triangleCount{0}
 {
@@ -0,0 +1,595 @@
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
+
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/decimation_triangle.h>
+#include <babylon/mesh/simplification/decimation_vertex.h>
+#include <babylon/mesh/simplification/isimplification_settings.h>
+#include <babylon/mesh/simplification/reference.h>
+#include <babylon/mesh/sub_mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Weight of the planes holding the open borders in place
+const float borderWeight = 1000.f;
+
+/**
+ * Collapse state of one sub mesh. The positions are normalized to the unit
+ * cube so that the error thresholds do not depend on the size of the mesh.
+ */
+struct Decimation {
+  std::vector<DecimationVertex> vertices;
+  std::vector<DecimationTriangle> triangles;
+  std::vector<Reference> references;
+  size_t deletedTriangles = 0;
+  // Triangles around the collapsed vertices which are removed by the collapse
+  std::vector<uint8_t> deleted0;
+  std::vector<uint8_t> deleted1;
+
+  size_t liveTriangles() const;
+  float calculateError(int id0, int id1, Vector3& result) const;
+  void updateNormal(DecimationTriangle& triangle) const;
+  void updateErrors(DecimationTriangle& triangle) const;
+  bool isFlipped(const Vector3& point, int id1, const DecimationVertex& vertex,
+                 std::vector<uint8_t>& deleted) const;
+  void updateTriangles(int id0, const DecimationVertex& vertex,
+                       const std::vector<uint8_t>& deleted);
+  void identifyBorders();
+  void updateMesh(unsigned int iteration);
+  void run(size_t targetCount, unsigned int decimationIterations,
+           unsigned int syncIterations, float aggressiveness);
+}; // end of struct Decimation
+
+size_t Decimation::liveTriangles() const
+{
+  return triangles.size() - deletedTriangles;
+}
+
+float Decimation::calculateError(int id0, int id1, Vector3& result) const
+{
+  const auto& vertex0     = vertices[id0];
+  const auto& vertex1     = vertices[id1];
+  const QuadraticMatrix q = vertex0.q.add(vertex1.q);
+  const Vector3 middle    = (vertex0.position + vertex1.position) * 0.5f;
+  const bool border       = vertex0.isBorder && vertex1.isBorder;
+  const float det         = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+  if (!border && det != 0.f) {
+    result.x = -1.f / det * q.det(1, 2, 3, 4, 5, 6, 5, 7, 8);
+    result.y = 1.f / det * q.det(0, 2, 3, 1, 5, 6, 2, 7, 8);
+    result.z = -1.f / det * q.det(0, 1, 3, 1, 4, 6, 2, 5, 8);
+    // Nearly singular systems can move the vertex far away from the edge
+    if ((result - middle).lengthSquared()
+        <= (vertex1.position - vertex0.position).lengthSquared()) {
+      return q.vertexError(result);
+    }
+  }
+
+  const float error0      = q.vertexError(vertex0.position);
+  const float error1      = q.vertexError(vertex1.position);
+  const float errorMiddle = q.vertexError(middle);
+  const float error       = std::min(error0, std::min(error1, errorMiddle));
+  if (error == error0) {
+    result = vertex0.position;
+  }
+  else if (error == error1) {
+    result = vertex1.position;
+  }
+  else {
+    result = middle;
+  }
+  return error;
+}
+
+void Decimation::updateNormal(DecimationTriangle& triangle) const
+{
+  const auto& p0 = vertices[triangle.vertices[0]].position;
+  const auto& p1 = vertices[triangle.vertices[1]].position;
+  const auto& p2 = vertices[triangle.vertices[2]].position;
+  triangle.normal = Vector3::Cross(p1 - p0, p2 - p0);
+  triangle.normal.normalize();
+}
+
+void Decimation::updateErrors(DecimationTriangle& triangle) const
+{
+  Vector3 point;
+  for (unsigned int j = 0; j < 3; ++j) {
+    triangle.error[j] = calculateError(
+      triangle.vertices[j], triangle.vertices[(j + 1) % 3], point);
+  }
+  triangle.error[3] = std::min(triangle.error[0],
+                               std::min(triangle.error[1], triangle.error[2]));
+}
+
+bool Decimation::isFlipped(const Vector3& point, int id1,
+                           const DecimationVertex& vertex,
+                           std::vector<uint8_t>& deleted) const
+{
+  deleted.assign(static_cast<size_t>(vertex.triangleCount), 0);
+  for (int k = 0; k < vertex.triangleCount; ++k) {
+    const auto& reference = references[vertex.triangleStart + k];
+    const auto& triangle  = triangles[reference.triangleId];
+    if (triangle.deleted) {
+      continue;
+    }
+
+    const int other1 = triangle.vertices[(reference.vertexId + 1) % 3];
+    const int other2 = triangle.vertices[(reference.vertexId + 2) % 3];
+    // Triangle sharing the collapsed edge
+    if (other1 == id1 || other2 == id1) {
+      deleted[k] = 1;
+      continue;
+    }
+
+    Vector3 direction1 = vertices[other1].position - point;
+    direction1.normalize();
+    Vector3 direction2 = vertices[other2].position - point;
+    direction2.normalize();
+    if (std::abs(Vector3::Dot(direction1, direction2)) > 0.999f) {
+      return true;
+    }
+    Vector3 normal = Vector3::Cross(direction1, direction2);
+    normal.normalize();
+    if (Vector3::Dot(normal, triangle.normal) < 0.2f) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Decimation::updateTriangles(int id0, const DecimationVertex& vertex,
+                                  const std::vector<uint8_t>& deleted)
+{
+  for (int k = 0; k < vertex.triangleCount; ++k) {
+    const Reference reference = references[vertex.triangleStart + k];
+    auto& triangle            = triangles[reference.triangleId];
+    if (triangle.deleted) {
+      continue;
+    }
+    if (deleted[k]) {
+      triangle.deleted = true;
+      ++deletedTriangles;
+      continue;
+    }
+    triangle.vertices[reference.vertexId] = id0;
+    triangle.isDirty                      = true;
+    updateNormal(triangle);
+    updateErrors(triangle);
+    references.emplace_back(reference);
+  }
+}
+
+void Decimation::identifyBorders()
+{
+  // Number of triangles per edge, and the last one of them
+  std::unordered_map<uint64_t, std::pair<unsigned int, size_t>> edges;
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    const auto& triangle = triangles[i];
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = static_cast<uint64_t>(triangle.vertices[j]);
+      const auto b = static_cast<uint64_t>(triangle.vertices[(j + 1) % 3]);
+      auto& edge   = edges[(std::min(a, b) << 32) | std::max(a, b)];
+      ++edge.first;
+      edge.second = i;
+    }
+  }
+
+  const float weight = std::sqrt(borderWeight);
+  for (const auto& item : edges) {
+    if (item.second.first == 2) {
+      continue;
+    }
+    auto& vertex0    = vertices[static_cast<size_t>(item.first >> 32)];
+    auto& vertex1    = vertices[static_cast<size_t>(item.first & 0xFFFFFFFF)];
+    vertex0.isBorder = true;
+    vertex1.isBorder = true;
+    // Open edge: penalize moving away from the plane orthogonal to its
+    // triangle
+    if (item.second.first == 1) {
+      const auto& triangle = triangles[item.second.second];
+      Vector3 normal
+        = Vector3::Cross(vertex1.position - vertex0.position, triangle.normal);
+      normal.normalize();
+      const auto q = QuadraticMatrix::FromData(
+        normal.x * weight, normal.y * weight, normal.z * weight,
+        -Vector3::Dot(normal, vertex0.position) * weight);
+      vertex0.q.addInPlace(q);
+      vertex1.q.addInPlace(q);
+    }
+  }
+}
+
+void Decimation::updateMesh(unsigned int iteration)
+{
+  if (iteration > 0) {
+    triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                   [](const DecimationTriangle& triangle) {
+                                     return triangle.deleted;
+                                   }),
+                    triangles.end());
+    deletedTriangles = 0;
+  }
+
+  // Rebuild the references of the triangles around each vertex
+  for (auto& vertex : vertices) {
+    vertex.triangleStart = 0;
+    vertex.triangleCount = 0;
+  }
+  for (const auto& triangle : triangles) {
+    for (int id : triangle.vertices) {
+      ++vertices[id].triangleCount;
+    }
+  }
+  int triangleStart = 0;
+  for (auto& vertex : vertices) {
+    vertex.triangleStart = triangleStart;
+    triangleStart += vertex.triangleCount;
+    vertex.triangleCount = 0;
+  }
+  references.assign(triangles.size() * 3, Reference(0, 0));
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    const auto& triangle = triangles[i];
+    for (unsigned int j = 0; j < 3; ++j) {
+      auto& vertex = vertices[triangle.vertices[j]];
+      references[vertex.triangleStart + vertex.triangleCount]
+        = Reference(static_cast<int>(j), static_cast<int>(i));
+      ++vertex.triangleCount;
+    }
+  }
+
+  if (iteration == 0) {
+    for (auto& triangle : triangles) {
+      updateNormal(triangle);
+      const auto& normal = triangle.normal;
+      const auto q       = QuadraticMatrix::FromData(
+        normal.x, normal.y, normal.z,
+        -Vector3::Dot(normal, vertices[triangle.vertices[0]].position));
+      for (int id : triangle.vertices) {
+        vertices[id].q.addInPlace(q);
+      }
+    }
+    identifyBorders();
+    for (auto& triangle : triangles) {
+      updateErrors(triangle);
+    }
+  }
+}
+
+void Decimation::run(size_t targetCount, unsigned int decimationIterations,
+                     unsigned int syncIterations, float aggressiveness)
+{
+  for (unsigned int iteration = 0; iteration < decimationIterations;
+       ++iteration) {
+    if (iteration % syncIterations == 0) {
+      updateMesh(iteration);
+    }
+    if (liveTriangles() <= targetCount) {
+      break;
+    }
+
+    for (auto& triangle : triangles) {
+      triangle.isDirty = false;
+    }
+
+    // Collapse the edges whose error is below a threshold which grows with
+    // the iterations
+    const float threshold
+      = 1e-9f * std::pow(static_cast<float>(iteration + 3), aggressiveness);
+    for (size_t i = 0; i < triangles.size(); ++i) {
+      const auto& triangle = triangles[i];
+      if (triangle.error[3] > threshold || triangle.deleted
+          || triangle.isDirty) {
+        continue;
+      }
+
+      for (unsigned int j = 0; j < 3; ++j) {
+        if (triangle.error[j] >= threshold) {
+          continue;
+        }
+        const int id0 = triangle.vertices[j];
+        const int id1 = triangle.vertices[(j + 1) % 3];
+        auto& vertex0 = vertices[id0];
+        auto& vertex1 = vertices[id1];
+        if (vertex0.isBorder != vertex1.isBorder) {
+          continue;
+        }
+
+        Vector3 point;
+        calculateError(id0, id1, point);
+        if (isFlipped(point, id1, vertex0, deleted0)
+            || isFlipped(point, id0, vertex1, deleted1)) {
+          continue;
+        }
+
+        vertex0.updatePosition(point);
+        vertex0.q.addInPlace(vertex1.q);
+        const size_t start = references.size();
+        updateTriangles(id0, vertex0, deleted0);
+        updateTriangles(id0, vertex1, deleted1);
+        const int count = static_cast<int>(references.size() - start);
+        if (count <= vertex0.triangleCount) {
+          // Reuse the references range of the vertex
+          std::copy(references.begin() + static_cast<std::ptrdiff_t>(start),
+                    references.end(),
+                    references.begin() + vertex0.triangleStart);
+          references.erase(
+            references.begin() + static_cast<std::ptrdiff_t>(start),
+            references.end());
+        }
+        else {
+          vertex0.triangleStart = static_cast<int>(start);
+        }
+        vertex0.triangleCount = count;
+        break;
+      }
+
+      if (liveTriangles() <= targetCount) {
+        break;
+      }
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : syncIterations{5}
+    , aggressiveness{7.f}
+    , decimationIterations{100}
+    , _mesh{mesh}
+    , _meshData{QuadraticErrorSimplification::ReadMeshData(mesh)}
+{
+}
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(
+  const SimplificationMeshData& meshData)
+    : syncIterations{5}
+    , aggressiveness{7.f}
+    , decimationIterations{100}
+    , _mesh{nullptr}
+    , _meshData{meshData}
+{
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification()
+{
+}
+
+const SimplificationMeshData& QuadraticErrorSimplification::meshData() const
+{
+  return _meshData;
+}
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(Mesh* mesh)>& successCallback)
+{
+  auto newMesh = createMesh(decimate(settings));
+  if (newMesh && successCallback) {
+    successCallback(newMesh);
+  }
+}
+
+SimplificationMeshData QuadraticErrorSimplification::decimate(
+  const ISimplificationSettings& settings) const
+{
+  SimplificationMeshData result;
+
+  const auto totalVertices = _meshData.totalVertices;
+  const auto positionsIt
+    = _meshData.verticesData.find(VertexBuffer::PositionKind);
+  if (totalVertices == 0 || positionsIt == _meshData.verticesData.end()
+      || positionsIt->second.size() < totalVertices * 3) {
+    return result;
+  }
+  const auto& positions = positionsIt->second;
+  const auto& indices   = _meshData.indices;
+
+  // Mapping to the unit cube
+  Vector3 minimum(std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max());
+  Vector3 maximum(std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest());
+  for (size_t i = 0; i < totalVertices; ++i) {
+    const Vector3 position(positions[i * 3 + 0], positions[i * 3 + 1],
+                           positions[i * 3 + 2]);
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
+  }
+  const Vector3 size = maximum - minimum;
+  float extent       = std::max(size.x, std::max(size.y, size.z));
+  if (extent <= 0.f) {
+    extent = 1.f;
+  }
+  const float scale = 1.f / extent;
+
+  // Output vertex buffers, the kinds whose size does not match the vertices
+  // count are dropped
+  std::vector<std::pair<unsigned int, size_t>> strides;
+  for (const auto& item : _meshData.verticesData) {
+    if (!item.second.empty() && item.second.size() % totalVertices == 0) {
+      strides.emplace_back(item.first, item.second.size() / totalVertices);
+      result.verticesData[item.first] = Float32Array();
+    }
+  }
+
+  // Source vertex of the decimation vertex whose attributes are the closest to
+  // the ones of the given source vertex
+  const auto closestOffset = [this, &strides](const DecimationVertex& vertex,
+                                              uint32_t offset) {
+    if (std_util::contains(vertex.originalOffsets, offset)) {
+      return offset;
+    }
+    uint32_t closest      = vertex.originalOffsets.front();
+    float closestDistance = std::numeric_limits<float>::max();
+    for (auto candidate : vertex.originalOffsets) {
+      float distance = 0.f;
+      for (const auto& item : strides) {
+        if (item.first == VertexBuffer::PositionKind) {
+          continue;
+        }
+        const auto& data = _meshData.verticesData.at(item.first);
+        for (size_t k = 0; k < item.second; ++k) {
+          const float delta = data[candidate * item.second + k]
+                              - data[offset * item.second + k];
+          distance += delta * delta;
+        }
+      }
+      if (distance < closestDistance) {
+        closest         = candidate;
+        closestDistance = distance;
+      }
+    }
+    return closest;
+  };
+
+  const float quality = std::max(0.f, std::min(settings.quality, 1.f));
+  for (const auto& subMesh : _meshData.subMeshes) {
+    const size_t indexEnd
+      = std::min(subMesh.indexStart + subMesh.indexCount, indices.size());
+
+    // Merge the vertices sharing the same position
+    Decimation decimation;
+    std::map<std::tuple<float, float, float>, int> ids;
+    for (size_t index = subMesh.indexStart; index + 2 < indexEnd; index += 3) {
+      std::array<int, 3> triangleIds;
+      std::array<uint32_t, 3> offsets;
+      bool valid = true;
+      for (unsigned int j = 0; j < 3; ++j) {
+        const uint32_t offset = indices[index + j];
+        if (offset >= totalVertices) {
+          valid = false;
+          break;
+        }
+        const auto key = std::make_tuple(positions[offset * 3 + 0],
+                                         positions[offset * 3 + 1],
+                                         positions[offset * 3 + 2]);
+        auto it = ids.find(key);
+        if (it == ids.end()) {
+          const int id = static_cast<int>(decimation.vertices.size());
+          const Vector3 position(std::get<0>(key), std::get<1>(key),
+                                 std::get<2>(key));
+          decimation.vertices.emplace_back((position - minimum) * scale, id);
+          it = ids.emplace(key, id).first;
+        }
+        auto& originalOffsets = decimation.vertices[it->second].originalOffsets;
+        if (!std_util::contains(originalOffsets, offset)) {
+          originalOffsets.emplace_back(offset);
+        }
+        triangleIds[j] = it->second;
+        offsets[j]     = offset;
+      }
+      // Skip the degenerated triangles
+      if (valid && triangleIds[0] != triangleIds[1]
+          && triangleIds[1] != triangleIds[2]
+          && triangleIds[0] != triangleIds[2]) {
+        decimation.triangles.emplace_back(triangleIds, offsets);
+      }
+    }
+
+    const auto targetCount = static_cast<size_t>(
+      static_cast<float>(decimation.triangles.size()) * quality);
+    decimation.run(targetCount, decimationIterations,
+                   std::max(syncIterations, 1u), aggressiveness);
+
+    // Emit one vertex per source vertex of the remaining decimation vertices
+    SimplificationMeshData::SubMeshRange range;
+    range.materialIndex = subMesh.materialIndex;
+    range.indexStart    = static_cast<unsigned int>(result.indices.size());
+    std::unordered_map<uint64_t, uint32_t> emitted;
+    for (const auto& triangle : decimation.triangles) {
+      if (triangle.deleted) {
+        continue;
+      }
+      for (unsigned int j = 0; j < 3; ++j) {
+        const int id = triangle.vertices[j];
+        const uint32_t offset = closestOffset(decimation.vertices[id],
+                                              triangle.originalOffsets[j]);
+        const uint64_t key = (static_cast<uint64_t>(id) << 32) | offset;
+        auto it            = emitted.find(key);
+        if (it == emitted.end()) {
+          const auto newIndex = static_cast<uint32_t>(result.totalVertices++);
+          it                  = emitted.emplace(key, newIndex).first;
+          for (const auto& item : strides) {
+            auto& data = result.verticesData[item.first];
+            if (item.first == VertexBuffer::PositionKind) {
+              const Vector3 position
+                = decimation.vertices[id].position * extent + minimum;
+              data.emplace_back(position.x);
+              data.emplace_back(position.y);
+              data.emplace_back(position.z);
+            }
+            else {
+              const auto& source = _meshData.verticesData.at(item.first);
+              const auto begin   = source.begin()
+                                 + static_cast<std::ptrdiff_t>(offset
+                                                               * item.second);
+              data.insert(data.end(), begin,
+                          begin + static_cast<std::ptrdiff_t>(item.second));
+            }
+          }
+        }
+        result.indices.emplace_back(it->second);
+      }
+    }
+    range.indexCount = result.indices.size() - range.indexStart;
+    if (range.indexCount > 0) {
+      result.subMeshes.emplace_back(range);
+    }
+  }
+
+  return result;
+}
+
+Mesh* QuadraticErrorSimplification::createMesh(
+  const SimplificationMeshData& meshData)
+{
+  if (!_mesh || meshData.indices.empty()) {
+    return nullptr;
+  }
+
+  auto newMesh = Mesh::New(_mesh->name + "Decimated", _mesh->getScene());
+  for (const auto& item : meshData.verticesData) {
+    newMesh->setVerticesData(
+      item.first, item.second, false,
+      static_cast<int>(item.second.size() / meshData.totalVertices));
+  }
+  newMesh->setIndices(meshData.indices,
+                      static_cast<int>(meshData.totalVertices));
+
+  newMesh->releaseSubMeshes();
+  for (const auto& range : meshData.subMeshes) {
+    SubMesh::CreateFromIndices(range.materialIndex, range.indexStart,
+                               range.indexCount, newMesh);
+  }
+
+  newMesh->material         = _mesh->material;
+  newMesh->renderingGroupId = _mesh->renderingGroupId;
+  newMesh->setParent(_mesh->parent());
+  newMesh->isVisible = false;
+
+  return newMesh;
+}
+
+SimplificationMeshData QuadraticErrorSimplification::ReadMeshData(Mesh* mesh)
+{
+  SimplificationMeshData meshData;
+  meshData.totalVertices = mesh->getTotalVertices();
+  for (auto kind : mesh->getVerticesDataKinds()) {
+    meshData.verticesData[kind] = mesh->getVerticesData(kind);
+  }
+  meshData.indices = mesh->getIndices();
+  for (const auto& subMesh : mesh->subMeshes) {
+    SimplificationMeshData::SubMeshRange range;
+    range.materialIndex = subMesh->materialIndex;
+    range.indexStart    = subMesh->indexStart;
+    range.indexCount    = subMesh->indexCount;
+    meshData.subMeshes.emplace_back(range);
+  }
+  return meshData;
+}
+
+} // end of namespace BABYLON
@@ -21,7 +21,7 @@ QuadraticMatrix::~QuadraticMatrix()
 }
 
 float QuadraticMatrix::det(int a11, int a12, int a13, int a21, int a22, int a23,
-                           int a31, int a32, int a33)
+                           int a31, int a32, int a33) const
 {
   return data[a11] * data[a22] * data[a33] + data[a13] * data[a21] * data[a32]
          + data[a12] * data[a23] * data[a31] - data[a13] * data[a22] * data[a31]
@@ -43,7 +43,7 @@ void QuadraticMatrix::addArrayInPlace(const std::array<float, 10>& _data)
   }
 }
 
-QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
+QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix) const
 {
   QuadraticMatrix m;
   for (unsigned int i = 0; i < 10; ++i) {
@@ -52,6 +52,16 @@ QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
   return m;
 }
 
+float QuadraticMatrix::vertexError(const Vector3& point) const
+{
+  const float x = point.x;
+  const float y = point.y;
+  const float z = point.z;
+  return data[0] * x * x + 2.f * data[1] * x * y + 2.f * data[2] * x * z
+         + 2.f * data[3] * x + data[4] * y * y + 2.f * data[5] * y * z
+         + 2.f * data[6] * y + data[7] * z * z + 2.f * data[8] * z + data[9];
+}
+
 QuadraticMatrix QuadraticMatrix::FromData(float a, float b, float c, float d)
 {
   return QuadraticMatrix(QuadraticMatrix::DataFromNumbers(a, b, c, d));
@@ -1,15 +1,22 @@
 #include <babylon/mesh/simplification/simplification_queue.h>
 
+#include <babylon/core/thread_pool.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
 #include <babylon/mesh/simplification/simplification_settings.h>
 
 namespace BABYLON {
 
-SimplificationQueue::SimplificationQueue() : running{false}
+SimplificationQueue::SimplificationQueue()
+    : running{false}, _publishedLevels{0}, _cancelled{false}
 {
 }
 
 SimplificationQueue::~SimplificationQueue()
 {
+  // The levels still being computed are dropped
+  _cancelled = true;
+  _tasks.wait();
 }
 
 void SimplificationQueue::addTask(const ISimplificationTask& task)
@@ -20,8 +27,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running                        = true;
+    const ISimplificationTask task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -30,22 +37,86 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
-  // TODO IMPLEMENT
-  // if (task.parallelProcessing)
-  //  std::cout << "";
+  running          = true;
+  _task            = task;
+  _publishedLevels = 0;
+  // Copies the mesh geometry
+  _simplifier = getSimplifier(task);
+
+  _tasks.post([this]() {
+    const size_t levelsCount = _task.settings.size();
+    if (_task.parallelProcessing) {
+      ThreadPool::Default().parallelFor(levelsCount, 1, [this](size_t begin,
+                                                              size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          _decimate(i);
+        }
+      });
+    }
+    else {
+      for (size_t i = 0; i < levelsCount; ++i) {
+        _decimate(i);
+      }
+    }
+  });
+
+  // A task without levels completes at once
+  processResults();
+}
+
+void SimplificationQueue::processResults()
+{
+  if (!running || !_simplifier) {
+    return;
+  }
+
+  std::vector<std::pair<size_t, SimplificationMeshData>> results;
+  {
+    std::lock_guard<std::mutex> lock(_resultsMutex);
+    results.swap(_results);
+  }
+
+  for (const auto& result : results) {
+    const auto& settings = _task.settings[result.first];
+    auto newMesh         = _simplifier->createMesh(result.second);
+    if (newMesh) {
+      _task.mesh->addLODLevel(settings.distance, newMesh);
+      newMesh->isVisible = true;
+    }
+    ++_publishedLevels;
+  }
+
+  if (_publishedLevels == _task.settings.size()) {
+    _tasks.wait();
+    _simplifier.reset();
+    running = false;
+    if (_task.successCallback) {
+      _task.successCallback();
+    }
+  }
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+std::unique_ptr<ISimplifier>
+SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std_util::make_unique<QuadraticErrorSimplification>(task.mesh);
   }
 }
 
+void SimplificationQueue::_decimate(size_t settingIndex)
+{
+  if (_cancelled) {
+    return;
+  }
+
+  auto meshData = _simplifier->decimate(_task.settings[settingIndex]);
+  std::lock_guard<std::mutex> lock(_resultsMutex);
+  _results.emplace_back(settingIndex, std::move(meshData));
+}
+
 } // end of namespace BABYLON
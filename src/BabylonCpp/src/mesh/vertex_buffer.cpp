@@ -49,14 +49,25 @@ VertexBuffer::VertexBuffer(Engine* engine, const Float32Array& data,
                            unsigned int kind, bool updatable,
                            bool postponeInternalCreation, int stride,
                            bool instanced, int offset, int size)
+    : VertexBuffer(engine, Float32Array(data), kind, updatable,
+                   postponeInternalCreation, stride, instanced, offset, size)
+{
+}
+
+VertexBuffer::VertexBuffer(Engine* engine, Float32Array&& data,
+                           unsigned int kind, bool updatable,
+                           bool postponeInternalCreation, int stride,
+                           bool instanced, int offset, int size)
     : _ownedBuffer{nullptr}, _buffer{nullptr}, _kind{kind}, _ownsBuffer{true}
 {
   // Deduce stride from kind
   _stride = (stride == -1) ? VertexBuffer::KindToStride(kind) : stride;
   _stride = (_stride == -1) ? 3 : _stride;
 
-  _ownedBuffer = std_util::make_unique<Buffer>(
-    engine, data, updatable, _stride, postponeInternalCreation, instanced);
+  _ownedBuffer = std_util::make_unique<Buffer>(engine, std::move(data),
+                                               updatable, _stride,
+                                               postponeInternalCreation,
+                                               instanced);
 
   _offset = (offset != -1) ? static_cast<unsigned int>(offset) : 0;
   _size   = (size != -1) ? size : _stride;
@@ -233,6 +244,12 @@ void VertexBuffer::updateDirectly(const Float32Array& data, int offset)
   return _getBuffer()->updateDirectly(data, offset);
 }
 
+void VertexBuffer::updateRange(const Float32Array& data, size_t offset,
+                               size_t count)
+{
+  _getBuffer()->updateRange(data, offset, count);
+}
+
 void VertexBuffer::dispose(bool /*doNotRecurse*/)
 {
   if (_ownsBuffer && _ownedBuffer) {
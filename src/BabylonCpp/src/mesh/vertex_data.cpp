@@ -3,6 +3,7 @@
 #include <babylon/core/json.h>
 #include <babylon/engine/engine.h>
 #include <babylon/math/axis.h>
+#include <babylon/math/simd/simd_batch.h>
 #include <babylon/math/vector2.h>
 #include <babylon/math/vector3.h>
 #include <babylon/mesh/geometry.h>
@@ -232,31 +233,15 @@ void VertexData::_update(IGetSetVerticesData* meshOrGeometry,
 
 void VertexData::transform(const Matrix& matrix)
 {
-  auto transformed = Vector3::Zero();
   if (!positions.empty()) {
-    auto position = Vector3::Zero();
-
-    for (unsigned int index = 0; index < positions.size(); index += 3) {
-      Vector3::FromArrayToRef(positions, index, position);
-
-      Vector3::TransformCoordinatesToRef(position, matrix, transformed);
-      positions[index + 0] = transformed.x;
-      positions[index + 1] = transformed.y;
-      positions[index + 2] = transformed.z;
-    }
+    SIMD::SIMDBatch::TransformCoordinates(positions.data(), matrix.m.data(),
+                                          positions.data(),
+                                          positions.size() / 3);
   }
 
   if (!normals.empty()) {
-    auto normal = Vector3::Zero();
-
-    for (unsigned int index = 0; index < normals.size(); index += 3) {
-      Vector3::FromArrayToRef(normals, index, normal);
-
-      Vector3::TransformNormalToRef(normal, matrix, transformed);
-      normals[index + 0] = transformed.x;
-      normals[index + 1] = transformed.y;
-      normals[index + 2] = transformed.z;
-    }
+    SIMD::SIMDBatch::TransformNormals(normals.data(), matrix.m.data(),
+                                      normals.data(), normals.size() / 3);
   }
 }
 
@@ -0,0 +1,239 @@
+#include <babylon/particles/particle_store.h>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/math/simd/simd_batch.h>
+#include <babylon/particles/particle.h>
+
+namespace BABYLON {
+
+constexpr unsigned int ParticleStore::POSITION;
+constexpr unsigned int ParticleStore::DIRECTION;
+constexpr unsigned int ParticleStore::COLOR;
+constexpr unsigned int ParticleStore::COLOR_STEP;
+constexpr unsigned int ParticleStore::ANGLE;
+constexpr unsigned int ParticleStore::ANGULAR_SPEED;
+constexpr unsigned int ParticleStore::AGE;
+constexpr unsigned int ParticleStore::LIFE_TIME;
+constexpr unsigned int ParticleStore::SIZE;
+constexpr unsigned int ParticleStore::STREAM_COUNT;
+constexpr unsigned int ParticleStore::VERTEX_STRIDE;
+
+namespace {
+
+// Alignment of the streams, in floats (64 bytes)
+const size_t StreamAlignment = 16;
+
+} // end of anonymous namespace
+
+ParticleStore::ParticleStore(size_t capacity)
+    : _capacity{capacity}
+    , _stride{(capacity + StreamAlignment - 1) & ~(StreamAlignment - 1)}
+    , _size{0}
+    , _storage(_stride * STREAM_COUNT + StreamAlignment - 1, 0.f)
+    , _dead((capacity + 31) / 32, 0u)
+{
+  const auto address   = reinterpret_cast<uintptr_t>(_storage.data());
+  const auto alignment = StreamAlignment * sizeof(float);
+  _streams = _storage.data()
+             + ((alignment - address % alignment) % alignment) / sizeof(float);
+}
+
+ParticleStore::~ParticleStore()
+{
+}
+
+size_t ParticleStore::size() const
+{
+  return _size;
+}
+
+size_t ParticleStore::capacity() const
+{
+  return _capacity;
+}
+
+bool ParticleStore::empty() const
+{
+  return _size == 0;
+}
+
+bool ParticleStore::full() const
+{
+  return _size == _capacity;
+}
+
+float* ParticleStore::stream(unsigned int index)
+{
+  return _streams + index * _stride;
+}
+
+const float* ParticleStore::stream(unsigned int index) const
+{
+  return _streams + index * _stride;
+}
+
+bool ParticleStore::add(const Particle& particle)
+{
+  if (full()) {
+    return false;
+  }
+
+  set(_size++, particle);
+  return true;
+}
+
+size_t ParticleStore::append(size_t count)
+{
+  count = std::min(count, _capacity - _size);
+  _size += count;
+  return count;
+}
+
+void ParticleStore::get(size_t index, Particle& particle) const
+{
+  const float* p = _streams + index;
+  const size_t s = _stride;
+  particle.position.set(p[(POSITION + 0) * s], p[(POSITION + 1) * s],
+                        p[(POSITION + 2) * s]);
+  particle.direction.set(p[(DIRECTION + 0) * s], p[(DIRECTION + 1) * s],
+                         p[(DIRECTION + 2) * s]);
+  particle.color.set(p[(COLOR + 0) * s], p[(COLOR + 1) * s],
+                     p[(COLOR + 2) * s], p[(COLOR + 3) * s]);
+  particle.colorStep.set(p[(COLOR_STEP + 0) * s], p[(COLOR_STEP + 1) * s],
+                         p[(COLOR_STEP + 2) * s], p[(COLOR_STEP + 3) * s]);
+  particle.angle        = p[ANGLE * s];
+  particle.angularSpeed = p[ANGULAR_SPEED * s];
+  particle.age          = p[AGE * s];
+  particle.lifeTime     = p[LIFE_TIME * s];
+  particle.size         = p[SIZE * s];
+}
+
+void ParticleStore::set(size_t index, const Particle& particle)
+{
+  float* p                = _streams + index;
+  const size_t s          = _stride;
+  p[(POSITION + 0) * s]   = particle.position.x;
+  p[(POSITION + 1) * s]   = particle.position.y;
+  p[(POSITION + 2) * s]   = particle.position.z;
+  p[(DIRECTION + 0) * s]  = particle.direction.x;
+  p[(DIRECTION + 1) * s]  = particle.direction.y;
+  p[(DIRECTION + 2) * s]  = particle.direction.z;
+  p[(COLOR + 0) * s]      = particle.color.r;
+  p[(COLOR + 1) * s]      = particle.color.g;
+  p[(COLOR + 2) * s]      = particle.color.b;
+  p[(COLOR + 3) * s]      = particle.color.a;
+  p[(COLOR_STEP + 0) * s] = particle.colorStep.r;
+  p[(COLOR_STEP + 1) * s] = particle.colorStep.g;
+  p[(COLOR_STEP + 2) * s] = particle.colorStep.b;
+  p[(COLOR_STEP + 3) * s] = particle.colorStep.a;
+  p[ANGLE * s]            = particle.angle;
+  p[ANGULAR_SPEED * s]    = particle.angularSpeed;
+  p[AGE * s]              = particle.age;
+  p[LIFE_TIME * s]        = particle.lifeTime;
+  p[SIZE * s]             = particle.size;
+}
+
+void ParticleStore::remove(size_t index)
+{
+  if (index >= _size) {
+    return;
+  }
+
+  --_size;
+  if (index != _size) {
+    _move(_size, index);
+  }
+}
+
+void ParticleStore::clear()
+{
+  _size = 0;
+}
+
+size_t ParticleStore::update(float step, const Vector3& gravity,
+                             ThreadPool* pool, size_t chunkSize)
+{
+  const float g[3] = {gravity.x, gravity.y, gravity.z};
+  // The chunks start on a word of the dead mask
+  const auto updateChunk = [this, step, &g](size_t begin, size_t end) {
+    SIMD::SIMDBatch::UpdateParticles(_streams + begin, _stride, end - begin,
+                                     step, g, _dead.data() + begin / 32);
+  };
+  if (pool && chunkSize > 0 && _size > chunkSize) {
+    pool->parallelFor(_size, (chunkSize + 31) & ~size_t(31), updateChunk);
+  }
+  else {
+    updateChunk(0, _size);
+  }
+
+  const size_t size = _size;
+  _removeDead();
+  return size - _size;
+}
+
+void ParticleStore::fillVertexData(float* vertexData) const
+{
+  fillVertexData(vertexData, 0, _size);
+}
+
+void ParticleStore::fillVertexData(float* vertexData, size_t begin,
+                                   size_t end) const
+{
+  static const float offsets[4][2] = {{0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f},
+                                      {0.f, 1.f}};
+
+  vertexData += begin * 4 * VERTEX_STRIDE;
+  const float* p = _streams + begin;
+  const size_t s = _stride;
+  for (size_t i = begin; i < end; ++i, ++p) {
+    for (unsigned int corner = 0; corner < 4;
+         ++corner, vertexData += VERTEX_STRIDE) {
+      vertexData[0]  = p[(POSITION + 0) * s];
+      vertexData[1]  = p[(POSITION + 1) * s];
+      vertexData[2]  = p[(POSITION + 2) * s];
+      vertexData[3]  = p[(COLOR + 0) * s];
+      vertexData[4]  = p[(COLOR + 1) * s];
+      vertexData[5]  = p[(COLOR + 2) * s];
+      vertexData[6]  = p[(COLOR + 3) * s];
+      vertexData[7]  = p[ANGLE * s];
+      vertexData[8]  = p[SIZE * s];
+      vertexData[9]  = offsets[corner][0];
+      vertexData[10] = offsets[corner][1];
+    }
+  }
+}
+
+void ParticleStore::_move(size_t from, size_t to)
+{
+  for (unsigned int k = 0; k < STREAM_COUNT; ++k) {
+    _streams[k * _stride + to] = _streams[k * _stride + from];
+  }
+}
+
+void ParticleStore::_removeDead()
+{
+  const auto isDead = [this](size_t index) {
+    return (_dead[index / 32] >> (index % 32)) & 1u;
+  };
+
+  // Each dead particle is replaced by the last live one, the dead particles at
+  // the end being dropped
+  size_t end = _size;
+  for (size_t word = 0; word * 32 < end; ++word) {
+    uint32_t bits = _dead[word];
+    for (size_t index = word * 32; bits && index < end; ++index, bits >>= 1) {
+      if (!(bits & 1u)) {
+        continue;
+      }
+      while (end > index + 1 && isDead(end - 1)) {
+        --end;
+      }
+      if (--end > index) {
+        _move(end, index);
+      }
+    }
+  }
+  _size = end;
+}
+
+} // end of namespace BABYLON
@@ -2,6 +2,7 @@
 
 #include <babylon/core/random.h>
 #include <babylon/core/string.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/materials/effect.h>
@@ -32,6 +33,7 @@ ParticleSystem::ParticleSystem(const std::string& _name, size_t capacity,
     , maxSize{1}
     , minAngularSpeed{0}
     , maxAngularSpeed{0}
+    , particleTexture{nullptr}
     , layerMask{0x0FFFFFFF}
     , blendMode{ParticleSystem::BLENDMODE_ONEONE}
     , forceDepthWrite{false}
@@ -44,18 +46,23 @@ ParticleSystem::ParticleSystem(const std::string& _name, size_t capacity,
     , color2{Color4(1.f, 1.f, 1.f, 1.f)}
     , colorDead{Color4(0.f, 0.f, 0.f, 1.f)}
     , textureMask{Color4(1.f, 1.f, 1.f, 1.f)}
+    , randomSeed{scene->particleSystems.size()}
+    , parallelChunkSize{16384}
+    , particles{capacity}
     , _capacity{capacity}
     , _scene{scene}
-    , _newPartsExcess{0}
+    , _newPartsExcess{0.f}
+    , _effect{nullptr}
     , _customEffect{customEffect}
-    , _scaledColorStep{Color4(0.f, 0.f, 0.f, 0.f)}
-    , _colorDiff{Color4(0.f, 0.f, 0.f, 0.f)}
-    , _scaledDirection{Vector3::Zero()}
-    , _scaledGravity{Vector3::Zero()}
     , _currentRenderId{-1}
+    , _pendingNewParticles{0}
+    , _emittedChunks{0}
+    , _simulationPool{nullptr}
+    , _alive{false}
     , _started{false}
     , _stopped{false}
-    , _actualFrame{0}
+    , _actualFrame{0.f}
+    , _scaledUpdateSpeed{0.f}
 {
   _scene->particleSystems.emplace_back(this);
 
@@ -73,74 +80,30 @@ ParticleSystem::ParticleSystem(const std::string& _name, size_t capacity,
 
   _indexBuffer = scene->getEngine()->createIndexBuffer(indices);
 
-  // 11 floats per particle (x, y, z, r, g, b, a, angle, size, offsetX, offsetY)
-  // + 1 filler
-  _vertexData.resize(capacity * 11 * 4);
-  /*_vertexBuffer = new Buffer(scene->getEngine(), _vertexData, true, 11);
+  // 11 floats per vertex (x, y, z, r, g, b, a, angle, size, offsetX, offsetY)
+  _vertexData.resize(capacity * ParticleStore::VERTEX_STRIDE * 4);
+  _vertexBuffer = std_util::make_unique<Buffer>(
+    scene->getEngine(), _vertexData, true, ParticleStore::VERTEX_STRIDE);
 
-  VertexBuffer* positions
+  auto positions
     = _vertexBuffer->createVertexBuffer(VertexBuffer::PositionKind, 0, 3);
-  VertexBuffer* colors
-    = _vertexBuffer->createVertexBuffer(VertexBuffer::ColorKindChars, 3, 4);
-  VertexBuffer* options = _vertexBuffer->createVertexBuffer("options", 7, 4);
-
-  _vertexBuffers[VertexBuffer::PositionKindChars] = positions;
-  _vertexBuffers[VertexBuffer::ColorKindChars]    = colors;
-  _vertexBuffers["options"]                       = options;*/
-
-  // Default behaviors
-  startDirectionFunction
-    = [this](float emitPower, const Matrix& worldMatrix,
-             Vector3& directionToUpdate, Particle* /*particle*/) {
-        float randX = Math::randomNumber(direction1.x, direction2.x);
-        float randY = Math::randomNumber(direction1.y, direction2.y);
-        float randZ = Math::randomNumber(direction1.z, direction2.z);
-
-        Vector3::TransformNormalFromFloatsToRef(
-          randX * emitPower, randY * emitPower, randZ * emitPower, worldMatrix,
-          directionToUpdate);
-      };
-
-  startPositionFunction = [this](const Matrix& worldMatrix,
-                                 Vector3& positionToUpdate,
-                                 Particle* /*particle*/) {
-    float randX = Math::randomNumber(minEmitBox.x, maxEmitBox.x);
-    float randY = Math::randomNumber(minEmitBox.y, maxEmitBox.y);
-    float randZ = Math::randomNumber(minEmitBox.z, maxEmitBox.z);
-
-    Vector3::TransformCoordinatesFromFloatsToRef(randX, randY, randZ,
-                                                 worldMatrix, positionToUpdate);
-  };
-
-  updateFunction = [this](std::vector<Particle*>& _particles) {
-    for (unsigned int pIndex = 0; pIndex < _particles.size(); ++pIndex) {
-      Particle* particle = _particles[pIndex];
-      particle->age += static_cast<float>(_scaledUpdateSpeed);
-
-      if (particle->age >= particle->lifeTime) {
-        // Recycle by swapping with last particle
-        recycleParticle(particle);
-        --pIndex;
-        continue;
-      }
-      else {
-        particle->colorStep.scaleToRef(_scaledUpdateSpeed, _scaledColorStep);
-        particle->color.addInPlace(_scaledColorStep);
-
-        if (particle->color.a < 0.f) {
-          particle->color.a = 0.f;
-        }
-
-        particle->angle
-          += particle->angularSpeed * static_cast<float>(_scaledUpdateSpeed);
-
-        particle->direction.scaleToRef(_scaledUpdateSpeed, _scaledDirection);
-        particle->position.addInPlace(_scaledDirection);
-
-        gravity.scaleToRef(_scaledUpdateSpeed, _scaledGravity);
-        particle->direction.addInPlace(_scaledGravity);
-      }
-    }
+  auto colors
+    = _vertexBuffer->createVertexBuffer(VertexBuffer::ColorKind, 3, 4);
+  auto options
+    = _vertexBuffer->createVertexBuffer(VertexBuffer::OptionsKind, 7, 4);
+
+  _vertexBufferPtrs[VertexBuffer::PositionKindChars] = positions.get();
+  _vertexBufferPtrs[VertexBuffer::ColorKindChars]    = colors.get();
+  _vertexBufferPtrs[VertexBuffer::OptionsKindChars]  = options.get();
+
+  _vertexBuffers[VertexBuffer::PositionKindChars] = std::move(positions);
+  _vertexBuffers[VertexBuffer::ColorKindChars]    = std::move(colors);
+  _vertexBuffers[VertexBuffer::OptionsKindChars]  = std::move(options);
+
+  // Default behavior
+  updateFunction = [this](ParticleStore& _particles) {
+    _particles.update(_scaledUpdateSpeed, gravity, _simulationPool,
+                      parallelChunkSize);
   };
 }
 
@@ -161,15 +124,9 @@ void ParticleSystem::setOnDispose(const FastFunc<void()>& /*callback*/)
   _onDisposeObserver = onDisposeObservable.add(callback);*/
 }
 
-void ParticleSystem::recycleParticle(Particle* particle)
+void ParticleSystem::recycleParticle(size_t index)
 {
-  Particle* lastParticle = particles.back();
-  particles.pop_back();
-
-  if (lastParticle != particle) {
-    lastParticle->copyTo(*particle);
-    _stockParticles.emplace_back(lastParticle);
-  }
+  particles.remove(index);
 }
 
 size_t ParticleSystem::getCapacity() const
@@ -177,6 +134,11 @@ size_t ParticleSystem::getCapacity() const
   return _capacity;
 }
 
+size_t ParticleSystem::getActiveCount() const
+{
+  return particles.size();
+}
+
 bool ParticleSystem::isAlive() const
 {
   return _alive;
@@ -191,7 +153,7 @@ void ParticleSystem::start()
 {
   _started     = true;
   _stopped     = false;
-  _actualFrame = 0;
+  _actualFrame = 0.f;
 }
 
 void ParticleSystem::stop()
@@ -199,24 +161,6 @@ void ParticleSystem::stop()
   _stopped = true;
 }
 
-void ParticleSystem::_appendParticleVertex(unsigned int index,
-                                           Particle* particle, int offsetX,
-                                           int offsetY)
-{
-  unsigned int offset      = index * 11;
-  _vertexData[offset]      = particle->position.x;
-  _vertexData[offset + 1]  = particle->position.y;
-  _vertexData[offset + 2]  = particle->position.z;
-  _vertexData[offset + 3]  = particle->color.r;
-  _vertexData[offset + 4]  = particle->color.g;
-  _vertexData[offset + 5]  = particle->color.b;
-  _vertexData[offset + 6]  = particle->color.a;
-  _vertexData[offset + 7]  = particle->angle;
-  _vertexData[offset + 8]  = particle->size;
-  _vertexData[offset + 9]  = static_cast<float>(offsetX);
-  _vertexData[offset + 10] = static_cast<float>(offsetY);
-}
-
 void ParticleSystem::_update(int newParticles)
 {
   // Update current
@@ -224,51 +168,84 @@ void ParticleSystem::_update(int newParticles)
 
   updateFunction(particles);
 
-  // Add new ones
-  Matrix worldMatrix;
-
-  // if (emitter->position()) {
-  //  worldMatrix = *emitter->getWorldMatrix();
-  //}
-  // else {
-  // worldMatrix = Matrix::Translation(emitter->x, emitter->y, emitter->z);
-  //}
+  // Add new ones, each chunk drawing from its own random sequence so that the
+  // particles do not depend on the threads emitting them
+  const size_t first = particles.size();
+  const size_t count
+    = particles.append(static_cast<size_t>(std::max(newParticles, 0)));
+  if (count == 0) {
+    return;
+  }
 
-  for (int index = 0; index < newParticles; ++index) {
-    if (particles.size() == _capacity) {
-      break;
+  const size_t chunkSize = parallelChunkSize > 0 ? parallelChunkSize : count;
+  const uint64_t firstChunk = _emittedChunks;
+  const auto emitChunk
+    = [this, first, chunkSize, firstChunk](size_t begin, size_t end) {
+        _emit(first + begin, first + end, firstChunk + begin / chunkSize);
+      };
+  if (_simulationPool) {
+    _simulationPool->parallelFor(count, chunkSize, emitChunk);
+  }
+  else {
+    for (size_t begin = 0; begin < count; begin += chunkSize) {
+      emitChunk(begin, std::min(begin + chunkSize, count));
     }
+  }
+  _emittedChunks += (count + chunkSize - 1) / chunkSize;
+}
+
+void ParticleSystem::_emit(size_t begin, size_t end, uint64_t stream)
+{
+  Math::RandomGenerator random(randomSeed, stream);
+
+  // The new particles are initialized in a staging particle, then copied to
+  // the store
+  Particle particle;
+  Color4 colorDiff;
+  for (size_t index = begin; index < end; ++index) {
+    particle.age   = 0.f;
+    particle.angle = 0.f;
 
-    Particle* particle = nullptr;
-    if (!_stockParticles.empty()) {
-      particle = _stockParticles.back();
-      _stockParticles.pop_back();
-      particle->age = 0;
+    const float emitPower = random.randomNumber(minEmitPower, maxEmitPower);
+
+    if (startDirectionFunction) {
+      startDirectionFunction(emitPower, _emitterWorldMatrix,
+                             particle.direction, &particle);
     }
     else {
-      particle = new Particle();
+      const float randX = random.randomNumber(direction1.x, direction2.x);
+      const float randY = random.randomNumber(direction1.y, direction2.y);
+      const float randZ = random.randomNumber(direction1.z, direction2.z);
+      Vector3::TransformNormalFromFloatsToRef(
+        randX * emitPower, randY * emitPower, randZ * emitPower,
+        _emitterWorldMatrix, particle.direction);
     }
-    particles.emplace_back(particle);
-
-    float emitPower = Math::randomNumber(minEmitPower, maxEmitPower);
 
-    startDirectionFunction(emitPower, worldMatrix, particle->direction,
-                           particle);
+    particle.lifeTime = random.randomNumber(minLifeTime, maxLifeTime);
 
-    particle->lifeTime = Math::randomNumber(minLifeTime, maxLifeTime);
+    particle.size = random.randomNumber(minSize, maxSize);
+    particle.angularSpeed
+      = random.randomNumber(minAngularSpeed, maxAngularSpeed);
 
-    particle->size = Math::randomNumber(minSize, maxSize);
-    particle->angularSpeed
-      = Math::randomNumber(minAngularSpeed, maxAngularSpeed);
+    if (startPositionFunction) {
+      startPositionFunction(_emitterWorldMatrix, particle.position, &particle);
+    }
+    else {
+      const float randX = random.randomNumber(minEmitBox.x, maxEmitBox.x);
+      const float randY = random.randomNumber(minEmitBox.y, maxEmitBox.y);
+      const float randZ = random.randomNumber(minEmitBox.z, maxEmitBox.z);
+      Vector3::TransformCoordinatesFromFloatsToRef(
+        randX, randY, randZ, _emitterWorldMatrix, particle.position);
+    }
 
-    startPositionFunction(worldMatrix, particle->position, particle);
+    const float step = random.random();
 
-    float step = Math::random();
+    Color4::LerpToRef(color1, color2, step, particle.color);
 
-    Color4::LerpToRef(color1, color2, step, particle->color);
+    colorDead.subtractToRef(particle.color, colorDiff);
+    colorDiff.scaleToRef(1.f / particle.lifeTime, particle.colorStep);
 
-    colorDead.subtractToRef(particle->color, _colorDiff);
-    _colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+    particles.set(index, particle);
   }
 }
 
@@ -300,25 +277,32 @@ Effect* ParticleSystem::_getEffect()
 }
 
 void ParticleSystem::animate()
+{
+  if (_beginAnimate()) {
+    _simulate(nullptr);
+    _endAnimate();
+  }
+}
+
+bool ParticleSystem::_beginAnimate()
 {
   if (!_started)
-    return;
+    return false;
 
   Effect* effect = _getEffect();
 
   // Check
   if (!emitter || !effect->isReady() || !particleTexture
       || !particleTexture->isReady())
-    return;
+    return false;
 
   if (_currentRenderId == _scene->getRenderId()) {
-    return;
+    return false;
   }
 
   _currentRenderId = _scene->getRenderId();
 
-  _scaledUpdateSpeed
-    = static_cast<int>(updateSpeed * _scene->getAnimationRatio());
+  _scaledUpdateSpeed = updateSpeed * _scene->getAnimationRatio();
 
   // determine the number of particles we need to create
   int newParticles = 0;
@@ -329,13 +313,14 @@ void ParticleSystem::animate()
     manualEmitCount = 0;
   }
   else {
-    newParticles = ((emitRate * _scaledUpdateSpeed) >> 0);
+    newParticles = static_cast<int>(emitRate * _scaledUpdateSpeed);
     _newPartsExcess += emitRate * _scaledUpdateSpeed - newParticles;
   }
 
-  if (_newPartsExcess > 1) {
-    newParticles += _newPartsExcess >> 0;
-    _newPartsExcess -= _newPartsExcess >> 0;
+  if (_newPartsExcess > 1.f) {
+    const int excess = static_cast<int>(_newPartsExcess);
+    newParticles += excess;
+    _newPartsExcess -= excess;
   }
 
   _alive = false;
@@ -350,8 +335,39 @@ void ParticleSystem::animate()
     newParticles = 0;
   }
 
-  _update(newParticles);
+  // The world matrix is read here as the simulation may run on another thread
+  _emitterWorldMatrix  = *emitter->getWorldMatrix();
+  _pendingNewParticles = newParticles;
+
+  return true;
+}
+
+bool ParticleSystem::_isChunked() const
+{
+  return parallelChunkSize > 0
+         && particles.size() + static_cast<size_t>(_pendingNewParticles)
+              > parallelChunkSize;
+}
+
+void ParticleSystem::_simulate(ThreadPool* pool)
+{
+  _simulationPool = pool;
+  _update(_pendingNewParticles);
+  _simulationPool = nullptr;
 
+  const auto fillChunk = [this](size_t begin, size_t end) {
+    particles.fillVertexData(_vertexData.data(), begin, end);
+  };
+  if (pool && parallelChunkSize > 0 && particles.size() > parallelChunkSize) {
+    pool->parallelFor(particles.size(), parallelChunkSize, fillChunk);
+  }
+  else {
+    fillChunk(0, particles.size());
+  }
+}
+
+void ParticleSystem::_endAnimate()
+{
   // Stopped?
   if (_stopped) {
     if (!_alive) {
@@ -362,15 +378,10 @@ void ParticleSystem::animate()
     }
   }
 
-  // Update VBO
-  unsigned int offset = 0;
-  for (auto& particle : particles) {
-    _appendParticleVertex(++offset, particle, 0, 0);
-    _appendParticleVertex(++offset, particle, 1, 0);
-    _appendParticleVertex(++offset, particle, 1, 1);
-    _appendParticleVertex(++offset, particle, 0, 1);
+  // Update VBO, only the vertices of the live particles are uploaded
+  if (!particles.empty()) {
+    _vertexBuffer->updateDirectly(_vertexData, 0, particles.size() * 4);
   }
-  //_scene->getEngine()->updateDynamicVertexBuffer(_vertexBuffer, _vertices);
 }
 
 size_t ParticleSystem::render()
@@ -379,7 +390,7 @@ size_t ParticleSystem::render()
 
   // Check
   if (!emitter || !effect->isReady() || !particleTexture
-      || !particleTexture->isReady() || !particles.size()) {
+      || !particleTexture->isReady() || particles.empty()) {
     return 0;
   }
 
@@ -406,7 +417,7 @@ size_t ParticleSystem::render()
   }
 
   // VBOs
-  engine->bindBuffers(_vertexBuffers, _indexBuffer.get(), effect);
+  engine->bindBuffers(_vertexBufferPtrs, _indexBuffer.get(), effect);
 
   // Draw order
   if (blendMode == ParticleSystem::BLENDMODE_ONEONE) {
@@ -429,8 +440,8 @@ size_t ParticleSystem::render()
 void ParticleSystem::dispose(bool /*doNotRecurse*/)
 {
   if (_vertexBuffer) {
-    //_scene->getEngine()->_releaseBuffer(_vertexBuffer);
-    _vertexBuffer = nullptr;
+    _vertexBuffer->dispose();
+    _vertexBuffer.reset(nullptr);
   }
 
   if (_indexBuffer) {
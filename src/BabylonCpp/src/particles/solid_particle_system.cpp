@@ -3,6 +3,7 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/target_camera.h>
 #include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/engine/scene.h>
 #include <babylon/math/axis.h>
@@ -17,6 +18,13 @@
 
 namespace BABYLON {
 
+namespace {
+
+// Particles set by a task of the pool in setParticles()
+const unsigned int ParallelChunkSize = 1024;
+
+} // end of anonymous namespace
+
 SolidParticleSystem::SolidParticleSystem(
   const std::string& iName, Scene* scene,
   const SolidParticleSystemOptions& options)
@@ -42,6 +50,7 @@ SolidParticleSystem::SolidParticleSystem(
     , _computeParticleRotation{true}
     , _computeParticleVertex{false}
     , _computeBoundingBox{false}
+    , _parallelUpdate{false}
     , _cam_axisZ{Vector3::Zero()}
     , _cam_axisY{Vector3::Zero()}
     , _cam_axisX{Vector3::Zero()}
@@ -53,25 +62,10 @@ SolidParticleSystem::SolidParticleSystem(
     , _rotated{Vector3::Zero()}
     , _vertex{Vector3::Zero()}
     , _normal{Vector3::Zero()}
-    , _yaw{0.f}
-    , _pitch{0.f}
-    , _roll{0.f}
-    , _halfroll{0.f}
-    , _halfpitch{0.f}
-    , _halfyaw{0.f}
-    , _sinRoll{0.f}
-    , _cosRoll{0.f}
-    , _sinPitch{0.f}
-    , _cosPitch{0.f}
-    , _sinYaw{0.f}
-    , _cosYaw{0.f}
-    , _w{0.f}
-    , _minimum{Tmp::Vector3Array[0]}
-    , _maximum{Tmp::Vector3Array[1]}
-    , _scale{Tmp::Vector3Array[2]}
-    , _translation{Tmp::Vector3Array[3]}
-    , _minBbox{Tmp::Vector3Array[4]}
-    , _maxBbox{Tmp::Vector3Array[5]}
+    , _minimum{Tmp::Vector3Array()[0]}
+    , _maximum{Tmp::Vector3Array()[1]}
+    , _scale{Tmp::Vector3Array()[2]}
+    , _translation{Tmp::Vector3Array()[3]}
     , _particlesIntersect{options.particleIntersection}
 {
 }
@@ -158,7 +152,7 @@ SolidParticleSystem::digest(Mesh* _mesh,
   Uint32Array facetInd;  // submesh indices
   Float32Array facetUV;  // submesh UV
   Float32Array facetCol; // submesh colors
-  Vector3 barycenter = Tmp::Vector3Array[0];
+  Vector3 barycenter = Tmp::Vector3Array()[0];
   size_t sizeO       = size;
 
   while (f < totalFacets) {
@@ -273,12 +267,10 @@ void SolidParticleSystem::_meshBuilder(
     _quaternion.copyFrom(*_copy->rotationQuaternion);
   }
   else {
-    _yaw   = _copy->rotation.y;
-    _pitch = _copy->rotation.x;
-    _roll  = _copy->rotation.z;
-    _quaternionRotationYPR();
+    _quaternionRotationYPR(_copy->rotation.y, _copy->rotation.x,
+                           _copy->rotation.z, _quaternion);
   }
-  _quaternionToRotationMatrix();
+  _quaternionToRotationMatrix(_quaternion, _rotMatrix);
 
   for (unsigned int si = 0; si < shape.size(); ++si) {
     _vertex.x = shape[si].x;
@@ -404,11 +396,12 @@ int SolidParticleSystem::addShape(
   // particles
   unsigned int idx = nbParticles;
   for (unsigned int i = 0; i < nb; ++i) {
+    // the particle vertices start at the current end of the positions
+    const auto currentPos = static_cast<unsigned int>(_positions.size());
     _meshBuilder(_index, shape, _positions, meshInd, _indices, meshUV, _uvs,
                  meshCol, _colors, meshNor, _normals, idx, i, options);
     if (_updatable) {
-      _addParticle(idx, static_cast<unsigned int>(_positions.size()),
-                   modelShape, _shapeCounter, i, bbInfo);
+      _addParticle(idx, currentPos, modelShape, _shapeCounter, i, bbInfo);
     }
     _index += static_cast<unsigned int>(shape.size());
     idx++;
@@ -431,18 +424,16 @@ void SolidParticleSystem::_rebuildParticle(SolidParticle* particle)
     _quaternion.copyFrom(*_copy->rotationQuaternion);
   }
   else {
-    _yaw   = _copy->rotation.y;
-    _pitch = _copy->rotation.x;
-    _roll  = _copy->rotation.z;
-    _quaternionRotationYPR();
+    _quaternionRotationYPR(_copy->rotation.y, _copy->rotation.x,
+                           _copy->rotation.z, _quaternion);
   }
-  _quaternionToRotationMatrix();
+  _quaternionToRotationMatrix(_quaternion, _rotMatrix);
 
-  _shape = particle->_model->_shape;
-  for (unsigned int pt = 0; pt < _shape.size(); ++pt) {
-    _vertex.x = _shape[pt].x;
-    _vertex.y = _shape[pt].y;
-    _vertex.z = _shape[pt].z;
+  const auto& shape = particle->_model->_shape;
+  for (unsigned int pt = 0; pt < shape.size(); ++pt) {
+    _vertex.x = shape[pt].x;
+    _vertex.y = shape[pt].y;
+    _vertex.z = shape[pt].z;
 
     if (particle->_model->_vertexFunction) {
       // recall to stored vertexFunction
@@ -509,7 +500,7 @@ void SolidParticleSystem::setParticles(unsigned int start, unsigned int end,
   if (billboard) {
     // compute the camera position and un-rotate it by the current mesh rotation
     if (mesh->_worldMatrix->decompose(_scale, _quaternion, _translation)) {
-      _quaternionToRotationMatrix();
+      _quaternionToRotationMatrix(_quaternion, _rotMatrix);
       _rotMatrix.invertToRef(_invertMatrix);
       _camera->_currentTarget.subtractToRef(_camera->globalPosition(), _camDir);
       Vector3::TransformCoordinatesToRef(_camDir, _invertMatrix, _cam_axisZ);
@@ -523,15 +514,6 @@ void SolidParticleSystem::setParticles(unsigned int start, unsigned int end,
     }
   }
 
-  Matrix::IdentityToRef(_rotMatrix);
-  unsigned int idx        = 0;
-  unsigned int index      = 0;
-  unsigned int colidx     = 0;
-  unsigned int colorIndex = 0;
-  unsigned int uvidx      = 0;
-  unsigned int uvIndex    = 0;
-  unsigned int pt         = 0;
-
   if (_computeBoundingBox) {
     Vector3::FromFloatsToRef(std::numeric_limits<float>::max(),
                              std::numeric_limits<float>::max(),
@@ -541,158 +523,214 @@ void SolidParticleSystem::setParticles(unsigned int start, unsigned int end,
                              -std::numeric_limits<float>::max(), _maximum);
   }
 
-  // particle loop
+  // particle loop, split in chunks over the pool of the scene evaluation
   _end = (_end > nbParticles - 1) ? nbParticles - 1 : _end;
-  for (unsigned int p = start; p <= _end; p++) {
-    _particle = particles[p];
-    _shape    = _particle->_model->_shape;
-    _shapeUV  = _particle->_model->_shapeUV;
+  const unsigned int count
+    = (nbParticles > 0 && start <= _end) ? _end - start + 1 : 0;
+  ThreadPool* pool = _parallelUpdate ? _scene->getEvaluationPool() : nullptr;
+  if (pool && count > ParallelChunkSize) {
+    _updateRanges.resize((count + ParallelChunkSize - 1) / ParallelChunkSize);
+    pool->parallelFor(count, ParallelChunkSize,
+                      [this, start](size_t begin, size_t end) {
+                        _setParticlesRange(
+                          start + static_cast<unsigned int>(begin),
+                          start + static_cast<unsigned int>(end),
+                          _updateRanges[begin / ParallelChunkSize]);
+                      });
+  }
+  else {
+    _updateRanges.resize(1);
+    _setParticlesRange(start, start + count, _updateRanges[0]);
+  }
+
+  // merge the chunk ranges
+  size_t vertexStart = std::numeric_limits<size_t>::max();
+  size_t vertexEnd   = 0;
+  for (const auto& range : _updateRanges) {
+    vertexStart = std::min(vertexStart, range.vertexStart);
+    vertexEnd   = std::max(vertexEnd, range.vertexEnd);
+    if (_computeBoundingBox) {
+      _minimum.minimizeInPlace(range.minimum);
+      _maximum.maximizeInPlace(range.maximum);
+    }
+  }
+
+  // if the VBO must be updated : only the vertices of the set particles are
+  // uploaded
+  if (update && vertexStart < vertexEnd) {
+    const size_t vertexCount = vertexEnd - vertexStart;
+    if (_computeParticleColor) {
+      mesh->updateVerticesDataRange(VertexBuffer::ColorKind, _colors32,
+                                    vertexStart * 4, vertexCount * 4);
+    }
+    if (_computeParticleTexture) {
+      mesh->updateVerticesDataRange(VertexBuffer::UVKind, _uvs32,
+                                    vertexStart * 2, vertexCount * 2);
+    }
+    mesh->updateVerticesDataRange(VertexBuffer::PositionKind, _positions32,
+                                  vertexStart * 3, vertexCount * 3);
+    if (!mesh->areNormalsFrozen()) {
+      if (_computeParticleVertex) {
+        // recompute the normals only if the particles can be morphed, update
+        // then also the normal reference array _fixedNormal32[]
+        VertexData::ComputeNormals(_positions32, _indices, _normals32);
+        for (size_t i = 0; i < _normals32.size(); ++i) {
+          _fixedNormal32[i] = _normals32[i];
+        }
+        mesh->updateVerticesData(VertexBuffer::NormalKind, _normals32, false,
+                                 false);
+      }
+      else {
+        mesh->updateVerticesDataRange(VertexBuffer::NormalKind, _normals32,
+                                      vertexStart * 3, vertexCount * 3);
+      }
+    }
+  }
+  if (_computeBoundingBox) {
+    mesh->_boundingInfo.reset(new BoundingInfo(_minimum, _maximum));
+    // mesh->_boundingInfo->update(mesh->_worldMatrix);
+  }
+  afterUpdateParticles(start, _end, update);
+}
+
+void SolidParticleSystem::_setParticlesRange(unsigned int start,
+                                             unsigned int end,
+                                             UpdateRange& range)
+{
+  const float maxFloat = std::numeric_limits<float>::max();
+  range.minimum.copyFromFloats(maxFloat, maxFloat, maxFloat);
+  range.maximum.copyFromFloats(-maxFloat, -maxFloat, -maxFloat);
+  range.vertexStart = std::numeric_limits<size_t>::max();
+  range.vertexEnd   = 0;
+
+  // the temporaries are local as the chunks run concurrently
+  Matrix rotMatrix = Matrix::Identity();
+  Quaternion quaternion;
+  Vector3 vertex;
+  Vector3 rotated;
+  const Vector3 origin = Vector3::Zero();
+
+  // rotates the vertex by the particle rotation matrix
+  const auto rotate = [&rotMatrix, &rotated](const Vector3& v) {
+    const auto& m = rotMatrix.m;
+    const float w = (v.x * m[3]) + (v.y * m[7]) + (v.z * m[11]) + m[15];
+    rotated.x = ((v.x * m[0]) + (v.y * m[4]) + (v.z * m[8]) + m[12]) / w;
+    rotated.y = ((v.x * m[1]) + (v.y * m[5]) + (v.z * m[9]) + m[13]) / w;
+    rotated.z = ((v.x * m[2]) + (v.y * m[6]) + (v.z * m[10]) + m[14]) / w;
+  };
+  // translates the rotated vertex, expressed in the camera axes
+  const auto place = [this, &rotated](const Vector3& position, float& x,
+                                      float& y, float& z) {
+    x = position.x + _cam_axisX.x * rotated.x + _cam_axisY.x * rotated.y
+        + _cam_axisZ.x * rotated.z;
+    y = position.y + _cam_axisX.y * rotated.x + _cam_axisY.y * rotated.y
+        + _cam_axisZ.y * rotated.z;
+    z = position.z + _cam_axisX.z * rotated.x + _cam_axisY.z * rotated.y
+        + _cam_axisZ.z * rotated.z;
+  };
+  // meshes without uvs have no uv buffer
+  const bool computeParticleTexture
+    = _computeParticleTexture && !_uvs32.empty();
+
+  for (unsigned int p = start; p < end; p++) {
+    SolidParticle* particle = particles[p];
+    const auto& shape       = particle->_model->_shape;
+    const auto& shapeUV     = particle->_model->_shapeUV;
+    // the particle vertices start at its position index
+    const size_t index       = particle->_pos;
+    const size_t firstVertex = index / 3;
+    range.vertexStart        = std::min(range.vertexStart, firstVertex);
+    range.vertexEnd = std::max(range.vertexEnd, firstVertex + shape.size());
 
     // call to custom user function to update the particle properties
-    updateParticle(_particle);
+    updateParticle(particle);
 
-    if (_particle->isVisible) {
+    if (particle->isVisible) {
 
       // particle rotation matrix
       if (billboard) {
-        _particle->rotation.x = 0.f;
-        _particle->rotation.y = 0.f;
+        particle->rotation.x = 0.f;
+        particle->rotation.y = 0.f;
       }
       if (_computeParticleRotation || billboard) {
-        if (_particle->rotationQuaternion) {
-          _quaternion.copyFrom(*_particle->rotationQuaternion);
+        if (particle->rotationQuaternion) {
+          quaternion.copyFrom(*particle->rotationQuaternion);
         }
         else {
-          _yaw   = _particle->rotation.y;
-          _pitch = _particle->rotation.x;
-          _roll  = _particle->rotation.z;
-          _quaternionRotationYPR();
+          _quaternionRotationYPR(particle->rotation.y, particle->rotation.x,
+                                 particle->rotation.z, quaternion);
         }
-        _quaternionToRotationMatrix();
+        _quaternionToRotationMatrix(quaternion, rotMatrix);
       }
 
       // particle vertex loop
-      for (pt = 0; pt < _shape.size(); ++pt) {
-        idx    = index + pt * 3;
-        colidx = colorIndex + pt * 4;
-        uvidx  = uvIndex + pt * 2;
+      for (unsigned int pt = 0; pt < shape.size(); ++pt) {
+        const size_t idx    = index + pt * 3;
+        const size_t colidx = (firstVertex + pt) * 4;
+        const size_t uvidx  = (firstVertex + pt) * 2;
 
-        _vertex.x = _shape[pt].x;
-        _vertex.y = _shape[pt].y;
-        _vertex.z = _shape[pt].z;
+        vertex.x = shape[pt].x;
+        vertex.y = shape[pt].y;
+        vertex.z = shape[pt].z;
 
         if (_computeParticleVertex) {
-          updateParticleVertex(_particle, _vertex, pt);
+          vertex = updateParticleVertex(particle, vertex, pt);
         }
 
         // positions
-        _vertex.x *= _particle->scaling.x;
-        _vertex.y *= _particle->scaling.y;
-        _vertex.z *= _particle->scaling.z;
-
-        _w = (_vertex.x * _rotMatrix.m[3]) + (_vertex.y * _rotMatrix.m[7])
-             + (_vertex.z * _rotMatrix.m[11]) + _rotMatrix.m[15];
-        _rotated.x
-          = ((_vertex.x * _rotMatrix.m[0]) + (_vertex.y * _rotMatrix.m[4])
-             + (_vertex.z * _rotMatrix.m[8]) + _rotMatrix.m[12])
-            / _w;
-        _rotated.y
-          = ((_vertex.x * _rotMatrix.m[1]) + (_vertex.y * _rotMatrix.m[5])
-             + (_vertex.z * _rotMatrix.m[9]) + _rotMatrix.m[13])
-            / _w;
-        _rotated.z
-          = ((_vertex.x * _rotMatrix.m[2]) + (_vertex.y * _rotMatrix.m[6])
-             + (_vertex.z * _rotMatrix.m[10]) + _rotMatrix.m[14])
-            / _w;
-
-        _positions32[idx] = _particle->position.x + _cam_axisX.x * _rotated.x
-                            + _cam_axisY.x * _rotated.y
-                            + _cam_axisZ.x * _rotated.z;
-        _positions32[idx + 1]
-          = _particle->position.y + _cam_axisX.y * _rotated.x
-            + _cam_axisY.y * _rotated.y + _cam_axisZ.y * _rotated.z;
-        _positions32[idx + 2]
-          = _particle->position.z + _cam_axisX.z * _rotated.x
-            + _cam_axisY.z * _rotated.y + _cam_axisZ.z * _rotated.z;
+        vertex.x *= particle->scaling.x;
+        vertex.y *= particle->scaling.y;
+        vertex.z *= particle->scaling.z;
+
+        rotate(vertex);
+        place(particle->position, _positions32[idx], _positions32[idx + 1],
+              _positions32[idx + 2]);
 
         if (_computeBoundingBox) {
-          if (_positions32[idx] < _minimum.x) {
-            _minimum.x = _positions32[idx];
-          }
-          if (_positions32[idx] > _maximum.x) {
-            _maximum.x = _positions32[idx];
-          }
-          if (_positions32[idx + 1] < _minimum.y) {
-            _minimum.y = _positions32[idx + 1];
-          }
-          if (_positions32[idx + 1] > _maximum.y) {
-            _maximum.y = _positions32[idx + 1];
-          }
-          if (_positions32[idx + 2] < _minimum.z) {
-            _minimum.z = _positions32[idx + 2];
-          }
-          if (_positions32[idx + 2] > _maximum.z) {
-            _maximum.z = _positions32[idx + 2];
-          }
+          range.minimum.x = std::min(range.minimum.x, _positions32[idx]);
+          range.minimum.y = std::min(range.minimum.y, _positions32[idx + 1]);
+          range.minimum.z = std::min(range.minimum.z, _positions32[idx + 2]);
+          range.maximum.x = std::max(range.maximum.x, _positions32[idx]);
+          range.maximum.y = std::max(range.maximum.y, _positions32[idx + 1]);
+          range.maximum.z = std::max(range.maximum.z, _positions32[idx + 2]);
         }
 
         // normals : if the particles can't be morphed then just rotate the
         // normals, what if much more faster than ComputeNormals()
         if (!_computeParticleVertex) {
-          _normal.x = _fixedNormal32[idx];
-          _normal.y = _fixedNormal32[idx + 1];
-          _normal.z = _fixedNormal32[idx + 2];
-
-          _w = (_normal.x * _rotMatrix.m[3]) + (_normal.y * _rotMatrix.m[7])
-               + (_normal.z * _rotMatrix.m[11]) + _rotMatrix.m[15];
-          _rotated.x
-            = ((_normal.x * _rotMatrix.m[0]) + (_normal.y * _rotMatrix.m[4])
-               + (_normal.z * _rotMatrix.m[8]) + _rotMatrix.m[12])
-              / _w;
-          _rotated.y
-            = ((_normal.x * _rotMatrix.m[1]) + (_normal.y * _rotMatrix.m[5])
-               + (_normal.z * _rotMatrix.m[9]) + _rotMatrix.m[13])
-              / _w;
-          _rotated.z
-            = ((_normal.x * _rotMatrix.m[2]) + (_normal.y * _rotMatrix.m[6])
-               + (_normal.z * _rotMatrix.m[10]) + _rotMatrix.m[14])
-              / _w;
-
-          _normals32[idx] = _cam_axisX.x * _rotated.x
-                            + _cam_axisY.x * _rotated.y
-                            + _cam_axisZ.x * _rotated.z;
-          _normals32[idx + 1] = _cam_axisX.y * _rotated.x
-                                + _cam_axisY.y * _rotated.y
-                                + _cam_axisZ.y * _rotated.z;
-          _normals32[idx + 2] = _cam_axisX.z * _rotated.x
-                                + _cam_axisY.z * _rotated.y
-                                + _cam_axisZ.z * _rotated.z;
+          vertex.x = _fixedNormal32[idx];
+          vertex.y = _fixedNormal32[idx + 1];
+          vertex.z = _fixedNormal32[idx + 2];
+
+          rotate(vertex);
+          place(origin, _normals32[idx], _normals32[idx + 1],
+                _normals32[idx + 2]);
         }
 
         if (_computeParticleColor) {
-          _colors32[colidx]     = _particle->color->r;
-          _colors32[colidx + 1] = _particle->color->g;
-          _colors32[colidx + 2] = _particle->color->b;
-          _colors32[colidx + 3] = _particle->color->a;
+          _colors32[colidx]     = particle->color->r;
+          _colors32[colidx + 1] = particle->color->g;
+          _colors32[colidx + 2] = particle->color->b;
+          _colors32[colidx + 3] = particle->color->a;
         }
 
-        if (_computeParticleTexture) {
+        if (computeParticleTexture) {
           _uvs32[uvidx]
-            = _shapeUV[pt * 2] * (_particle->uvs.z - _particle->uvs.x)
-              + _particle->uvs.x;
+            = shapeUV[pt * 2] * (particle->uvs.z - particle->uvs.x)
+              + particle->uvs.x;
           _uvs32[uvidx + 1]
-            = _shapeUV[pt * 2 + 1] * (_particle->uvs.w - _particle->uvs.y)
-              + _particle->uvs.y;
+            = shapeUV[pt * 2 + 1] * (particle->uvs.w - particle->uvs.y)
+              + particle->uvs.y;
         }
       }
     }
     // particle not visible : scaled to zero and positioned to the camera
     // position
     else {
-      for (pt = 0; pt < _shape.size(); ++pt) {
-        idx                   = index + pt * 3;
-        colidx                = colorIndex + pt * 4;
-        uvidx                 = uvIndex + pt * 2;
+      for (unsigned int pt = 0; pt < shape.size(); ++pt) {
+        const size_t idx      = index + pt * 3;
+        const size_t colidx   = (firstVertex + pt) * 4;
+        const size_t uvidx    = (firstVertex + pt) * 2;
         _positions32[idx]     = _camera->position.x;
         _positions32[idx + 1] = _camera->position.y;
         _positions32[idx + 2] = _camera->position.z;
@@ -700,179 +738,101 @@ void SolidParticleSystem::setParticles(unsigned int start, unsigned int end,
         _normals32[idx + 1]   = 0.f;
         _normals32[idx + 2]   = 0.f;
         if (_computeParticleColor) {
-          _colors32[colidx]     = _particle->color->r;
-          _colors32[colidx + 1] = _particle->color->g;
-          _colors32[colidx + 2] = _particle->color->b;
-          _colors32[colidx + 3] = _particle->color->a;
+          _colors32[colidx]     = particle->color->r;
+          _colors32[colidx + 1] = particle->color->g;
+          _colors32[colidx + 2] = particle->color->b;
+          _colors32[colidx + 3] = particle->color->a;
         }
-        if (_computeParticleTexture) {
+        if (computeParticleTexture) {
           _uvs32[uvidx]
-            = _shapeUV[pt * 2] * (_particle->uvs.z - _particle->uvs.x)
-              + _particle->uvs.x;
+            = shapeUV[pt * 2] * (particle->uvs.z - particle->uvs.x)
+              + particle->uvs.x;
           _uvs32[uvidx + 1]
-            = _shapeUV[pt * 2 + 1] * (_particle->uvs.w - _particle->uvs.y)
-              + _particle->uvs.y;
+            = shapeUV[pt * 2 + 1] * (particle->uvs.w - particle->uvs.y)
+              + particle->uvs.y;
         }
       }
     }
 
     // if the particle intersections must be computed : update the bbInfo
     if (_particlesIntersect) {
-      BoundingInfo* bInfo     = _particle->_boundingInfo;
-      BoundingBox& bBox       = bInfo->boundingBox;
-      BoundingSphere& bSphere = bInfo->boundingSphere;
+      BoundingInfo* bInfo       = particle->_boundingInfo;
+      BoundingBox& bBox         = bInfo->boundingBox;
+      BoundingSphere& bSphere   = bInfo->boundingSphere;
+      const BoundingInfo& model = *particle->_modelBoundingInfo;
       if (!_bSphereOnly) {
         // place, scale and rotate the particle bbox within the SPS local
         // system, then update it
         for (size_t b = 0; b < bBox.vectors.size(); ++b) {
-          _vertex.x = _particle->_modelBoundingInfo->boundingBox.vectors[b].x
-                      * _particle->scaling.x;
-          _vertex.y = _particle->_modelBoundingInfo->boundingBox.vectors[b].y
-                      * _particle->scaling.y;
-          _vertex.z = _particle->_modelBoundingInfo->boundingBox.vectors[b].z
-                      * _particle->scaling.z;
-          _w = (_vertex.x * _rotMatrix.m[3]) + (_vertex.y * _rotMatrix.m[7])
-               + (_vertex.z * _rotMatrix.m[11]) + _rotMatrix.m[15];
-          _rotated.x
-            = ((_vertex.x * _rotMatrix.m[0]) + (_vertex.y * _rotMatrix.m[4])
-               + (_vertex.z * _rotMatrix.m[8]) + _rotMatrix.m[12])
-              / _w;
-          _rotated.y
-            = ((_vertex.x * _rotMatrix.m[1]) + (_vertex.y * _rotMatrix.m[5])
-               + (_vertex.z * _rotMatrix.m[9]) + _rotMatrix.m[13])
-              / _w;
-          _rotated.z
-            = ((_vertex.x * _rotMatrix.m[2]) + (_vertex.y * _rotMatrix.m[6])
-               + (_vertex.z * _rotMatrix.m[10]) + _rotMatrix.m[14])
-              / _w;
-          bBox.vectors[b].x = _particle->position.x + _cam_axisX.x * _rotated.x
-                              + _cam_axisY.x * _rotated.y
-                              + _cam_axisZ.x * _rotated.z;
-          bBox.vectors[b].y = _particle->position.y + _cam_axisX.y * _rotated.x
-                              + _cam_axisY.y * _rotated.y
-                              + _cam_axisZ.y * _rotated.z;
-          bBox.vectors[b].z = _particle->position.z + _cam_axisX.z * _rotated.x
-                              + _cam_axisY.z * _rotated.y
-                              + _cam_axisZ.z * _rotated.z;
+          vertex.x = model.boundingBox.vectors[b].x * particle->scaling.x;
+          vertex.y = model.boundingBox.vectors[b].y * particle->scaling.y;
+          vertex.z = model.boundingBox.vectors[b].z * particle->scaling.z;
+          rotate(vertex);
+          place(particle->position, bBox.vectors[b].x, bBox.vectors[b].y,
+                bBox.vectors[b].z);
         }
         bBox._update(*mesh->_worldMatrix);
       }
       // place and scale the particle bouding sphere in the SPS local system,
       // then update it
-      _minBbox.x
-        = _particle->_modelBoundingInfo->minimum.x * _particle->scaling.x;
-      _minBbox.y
-        = _particle->_modelBoundingInfo->minimum.y * _particle->scaling.y;
-      _minBbox.z
-        = _particle->_modelBoundingInfo->minimum.z * _particle->scaling.z;
-      _maxBbox.x
-        = _particle->_modelBoundingInfo->maximum.x * _particle->scaling.x;
-      _maxBbox.y
-        = _particle->_modelBoundingInfo->maximum.y * _particle->scaling.y;
-      _maxBbox.z
-        = _particle->_modelBoundingInfo->maximum.z * _particle->scaling.z;
-      bSphere.center.x
-        = _particle->position.x + (_minBbox.x + _maxBbox.x) * 0.5f;
-      bSphere.center.y
-        = _particle->position.y + (_minBbox.y + _maxBbox.y) * 0.5f;
-      bSphere.center.z
-        = _particle->position.z + (_minBbox.z + _maxBbox.z) * 0.5f;
+      const Vector3 minBbox = model.minimum.multiply(particle->scaling);
+      const Vector3 maxBbox = model.maximum.multiply(particle->scaling);
+      bSphere.center.x = particle->position.x + (minBbox.x + maxBbox.x) * 0.5f;
+      bSphere.center.y = particle->position.y + (minBbox.y + maxBbox.y) * 0.5f;
+      bSphere.center.z = particle->position.z + (minBbox.z + maxBbox.z) * 0.5f;
       bSphere.radius
         = _bSphereRadiusFactor * 0.5f
-          * std::sqrt((_maxBbox.x - _minBbox.x) * (_maxBbox.x - _minBbox.x)
-                      + (_maxBbox.y - _minBbox.y) * (_maxBbox.y - _minBbox.y)
-                      + (_maxBbox.z - _minBbox.z) * (_maxBbox.z - _minBbox.z));
+          * std::sqrt((maxBbox.x - minBbox.x) * (maxBbox.x - minBbox.x)
+                      + (maxBbox.y - minBbox.y) * (maxBbox.y - minBbox.y)
+                      + (maxBbox.z - minBbox.z) * (maxBbox.z - minBbox.z));
       bSphere._update(*mesh->_worldMatrix);
     }
-
-    // increment indexes for the next particle
-    index      = idx + 3;
-    colorIndex = colidx + 4;
-    uvIndex    = uvidx + 2;
-  }
-
-  // if the VBO must be updated
-  if (update) {
-    if (_computeParticleColor) {
-      mesh->updateVerticesData(VertexBuffer::ColorKind, _colors32, false,
-                               false);
-    }
-    if (_computeParticleTexture) {
-      mesh->updateVerticesData(VertexBuffer::UVKind, _uvs32, false, false);
-    }
-    mesh->updateVerticesData(VertexBuffer::PositionKind, _positions32, false,
-                             false);
-    if (!mesh->areNormalsFrozen()) {
-      if (_computeParticleVertex) {
-        // recompute the normals only if the particles can be morphed, update
-        // then also the normal reference array _fixedNormal32[]
-        VertexData::ComputeNormals(_positions32, _indices, _normals32);
-        for (size_t i = 0; i < _normals32.size(); ++i) {
-          _fixedNormal32[i] = _normals32[i];
-        }
-      }
-      mesh->updateVerticesData(VertexBuffer::NormalKind, _normals32, false,
-                               false);
-    }
-  }
-  if (_computeBoundingBox) {
-    mesh->_boundingInfo.reset(new BoundingInfo(_minimum, _maximum));
-    // mesh->_boundingInfo->update(mesh->_worldMatrix);
   }
-  afterUpdateParticles(start, _end, update);
 }
 
-void SolidParticleSystem::_quaternionRotationYPR()
-{
-  _halfroll  = _roll * 0.5f;
-  _halfpitch = _pitch * 0.5f;
-  _halfyaw   = _yaw * 0.5f;
-  _sinRoll   = std::sin(_halfroll);
-  _cosRoll   = std::cos(_halfroll);
-  _sinPitch  = std::sin(_halfpitch);
-  _cosPitch  = std::cos(_halfpitch);
-  _sinYaw    = std::sin(_halfyaw);
-  _cosYaw    = std::cos(_halfyaw);
-  _quaternion.x
-    = (_cosYaw * _sinPitch * _cosRoll) + (_sinYaw * _cosPitch * _sinRoll);
-  _quaternion.y
-    = (_sinYaw * _cosPitch * _cosRoll) - (_cosYaw * _sinPitch * _sinRoll);
-  _quaternion.z
-    = (_cosYaw * _cosPitch * _sinRoll) - (_sinYaw * _sinPitch * _cosRoll);
-  _quaternion.w
-    = (_cosYaw * _cosPitch * _cosRoll) + (_sinYaw * _sinPitch * _sinRoll);
-}
-
-void SolidParticleSystem::_quaternionToRotationMatrix()
-{
-  _rotMatrix.m[0]
-    = 1.f
-      - (2.f * (_quaternion.y * _quaternion.y + _quaternion.z * _quaternion.z));
-  _rotMatrix.m[1]
-    = 2.f * (_quaternion.x * _quaternion.y + _quaternion.z * _quaternion.w);
-  _rotMatrix.m[2]
-    = 2.f * (_quaternion.z * _quaternion.x - _quaternion.y * _quaternion.w);
-  _rotMatrix.m[3] = 0.f;
-  _rotMatrix.m[4]
-    = 2.f * (_quaternion.x * _quaternion.y - _quaternion.z * _quaternion.w);
-  _rotMatrix.m[5]
-    = 1.f
-      - (2.f * (_quaternion.z * _quaternion.z + _quaternion.x * _quaternion.x));
-  _rotMatrix.m[6]
-    = 2.f * (_quaternion.y * _quaternion.z + _quaternion.x * _quaternion.w);
-  _rotMatrix.m[7] = 0.f;
-  _rotMatrix.m[8]
-    = 2.f * (_quaternion.z * _quaternion.x + _quaternion.y * _quaternion.w);
-  _rotMatrix.m[9]
-    = 2.f * (_quaternion.y * _quaternion.z - _quaternion.x * _quaternion.w);
-  _rotMatrix.m[10]
-    = 1.f
-      - (2.f * (_quaternion.y * _quaternion.y + _quaternion.x * _quaternion.x));
-  _rotMatrix.m[11] = 0.f;
-  _rotMatrix.m[12] = 0.f;
-  _rotMatrix.m[13] = 0.f;
-  _rotMatrix.m[14] = 0.f;
-  _rotMatrix.m[15] = 1.f;
+void SolidParticleSystem::_quaternionRotationYPR(float yaw, float pitch,
+                                                 float roll,
+                                                 Quaternion& quaternion)
+{
+  const float halfroll  = roll * 0.5f;
+  const float halfpitch = pitch * 0.5f;
+  const float halfyaw   = yaw * 0.5f;
+  const float sinRoll   = std::sin(halfroll);
+  const float cosRoll   = std::cos(halfroll);
+  const float sinPitch  = std::sin(halfpitch);
+  const float cosPitch  = std::cos(halfpitch);
+  const float sinYaw    = std::sin(halfyaw);
+  const float cosYaw    = std::cos(halfyaw);
+  quaternion.x = (cosYaw * sinPitch * cosRoll) + (sinYaw * cosPitch * sinRoll);
+  quaternion.y = (sinYaw * cosPitch * cosRoll) - (cosYaw * sinPitch * sinRoll);
+  quaternion.z = (cosYaw * cosPitch * sinRoll) - (sinYaw * sinPitch * cosRoll);
+  quaternion.w = (cosYaw * cosPitch * cosRoll) + (sinYaw * sinPitch * sinRoll);
+}
+
+void SolidParticleSystem::_quaternionToRotationMatrix(
+  const Quaternion& quaternion, Matrix& rotMatrix)
+{
+  const float x = quaternion.x;
+  const float y = quaternion.y;
+  const float z = quaternion.z;
+  const float w = quaternion.w;
+
+  rotMatrix.m[0]  = 1.f - (2.f * (y * y + z * z));
+  rotMatrix.m[1]  = 2.f * (x * y + z * w);
+  rotMatrix.m[2]  = 2.f * (z * x - y * w);
+  rotMatrix.m[3]  = 0.f;
+  rotMatrix.m[4]  = 2.f * (x * y - z * w);
+  rotMatrix.m[5]  = 1.f - (2.f * (z * z + x * x));
+  rotMatrix.m[6]  = 2.f * (y * z + x * w);
+  rotMatrix.m[7]  = 0.f;
+  rotMatrix.m[8]  = 2.f * (z * x + y * w);
+  rotMatrix.m[9]  = 2.f * (y * z - x * w);
+  rotMatrix.m[10] = 1.f - (2.f * (y * y + x * x));
+  rotMatrix.m[11] = 0.f;
+  rotMatrix.m[12] = 0.f;
+  rotMatrix.m[13] = 0.f;
+  rotMatrix.m[14] = 0.f;
+  rotMatrix.m[15] = 1.f;
 }
 
 void SolidParticleSystem::dispose(bool /*doNotRecurse*/)
@@ -953,6 +913,11 @@ void SolidParticleSystem::setComputeBoundingBox(bool val)
   _computeBoundingBox = val;
 }
 
+void SolidParticleSystem::setParallelUpdate(bool val)
+{
+  _parallelUpdate = val;
+}
+
 bool SolidParticleSystem::computeParticleRotation() const
 {
   return _computeParticleRotation;
@@ -978,6 +943,11 @@ bool SolidParticleSystem::computeBoundingBox() const
   return _computeBoundingBox;
 }
 
+bool SolidParticleSystem::parallelUpdate() const
+{
+  return _parallelUpdate;
+}
+
 void SolidParticleSystem::initParticles()
 {
 }
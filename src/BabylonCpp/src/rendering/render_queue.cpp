@@ -0,0 +1,171 @@
+#include <babylon/rendering/render_queue.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_sphere.h>
+#include <babylon/materials/material.h>
+#include <babylon/mesh/abstract_mesh.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+
+namespace BABYLON {
+
+RenderQueue::RenderQueue()
+{
+}
+
+RenderQueue::~RenderQueue()
+{
+}
+
+size_t RenderQueue::size() const
+{
+  return _entries.size();
+}
+
+bool RenderQueue::empty() const
+{
+  return _entries.empty();
+}
+
+const std::vector<SubMesh*>& RenderQueue::subMeshes() const
+{
+  return _subMeshes;
+}
+
+void RenderQueue::clear()
+{
+  _entries.clear();
+  _subMeshes.clear();
+  _materialIndices.clear();
+  _geometryIndices.clear();
+}
+
+void RenderQueue::push(uint64_t key, SubMesh* subMesh)
+{
+  _entries.emplace_back(Entry{key, subMesh});
+}
+
+void RenderQueue::push(unsigned int renderingGroupId, Pass pass,
+                       SubMesh* subMesh, const Vector3& cameraPosition)
+{
+  const auto& center = subMesh->getBoundingInfo()->boundingSphere.centerWorld;
+
+  const float dx           = center.x - cameraPosition.x;
+  const float dy           = center.y - cameraPosition.y;
+  const float dz           = center.z - cameraPosition.z;
+  const float squaredDepth = dx * dx + dy * dy + dz * dz;
+
+  auto material         = subMesh->getMaterial();
+  const auto materialId = material ? material->uniqueId : 0u;
+  if (pass == Pass::TRANSPARENT_PASS) {
+    const auto materialIndex
+      = _DenseIndex(_materialIndices, materialId, 0x3FFFF);
+    push(RenderQueue::TransparentKey(renderingGroupId,
+                                     subMesh->getMesh()->alphaIndex,
+                                     squaredDepth, materialIndex),
+         subMesh);
+  }
+  else {
+    auto geometry         = subMesh->getRenderingMesh()->geometry();
+    const auto geometryId = geometry ? geometry->uniqueId : 0u;
+    const auto materialIndex
+      = _DenseIndex(_materialIndices, materialId, 0x1FFFF);
+    const auto geometryIndex
+      = _DenseIndex(_geometryIndices, geometryId, 0x1FFFF);
+    push(RenderQueue::OpaqueKey(renderingGroupId, pass, materialIndex,
+                                geometryIndex, squaredDepth),
+         subMesh);
+  }
+}
+
+void RenderQueue::sort()
+{
+  const size_t count = _entries.size();
+
+  // Histograms of the 8 key bytes, computed in a single pass
+  std::array<std::array<size_t, 256>, 8> histograms;
+  for (auto& histogram : histograms) {
+    histogram.fill(0);
+  }
+  for (const auto& entry : _entries) {
+    for (unsigned int byte = 0; byte < 8; ++byte) {
+      ++histograms[byte][(entry.key >> (byte * 8)) & 0xFF];
+    }
+  }
+
+  _scratch.resize(count);
+  for (unsigned int byte = 0; byte < 8 && count > 1; ++byte) {
+    auto& histogram = histograms[byte];
+    // All the keys share this digit, the pass would not move anything
+    if (histogram[(_entries[0].key >> (byte * 8)) & 0xFF] == count) {
+      continue;
+    }
+
+    size_t offset = 0;
+    for (auto& bucket : histogram) {
+      const size_t bucketSize = bucket;
+      bucket                  = offset;
+      offset += bucketSize;
+    }
+    for (const auto& entry : _entries) {
+      _scratch[histogram[(entry.key >> (byte * 8)) & 0xFF]++] = entry;
+    }
+    _entries.swap(_scratch);
+  }
+
+  _subMeshes.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    _subMeshes[i] = _entries[i].subMesh;
+  }
+}
+
+uint64_t RenderQueue::OpaqueKey(unsigned int renderingGroupId, Pass pass,
+                                uint32_t materialIndex, uint32_t geometryIndex,
+                                float squaredDepth)
+{
+  return (static_cast<uint64_t>(renderingGroupId & 0xF) << 60)
+         | (static_cast<uint64_t>(pass) << 58)
+         | (static_cast<uint64_t>(materialIndex & 0x1FFFF) << 41)
+         | (static_cast<uint64_t>(geometryIndex & 0x1FFFF) << 24)
+         | static_cast<uint64_t>(RenderQueue::QuantizeDepth(squaredDepth));
+}
+
+uint64_t RenderQueue::TransparentKey(unsigned int renderingGroupId,
+                                     int alphaIndex, float squaredDepth,
+                                     uint32_t materialIndex)
+{
+  // Lower alpha indices first, then back to front
+  const auto clampedAlphaIndex = static_cast<uint64_t>(
+    std::min(std::max(alphaIndex, 0), static_cast<int>(0xFFFF)));
+  const auto invertedDepth = static_cast<uint64_t>(
+    0xFFFFFF - RenderQueue::QuantizeDepth(squaredDepth));
+  return (static_cast<uint64_t>(renderingGroupId & 0xF) << 60)
+         | (static_cast<uint64_t>(Pass::TRANSPARENT_PASS) << 58)
+         | (clampedAlphaIndex << 42) | (invertedDepth << 18)
+         | static_cast<uint64_t>(materialIndex & 0x3FFFF);
+}
+
+uint32_t RenderQueue::QuantizeDepth(float squaredDepth)
+{
+  if (!(squaredDepth > 0.f)) {
+    return 0;
+  }
+
+  // The bit patterns of positive floats have the same order as their values,
+  // keep the exponent and the 16 most significant bits of the mantissa
+  uint32_t bits;
+  std::memcpy(&bits, &squaredDepth, sizeof(bits));
+  return bits >> 7;
+}
+
+uint32_t
+RenderQueue::_DenseIndex(std::unordered_map<unsigned int, uint32_t>& indices,
+                         unsigned int uniqueId, uint32_t maxIndex)
+{
+  const auto nextIndex = static_cast<uint32_t>(indices.size());
+  const auto index     = indices.emplace(uniqueId, nextIndex).first->second;
+  return std::min(index, maxIndex);
+}
+
+} // end of namespace BABYLON
@@ -5,8 +5,10 @@
 #include <babylon/culling/bounding_sphere.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
+#include <babylon/lights/light.h>
 #include <babylon/materials/material.h>
 #include <babylon/mesh/abstract_mesh.h>
+#include <babylon/mesh/mesh.h>
 #include <babylon/mesh/sub_mesh.h>
 
 namespace BABYLON {
@@ -19,6 +21,9 @@ RenderingGroup::RenderingGroup(
     : index{iIndex}
     , onBeforeTransparentRendering{nullptr}
     , _scene{scene}
+    , _autoInstancing{false}
+    , _useSortKeys{false}
+    , _customTransparentSort{false}
 {
   _opaqueSubMeshes.reserve(256);
   _transparentSubMeshes.reserve(256);
@@ -44,7 +49,15 @@ void RenderingGroup::setOpaqueSortCompareFn(
   }
   else {
     _renderOpaque = [this](const std::vector<SubMesh*>& subMeshes) {
-      RenderingGroup::renderUnsorted(subMeshes);
+      if (_autoInstancing) {
+        renderAutoInstanced(subMeshes);
+      }
+      else if (_useSortKeys) {
+        renderSortKeyed(subMeshes, RenderQueue::Pass::OPAQUE_PASS);
+      }
+      else {
+        RenderingGroup::renderUnsorted(subMeshes);
+      }
     };
   }
 }
@@ -60,7 +73,15 @@ void RenderingGroup::setAlphaTestSortCompareFn(
   }
   else {
     _renderAlphaTest = [this](const std::vector<SubMesh*>& subMeshes) {
-      RenderingGroup::renderUnsorted(subMeshes);
+      if (_autoInstancing) {
+        renderAutoInstanced(subMeshes);
+      }
+      else if (_useSortKeys) {
+        renderSortKeyed(subMeshes, RenderQueue::Pass::ALPHATEST_PASS);
+      }
+      else {
+        RenderingGroup::renderUnsorted(subMeshes);
+      }
     };
   }
 }
@@ -68,6 +89,7 @@ void RenderingGroup::setAlphaTestSortCompareFn(
 void RenderingGroup::setTransparentSortCompareFn(
   const std::function<int(SubMesh* a, SubMesh* b)>& value)
 {
+  _customTransparentSort = static_cast<bool>(value);
   if (value) {
     _transparentSortCompareFn = value;
   }
@@ -77,10 +99,25 @@ void RenderingGroup::setTransparentSortCompareFn(
     };
   }
   _renderTransparent = [this](const std::vector<SubMesh*>& subMeshes) {
-    renderTransparentSorted(subMeshes);
+    if (_useSortKeys && !_customTransparentSort) {
+      renderSortKeyed(subMeshes, RenderQueue::Pass::TRANSPARENT_PASS);
+    }
+    else {
+      renderTransparentSorted(subMeshes);
+    }
   };
 }
 
+void RenderingGroup::setAutoInstancing(bool value)
+{
+  _autoInstancing = value;
+}
+
+void RenderingGroup::setUseSortKeys(bool value)
+{
+  _useSortKeys = value;
+}
+
 bool RenderingGroup::render(
   std::function<void(const std::vector<SubMesh*>& opaqueSubMeshes,
                      const std::vector<SubMesh*>& transparentSubMeshes,
@@ -172,6 +209,95 @@ void RenderingGroup::renderUnsorted(const std::vector<SubMesh*>& subMeshes)
   }
 }
 
+void RenderingGroup::renderSortKeyed(const std::vector<SubMesh*>& subMeshes,
+                                     RenderQueue::Pass pass)
+{
+  const auto& cameraPosition = _scene->activeCamera->globalPosition();
+
+  _renderQueue.clear();
+  for (auto& subMesh : subMeshes) {
+    _renderQueue.push(index, pass, subMesh, cameraPosition);
+  }
+  _renderQueue.sort();
+
+  const bool transparent = (pass == RenderQueue::Pass::TRANSPARENT_PASS);
+  for (auto& subMesh : _renderQueue.subMeshes()) {
+    subMesh->render(transparent);
+  }
+}
+
+void RenderingGroup::renderAutoInstanced(
+  const std::vector<SubMesh*>& subMeshes)
+{
+  if (subMeshes.size() < 2
+      || !_scene->getEngine()->getCaps().instancedArrays) {
+    RenderingGroup::renderUnsorted(subMeshes);
+    return;
+  }
+
+  // Lights are bound per mesh, batching is only valid when all the meshes
+  // are affected by the same lights
+  for (auto& light : _scene->lights) {
+    if (!light->includedOnlyMeshes.empty() || !light->excludedMeshes.empty()) {
+      RenderingGroup::renderUnsorted(subMeshes);
+      return;
+    }
+  }
+
+  _batchableSubMeshes.clear();
+  for (auto& subMesh : subMeshes) {
+    if (RenderingGroup::_isBatchable(subMesh)) {
+      _batchableSubMeshes.emplace_back(subMesh);
+    }
+    else {
+      subMesh->render(false);
+    }
+  }
+
+  // Group the sub meshes with the same key, keeping their dispatch order
+  std::stable_sort(_batchableSubMeshes.begin(), _batchableSubMeshes.end(),
+                   RenderingGroup::_batchKeyLess);
+
+  for (size_t start = 0; start < _batchableSubMeshes.size();) {
+    auto leader = _batchableSubMeshes[start];
+    size_t end  = start + 1;
+    while (end < _batchableSubMeshes.size()
+           && !RenderingGroup::_batchKeyLess(leader,
+                                             _batchableSubMeshes[end])) {
+      ++end;
+    }
+
+    _batchedSubMeshes.assign(_batchableSubMeshes.begin() + start + 1,
+                             _batchableSubMeshes.begin() + end);
+    leader->getRenderingMesh()->renderBatched(leader, _batchedSubMeshes,
+                                              false);
+    start = end;
+  }
+}
+
+bool RenderingGroup::_isBatchable(SubMesh* subMesh)
+{
+  auto mesh = subMesh->getRenderingMesh();
+  return (static_cast<AbstractMesh*>(mesh) == subMesh->getMesh())
+         && mesh->_isAutoInstancingCandidate();
+}
+
+bool RenderingGroup::_batchKeyLess(SubMesh* a, SubMesh* b)
+{
+  auto meshA = a->getMesh();
+  auto meshB = b->getMesh();
+  return std::make_tuple(a->getRenderingMesh()->geometry(), a->getMaterial(),
+                         a->indexStart, a->indexCount, a->verticesStart,
+                         a->verticesCount, meshA->layerMask,
+                         meshA->receiveShadows, meshA->applyFog,
+                         meshA->useVertexColors)
+         < std::make_tuple(b->getRenderingMesh()->geometry(),
+                           b->getMaterial(), b->indexStart, b->indexCount,
+                           b->verticesStart, b->verticesCount,
+                           meshB->layerMask, meshB->receiveShadows,
+                           meshB->applyFog, meshB->useVertexColors);
+}
+
 int RenderingGroup::defaultTransparentSortCompare(SubMesh* a, SubMesh* b)
 {
   // Alpha index first
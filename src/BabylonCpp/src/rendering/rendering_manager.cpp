@@ -16,6 +16,8 @@ RenderingManager::RenderingManager(Scene* scene)
     , _renderinGroupInfo{nullptr}
 {
   _autoClearDepthStencil.resize(MAX_RENDERINGGROUPS);
+  _autoInstancing.resize(MAX_RENDERINGGROUPS);
+  _useSortKeys.resize(MAX_RENDERINGGROUPS);
   _customOpaqueSortCompareFn.resize(MAX_RENDERINGGROUPS);
   _customAlphaTestSortCompareFn.resize(MAX_RENDERINGGROUPS);
   _customTransparentSortCompareFn.resize(MAX_RENDERINGGROUPS);
@@ -23,6 +25,8 @@ RenderingManager::RenderingManager(Scene* scene)
   for (unsigned int i = RenderingManager::MIN_RENDERINGGROUPS;
        i < RenderingManager::MAX_RENDERINGGROUPS; ++i) {
     _autoClearDepthStencil[i]          = true;
+    _autoInstancing[i]                 = false;
+    _useSortKeys[i]                    = false;
     _customOpaqueSortCompareFn[i]      = nullptr;
     _customAlphaTestSortCompareFn[i]   = nullptr;
     _customTransparentSortCompareFn[i] = nullptr;
@@ -241,6 +245,10 @@ void RenderingManager::dispatch(SubMesh* subMesh)
         renderingGroupId, _scene, _customOpaqueSortCompareFn[renderingGroupId],
         _customAlphaTestSortCompareFn[renderingGroupId],
         _customTransparentSortCompareFn[renderingGroupId]));
+    _renderingGroups[renderingGroupId]->setAutoInstancing(
+      _autoInstancing[renderingGroupId]);
+    _renderingGroups[renderingGroupId]->setUseSortKeys(
+      _useSortKeys[renderingGroupId]);
   }
 
   _renderingGroups[renderingGroupId]->dispatch(subMesh);
@@ -272,4 +280,26 @@ void RenderingManager::setRenderingAutoClearDepthStencil(
   _autoClearDepthStencil[renderingGroupId] = autoClearDepthStencil;
 }
 
+void RenderingManager::setRenderingAutoInstancing(
+  unsigned int renderingGroupId, bool autoInstancing)
+{
+  _autoInstancing[renderingGroupId] = autoInstancing;
+
+  if (renderingGroupId < _renderingGroups.size()
+      && _renderingGroups[renderingGroupId]) {
+    _renderingGroups[renderingGroupId]->setAutoInstancing(autoInstancing);
+  }
+}
+
+void RenderingManager::setRenderingSortKeys(unsigned int renderingGroupId,
+                                            bool useSortKeys)
+{
+  _useSortKeys[renderingGroupId] = useSortKeys;
+
+  if (renderingGroupId < _renderingGroups.size()
+      && _renderingGroups[renderingGroupId]) {
+    _renderingGroups[renderingGroupId]->setUseSortKeys(useSortKeys);
+  }
+}
+
 } // end of namespace BABYLON
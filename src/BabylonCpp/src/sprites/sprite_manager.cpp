@@ -173,7 +173,7 @@ void SpriteManager::_appendSpriteVertex(size_t index, Sprite* sprite,
   _vertexData[arrayOffset + 15] = sprite->color->a;
 }
 
-PickingInfo*
+std::unique_ptr<PickingInfo>
 SpriteManager::intersects(const Ray ray, Camera* camera,
                           std::function<bool(Sprite* sprite)> predicate,
                           bool fastCheck)
@@ -228,7 +228,7 @@ SpriteManager::intersects(const Ray ray, Camera* camera,
   }
 
   if (currentSprite) {
-    PickingInfo* result = new PickingInfo();
+    auto result = std_util::make_unique<PickingInfo>();
 
     result->hit          = true;
     result->pickedSprite = currentSprite;
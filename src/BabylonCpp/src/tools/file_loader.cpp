@@ -0,0 +1,320 @@
+#include <babylon/tools/file_loader.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/string.h>
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BABYLON {
+
+FileData::FileData() : _mapping{nullptr}, _mappingSize{0}
+{
+}
+
+FileData::FileData(std::string&& buffer)
+    : _buffer{std::move(buffer)}, _mapping{nullptr}, _mappingSize{0}
+{
+}
+
+FileData::~FileData()
+{
+#ifdef __unix__
+  if (_mapping) {
+    ::munmap(const_cast<char*>(_mapping), _mappingSize);
+  }
+#endif
+}
+
+const char* FileData::data() const
+{
+  return _mapping ? _mapping : _buffer.data();
+}
+
+size_t FileData::size() const
+{
+  return _mapping ? _mappingSize : _buffer.size();
+}
+
+bool FileData::isMapped() const
+{
+  return _mapping != nullptr;
+}
+
+std::string FileData::toString() const
+{
+  return std::string(data(), size());
+}
+
+std::string FileData::releaseString()
+{
+  return _mapping ? toString() : std::move(_buffer);
+}
+
+std::shared_ptr<FileData> FileData::Map(const std::string& path,
+                                        std::string& error)
+{
+#ifdef __unix__
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    error = "Unable to open the file " + path;
+    return nullptr;
+  }
+
+  struct stat buffer;
+  if (::fstat(fd, &buffer) != 0) {
+    ::close(fd);
+    error = "Unable to read the file " + path;
+    return nullptr;
+  }
+
+  // An empty file has nothing to map
+  auto fileData = std::make_shared<FileData>();
+  const auto size = static_cast<size_t>(buffer.st_size);
+  if (size > 0) {
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      ::close(fd);
+      error = "Unable to map the file " + path;
+      return nullptr;
+    }
+    fileData->_mapping     = static_cast<const char*>(mapping);
+    fileData->_mappingSize = size;
+  }
+  ::close(fd);
+
+  return fileData;
+#else
+  // Without mapping support the file is read in a buffer
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (!file) {
+    error = "Unable to open the file " + path;
+    return nullptr;
+  }
+
+  return std::make_shared<FileData>(
+    Filesystem::readFileContents(path.c_str()));
+#endif
+}
+
+FileLoader::FileLoader(size_t maxConcurrentLoads)
+    : chunkSize{1 << 20}
+    , _maxConcurrentLoads{std::max(maxConcurrentLoads, static_cast<size_t>(1))}
+    , _pendingCount{0}
+    , _runningLoads{0}
+    , _stop{false}
+{
+}
+
+FileLoader::~FileLoader()
+{
+  // The queued loads are dropped, the running ones are waited for
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _tasks.wait();
+}
+
+size_t FileLoader::pendingCount() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pendingCount;
+}
+
+void FileLoader::registerUrlHandler(const std::string& scheme,
+                                    const UrlHandler& handler)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (handler) {
+    _urlHandlers[scheme] = handler;
+  }
+  else {
+    _urlHandlers.erase(scheme);
+  }
+}
+
+std::shared_ptr<FileData> FileLoader::load(const std::string& url,
+                                           const ProgressCallback& onProgress,
+                                           bool useArrayBuffer,
+                                           std::string& error)
+{
+  const auto reportProgress = [&onProgress](size_t loaded, size_t total) {
+    if (onProgress) {
+      onProgress(loaded, total);
+    }
+  };
+
+  // Urls
+  const auto schemeEnd = url.find("://");
+  if (schemeEnd != std::string::npos
+      && url.compare(0, schemeEnd, "file") != 0) {
+    const auto handler = _getUrlHandler(url.substr(0, schemeEnd));
+    if (!handler) {
+      error = "No handler to load the url " + url;
+      return nullptr;
+    }
+
+    std::string buffer;
+    const auto onChunk = [&buffer, &reportProgress](const char* data,
+                                                    size_t size, size_t total) {
+      buffer.append(data, size);
+      reportProgress(buffer.size(), total);
+    };
+    if (!handler(url, onChunk, error)) {
+      return nullptr;
+    }
+
+    return std::make_shared<FileData>(std::move(buffer));
+  }
+
+  // Local files
+  std::string path = url;
+  if (String::startsWith(path, "file://")) {
+    path = path.substr(7);
+  }
+  else if (String::startsWith(path, "file:")) {
+    path = path.substr(5);
+  }
+
+  if (useArrayBuffer) {
+    auto fileData = FileData::Map(path, error);
+    if (fileData) {
+      reportProgress(fileData->size(), fileData->size());
+    }
+    return fileData;
+  }
+
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (!file) {
+    error = "Unable to open the file " + path;
+    return nullptr;
+  }
+
+  file.seekg(0, std::ios::end);
+  const auto end = file.tellg();
+  if (end < 0) {
+    error = "Unable to read the size of the file " + path;
+    return nullptr;
+  }
+  const auto total = static_cast<size_t>(end);
+  file.seekg(0, std::ios::beg);
+  std::string buffer(total, '\0');
+  for (size_t loaded = 0; loaded < total;) {
+    const size_t count = std::min(chunkSize, total - loaded);
+    file.read(&buffer[loaded], static_cast<std::streamsize>(count));
+    if (!file) {
+      error = "Unable to read the file " + path;
+      return nullptr;
+    }
+    loaded += count;
+    reportProgress(loaded, total);
+  }
+
+  return std::make_shared<FileData>(std::move(buffer));
+}
+
+void FileLoader::loadAsync(const std::string& url, const LoadCallback& onLoad,
+                           const ProgressCallback& onProgress,
+                           const ErrorCallback& onError, bool useArrayBuffer)
+{
+  auto job            = std::make_shared<Job>();
+  job->url            = url;
+  job->useArrayBuffer = useArrayBuffer;
+  job->onLoad         = onLoad;
+  job->onProgress     = onProgress;
+  job->onError        = onError;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jobs.emplace_back(std::move(job));
+    ++_pendingCount;
+    if (_runningLoads == _maxConcurrentLoads) {
+      return;
+    }
+    ++_runningLoads;
+  }
+  _tasks.post([this]() { _loadQueuedJobs(); });
+}
+
+void FileLoader::processResults()
+{
+  std::vector<Event> events;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    events.swap(_events);
+  }
+
+  for (const auto& event : events) {
+    const auto& job = *event.job;
+    if (!event.completed) {
+      if (job.onProgress) {
+        job.onProgress(event.loaded, event.total);
+      }
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      --_pendingCount;
+    }
+
+    if (event.data) {
+      if (job.onLoad) {
+        job.onLoad(event.data);
+      }
+    }
+    else if (job.onError) {
+      job.onError(event.error);
+    }
+    else {
+      BABYLON_LOG_ERROR("FileLoader", event.error);
+    }
+  }
+}
+
+FileLoader& FileLoader::Default()
+{
+  static FileLoader fileLoader;
+  return fileLoader;
+}
+
+FileLoader::UrlHandler FileLoader::_getUrlHandler(const std::string& scheme)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _urlHandlers.find(scheme);
+  return (it != _urlHandlers.end()) ? it->second : nullptr;
+}
+
+void FileLoader::_loadQueuedJobs()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    if (_stop || _jobs.empty()) {
+      --_runningLoads;
+      return;
+    }
+
+    auto job = std::move(_jobs.front());
+    _jobs.pop_front();
+    lock.unlock();
+
+    const auto onProgress = [this, &job](size_t loaded, size_t total) {
+      std::lock_guard<std::mutex> progressLock(_mutex);
+      _events.emplace_back(Event{job, false, loaded, total, nullptr, ""});
+    };
+    Event completion{job, true, 0, 0, nullptr, ""};
+    completion.data
+      = load(job->url, onProgress, job->useArrayBuffer, completion.error);
+
+    lock.lock();
+    _events.emplace_back(std::move(completion));
+  }
+}
+
+} // end of namespace BABYLON
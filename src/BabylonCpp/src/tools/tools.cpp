@@ -14,9 +14,11 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <babylon/core/logging.h>
 #include <babylon/core/random.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/math/vector3.h>
+#include <babylon/tools/file_loader.h>
 
 namespace BABYLON {
 
@@ -168,10 +170,39 @@ void Tools::LoadImage(
 }
 
 void Tools::LoadFile(
-  const std::string& /*url*/,
-  const std::function<void(const std::string& text)>& /*callback*/,
-  const std::function<void()>& /*progressCallBack*/, bool /*useArrayBuffer*/)
+  const std::string& url,
+  const std::function<void(const std::string& text)>& callback,
+  const std::function<void()>& progressCallBack)
 {
+  // Read in the buffer handed over to the callback, a mapped file would be
+  // copied
+  LoadFile(url,
+           [&callback](const std::shared_ptr<FileData>& data) {
+             callback(data->releaseString());
+           },
+           progressCallBack, false);
+}
+
+void Tools::LoadFile(
+  const std::string& url,
+  const std::function<void(const std::shared_ptr<FileData>& data)>& callback,
+  const std::function<void()>& progressCallBack, bool useArrayBuffer)
+{
+  // Loaded on the calling thread, the callers use the content right away
+  FileLoader::ProgressCallback onProgress = nullptr;
+  if (progressCallBack) {
+    onProgress = [&progressCallBack](size_t, size_t) { progressCallBack(); };
+  }
+
+  std::string error;
+  auto data
+    = FileLoader::Default().load(url, onProgress, useArrayBuffer, error);
+  if (!data) {
+    BABYLON_LOG_ERROR("Tools", error);
+    return;
+  }
+
+  callback(data);
 }
 
 void Tools::CheckExtends(Vector3& v, Vector3& min, Vector3& max)
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_binding.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+
+namespace {
+
+std::unique_ptr<BABYLON::Animation>
+createAnimation(const std::string& targetProperty, int dataType,
+                const BABYLON::AnimationValue& from,
+                const BABYLON::AnimationValue& to,
+                unsigned int loopMode
+                = BABYLON::Animation::ANIMATIONLOOPMODE_CYCLE)
+{
+  using namespace BABYLON;
+  auto animation = std_util::make_unique<Animation>("animation", targetProperty,
+                                                    30, dataType, loopMode);
+  animation->setKeys({AnimationKey(0, from), AnimationKey(100, to)});
+  return animation;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAnimation, BindTargetPropertyPath)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = Mesh::New("mesh", scene.get());
+
+  auto binding = AnimationBinding::Bind(mesh, {"position"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_VECTOR3));
+  EXPECT_EQ(binding.vector3Value, &mesh->position());
+
+  binding = AnimationBinding::Bind(mesh, {"scaling", "y"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  EXPECT_EQ(binding.floatValue, &mesh->scaling().y);
+
+  binding = AnimationBinding::Bind(mesh, {"rotationQuaternion"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_QUATERNION));
+  EXPECT_EQ(binding.quaternionValue, &mesh->rotationQuaternion());
+
+  binding = AnimationBinding::Bind(mesh, {"visibility"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  EXPECT_EQ(binding.floatValue, &mesh->visibility);
+
+  binding = AnimationBinding::Bind(mesh, {"unknown"});
+  EXPECT_FALSE(binding.isBound());
+  EXPECT_EQ(binding.target, mesh);
+
+  // Materials
+  auto material = StandardMaterial::New("material", scene.get());
+  binding       = AnimationBinding::Bind(material, {"diffuseColor"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_COLOR3));
+  EXPECT_EQ(binding.color3Value, &material->diffuseColor);
+
+  binding = AnimationBinding::Bind(material, {"emissiveColor", "g"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  EXPECT_EQ(binding.floatValue, &material->emissiveColor.g);
+
+  binding = AnimationBinding::Bind(material, {"alpha"});
+  EXPECT_EQ(binding.floatValue, &material->alpha);
+
+  // Bones
+  auto skeleton = new Skeleton("skeleton", "skeleton", scene.get());
+  auto bone     = Bone::New("bone", skeleton, nullptr, Matrix::Identity());
+  binding       = AnimationBinding::Bind(bone, {"_matrix"});
+  EXPECT_EQ(binding.dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_MATRIX));
+  EXPECT_EQ(binding.matrixValue, &bone->getLocalMatrix());
+}
+
+TEST(TestAnimation, AnimateMaterialsAndBones)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine   = Engine::New(&canvas);
+  auto scene    = Scene::New(engine.get());
+  auto mesh     = Mesh::New("mesh", scene.get());
+  auto material = StandardMaterial::New("material", scene.get());
+  auto skeleton = new Skeleton("skeleton", "skeleton", scene.get());
+  auto bone     = Bone::New("bone", skeleton, nullptr, Matrix::Identity());
+
+  auto visibility
+    = createAnimation("visibility", Animation::ANIMATIONTYPE_FLOAT,
+                      AnimationValue(1.f), AnimationValue(0.f));
+  visibility->_target = mesh;
+  auto diffuseColor
+    = createAnimation("diffuseColor", Animation::ANIMATIONTYPE_COLOR3,
+                      AnimationValue(Color3(0.f, 0.f, 0.f)),
+                      AnimationValue(Color3(1.f, 0.5f, 0.f)));
+  diffuseColor->_target = material;
+  const auto translation = Matrix::Translation(10.f, 0.f, 0.f);
+  auto matrix = createAnimation("_matrix", Animation::ANIMATIONTYPE_MATRIX,
+                                AnimationValue(Matrix::Identity()),
+                                AnimationValue(translation));
+  matrix->allowMatricesInterpolation = true;
+  matrix->_target                    = bone;
+
+  // 30 frames per second, 1s after the start
+  for (auto animation : {visibility.get(), diffuseColor.get(), matrix.get()}) {
+    EXPECT_TRUE(animation->animate(millisecond_t(1000), 0.f, 100.f, true, 1.f));
+  }
+  EXPECT_FLOAT_EQ(mesh->visibility, 0.7f);
+  EXPECT_FLOAT_EQ(material->diffuseColor.r, 0.3f);
+  EXPECT_FLOAT_EQ(material->diffuseColor.g, 0.15f);
+  EXPECT_FLOAT_EQ(bone->getLocalMatrix().m[12], 3.f);
+  EXPECT_FLOAT_EQ(bone->getLocalMatrix().m[0], 1.f);
+}
+
+TEST(TestAnimation, AnimateBoundProperties)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = Mesh::New("mesh", scene.get());
+
+  auto positionY = createAnimation("position.y", Animation::ANIMATIONTYPE_FLOAT,
+                                   AnimationValue(0.f), AnimationValue(10.f));
+  auto scaling   = createAnimation("scaling", Animation::ANIMATIONTYPE_VECTOR3,
+                                  AnimationValue(Vector3(1.f, 1.f, 1.f)),
+                                  AnimationValue(Vector3(3.f, 5.f, 7.f)));
+  const Quaternion start = Quaternion::RotationYawPitchRoll(0.f, 0.f, 0.f);
+  const Quaternion end   = Quaternion::RotationYawPitchRoll(1.f, 0.5f, 0.f);
+  auto rotation
+    = createAnimation("rotationQuaternion", Animation::ANIMATIONTYPE_QUATERNION,
+                      AnimationValue(start), AnimationValue(end));
+  for (auto animation : {positionY.get(), scaling.get(), rotation.get()}) {
+    animation->_target = mesh;
+  }
+
+  positionY->goToFrame(25);
+  EXPECT_FLOAT_EQ(mesh->position().y, 2.5f);
+
+  // 30 frames per second, 1s after the start
+  for (auto animation : {positionY.get(), scaling.get(), rotation.get()}) {
+    EXPECT_TRUE(animation->animate(millisecond_t(1000), 0.f, 100.f, true, 1.f));
+  }
+  EXPECT_EQ(positionY->currentFrame, 30);
+  EXPECT_FLOAT_EQ(mesh->position().y, 3.f);
+  EXPECT_FLOAT_EQ(mesh->scaling().x, 1.6f);
+  EXPECT_FLOAT_EQ(mesh->scaling().z, 2.8f);
+  const auto expected = Quaternion::Slerp(start, end, 0.3f);
+  EXPECT_FLOAT_EQ(mesh->rotationQuaternion().y, expected.y);
+  EXPECT_FLOAT_EQ(mesh->rotationQuaternion().w, expected.w);
+
+  // A new target is bound on the next frame
+  auto other         = Mesh::New("other", scene.get());
+  positionY->_target = other;
+  positionY->animate(millisecond_t(2000), 0.f, 100.f, true, 1.f);
+  EXPECT_FLOAT_EQ(other->position().y, 6.f);
+  EXPECT_FLOAT_EQ(mesh->position().y, 3.f);
+
+  // Unresolved path, nothing is written
+  auto unknown = createAnimation("unknown", Animation::ANIMATIONTYPE_FLOAT,
+                                 AnimationValue(0.f), AnimationValue(10.f));
+  unknown->_target = mesh;
+  EXPECT_TRUE(unknown->animate(millisecond_t(1000), 0.f, 100.f, true, 1.f));
+  EXPECT_FLOAT_EQ(mesh->position().y, 3.f);
+}
+
+TEST(TestAnimation, AnimateRelativeLoop)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = Mesh::New("mesh", scene.get());
+
+  auto position = createAnimation("position", Animation::ANIMATIONTYPE_VECTOR3,
+                                  AnimationValue(Vector3::Zero()),
+                                  AnimationValue(Vector3(10.f, 20.f, 30.f)),
+                                  Animation::ANIMATIONLOOPMODE_RELATIVE);
+  position->_target = mesh;
+
+  // Frame 50 of the second loop, offset by the change of the first loop
+  EXPECT_TRUE(position->animate(millisecond_t(5000), 0.f, 100.f, true, 1.f));
+  EXPECT_FLOAT_EQ(mesh->position().x, 15.f);
+  EXPECT_FLOAT_EQ(mesh->position().y, 30.f);
+  EXPECT_FLOAT_EQ(mesh->position().z, 45.f);
+
+  // Past the end without looping, the last key is kept
+  EXPECT_FALSE(position->animate(millisecond_t(5000), 0.f, 100.f, false, 1.f));
+  EXPECT_FLOAT_EQ(mesh->position().x, 10.f);
+  EXPECT_FLOAT_EQ(mesh->position().z, 30.f);
+}
+
+TEST(TestAnimation, ParallelAnimatables)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto camera
+    = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->activeCamera = camera;
+  scene->enableParallelEvaluation(3);
+
+  const unsigned int count = 200;
+  std::vector<Mesh*> meshes;
+  std::vector<std::unique_ptr<Animation>> animations;
+  unsigned int ended = 0, events = 0;
+  for (unsigned int i = 0; i < count; ++i) {
+    auto mesh = Mesh::New("mesh" + std::to_string(i), scene.get());
+    const float value = static_cast<float>(i);
+    animations.emplace_back(createAnimation(
+      "position", Animation::ANIMATIONTYPE_VECTOR3,
+      AnimationValue(Vector3::Zero()),
+      AnimationValue(Vector3(value, 2.f * value, 1.f))));
+    animations.back()->addEvent(AnimationEvent(50, [&events]() { ++events; }));
+    // Ends at the second frame
+    scene->beginDirectAnimation(mesh, {animations.back().get()}, 0, 100, false,
+                                1000.f, [&ended]() { ++ended; });
+    meshes.emplace_back(mesh);
+  }
+  EXPECT_EQ(scene->animatables().size(), count);
+
+  scene->render();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  scene->render();
+
+  // Evaluated concurrently, ended on the rendering thread
+  EXPECT_EQ(ended, count);
+  EXPECT_EQ(events, count);
+  EXPECT_TRUE(scene->animatables().empty());
+  for (unsigned int i = 0; i < count; ++i) {
+    const float value = static_cast<float>(i);
+    EXPECT_FLOAT_EQ(meshes[i]->position().x, value);
+    EXPECT_FLOAT_EQ(meshes[i]->position().y, 2.f * value);
+    EXPECT_FLOAT_EQ(meshes[i]->position().z, 1.f);
+  }
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_key.h>
+#include <babylon/animations/animation_track.h>
+#include <babylon/core/random.h>
+
+namespace {
+
+// Previous linear search of Animation::_interpolate
+bool findKey(const std::vector<BABYLON::AnimationKey>& keys, int frame,
+             size_t& key)
+{
+  for (key = 0; key + 1 < keys.size(); ++key) {
+    if (keys[key + 1].frame >= frame) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAnimationTrack, Values)
+{
+  using namespace BABYLON;
+  AnimationTrack track;
+  track.set({AnimationKey(0, AnimationValue(Vector3(1.f, 2.f, 3.f))),
+             AnimationKey(10, AnimationValue(Vector3(4.f, 5.f, 6.f)))},
+            Animation::ANIMATIONTYPE_VECTOR3);
+  EXPECT_EQ(track.size(), 2u);
+  EXPECT_EQ(track.stride(), 3u);
+  EXPECT_EQ(track.frame(1), 10);
+  EXPECT_FLOAT_EQ(track.value(1)[0], 4.f);
+  EXPECT_FLOAT_EQ(track.value(1)[2], 6.f);
+
+  // Only the frames of the other types are stored
+  track.set({AnimationKey(0, AnimationValue(true)),
+             AnimationKey(5, AnimationValue(false))},
+            Animation::ANIMATIONTYPE_BOOL);
+  EXPECT_EQ(track.size(), 2u);
+  EXPECT_EQ(track.stride(), 0u);
+}
+
+TEST(TestAnimationTrack, FindKey)
+{
+  using namespace BABYLON;
+  // Repeated frames, uneven spacing
+  std::vector<AnimationKey> keys;
+  for (int frame : {0, 10, 10, 20, 50, 51, 100}) {
+    keys.emplace_back(AnimationKey(frame, AnimationValue(0.f)));
+  }
+  AnimationTrack track;
+  track.set(keys, Animation::ANIMATIONTYPE_FLOAT);
+
+  // Sequential playback, looping
+  size_t cursor = 0;
+  size_t expected;
+  for (int loop = 0; loop < 2; ++loop) {
+    for (int frame = -5; frame <= 105; ++frame) {
+      const bool found = findKey(keys, frame, expected);
+      ASSERT_EQ(track.findKey(frame, cursor), found) << frame;
+      if (found) {
+        ASSERT_EQ(cursor, expected) << frame;
+      }
+    }
+  }
+
+  // Random access
+  Math::RandomGenerator random(3);
+  for (unsigned int i = 0; i < 1000; ++i) {
+    const int frame = static_cast<int>(random.randomNumber(-10.f, 110.f));
+    const bool found = findKey(keys, frame, expected);
+    ASSERT_EQ(track.findKey(frame, cursor), found) << frame;
+    if (found) {
+      ASSERT_EQ(cursor, expected) << frame;
+    }
+  }
+
+  // A single key has no interval
+  track.set({AnimationKey(0, AnimationValue(1.f))},
+            Animation::ANIMATIONTYPE_FLOAT);
+  cursor = 0;
+  EXPECT_FALSE(track.findKey(0, cursor));
+}
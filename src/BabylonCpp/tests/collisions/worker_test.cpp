@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <babylon/collisions/worker.h>
+#include <babylon/math/matrix.h>
+
+namespace {
+
+BABYLON::BabylonMessage CollideMessage(unsigned int collisionId, float y)
+{
+  using namespace BABYLON;
+  BabylonMessage message;
+  message.taskType                            = WorkerTaskType::COLLIDE;
+  message.collidePayload.collisionId          = collisionId;
+  message.collidePayload.collider.position    = {0.f, y, 0.f};
+  message.collidePayload.collider.velocity    = {0.f, -5.f, 0.f};
+  message.collidePayload.collider.radius      = {1.f, 1.f, 1.f};
+  message.collidePayload.maximumRetry         = 3;
+  message.collidePayload.excludedMeshUniqueId = -1;
+  return message;
+}
+
+// Processes the replies until count replies were received
+std::vector<BABYLON::WorkerReply> WaitForReplies(BABYLON::Worker& worker,
+                                                 size_t count)
+{
+  std::vector<BABYLON::WorkerReply> replies;
+  worker.callbackHandler = [&replies](const BABYLON::WorkerReply& reply) {
+    replies.emplace_back(reply);
+  };
+  for (unsigned int i = 0; i < 1000 && replies.size() < count; ++i) {
+    worker.processReplies();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return replies;
+}
+
+} // end of anonymous namespace
+
+TEST(TestWorker, RepliesAreProcessedOnTheCallingThread)
+{
+  using namespace BABYLON;
+  Worker worker;
+
+  BabylonMessage init;
+  init.taskType = WorkerTaskType::INIT;
+  worker.postMessage(init);
+  worker.postMessage(CollideMessage(3, 10.f));
+
+  auto replies = WaitForReplies(worker, 2);
+  ASSERT_EQ(replies.size(), 2u);
+  EXPECT_EQ(replies[0].taskType, WorkerTaskType::INIT);
+  EXPECT_EQ(replies[1].taskType, WorkerTaskType::COLLIDE);
+
+  // Nothing to collide with
+  const auto& payload = replies[1].collisionReplyPayload;
+  EXPECT_EQ(payload.collisionId, 3u);
+  EXPECT_EQ(payload.collidedMeshUniqueId, -1);
+  ASSERT_EQ(payload.newPosition.size(), 3u);
+  EXPECT_FLOAT_EQ(payload.newPosition[1], 5.f);
+}
+
+TEST(TestWorker, CollidesWithTheUpdatedMeshes)
+{
+  using namespace BABYLON;
+  Worker worker;
+
+  BabylonMessage init;
+  init.taskType = WorkerTaskType::INIT;
+  worker.postMessage(init);
+
+  // Ground quad at y = 0
+  SerializedGeometry geometry;
+  geometry.id        = "ground";
+  geometry.positions = {-10.f, 0.f, -10.f, 10.f, 0.f, -10.f,
+                        10.f,  0.f, 10.f,  -10.f, 0.f, 10.f};
+  geometry.indices   = {0, 2, 1, 0, 3, 2};
+
+  SerializedSubMesh subMesh;
+  subMesh.position      = 0;
+  subMesh.verticesStart = 0;
+  subMesh.verticesCount = 4;
+  subMesh.indexStart    = 0;
+  subMesh.indexCount    = 6;
+  subMesh.hasMaterial   = true;
+
+  SerializedMesh mesh;
+  mesh.uniqueId             = 7;
+  mesh.geometryId           = geometry.id;
+  mesh.sphereCenter         = {0.f, 0.f, 0.f};
+  mesh.sphereRadius         = 15.f;
+  mesh.boxMinimum           = {-10.f, 0.f, -10.f};
+  mesh.boxMaximum           = {10.f, 0.f, 10.f};
+  mesh.worldMatrixFromCache = Matrix::Identity().asArray();
+  mesh.subMeshes            = {subMesh};
+  mesh.checkCollisions      = true;
+
+  BabylonMessage update;
+  update.taskType = WorkerTaskType::UPDATE;
+  update.updatePayload.updatedGeometries[geometry.id] = std::move(geometry);
+  update.updatePayload.updatedMeshes[mesh.uniqueId]   = std::move(mesh);
+  worker.postMessage(std::move(update));
+  worker.postMessage(CollideMessage(0, 2.f));
+
+  auto replies = WaitForReplies(worker, 3);
+  ASSERT_EQ(replies.size(), 3u);
+  EXPECT_EQ(replies[1].taskType, WorkerTaskType::UPDATE);
+
+  // The sphere stops on the ground
+  const auto& payload = replies[2].collisionReplyPayload;
+  EXPECT_EQ(payload.collidedMeshUniqueId, 7);
+  ASSERT_EQ(payload.newPosition.size(), 3u);
+  EXPECT_NEAR(payload.newPosition[1], 1.f, 0.05f);
+
+  // Messages posted after termination are ignored
+  worker.terminate();
+  worker.postMessage(CollideMessage(1, 2.f));
+  size_t repliesCount    = 0;
+  worker.callbackHandler = [&repliesCount](const WorkerReply& /*reply*/) {
+    ++repliesCount;
+  };
+  worker.processReplies();
+  EXPECT_EQ(repliesCount, 0u);
+}
+
+TEST(TestWorker, TerminateDropsTheLaterMessages)
+{
+  using namespace BABYLON;
+  Worker worker;
+  size_t replies         = 0;
+  worker.callbackHandler = [&replies](const WorkerReply&) { ++replies; };
+
+  BabylonMessage init;
+  init.taskType = WorkerTaskType::INIT;
+  for (unsigned int i = 0; i < 10; ++i) {
+    worker.postMessage(init);
+  }
+  worker.terminate();
+  worker.postMessage(init);
+  worker.processReplies();
+  EXPECT_EQ(replies, 0u);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/json.h>
+#include <babylon/core/json_stream_parser.h>
+
+namespace {
+
+struct EventRecorder : public BABYLON::JsonStreamParser::Handler {
+  std::vector<std::string> events;
+
+  void startObject() override
+  {
+    events.emplace_back("{");
+  }
+  void endObject() override
+  {
+    events.emplace_back("}");
+  }
+  void key(std::string&& name) override
+  {
+    events.emplace_back(name + ":");
+  }
+  void startArray(size_t numberCount) override
+  {
+    events.emplace_back("[" + std::to_string(numberCount));
+  }
+  void endArray() override
+  {
+    events.emplace_back("]");
+  }
+  void null() override
+  {
+    events.emplace_back("null");
+  }
+  void boolean(bool value) override
+  {
+    events.emplace_back(value ? "true" : "false");
+  }
+  void number(double value) override
+  {
+    std::ostringstream oss;
+    oss << value;
+    events.emplace_back(oss.str());
+  }
+  void string(std::string&& value) override
+  {
+    events.emplace_back("\"" + value + "\"");
+  }
+}; // end of struct EventRecorder
+
+// Scene of meshCount meshes holding vertexCount vertices each
+std::string generateScene(size_t meshCount, size_t vertexCount)
+{
+  std::ostringstream oss;
+  oss << "{\"autoClear\":true,\"meshes\":[";
+  for (size_t m = 0; m < meshCount; ++m) {
+    oss << (m > 0 ? "," : "") << "{\"name\":\"mesh" << m << "\",\"id\":\"" << m
+        << "\",\"position\":[0,1.5,-2],\"positions\":[";
+    for (size_t i = 0; i < vertexCount * 3; ++i) {
+      oss << (i > 0 ? "," : "") << (static_cast<float>(i) * 0.001f - 12.5f);
+    }
+    oss << "],\"normals\":[";
+    for (size_t i = 0; i < vertexCount * 3; ++i) {
+      oss << (i > 0 ? "," : "") << ((i % 3 == 1) ? "1" : "0");
+    }
+    oss << "],\"indices\":[";
+    for (size_t i = 0; i < vertexCount; ++i) {
+      oss << (i > 0 ? "," : "") << (vertexCount - 1 - i);
+    }
+    oss << "]}";
+  }
+  oss << "]}";
+  return oss.str();
+}
+
+} // end of anonymous namespace
+
+TEST(TestJsonStreamParser, Events)
+{
+  using namespace BABYLON;
+  EventRecorder recorder;
+  JsonStreamParser parser(recorder);
+  const std::string json
+    = "{\"a\": [1, -2.5e1, 3], \"b\": [\"x\\n\\u00e9\", true, null, []],"
+      " \"c\": {}}";
+  ASSERT_TRUE(parser.parse(json.data(), json.size())) << parser.error();
+  const std::vector<std::string> expected{
+    "{", "a:", "[3", "1", "-25", "3", "]", "b:", "[0", "\"x\n\xC3\xA9\"",
+    "true", "null", "[0", "]", "]", "c:", "{", "}", "}"};
+  EXPECT_EQ(recorder.events, expected);
+}
+
+TEST(TestJsonStreamParser, Errors)
+{
+  using namespace BABYLON;
+  EventRecorder recorder;
+  JsonStreamParser parser(recorder);
+  for (const std::string json :
+       {"", "{", "[1,]", "{\"a\" 1}", "[01]", "[1.]", "\"abc", "tru", "{} {}",
+        "[\"\\q\"]"}) {
+    EXPECT_FALSE(parser.parse(json.data(), json.size())) << json;
+    EXPECT_FALSE(parser.error().empty());
+  }
+
+  parser.maxDepth = 2;
+  const std::string json = "[[[1]]]";
+  EXPECT_FALSE(parser.parse(json.data(), json.size()));
+}
+
+TEST(TestJsonStreamParser, PacksVertexData)
+{
+  using namespace BABYLON;
+  const std::string json
+    = "{\"meshes\": [{\"position\": [1, 2, 3], \"positions\": [0.5, -1, 2],"
+      " \"indices\": [0, 1, 4294967295], \"matricesIndices\": [50462976]}]}";
+
+  Json::value parsedData;
+  ASSERT_EQ(Json::Parse(parsedData, json.data(), json.size()), "");
+
+  const auto& parsedMesh = Json::GetArray(parsedData, "meshes")[0];
+  // Only the vertex data are packed
+  EXPECT_TRUE(parsedMesh.get("position").is<Json::array>());
+  EXPECT_TRUE(parsedMesh.get("positions").is<Json::float32_array>());
+  EXPECT_TRUE(parsedMesh.get("indices").is<Json::uint32_array>());
+
+  EXPECT_EQ(Json::ToArray<float>(parsedMesh, "position"),
+            (std::vector<float>{1.f, 2.f, 3.f}));
+  EXPECT_EQ(Json::ToArray<float>(parsedMesh, "positions"),
+            (std::vector<float>{0.5f, -1.f, 2.f}));
+  EXPECT_EQ(Json::ToArray<uint32_t>(parsedMesh, "indices"),
+            (std::vector<uint32_t>{0, 1, 4294967295u}));
+  EXPECT_EQ(Json::ToArray<uint32_t>(parsedMesh, "matricesIndices"),
+            (std::vector<uint32_t>{50462976u}));
+  EXPECT_TRUE(Json::ToArray<float>(parsedMesh, "normals").empty());
+  // Serialized as numeric arrays
+  EXPECT_EQ(parsedMesh.get("positions").serialize(), "[0.5,-1,2]");
+  EXPECT_EQ(parsedMesh.get("indices").serialize(), "[0,1,4294967295]");
+
+  // Same content as the picojson DOM
+  const auto scene = generateScene(2, 100);
+  Json::value domData;
+  const char* first = scene.data();
+  ASSERT_EQ(picojson::parse(domData, first, scene.data() + scene.size()), "");
+  ASSERT_EQ(Json::Parse(parsedData, scene.data(), scene.size()), "");
+  for (size_t m = 0; m < 2; ++m) {
+    const auto& domMesh = Json::GetArray(domData, "meshes")[m];
+    const auto& mesh    = Json::GetArray(parsedData, "meshes")[m];
+    EXPECT_EQ(Json::GetString(mesh, "name"), Json::GetString(domMesh, "name"));
+    for (const auto& key : {"position", "positions", "normals"}) {
+      EXPECT_EQ(Json::ToArray<float>(mesh, key),
+                Json::ToArray<float>(domMesh, key));
+    }
+    EXPECT_EQ(Json::ToArray<uint32_t>(mesh, "indices"),
+              Json::ToArray<uint32_t>(domMesh, "indices"));
+  }
+}
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/random.h>
+
+TEST(TestRandom, RandomGeneratorSequences)
+{
+  using namespace BABYLON;
+  Math::RandomGenerator generator(42, 3), sameGenerator(42, 3);
+  Math::RandomGenerator otherStream(42, 4), otherSeed(43, 3);
+
+  unsigned int sameAsOtherStream = 0, sameAsOtherSeed = 0;
+  for (unsigned int i = 0; i < 1000; ++i) {
+    const float value = generator.random();
+    EXPECT_GE(value, 0.f);
+    EXPECT_LT(value, 1.f);
+    EXPECT_EQ(value, sameGenerator.random());
+    sameAsOtherStream += (value == otherStream.random());
+    sameAsOtherSeed += (value == otherSeed.random());
+  }
+  EXPECT_LT(sameAsOtherStream, 5u);
+  EXPECT_LT(sameAsOtherSeed, 5u);
+
+  const float number = generator.randomNumber(-2.f, 3.f);
+  EXPECT_GE(number, -2.f);
+  EXPECT_LT(number, 3.f);
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/task_group.h>
+
+TEST(TestTaskGroup, WaitsForItsTasks)
+{
+  using namespace BABYLON;
+  ThreadPool pool(3);
+  std::atomic<size_t> done(0);
+  {
+    TaskGroup group(pool);
+    for (unsigned int i = 0; i < 20; ++i) {
+      group.post([&done]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++done;
+      });
+    }
+    group.wait();
+    EXPECT_EQ(done.load(), 20u);
+    EXPECT_EQ(group.pendingCount(), 0u);
+
+    // The destructor waits as well
+    group.post([&done]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      ++done;
+    });
+  }
+  EXPECT_EQ(done.load(), 21u);
+}
+
+TEST(TestTaskGroup, TasksRunParallelLoops)
+{
+  using namespace BABYLON;
+  ThreadPool pool(2);
+  TaskGroup group(pool);
+  std::atomic<size_t> visits(0);
+  group.post([&pool, &visits]() {
+    pool.parallelFor(1000, 10, [&visits](size_t begin, size_t end) {
+      visits += end - begin;
+    });
+  });
+  group.wait();
+  EXPECT_EQ(visits.load(), 1000u);
+}
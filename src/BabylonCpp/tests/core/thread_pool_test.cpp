@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, ParallelForVisitsEachIndexOnce)
+{
+  using namespace BABYLON;
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.threadCount(), 3u);
+
+  std::vector<std::atomic<int>> visits(1000);
+  for (auto& visit : visits) {
+    visit.store(0);
+  }
+  for (unsigned int iteration = 0; iteration < 10; ++iteration) {
+    pool.parallelFor(visits.size(), 7, [&visits](size_t begin, size_t end) {
+      EXPECT_LE(end - begin, 7u);
+      for (size_t i = begin; i < end; ++i) {
+        ++visits[i];
+      }
+    });
+  }
+  for (auto& visit : visits) {
+    EXPECT_EQ(visit.load(), 10);
+  }
+
+  // Empty range
+  pool.parallelFor(0, 7, [](size_t, size_t) { FAIL(); });
+}
+
+TEST(TestThreadPool, NestedParallelForRunsSerially)
+{
+  using namespace BABYLON;
+  ThreadPool pool(2);
+  EXPECT_FALSE(ThreadPool::IsInParallelFor());
+
+  std::atomic<size_t> sum(0);
+  pool.parallelFor(8, 1, [&pool, &sum](size_t begin, size_t end) {
+    EXPECT_TRUE(ThreadPool::IsInParallelFor());
+    for (size_t i = begin; i < end; ++i) {
+      pool.parallelFor(10, 2, [&sum](size_t innerBegin, size_t innerEnd) {
+        sum += innerEnd - innerBegin;
+      });
+    }
+  });
+  EXPECT_EQ(sum.load(), 80u);
+  EXPECT_FALSE(ThreadPool::IsInParallelFor());
+}
+
+TEST(TestThreadPool, PostedTasksRunOnWorkers)
+{
+  using namespace BABYLON;
+  std::atomic<size_t> sum(0);
+  {
+    ThreadPool pool(2);
+    std::atomic<size_t> done(0);
+    for (size_t i = 1; i <= 100; ++i) {
+      pool.post([&sum, &done, i]() {
+        EXPECT_FALSE(ThreadPool::IsInParallelFor());
+        sum += i;
+        ++done;
+      });
+    }
+    // A loop runs alongside the queued tasks
+    std::atomic<size_t> visits(0);
+    pool.parallelFor(100, 10, [&visits](size_t begin, size_t end) {
+      visits += end - begin;
+    });
+    EXPECT_EQ(visits.load(), 100u);
+    while (done.load() < 100) {
+      std::this_thread::yield();
+    }
+  }
+  EXPECT_EQ(sum.load(), 5050u);
+
+  // Without worker, the task runs at once on the calling thread
+  bool ran = false;
+  ThreadPool emptyPool(0);
+  emptyPool.post([&ran]() { ran = true; });
+  EXPECT_TRUE(ran);
+  EXPECT_GE(ThreadPool::Default().threadCount(), 1u);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_box_array.h>
+#include <babylon/math/frustum.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/simd/simd_batch.h>
+
+namespace {
+
+// Camera at the origin looking along z, with boxes all around it
+std::array<BABYLON::Plane, 6> cameraFrustum()
+{
+  using namespace BABYLON;
+  Vector3 target(0.f, 0.f, 1.f);
+  Vector3 up(0.f, 1.f, 0.f);
+  auto view       = Matrix::LookAtLH(Vector3::Zero(), target, up);
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 1.5f, 1.f, 100.f);
+  return Frustum::GetPlanes(view.multiply(projection));
+}
+
+// Boxes of random sizes, rotations, scalings and positions
+std::vector<BABYLON::BoundingBox> randomBoxes(size_t count)
+{
+  using namespace BABYLON;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(-120.f, 120.f);
+  std::uniform_real_distribution<float> size(0.1f, 10.f);
+  std::uniform_real_distribution<float> angle(-3.f, 3.f);
+  std::vector<BoundingBox> boxes;
+  boxes.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const Vector3 center(position(generator), position(generator),
+                         position(generator));
+    const Vector3 extend(size(generator), size(generator), size(generator));
+    boxes.emplace_back(
+      BoundingBox(center.subtract(extend), center.add(extend)));
+    auto rotation = Quaternion::RotationYawPitchRoll(
+      angle(generator), angle(generator), angle(generator));
+    boxes.back()._update(
+      Matrix::Compose(Vector3(size(generator), size(generator), 1.f),
+                      rotation, Vector3(position(generator), 0.f, 0.f)));
+  }
+  return boxes;
+}
+
+} // end of anonymous namespace
+
+TEST(TestBoundingBoxArray, MatchesBoundingBoxFrustumTest)
+{
+  using namespace BABYLON;
+  const auto frustumPlanes = cameraFrustum();
+  auto boxes               = randomBoxes(2001);
+
+  BoundingBoxArray array;
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    EXPECT_EQ(i, array.add(boxes[i]));
+  }
+  EXPECT_EQ(boxes.size(), array.size());
+
+  const auto supported = SIMD::SIMDBatch::SupportedInstructionSet();
+  for (unsigned int i = 0; i <= static_cast<unsigned int>(supported); ++i) {
+    SIMD::SIMDBatch::SetInstructionSet(static_cast<SIMD::InstructionSet>(i));
+    std::vector<uint32_t> visibility;
+    array.isInFrustum(frustumPlanes, visibility);
+    ASSERT_EQ((boxes.size() + 31) / 32, visibility.size());
+    size_t visibleCount = 0;
+    for (size_t b = 0; b < boxes.size(); ++b) {
+      const bool visible = boxes[b].isInFrustum(frustumPlanes);
+      EXPECT_EQ(visible, BoundingBoxArray::IsVisible(visibility, b))
+        << "box " << b;
+      visibleCount += visible ? 1 : 0;
+    }
+    // Both cases are covered
+    EXPECT_GT(visibleCount, 0u);
+    EXPECT_LT(visibleCount, boxes.size());
+  }
+  SIMD::SIMDBatch::SetInstructionSet(supported);
+
+  array.clear();
+  EXPECT_TRUE(array.empty());
+  std::vector<uint32_t> visibility;
+  array.isInFrustum(frustumPlanes, visibility);
+  EXPECT_TRUE(visibility.empty());
+}
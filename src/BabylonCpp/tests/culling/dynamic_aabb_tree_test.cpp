@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/dynamic_aabb_tree.h>
+#include <babylon/culling/ray.h>
+#include <babylon/math/plane.h>
+
+namespace {
+
+// The tree only stores pointers, so entries are faked with points
+BABYLON::AbstractMesh* toEntry(BABYLON::Vector3& point)
+{
+  return reinterpret_cast<BABYLON::AbstractMesh*>(&point);
+}
+
+std::vector<BABYLON::AbstractMesh*>
+sorted(std::vector<BABYLON::AbstractMesh*> entries)
+{
+  std::sort(entries.begin(), entries.end());
+  return entries;
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicAABBTree, QueriesMatchBruteForce)
+{
+  using namespace BABYLON;
+  DynamicAABBTree<AbstractMesh*> tree(0.f);
+
+  // 10 x 10 grid of unit boxes in the z = 0 plane
+  std::vector<Vector3> points;
+  for (unsigned int x = 0; x < 10; ++x) {
+    for (unsigned int y = 0; y < 10; ++y) {
+      points.emplace_back(Vector3(x * 2.f, y * 2.f, 0.f));
+    }
+  }
+  for (auto& point : points) {
+    tree.createProxy(point.subtract(Vector3(0.5f, 0.5f, 0.5f)),
+                     point.add(Vector3(0.5f, 0.5f, 0.5f)), toEntry(point));
+  }
+  EXPECT_EQ(tree.size(), 100u);
+  // Balanced tree
+  EXPECT_LE(tree.height(), 14);
+
+  // Frustum keeping the x in [5, 11] slab
+  std::array<Plane, 6> frustumPlanes{
+    {Plane(1.f, 0.f, 0.f, -5.f), Plane(-1.f, 0.f, 0.f, 11.f),
+     Plane(0.f, 1.f, 0.f, 100.f), Plane(0.f, -1.f, 0.f, 100.f),
+     Plane(0.f, 0.f, 1.f, 100.f), Plane(0.f, 0.f, -1.f, 100.f)}};
+  std::vector<AbstractMesh*> selection, expected;
+  tree.select(frustumPlanes, selection);
+  for (auto& point : points) {
+    if (point.x + 0.5f >= 5.f && point.x - 0.5f <= 11.f) {
+      expected.emplace_back(toEntry(point));
+    }
+  }
+  EXPECT_EQ(sorted(selection), sorted(expected));
+
+  // Sphere around (4, 4, 0)
+  selection.clear();
+  expected.clear();
+  tree.intersects(Vector3(4.f, 4.f, 0.f), 1.f, selection);
+  expected.emplace_back(toEntry(points[2 * 10 + 2]));
+  EXPECT_EQ(selection, expected);
+
+  // Ray along the y = 6 row
+  selection.clear();
+  expected.clear();
+  tree.intersectsRay(Ray(Vector3(-5.f, 6.f, 0.f), Vector3(1.f, 0.f, 0.f)),
+                     selection);
+  for (unsigned int x = 0; x < 10; ++x) {
+    expected.emplace_back(toEntry(points[x * 10 + 3]));
+  }
+  EXPECT_EQ(sorted(selection), sorted(expected));
+}
+
+TEST(TestDynamicAABBTree, MoveAndDestroyProxies)
+{
+  using namespace BABYLON;
+  DynamicAABBTree<AbstractMesh*> tree(0.5f);
+  Vector3 a(0.f, 0.f, 0.f), b(10.f, 0.f, 0.f);
+
+  const int proxyA = tree.createProxy(a, a, toEntry(a));
+  const int proxyB = tree.createProxy(b, b, toEntry(b));
+  EXPECT_EQ(tree.getData(proxyA), toEntry(a));
+
+  // Small moves stay within the fat box
+  EXPECT_FALSE(
+    tree.moveProxy(proxyA, Vector3(0.2f, 0.f, 0.f), Vector3(0.2f, 0.f, 0.f)));
+  EXPECT_TRUE(
+    tree.moveProxy(proxyA, Vector3(20.f, 0.f, 0.f), Vector3(20.f, 0.f, 0.f)));
+
+  std::vector<AbstractMesh*> selection;
+  tree.intersects(Vector3(20.f, 0.f, 0.f), 0.1f, selection);
+  ASSERT_EQ(selection.size(), 1u);
+  EXPECT_EQ(selection[0], toEntry(a));
+
+  tree.destroyProxy(proxyB);
+  EXPECT_EQ(tree.size(), 1u);
+  selection.clear();
+  tree.intersects(Vector3(10.f, 0.f, 0.f), 1.f, selection);
+  EXPECT_TRUE(selection.empty());
+
+  // Freed nodes are reused
+  const int proxyC = tree.createProxy(b, b, toEntry(b));
+  EXPECT_EQ(tree.size(), 2u);
+  EXPECT_EQ(tree.getData(proxyC), toEntry(b));
+
+  tree.clear();
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.height(), 0);
+}
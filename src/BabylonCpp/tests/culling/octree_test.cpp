@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/culling/octrees/octree_block.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/mesh.h>
+
+namespace {
+
+// The octree only stores pointers, so entries are faked with points
+BABYLON::AbstractMesh* toEntry(BABYLON::Vector3& point)
+{
+  return reinterpret_cast<BABYLON::AbstractMesh*>(&point);
+}
+
+std::unique_ptr<BABYLON::Octree<BABYLON::AbstractMesh*>>
+createOctree(BABYLON::Vector3* everywhere)
+{
+  using namespace BABYLON;
+  return std_util::make_unique<Octree<AbstractMesh*>>(
+    [everywhere](AbstractMesh*& entry, OctreeBlock<AbstractMesh*>& block) {
+      auto point = reinterpret_cast<Vector3*>(entry);
+      if (point == everywhere
+          || (point->x >= block.minPoint().x && point->x <= block.maxPoint().x
+              && point->y >= block.minPoint().y
+              && point->y <= block.maxPoint().y
+              && point->z >= block.minPoint().z
+              && point->z <= block.maxPoint().z)) {
+        block.entries.emplace_back(entry);
+      }
+    },
+    2, 2);
+}
+
+// Frustum keeping the x >= 1 half of the [-8, 8] world
+std::array<BABYLON::Plane, 6> rightHalfFrustum()
+{
+  using namespace BABYLON;
+  return {{Plane(1.f, 0.f, 0.f, -1.f), Plane(-1.f, 0.f, 0.f, 8.f),
+           Plane(0.f, 1.f, 0.f, 8.f), Plane(0.f, -1.f, 0.f, 8.f),
+           Plane(0.f, 0.f, 1.f, 8.f), Plane(0.f, 0.f, -1.f, 8.f)}};
+}
+
+} // end of anonymous namespace
+
+TEST(TestOctree, SelectCullsBlocksOutsideFrustum)
+{
+  using namespace BABYLON;
+  std::vector<Vector3> points{Vector3(-6.f, -4.f, -4.f),
+                              Vector3(-2.f, 4.f, 4.f), Vector3(2.f, -4.f, 4.f),
+                              Vector3(6.f, 4.f, -4.f), Vector3(5.f, 5.f, 5.f)};
+  std::vector<AbstractMesh*> entries;
+  for (auto& point : points) {
+    entries.emplace_back(toEntry(point));
+  }
+
+  auto octree = createOctree(nullptr);
+  octree->update(Vector3(-8.f, -8.f, -8.f), Vector3(8.f, 8.f, 8.f), entries);
+
+  auto selection = octree->select(rightHalfFrustum(), false);
+  std::sort(selection.begin(), selection.end());
+  std::vector<AbstractMesh*> expected{entries[2], entries[3], entries[4]};
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(selection, expected);
+}
+
+TEST(TestOctree, OctreesDoNotShareBlocks)
+{
+  using namespace BABYLON;
+  Vector3 first(2.f, 2.f, 2.f), second(4.f, 4.f, 4.f);
+  std::vector<AbstractMesh*> firstEntries{toEntry(first)};
+  std::vector<AbstractMesh*> secondEntries{toEntry(second)};
+
+  auto firstOctree  = createOctree(nullptr);
+  auto secondOctree = createOctree(nullptr);
+  firstOctree->update(Vector3(-8.f, -8.f, -8.f), Vector3(8.f, 8.f, 8.f),
+                      firstEntries);
+  secondOctree->update(Vector3(-8.f, -8.f, -8.f), Vector3(8.f, 8.f, 8.f),
+                       secondEntries);
+
+  EXPECT_EQ(firstOctree->select(rightHalfFrustum(), false), firstEntries);
+  EXPECT_EQ(secondOctree->select(rightHalfFrustum(), false), secondEntries);
+}
+
+TEST(TestOctree, DynamicContentAndRemoval)
+{
+  using namespace BABYLON;
+  Vector3 everywhere, culled(-4.f, 0.f, 0.f), dynamic(-6.f, 0.f, 0.f);
+  std::vector<AbstractMesh*> entries{toEntry(everywhere), toEntry(culled)};
+
+  auto octree = createOctree(&everywhere);
+  octree->update(Vector3(-8.f, -8.f, -8.f), Vector3(8.f, 8.f, 8.f), entries);
+  octree->dynamicContent.emplace_back(toEntry(dynamic));
+
+  // Entries spanning several blocks are only returned once, in selection order
+  auto selection = octree->select(rightHalfFrustum(), false);
+  EXPECT_EQ(selection.size(), 2u);
+  EXPECT_TRUE(std_util::contains(selection, toEntry(everywhere)));
+  EXPECT_TRUE(std_util::contains(selection, toEntry(dynamic)));
+  std::vector<AbstractMesh*> expected{toEntry(everywhere), toEntry(dynamic)};
+  EXPECT_EQ(selection, expected);
+  EXPECT_EQ(octree->intersects(Vector3(4.f, 0.f, 0.f), 1.f, false), expected);
+  EXPECT_EQ(octree->intersectsRay(
+              Ray(Vector3(1.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f), 4.f)),
+            expected);
+
+  auto entry = toEntry(everywhere);
+  octree->removeMesh(entry);
+  entry = toEntry(dynamic);
+  octree->removeMesh(entry);
+  EXPECT_TRUE(octree->select(rightHalfFrustum(), false).empty());
+}
+
+TEST(TestOctree, AddedMeshesAreInsertedOnUpdate)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto left   = Mesh::CreateBox("left", 1.f, scene.get());
+  auto right  = Mesh::CreateBox("right", 1.f, scene.get());
+  left->position().x  = -6.f;
+  right->position().x = 6.f;
+  auto octree         = scene->createOrUpdateSelectionOctree();
+  EXPECT_EQ(octree->select(rightHalfFrustum(), false),
+            std::vector<AbstractMesh*>{right});
+
+  // Selected until the next update
+  auto added          = Mesh::CreateBox("added", 1.f, scene.get());
+  added->position().x = -5.f;
+  EXPECT_TRUE(
+    std_util::contains(octree->select(rightHalfFrustum(), false), added));
+
+  // then culled with its block
+  scene->createOrUpdateSelectionOctree();
+  EXPECT_TRUE(octree->dynamicContent.empty());
+  EXPECT_EQ(octree->select(rightHalfFrustum(), false),
+            std::vector<AbstractMesh*>{right});
+
+  // The meshes always selected stay in the dynamic content
+  left->alwaysSelectAsActiveMesh = true;
+  scene->createOrUpdateSelectionOctree();
+  scene->createOrUpdateSelectionOctree();
+  EXPECT_EQ(octree->dynamicContent, std::vector<AbstractMesh*>{left});
+}
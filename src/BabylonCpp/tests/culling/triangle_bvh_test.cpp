@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+
+namespace {
+
+/**
+ * @brief Creates a bumpy grid of size x size quads in the xz plane.
+ */
+void createGrid(unsigned int size, BABYLON::Float32Array& positions,
+                BABYLON::Uint32Array& indices)
+{
+  for (unsigned int z = 0; z <= size; ++z) {
+    for (unsigned int x = 0; x <= size; ++x) {
+      positions.emplace_back(static_cast<float>(x));
+      positions.emplace_back(std::sin(static_cast<float>(x * z)) * 0.5f);
+      positions.emplace_back(static_cast<float>(z));
+    }
+  }
+  for (unsigned int z = 0; z < size; ++z) {
+    for (unsigned int x = 0; x < size; ++x) {
+      const unsigned int i = z * (size + 1) + x;
+      indices.insert(indices.end(), {i, i + size + 1, i + 1});
+      indices.insert(indices.end(), {i + 1, i + size + 1, i + size + 2});
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestTriangleBVH, ClosestHitMatchesBruteForce)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  Uint32Array indices;
+  createGrid(16, positions, indices);
+
+  TriangleBVH bvh(positions, indices);
+  EXPECT_EQ(bvh.trianglesCount(), indices.size() / 3);
+  EXPECT_GT(bvh.nodesCount(), 1u);
+
+  for (unsigned int i = 0; i < 64; ++i) {
+    const float x = 0.25f + static_cast<float>(i % 8) * 2.f;
+    const float z = 0.75f + static_cast<float>(i / 8) * 2.f;
+    Ray ray(Vector3(x, 5.f, z), Vector3(0.1f, -1.f, 0.05f).normalize());
+
+    // Brute force
+    std::unique_ptr<IntersectionInfo> expected = nullptr;
+    for (size_t index = 0; index < indices.size(); index += 3) {
+      auto info = ray.intersectsTriangle(
+        Vector3::FromArray(positions, indices[index] * 3),
+        Vector3::FromArray(positions, indices[index + 1] * 3),
+        Vector3::FromArray(positions, indices[index + 2] * 3));
+      if (info && info->distance >= 0.f
+          && (!expected || info->distance < expected->distance)) {
+        expected         = std::move(info);
+        expected->faceId = index / 3;
+      }
+    }
+
+    auto result = bvh.intersectsRay(ray, 0, indices.size(), false);
+    ASSERT_NE(expected, nullptr);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->faceId, expected->faceId);
+    EXPECT_FLOAT_EQ(result->distance, expected->distance);
+
+    // Any hit when fast checking
+    EXPECT_NE(bvh.intersectsRay(ray, 0, indices.size(), true), nullptr);
+  }
+}
+
+TEST(TestTriangleBVH, IndexRangeAndMisses)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  Uint32Array indices;
+  createGrid(4, positions, indices);
+
+  TriangleBVH bvh(positions, indices);
+
+  // Hits the first quad, made of the first two triangles
+  Ray ray(Vector3(0.25f, 5.f, 0.25f), Vector3(0.f, -1.f, 0.f));
+  auto result = bvh.intersectsRay(ray, 0, indices.size(), false);
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->faceId, 0u);
+
+  // Range excluding the first quad
+  EXPECT_EQ(bvh.intersectsRay(ray, 6, indices.size(), false), nullptr);
+
+  // Pointing away from the grid
+  Ray missingRay(Vector3(0.25f, 5.f, 0.25f), Vector3(0.f, 1.f, 0.f));
+  EXPECT_EQ(bvh.intersectsRay(missingRay, 0, indices.size(), false), nullptr);
+
+  // Empty geometry
+  TriangleBVH emptyBvh{Float32Array(), Uint32Array()};
+  EXPECT_EQ(emptyBvh.nodesCount(), 0u);
+  EXPECT_EQ(emptyBvh.intersectsRay(ray, 0, 0, false), nullptr);
+}
+
+TEST(TestTriangleBVH, BoxQueryMatchesBruteForce)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  Uint32Array indices;
+  createGrid(16, positions, indices);
+  TriangleBVH bvh(positions, indices);
+
+  const Vector3 minimum(3.5f, -1.f, 7.2f);
+  const Vector3 maximum(6.1f, 1.f, 9.9f);
+  const size_t indexEnd = indices.size() / 2;
+
+  std::vector<uint32_t> expected;
+  for (size_t index = 0; index < indexEnd; index += 3) {
+    Vector3 triangleMin = Vector3::FromArray(positions, indices[index] * 3);
+    Vector3 triangleMax = triangleMin;
+    for (size_t i = 1; i < 3; ++i) {
+      const auto vertex = Vector3::FromArray(positions, indices[index + i] * 3);
+      triangleMin.minimizeInPlace(vertex);
+      triangleMax.maximizeInPlace(vertex);
+    }
+    if (triangleMin.x <= maximum.x && triangleMax.x >= minimum.x
+        && triangleMin.y <= maximum.y && triangleMax.y >= minimum.y
+        && triangleMin.z <= maximum.z && triangleMax.z >= minimum.z) {
+      expected.emplace_back(static_cast<uint32_t>(index / 3));
+    }
+  }
+
+  std::vector<uint32_t> faceIds;
+  bvh.intersectsBox(minimum, maximum, 0, indexEnd, faceIds);
+  std::sort(faceIds.begin(), faceIds.end());
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(faceIds, expected);
+
+  // Outside of the grid
+  faceIds.clear();
+  bvh.intersectsBox(Vector3(20.f, 0.f, 20.f), Vector3(21.f, 1.f, 21.f), 0,
+                    indices.size(), faceIds);
+  EXPECT_TRUE(faceIds.empty());
+}
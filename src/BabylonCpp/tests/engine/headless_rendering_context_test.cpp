@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/headless_rendering_context.h>
+
+TEST(TestHeadlessRenderingContext, RecordsDrawCallsAndUploads)
+{
+  using namespace BABYLON;
+  GL::HeadlessRenderingContext gl;
+
+  auto buffer = gl.createBuffer();
+  gl.bindBuffer(GL::ARRAY_BUFFER, buffer.get());
+  gl.bufferData(GL::ARRAY_BUFFER, Float32Array(12, 0.f), GL::STATIC_DRAW);
+  gl.enable(GL::DEPTH_TEST);
+  gl.drawArrays(GL::TRIANGLES, 0, 3);
+  gl.drawElements(GL::TRIANGLES, 6, GL::UNSIGNED_INT, 0);
+
+  const auto& stats = gl.frameStats();
+  EXPECT_EQ(stats.drawCalls, 2u);
+  EXPECT_EQ(stats.drawnElements, 9u);
+  EXPECT_EQ(stats.bufferBinds, 1u);
+  EXPECT_EQ(stats.bufferUploads, 1u);
+  EXPECT_EQ(stats.bufferUploadBytes, 12 * sizeof(float));
+  EXPECT_EQ(stats.stateChanges, 1u);
+  EXPECT_TRUE(gl.isEnabled(GL::DEPTH_TEST));
+
+  const auto& log = gl.commandLog();
+  ASSERT_EQ(log.size(), stats.commands);
+  EXPECT_EQ(log.back().type, GL::HeadlessCommandType::DRAW);
+  EXPECT_EQ(log.back().name, GL::TRIANGLES);
+  EXPECT_EQ(log.back().size, 6);
+}
+
+TEST(TestHeadlessRenderingContext, RecordsInstancedDrawCalls)
+{
+  using namespace BABYLON;
+  GL::HeadlessRenderingContext gl;
+
+  EXPECT_NE(gl.getString(GL::EXTENSIONS).find("GL_ARB_instanced_arrays"),
+            std::string::npos);
+
+  gl.vertexAttribDivisor(4, 1);
+  gl.drawElementsInstanced(GL::TRIANGLES, 6, GL::UNSIGNED_INT, 0, 10);
+  gl.drawArraysInstanced(GL::TRIANGLES, 0, 3, 2);
+
+  const auto& stats = gl.frameStats();
+  EXPECT_EQ(stats.drawCalls, 2u);
+  EXPECT_EQ(stats.drawnElements, 66u);
+  EXPECT_EQ(stats.instancedDrawCalls, 2u);
+  EXPECT_EQ(stats.drawnInstances, 12u);
+
+  const auto& log = gl.commandLog();
+  ASSERT_EQ(log.size(), 3u);
+  EXPECT_EQ(log[0].type, GL::HeadlessCommandType::ATTRIBUTE);
+  EXPECT_EQ(log[0].name, GL::VERTEX_ATTRIB_ARRAY_DIVISOR);
+  EXPECT_EQ(log[0].object, 4u);
+  EXPECT_EQ(log[1].type, GL::HeadlessCommandType::DRAW);
+  EXPECT_EQ(log[1].size, 60);
+}
+
+TEST(TestHeadlessRenderingContext, NewFrameResetsCounters)
+{
+  using namespace BABYLON;
+  GL::HeadlessRenderingContext gl;
+
+  gl.drawArrays(GL::TRIANGLES, 0, 3);
+  gl.newFrame();
+  EXPECT_EQ(gl.frameCount(), 1u);
+  EXPECT_EQ(gl.lastFrameStats().drawCalls, 1u);
+  EXPECT_EQ(gl.frameStats().drawCalls, 0u);
+  EXPECT_TRUE(gl.commandLog().empty());
+
+  gl.setCommandLogEnabled(false);
+  gl.drawArrays(GL::TRIANGLES, 0, 3);
+  EXPECT_EQ(gl.frameStats().drawCalls, 1u);
+  EXPECT_TRUE(gl.commandLog().empty());
+}
+
+TEST(TestHeadlessRenderingContext, ProgramReflection)
+{
+  using namespace BABYLON;
+  GL::HeadlessRenderingContext gl;
+
+  auto vertexShader   = gl.createShader(GL::VERTEX_SHADER);
+  auto fragmentShader = gl.createShader(GL::FRAGMENT_SHADER);
+  gl.shaderSource(vertexShader, "void main() {}");
+  gl.compileShader(vertexShader);
+  EXPECT_EQ(gl.getShaderParameter(vertexShader, GL::COMPILE_STATUS), 1);
+
+  auto program = gl.createProgram();
+  gl.attachShader(program, vertexShader);
+  gl.attachShader(program, fragmentShader);
+  EXPECT_TRUE(gl.linkProgram(program));
+
+  auto shaders = gl.getAttachedShaders(program.get());
+  ASSERT_EQ(shaders.size(), 2u);
+  EXPECT_EQ(gl.getShaderSource(shaders[0]), "void main() {}");
+
+  // Locations are stable per name and unique per program
+  auto world = gl.getUniformLocation(program.get(), "world");
+  auto view  = gl.getUniformLocation(program.get(), "view");
+  EXPECT_NE(world->value, view->value);
+  EXPECT_EQ(gl.getUniformLocation(program.get(), "world")->value,
+            world->value);
+  EXPECT_EQ(gl.getAttribLocation(program.get(), "position"), 0);
+  EXPECT_EQ(gl.getAttribLocation(program.get(), "normal"), 1);
+
+  gl.useProgram(program.get());
+  gl.uniformMatrix4fv(world.get(), false, Float32Array(16, 0.f));
+  EXPECT_EQ(gl.frameStats().programChanges, 1u);
+  EXPECT_EQ(gl.frameStats().uniformWrites, 1u);
+}
+
+TEST(TestHeadlessCanvas, ProvidesContext)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas(640, 480);
+  EXPECT_EQ(canvas.width, 640);
+  EXPECT_EQ(canvas.height, 480);
+  auto gl = canvas.getContext3d(EngineOptions());
+  ASSERT_NE(gl, nullptr);
+  EXPECT_EQ(gl, &canvas.renderingContext());
+  EXPECT_EQ(gl->getParameteri(GL::MAX_TEXTURE_IMAGE_UNITS), 16);
+}
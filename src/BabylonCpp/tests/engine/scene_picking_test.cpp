@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace {
+
+// Ray along the z axis, from z = -20
+BABYLON::Ray zRay()
+{
+  using namespace BABYLON;
+  return Ray(Vector3(0.f, 0.f, -20.f), Vector3(0.f, 0.f, 1.f), 100.f);
+}
+
+// The world matrices are otherwise computed once per frame
+void computeWorldMatrices(BABYLON::Scene& scene)
+{
+  for (auto& mesh : scene.meshes) {
+    mesh->computeWorldMatrix(true);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestScenePicking, PicksTheNearestMesh)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+
+  // Overlapping boxes, the farthest one added first
+  auto far             = Mesh::CreateBox("far", 2.f, scene.get());
+  auto middle          = Mesh::CreateBox("middle", 2.f, scene.get());
+  auto near            = Mesh::CreateBox("near", 2.f, scene.get());
+  far->position().z    = 1.f;
+  middle->position().z = 0.5f;
+  Mesh::CreateBox("aside", 2.f, scene.get())->position().x = 5.f;
+  computeWorldMatrices(*scene);
+
+  auto pickingInfo = scene->pickWithRay(zRay(), nullptr);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh, near);
+  EXPECT_FLOAT_EQ(pickingInfo->distance, 19.f);
+
+  // Filtered meshes are not picked
+  pickingInfo = scene->pickWithRay(
+    zRay(), [near](Mesh* mesh) { return mesh != near; });
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh, middle);
+  EXPECT_FLOAT_EQ(pickingInfo->distance, 19.5f);
+  EXPECT_FALSE(scene->pickWithRay(zRay(), [](Mesh*) { return false; })->hit);
+
+  // Every mesh crossed by the ray
+  EXPECT_EQ(scene->multiPickWithRay(zRay(), nullptr).size(), 3u);
+  EXPECT_EQ(
+    scene->multiPickWithRay(zRay(), [far](Mesh* mesh) { return mesh != far; })
+      .size(),
+    2u);
+
+  // Through the center of the screen
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f),
+                                scene.get());
+  scene->activeCamera = camera;
+  const int x         = engine->getRenderWidth() / 2;
+  const int y         = engine->getRenderHeight() / 2;
+  pickingInfo         = scene->pick(x, y, nullptr);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh, near);
+  EXPECT_EQ(scene->multiPick(x, y, nullptr, nullptr).size(), 3u);
+}
+
+TEST(TestScenePicking, FastCheckReturnsTheFirstHit)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+
+  // Bounding box entered at z = -5, but only hit at z = 5
+  auto hollow = Mesh::New("hollow", scene.get());
+  VertexData vertexData;
+  vertexData.positions = {5.f,  0.f, -5.f, 6.f, 0.f,  -5.f, 5.f, 1.f, -5.f,
+                          -2.f, -2.f, 5.f, 2.f, -2.f, 5.f,  0.f, 2.f, 5.f};
+  vertexData.indices = {0, 1, 2, 3, 4, 5};
+  vertexData.applyToMesh(hollow);
+  auto box = Mesh::CreateBox("box", 2.f, scene.get());
+
+  auto pickingInfo = scene->pickWithRay(zRay(), nullptr);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh, box);
+  EXPECT_FLOAT_EQ(pickingInfo->distance, 19.f);
+
+  // The meshes are tested in the order their bounding box is entered
+  pickingInfo = scene->pickWithRay(zRay(), nullptr, true);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh, hollow);
+  EXPECT_FLOAT_EQ(pickingInfo->distance, 25.f);
+}
+
+TEST(TestScenePicking, MeshesWithoutTriangleBVH)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+
+  auto far          = Mesh::CreateBox("far", 2.f, scene.get());
+  auto near         = Mesh::CreateBox("near", 2.f, scene.get());
+  far->position().z = 1.f;
+  far->position().x = 0.5f;
+  computeWorldMatrices(*scene);
+
+  const auto withBVH = scene->pickWithRay(zRay(), nullptr);
+  for (auto mesh : {far, near}) {
+    mesh->useTriangleBVHForPicking = false;
+  }
+
+  // Same hit with the submeshes loop
+  const auto withoutBVH = scene->pickWithRay(zRay(), nullptr);
+  ASSERT_TRUE(withoutBVH->hit);
+  EXPECT_EQ(withoutBVH->pickedMesh, near);
+  EXPECT_EQ(withoutBVH->pickedMesh, withBVH->pickedMesh);
+  EXPECT_FLOAT_EQ(withoutBVH->distance, withBVH->distance);
+  EXPECT_EQ(withoutBVH->faceId, withBVH->faceId);
+  EXPECT_EQ(scene->multiPickWithRay(zRay(), nullptr).size(), 2u);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/shader_compilation_queue.h>
+#include <babylon/materials/effect.h>
+
+TEST(TestShaderCompilationQueue, EffectsAreReadyOnceCompiled)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  engine->asyncShaderCompilation = true;
+  EXPECT_TRUE(engine->getCaps().parallelShaderCompile);
+  auto& queue = engine->getShaderCompilationQueue();
+
+  unsigned int compiled = 0;
+  auto onCompiled       = [&compiled](const Effect*) { ++compiled; };
+  auto effect = engine->createEffect("color", {"position"}, {"world"}, {}, "",
+                                     nullptr, onCompiled);
+  ASSERT_NE(effect, nullptr);
+  EXPECT_FALSE(effect->isReady());
+  EXPECT_EQ(effect->getProgram(), nullptr);
+  EXPECT_EQ(queue.pendingCount(), 1u);
+
+  // The uniform indices are known before the program
+  EXPECT_EQ(effect->getUniformIndex("world"), 0);
+
+  queue.flush();
+  EXPECT_TRUE(effect->isReady());
+  EXPECT_NE(effect->getProgram(), nullptr);
+  EXPECT_NE(effect->getUniform("world"), nullptr);
+  EXPECT_EQ(compiled, 1u);
+  EXPECT_EQ(queue.pendingCount(), 0u);
+}
+
+TEST(TestShaderCompilationQueue, CompilesABatchPerFrame)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  engine->asyncShaderCompilation = true;
+  auto& queue                    = engine->getShaderCompilationQueue();
+  queue.maxCompilationsPerFrame  = 1;
+
+  std::vector<Effect*> effects;
+  for (const auto& defines : {"#define A", "#define B", "#define C"}) {
+    effects.emplace_back(
+      engine->createEffect("color", {"position"}, {"world"}, {}, defines));
+  }
+
+  const auto readyCount = [&effects]() {
+    return std::count_if(effects.begin(), effects.end(),
+                         [](const Effect* effect) {
+                           return effect->isReady();
+                         });
+  };
+
+  // At most one effect completes per frame
+  long previousReadyCount = 0;
+  while (queue.pendingCount() > 0) {
+    queue.processResults();
+    EXPECT_LE(readyCount() - previousReadyCount, 1);
+    previousReadyCount = readyCount();
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(readyCount(), 3);
+}
+
+TEST(TestShaderCompilationQueue, DestroyedEffectsLeaveTheQueue)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  engine->asyncShaderCompilation = true;
+  auto& queue                    = engine->getShaderCompilationQueue();
+
+  {
+    Effect effect("color", {"position"}, {"world"}, {}, engine.get(), "",
+                  nullptr, nullptr, nullptr);
+    EXPECT_FALSE(effect.isReady());
+    EXPECT_EQ(queue.pendingCount(), 1u);
+  }
+  EXPECT_EQ(queue.pendingCount(), 0u);
+
+  auto effect
+    = engine->createEffect("color", {"position"}, {"world"}, {}, "");
+  engine->_releaseEffect(effect);
+  EXPECT_EQ(queue.pendingCount(), 0u);
+  queue.flush();
+
+  // Synchronous compilation is unchanged
+  engine->asyncShaderCompilation = false;
+  EXPECT_TRUE(
+    engine->createEffect("color", {"position"}, {"world"}, {}, "")->isReady());
+}
+
+TEST(TestShaderCompilationQueue, DisposeDropsTheQueuedEffects)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  engine->asyncShaderCompilation = true;
+  auto& queue                    = engine->getShaderCompilationQueue();
+
+  auto effect = std_util::make_unique<Effect>(
+    "color", std::vector<std::string>{"position"},
+    std::vector<std::string>{"world"}, std::vector<std::string>{},
+    engine.get(), "", nullptr, nullptr, nullptr);
+  for (const auto& defines : {"#define A", "#define B"}) {
+    engine->createEffect("color", {"position"}, {"world"}, {}, defines);
+  }
+  EXPECT_EQ(queue.pendingCount(), 3u);
+  // Issues the compilation of one effect, the other ones are preprocessed or
+  // not yet
+  queue.maxCompilationsPerFrame = 1;
+  queue.processResults();
+
+  engine->dispose();
+  EXPECT_EQ(queue.pendingCount(), 0u);
+
+  // Destroyed once the context is released
+  effect.reset(nullptr);
+  engine.reset(nullptr);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/shader_program_cache.h>
+#include <babylon/materials/effect_shaders_store.h>
+
+namespace {
+
+const std::string cacheDirectory = "shader_program_cache_test";
+
+} // end of anonymous namespace
+
+TEST(TestShaderProgramCache, SourcesInMemory)
+{
+  using namespace BABYLON;
+  ShaderProgramCache cache;
+  EXPECT_TRUE(cache.directory().empty());
+
+  const auto key = ShaderProgramCache::Hash("void main() {}");
+  EXPECT_NE(key, ShaderProgramCache::Hash("void main() { }"));
+
+  std::string source;
+  EXPECT_FALSE(cache.getSource(key, source));
+  cache.setSource(key, "#define A\nvoid main() {}");
+  ASSERT_TRUE(cache.getSource(key, source));
+  EXPECT_EQ(source, "#define A\nvoid main() {}");
+
+  // Without a directory, nothing outlives the memory entries
+  Uint8Array binary{1, 2, 3};
+  cache.setBinary(key, 0x1234, binary);
+  GL::GLenum binaryFormat;
+  EXPECT_FALSE(cache.getBinary(key, binaryFormat, binary));
+  cache.clear();
+  EXPECT_FALSE(cache.getSource(key, source));
+}
+
+TEST(TestShaderProgramCache, PersistsInVersionedDirectory)
+{
+  using namespace BABYLON;
+  const uint64_t key = 0x0123456789abcdefull;
+  {
+    ShaderProgramCache cache;
+    ASSERT_TRUE(cache.setDirectory(cacheDirectory, "1.0"));
+    EXPECT_EQ(Filesystem::baseName(cache.directory()),
+              "v" + std::to_string(ShaderProgramCache::FormatVersion)
+                + "-1.0");
+    cache.setSource(key, "void main() {}");
+    cache.setBinary(key, 0x1234, Uint8Array{1, 2, 3});
+    EXPECT_TRUE(Filesystem::isFile(Filesystem::joinPath<std::string>(
+      cache.directory(), "0123456789abcdef.glsl")));
+  }
+
+  // Another run reads the entries back
+  ShaderProgramCache cache;
+  ASSERT_TRUE(cache.setDirectory(cacheDirectory, "1.0"));
+  std::string source;
+  ASSERT_TRUE(cache.getSource(key, source));
+  EXPECT_EQ(source, "void main() {}");
+  GL::GLenum binaryFormat = 0;
+  Uint8Array binary;
+  ASSERT_TRUE(cache.getBinary(key, binaryFormat, binary));
+  EXPECT_EQ(binaryFormat, 0x1234u);
+  EXPECT_EQ(binary, (Uint8Array{1, 2, 3}));
+
+  // Rejected binaries are removed
+  cache.removeBinary(key);
+  EXPECT_FALSE(cache.getBinary(key, binaryFormat, binary));
+
+  // The entries of other versions are never read
+  ShaderProgramCache otherVersion;
+  ASSERT_TRUE(otherVersion.setDirectory(cacheDirectory, "2.0"));
+  EXPECT_FALSE(otherVersion.getSource(key, source));
+
+  Filesystem::removeFile(Filesystem::joinPath<std::string>(
+    cache.directory(), "0123456789abcdef.glsl"));
+  Filesystem::removeFile(cache.directory());
+  Filesystem::removeFile(otherVersion.directory());
+  Filesystem::removeFile(cacheDirectory);
+}
+
+TEST(TestShaderProgramCache, EffectsReusePreprocessedSources)
+{
+  using namespace BABYLON;
+  const auto vertexKey = ShaderProgramCache::Hash(
+    EffectShadersStore::Shaders["colorVertexShader"]);
+  std::string directory;
+  {
+    HeadlessCanvas canvas;
+    auto engine = Engine::New(&canvas);
+    // The headless context has no program binary format
+    EXPECT_FALSE(engine->getCaps().programBinary);
+    engine->setShaderCacheDirectory(cacheDirectory);
+    directory = engine->getShaderProgramCache().directory();
+    ASSERT_FALSE(directory.empty());
+
+    ASSERT_NE(engine->createEffect("color", {"position"}, {"world"}, {}, ""),
+              nullptr);
+  }
+
+  // A new engine finds the expanded vertex shader on disk
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  engine->setShaderCacheDirectory(cacheDirectory);
+  EXPECT_EQ(engine->getShaderProgramCache().directory(), directory);
+  std::string source;
+  ASSERT_TRUE(engine->getShaderProgramCache().getSource(vertexKey, source));
+  EXPECT_NE(source.find("void main"), std::string::npos);
+  EXPECT_EQ(source.find("#include<"), std::string::npos);
+
+  const auto fragmentKey = ShaderProgramCache::Hash(
+    EffectShadersStore::Shaders["colorPixelShader"]);
+  for (const auto key : {vertexKey, fragmentKey}) {
+    std::ostringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << key
+             << ".glsl";
+    Filesystem::removeFile(
+      Filesystem::joinPath<std::string>(directory, filename.str()));
+  }
+  Filesystem::removeFile(directory);
+  Filesystem::removeFile(cacheDirectory);
+}
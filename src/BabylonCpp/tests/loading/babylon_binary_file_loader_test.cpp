@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/json.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
+#include <babylon/loading/scene_loader.h>
+#include <babylon/mesh/abstract_mesh.h>
+
+namespace {
+
+const std::string sceneJson
+  = "{\"autoClear\": true, \"meshes\": [{\"name\": \"triangle\", \"id\": "
+    "\"triangle\", \"position\": [1, 2, 3], \"rotation\": [0, 0, 0], "
+    "\"scaling\": [1, 1, 1], \"isVisible\": true, \"isEnabled\": true, "
+    "\"positions\": [0, 0, 0, 1, 0, 0, 0, 1, 0], "
+    "\"normals\": [0, 0, 1, 0, 0, 1, 0, 0, 1], \"indices\": [0, 1, 2], "
+    "\"subMeshes\": [{\"materialIndex\": 0, \"verticesStart\": 0, "
+    "\"verticesCount\": 3, \"indexStart\": 0, \"indexCount\": 3}]}]}";
+
+} // end of anonymous namespace
+
+TEST(TestBabylonBinaryFileLoader, SerializeRoundTrip)
+{
+  using namespace BABYLON;
+  Json::value parsedData;
+  ASSERT_EQ(Json::Parse(parsedData, sceneJson.data(), sceneJson.size()), "");
+
+  const auto binary = BabylonBinaryFileLoader::Serialize(parsedData);
+  Json::value binaryData;
+  ASSERT_EQ(BabylonBinaryFileLoader::Deserialize(binary.data(), binary.size(),
+                                                 binaryData),
+            "");
+
+  EXPECT_TRUE(Json::GetBool(binaryData, "autoClear"));
+  const auto& mesh       = Json::GetArray(binaryData, "meshes")[0];
+  const auto& parsedMesh = Json::GetArray(parsedData, "meshes")[0];
+  EXPECT_EQ(Json::GetString(mesh, "name"), "triangle");
+  for (const auto& key : {"position", "positions", "normals"}) {
+    EXPECT_EQ(Json::ToArray<float>(mesh, key),
+              Json::ToArray<float>(parsedMesh, key));
+  }
+  EXPECT_EQ(Json::ToArray<uint32_t>(mesh, "indices"),
+            (std::vector<uint32_t>{0, 1, 2}));
+
+  // Invalid files are rejected
+  for (size_t size : {size_t(0), size_t(16), binary.size() / 2}) {
+    EXPECT_NE(BabylonBinaryFileLoader::Deserialize(binary.data(), size,
+                                                   binaryData),
+              "");
+  }
+  auto corrupted = binary;
+  corrupted[4]   = 2;
+  EXPECT_NE(BabylonBinaryFileLoader::Deserialize(corrupted.data(),
+                                                 corrupted.size(), binaryData),
+            "");
+}
+
+TEST(TestBabylonBinaryFileLoader, ImportsConvertedScene)
+{
+  using namespace BABYLON;
+  ASSERT_TRUE(Filesystem::writeFileContents("binary_test.babylon", sceneJson));
+  ASSERT_EQ(BabylonBinaryFileLoader::Convert("binary_test.babylon",
+                                             "binary_test.babylonbin"),
+            "");
+
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  for (const auto& filename :
+       {"binary_test.babylon", "binary_test.babylonbin"}) {
+    std::vector<AbstractMesh*> importedMeshes;
+    SceneLoader::ImportMesh({}, "", filename, scene.get(),
+                            [&importedMeshes](
+                              std::vector<AbstractMesh*>& meshes,
+                              std::vector<ParticleSystem*>&,
+                              std::vector<Skeleton*>&) {
+                              importedMeshes = meshes;
+                            });
+    ASSERT_EQ(importedMeshes.size(), 1u) << filename;
+    EXPECT_EQ(importedMeshes[0]->name, "triangle");
+    EXPECT_EQ(importedMeshes[0]->getTotalVertices(), 3u);
+    EXPECT_EQ(importedMeshes[0]->getIndices().size(), 3u);
+  }
+
+  Filesystem::removeFile("binary_test.babylon");
+  Filesystem::removeFile("binary_test.babylonbin");
+}
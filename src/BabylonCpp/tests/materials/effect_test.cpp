@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/headless_rendering_context.h>
+#include <babylon/materials/effect.h>
+#include <babylon/math/color3.h>
+#include <babylon/math/matrix.h>
+
+TEST(TestEffect, UniformIndicesAndValueCache)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto& gl = canvas.renderingContext();
+
+  Effect effect("base64:void main() {}", {"position"},
+                {"world", "vDiffuseColor", "pointSize"}, {"diffuseSampler"},
+                engine.get(), "", nullptr, nullptr, nullptr);
+  ASSERT_TRUE(effect.isReady());
+
+  // Indices follow the uniforms then the samplers
+  EXPECT_EQ(effect.getUniformIndex("world"), 0);
+  EXPECT_EQ(effect.getUniformIndex("pointSize"), 2);
+  EXPECT_EQ(effect.getUniformIndex("diffuseSampler"), 3);
+  EXPECT_EQ(effect.getUniformIndex("unknown"), -1);
+  EXPECT_EQ(effect.getUniform(0), effect.getUniform("world"));
+  EXPECT_NE(effect.getUniform(0), nullptr);
+  EXPECT_EQ(effect.getUniform(-1), nullptr);
+
+  const int world = effect.getUniformIndex("world");
+  const int color = effect.getUniformIndex("vDiffuseColor");
+  const auto writes = [&gl]() { return gl.frameStats().uniformWrites; };
+  const auto initialWrites = writes();
+
+  // Only changed values are uploaded, by name or by index
+  auto matrix = Matrix::Translation(1.f, 2.f, 3.f);
+  effect.setMatrix(world, matrix);
+  effect.setMatrix("world", matrix);
+  EXPECT_EQ(writes(), initialWrites + 1);
+  matrix.m[12] = 4.f;
+  effect.setMatrix(world, matrix);
+  EXPECT_EQ(writes(), initialWrites + 2);
+
+  effect.setColor4(color, Color3(1.f, 0.5f, 0.f), 1.f);
+  effect.setColor4("vDiffuseColor", Color3(1.f, 0.5f, 0.f), 1.f);
+  EXPECT_EQ(writes(), initialWrites + 3);
+  effect.setColor4(color, Color3(1.f, 0.5f, 0.f), 0.5f);
+  EXPECT_EQ(writes(), initialWrites + 4);
+
+  // A value set with a different size is not a cache hit
+  effect.setFloat3(color, 1.f, 0.5f, 0.f);
+  EXPECT_EQ(writes(), initialWrites + 5);
+
+  effect.setFloat("pointSize", 2.f);
+  effect.setFloat(2, 2.f);
+  EXPECT_EQ(writes(), initialWrites + 6);
+
+  // Unknown uniforms are ignored
+  effect.setFloat("unknown", 1.f);
+  effect.setFloat(-1, 1.f);
+  EXPECT_EQ(writes(), initialWrites + 6);
+}
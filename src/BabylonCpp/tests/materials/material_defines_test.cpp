@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/pbr_material_defines.h>
+#include <babylon/materials/standard_material_defines.h>
+
+TEST(TestMaterialDefines, IncrementalHash)
+{
+  using namespace BABYLON;
+  using SMD = StandardMaterialDefines;
+  StandardMaterialDefines defines;
+  const auto emptyHash = defines.hash();
+
+  defines.defines[SMD::DIFFUSE] = true;
+  defines.lights[0]             = true;
+  defines.pointlights[0]        = true;
+  EXPECT_NE(defines.hash(), emptyHash);
+  EXPECT_TRUE(defines[SMD::DIFFUSE]);
+  EXPECT_TRUE(defines.lights[0]);
+
+  // Setting a flag twice does not change the hash, clearing it restores it
+  const auto diffuseHash = defines.hash();
+  defines.defines[SMD::DIFFUSE] = true;
+  EXPECT_EQ(defines.hash(), diffuseHash);
+  defines.defines[SMD::FOG] = true;
+  defines.defines[SMD::FOG] = false;
+  EXPECT_EQ(defines.hash(), diffuseHash);
+
+  // The same flag of another set has another key
+  StandardMaterialDefines other;
+  other.defines[SMD::DIFFUSE] = true;
+  other.lights[0]             = true;
+  other.spotlights[0]         = true;
+  EXPECT_NE(other.hash(), defines.hash());
+  EXPECT_FALSE(defines.isEqual(other));
+
+  // The order of the writes does not matter
+  other.spotlights[0]  = false;
+  other.pointlights[0] = true;
+  EXPECT_EQ(other.hash(), defines.hash());
+  EXPECT_TRUE(defines.isEqual(other));
+
+  // The bones are part of the hash
+  other.NUM_BONE_INFLUENCERS = 4;
+  EXPECT_NE(other.hash(), defines.hash());
+  EXPECT_FALSE(defines.isEqual(other));
+
+  defines.cloneTo(other);
+  EXPECT_EQ(other.hash(), defines.hash());
+  EXPECT_TRUE(defines.isEqual(other));
+
+  defines.reset();
+  EXPECT_EQ(defines.hash(), emptyHash);
+  EXPECT_FALSE(defines[SMD::DIFFUSE]);
+
+  // Out of range flags are ignored
+  defines.lights[MaterialDefines::MaxLights] = true;
+  EXPECT_FALSE(defines.lights[MaterialDefines::MaxLights]);
+  EXPECT_EQ(defines.hash(), emptyHash);
+}
+
+TEST(TestMaterialDefines, ToString)
+{
+  using namespace BABYLON;
+  using SMD = StandardMaterialDefines;
+  StandardMaterialDefines defines;
+  defines.defines[SMD::SPECULARTERM] = true;
+  defines.defines[SMD::DIFFUSE]      = true;
+  defines.BonesPerMesh               = 2;
+  defines.lights[1]                  = true;
+  defines.hemilights[1]              = true;
+  defines.lights[0]                  = true;
+
+  EXPECT_EQ(defines.toString(),
+            "#define DIFFUSE\n"
+            "#define SPECULARTERM\n"
+            "#define NUM_BONE_INFLUENCERS 0\n"
+            "#define BonesPerMesh 2\n"
+            "#define LIGHT0\n"
+            "#define LIGHT1\n"
+            "#define HEMILIGHT1\n");
+
+  // Defines of different material types are never equal
+  PBRMaterialDefines pbrDefines;
+  StandardMaterialDefines standardDefines;
+  EXPECT_FALSE(pbrDefines.isEqual(standardDefines));
+}
+
+TEST(TestMaterialDefines, EffectLookupByHash)
+{
+  using namespace BABYLON;
+  using SMD = StandardMaterialDefines;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+
+  StandardMaterialDefines defines;
+  defines.defines[SMD::DIFFUSE] = true;
+  auto effect = engine->createEffect("color", {"position"}, {"world"}, {},
+                                     defines);
+  ASSERT_NE(effect, nullptr);
+
+  // Equal defines share the effect, with or without their text
+  StandardMaterialDefines same;
+  same.defines[SMD::DIFFUSE] = true;
+  EXPECT_EQ(engine->createEffect("color", {"position"}, {"world"}, {}, same),
+            effect);
+  EXPECT_EQ(engine->createEffect("color", {"position"}, {"world"}, {},
+                                 defines.toString()),
+            effect);
+
+  // Other defines or another shader are other effects
+  same.defines[SMD::FOG] = true;
+  EXPECT_NE(engine->createEffect("color", {"position"}, {"world"}, {}, same),
+            effect);
+  EXPECT_NE(engine->createEffect("default", {"position"}, {"world"}, {},
+                                 defines),
+            effect);
+
+  // Same hash, the flags of the material types have different names
+  PBRMaterialDefines pbrDefines;
+  pbrDefines.defines[PBRMaterialDefines::ALBEDO] = true;
+  EXPECT_EQ(pbrDefines.hash(), defines.hash());
+  auto pbrEffect
+    = engine->createEffect("color", {"position"}, {"world"}, {}, pbrDefines);
+  EXPECT_NE(pbrEffect, effect);
+  EXPECT_EQ(engine->createEffect("color", {"position"}, {"world"}, {},
+                                 pbrDefines.toString()),
+            pbrEffect);
+  EXPECT_EQ(
+    engine->createEffect("color", {"position"}, {"world"}, {}, pbrDefines),
+    pbrEffect);
+  EXPECT_EQ(engine->createEffect("color", {"position"}, {"world"}, {},
+                                 defines),
+            effect);
+}
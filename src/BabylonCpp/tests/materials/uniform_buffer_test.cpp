@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/headless_rendering_context.h>
+#include <babylon/materials/uniform_buffer.h>
+#include <babylon/math/color3.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/vector3.h>
+
+TEST(TestUniformBuffer, Std140Layout)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+
+  UniformBuffer ubo(engine.get());
+  const int scalar  = ubo.addUniform("scalar", 1);
+  const int vector2 = ubo.addUniform("vector2", 2);
+  const int vector3 = ubo.addUniform("vector3", 3);
+  const int scalar2 = ubo.addUniform("scalar2", 1);
+  const int matrix  = ubo.addUniform("matrix", 16);
+  const int vector4 = ubo.addUniform("vector4", 4);
+  const int vector  = ubo.addUniform("vector", 2);
+
+  // Adding a uniform twice returns its index
+  EXPECT_EQ(ubo.addUniform("vector3", 3), vector3);
+  EXPECT_EQ(ubo.getUniformIndex("matrix"), matrix);
+  EXPECT_EQ(ubo.getUniformIndex("unknown"), -1);
+
+  // Offsets in floats, vec2 on 2 floats, vec3, vec4 and mat4 on 4 floats, a
+  // float after a vec3 in its last component
+  EXPECT_EQ(ubo.getUniformOffset(scalar), 0u);
+  EXPECT_EQ(ubo.getUniformOffset(vector2), 2u);
+  EXPECT_EQ(ubo.getUniformOffset(vector3), 4u);
+  EXPECT_EQ(ubo.getUniformOffset(scalar2), 7u);
+  EXPECT_EQ(ubo.getUniformOffset(matrix), 8u);
+  EXPECT_EQ(ubo.getUniformOffset(vector4), 24u);
+  EXPECT_EQ(ubo.getUniformOffset(vector), 28u);
+
+  // The block size is rounded up to a vec4
+  ubo.create();
+  EXPECT_EQ(ubo.getData().size(), 32u);
+}
+
+TEST(TestUniformBuffer, UploadsOnlyChangedBlocks)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto& gl    = canvas.renderingContext();
+  ASSERT_TRUE(engine->supportsUniformBuffers());
+
+  UniformBuffer ubo(engine.get());
+  const int viewProjection = ubo.addUniform("viewProjection", 16);
+  ubo.addUniform("vEyePosition", 3);
+  ubo.create();
+  ASSERT_NE(ubo.getBuffer(), nullptr);
+  EXPECT_TRUE(ubo.isSync());
+
+  const auto uploads = [&gl]() { return gl.frameStats().bufferUploads; };
+  const auto initialUploads = uploads();
+
+  // Several updates are uploaded at once
+  ubo.updateMatrix(viewProjection, Matrix::Translation(1.f, 2.f, 3.f));
+  ubo.updateVector3("vEyePosition", Vector3(4.f, 5.f, 6.f));
+  EXPECT_FALSE(ubo.isSync());
+  ubo.update();
+  EXPECT_TRUE(ubo.isSync());
+  EXPECT_EQ(uploads(), initialUploads + 1);
+  EXPECT_FLOAT_EQ(ubo.getData()[12], 1.f);
+  EXPECT_FLOAT_EQ(ubo.getData()[16 + 2], 6.f);
+
+  // Writing the same values does not upload the block again
+  ubo.updateMatrix("viewProjection", Matrix::Translation(1.f, 2.f, 3.f));
+  ubo.updateFloat3("vEyePosition", 4.f, 5.f, 6.f);
+  ubo.update();
+  EXPECT_EQ(uploads(), initialUploads + 1);
+
+  ubo.updateColor3("vEyePosition", Color3(4.f, 5.f, 7.f));
+  ubo.update();
+  EXPECT_EQ(uploads(), initialUploads + 2);
+
+  // Unknown uniforms are ignored
+  ubo.updateFloat("unknown", 1.f);
+  EXPECT_TRUE(ubo.isSync());
+}
+
+TEST(TestUniformBuffer, BindsOnlyChangedSlots)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto& gl    = canvas.renderingContext();
+
+  UniformBuffer scene(engine.get());
+  scene.addUniform("view", 16);
+  scene.create();
+  UniformBuffer light(engine.get());
+  light.addUniform("vLightData", 4);
+  light.create();
+
+  const auto binds = [&gl]() { return gl.frameStats().bufferBinds; };
+  const auto initialBinds = binds();
+
+  scene.bind(UniformBuffer::SceneBlockBinding);
+  light.bind(UniformBuffer::LightBlockBinding);
+  EXPECT_EQ(binds(), initialBinds + 2);
+
+  // Rebinding a buffer to the slot it is bound to is skipped
+  scene.bind(UniformBuffer::SceneBlockBinding);
+  light.bind(UniformBuffer::LightBlockBinding);
+  EXPECT_EQ(binds(), initialBinds + 2);
+
+  light.bind(UniformBuffer::LightBlockBinding + 1);
+  EXPECT_EQ(binds(), initialBinds + 3);
+
+  // Without uniform buffers, no buffer is created nor bound
+  engine->disableUniformBuffers = true;
+  UniformBuffer disabled(engine.get());
+  disabled.addUniform("view", 16);
+  disabled.create();
+  EXPECT_FALSE(disabled.useUbo());
+  EXPECT_EQ(disabled.getBuffer(), nullptr);
+  disabled.bind(UniformBuffer::SceneBlockBinding);
+  EXPECT_EQ(binds(), initialBinds + 3);
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <babylon/math/matrix.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/simd/simd_batch.h>
+#include <babylon/math/vector3.h>
+
+namespace {
+
+// Not a multiple of the 2, 4, 8 and 16 elements processed at once
+const size_t count = 37;
+
+std::vector<float> randomFloats(size_t size, float min, float max,
+                                unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> distribution(min, max);
+  std::vector<float> values(size);
+  for (auto& value : values) {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+BABYLON::Matrix toMatrix(const float* m)
+{
+  BABYLON::Matrix matrix;
+  std::copy(m, m + 16, matrix.m.begin());
+  return matrix;
+}
+
+void expectNear(const float* expected, const float* actual, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_NEAR(expected[i], actual[i],
+                1e-4f * std::max(1.f, std::abs(expected[i])))
+      << "at " << i;
+  }
+}
+
+// Invertible matrices with scalings, rotations and translations
+std::vector<float> composedMatrices(unsigned int seed)
+{
+  using namespace BABYLON;
+  const auto angles = randomFloats(count * 3, -3.f, 3.f, seed);
+  const auto scales = randomFloats(count * 3, 0.5f, 2.f, seed + 1);
+  const auto moves  = randomFloats(count * 3, -10.f, 10.f, seed + 2);
+  std::vector<float> matrices(count * 16);
+  Matrix matrix;
+  for (size_t i = 0; i < count; ++i) {
+    auto rotation = Quaternion::RotationYawPitchRoll(
+      angles[i * 3], angles[i * 3 + 1], angles[i * 3 + 2]);
+    Matrix::ComposeToRef(
+      Vector3(scales[i * 3], scales[i * 3 + 1], scales[i * 3 + 2]), rotation,
+      Vector3(moves[i * 3], moves[i * 3 + 1], moves[i * 3 + 2]), matrix);
+    std::copy(matrix.m.begin(), matrix.m.end(), matrices.begin() + i * 16);
+  }
+  return matrices;
+}
+
+// Runs the test for all the instruction sets supported by the CPU
+template <typename F>
+void forEachInstructionSet(const F& test)
+{
+  using namespace BABYLON::SIMD;
+  const auto supported = SIMDBatch::SupportedInstructionSet();
+  for (unsigned int i = 0; i <= static_cast<unsigned int>(supported); ++i) {
+    SIMDBatch::SetInstructionSet(static_cast<InstructionSet>(i));
+    EXPECT_EQ(static_cast<InstructionSet>(i),
+              SIMDBatch::ActiveInstructionSet());
+    test();
+  }
+  SIMDBatch::SetInstructionSet(supported);
+}
+
+} // end of anonymous namespace
+
+TEST(TestSIMDBatch, MultiplyMatrices)
+{
+  using namespace BABYLON;
+  const auto left  = randomFloats(count * 16, -2.f, 2.f, 1);
+  const auto right = randomFloats(count * 16, -2.f, 2.f, 2);
+  std::vector<float> expected(count * 16);
+  for (size_t i = 0; i < count; ++i) {
+    std::array<float, 16> result;
+    toMatrix(&left[i * 16]).multiplyToArray(toMatrix(&right[i * 16]), result,
+                                            0);
+    std::copy(result.begin(), result.end(), expected.begin() + i * 16);
+  }
+
+  forEachInstructionSet([&]() {
+    std::vector<float> result(count * 16);
+    SIMD::SIMDBatch::MultiplyMatrices(left.data(), right.data(), result.data(),
+                                      count);
+    expectNear(expected.data(), result.data(), result.size());
+    // In place
+    result = left;
+    SIMD::SIMDBatch::MultiplyMatrices(result.data(), right.data(),
+                                      result.data(), count);
+    expectNear(expected.data(), result.data(), result.size());
+  });
+}
+
+TEST(TestSIMDBatch, TransformVectors)
+{
+  using namespace BABYLON;
+  const auto vectors  = randomFloats(count * 3, -5.f, 5.f, 3);
+  const auto matrices = composedMatrices(4);
+  // Projective matrix, to check the division by w
+  auto projection = toMatrix(&matrices[0]);
+  projection.m[3] = 0.1f;
+  projection.m[7] = -0.05f;
+  std::vector<float> coordinates(count * 3), normals(count * 3);
+  std::vector<float> coordinatesByMatrices(count * 3);
+  std::vector<float> normalsByMatrices(count * 3);
+  Vector3 result;
+  for (size_t i = 0; i < count; ++i) {
+    const float* v = &vectors[i * 3];
+    Vector3::TransformCoordinatesFromFloatsToRef(v[0], v[1], v[2], projection,
+                                                 result);
+    result.toArray(coordinates, i * 3);
+    Vector3::TransformNormalFromFloatsToRef(v[0], v[1], v[2], projection,
+                                            result);
+    result.toArray(normals, i * 3);
+    const auto matrix = toMatrix(&matrices[i * 16]);
+    Vector3::TransformCoordinatesFromFloatsToRef(v[0], v[1], v[2], matrix,
+                                                 result);
+    result.toArray(coordinatesByMatrices, i * 3);
+    Vector3::TransformNormalFromFloatsToRef(v[0], v[1], v[2], matrix, result);
+    result.toArray(normalsByMatrices, i * 3);
+  }
+
+  forEachInstructionSet([&]() {
+    for (size_t n = 0; n <= count; n += count / 4 + 1) {
+      std::vector<float> result(vectors);
+      SIMD::SIMDBatch::TransformCoordinates(
+        result.data(), projection.m.data(), result.data(), n);
+      expectNear(coordinates.data(), result.data(), n * 3);
+      expectNear(&vectors[n * 3], &result[n * 3], (count - n) * 3);
+    }
+    std::vector<float> result(count * 3);
+    SIMD::SIMDBatch::TransformNormals(vectors.data(), projection.m.data(),
+                                      result.data(), count);
+    expectNear(normals.data(), result.data(), result.size());
+    SIMD::SIMDBatch::TransformCoordinatesByMatrices(
+      vectors.data(), matrices.data(), result.data(), count);
+    expectNear(coordinatesByMatrices.data(), result.data(), result.size());
+    SIMD::SIMDBatch::TransformNormalsByMatrices(vectors.data(), matrices.data(),
+                                                result.data(), count);
+    expectNear(normalsByMatrices.data(), result.data(), result.size());
+  });
+}
+
+TEST(TestSIMDBatch, ComposeAndInvertMatrices)
+{
+  using namespace BABYLON;
+  const auto scalings     = randomFloats(count * 3, 0.5f, 2.f, 5);
+  const auto translations = randomFloats(count * 3, -10.f, 10.f, 6);
+  const auto angles       = randomFloats(count * 3, -3.f, 3.f, 7);
+  std::vector<float> rotations(count * 4);
+  std::vector<float> composed(count * 16), inverted(count * 16);
+  Matrix matrix, inverse;
+  for (size_t i = 0; i < count; ++i) {
+    auto rotation = Quaternion::RotationYawPitchRoll(
+      angles[i * 3], angles[i * 3 + 1], angles[i * 3 + 2]);
+    rotations[i * 4 + 0] = rotation.x;
+    rotations[i * 4 + 1] = rotation.y;
+    rotations[i * 4 + 2] = rotation.z;
+    rotations[i * 4 + 3] = rotation.w;
+    Matrix::ComposeToRef(Vector3::FromArray(scalings, i * 3), rotation,
+                         Vector3::FromArray(translations, i * 3), matrix);
+    matrix.invertToRef(inverse);
+    std::copy(matrix.m.begin(), matrix.m.end(), composed.begin() + i * 16);
+    std::copy(inverse.m.begin(), inverse.m.end(), inverted.begin() + i * 16);
+  }
+
+  forEachInstructionSet([&]() {
+    std::vector<float> result(count * 16);
+    SIMD::SIMDBatch::ComposeMatrices(scalings.data(), rotations.data(),
+                                     translations.data(), result.data(),
+                                     count);
+    expectNear(composed.data(), result.data(), result.size());
+    SIMD::SIMDBatch::InvertMatrices(result.data(), result.data(), count);
+    expectNear(inverted.data(), result.data(), result.size());
+  });
+}
+
+TEST(TestSIMDBatch, UpdateParticles)
+{
+  using namespace BABYLON;
+  // 18 streams of stride floats, the ages close to the life times
+  const size_t stride = count + 3;
+  auto particles      = randomFloats(stride * 18, -1.f, 1.f, 8);
+  for (size_t i = 0; i < count; ++i) {
+    particles[16 * stride + i] = static_cast<float>(i % 5) * 0.25f;
+    particles[17 * stride + i] = 1.f;
+  }
+  const float step       = 0.1f;
+  const float gravity[3] = {0.f, -9.81f, 0.5f};
+
+  auto expected = particles;
+  std::vector<uint32_t> expectedDead((count + 31) / 32, 0u);
+  for (size_t i = 0; i < count; ++i) {
+    float* p = expected.data() + i;
+    for (unsigned int k = 0; k < 3; ++k) {
+      p[k * stride] += p[(3 + k) * stride] * step;
+      p[(3 + k) * stride] += gravity[k] * step;
+    }
+    for (unsigned int k = 6; k < 10; ++k) {
+      p[k * stride] += p[(4 + k) * stride] * step;
+    }
+    p[9 * stride] = std::max(p[9 * stride], 0.f);
+    p[14 * stride] += p[15 * stride] * step;
+    p[16 * stride] += step;
+    if (p[16 * stride] >= p[17 * stride]) {
+      expectedDead[i / 32] |= 1u << (i % 32);
+    }
+  }
+
+  forEachInstructionSet([&]() {
+    auto result = particles;
+    std::vector<uint32_t> dead(expectedDead.size(), ~0u);
+    SIMD::SIMDBatch::UpdateParticles(result.data(), stride, count, step,
+                                     gravity, dead.data());
+    expectNear(expected.data(), result.data(), result.size());
+    EXPECT_EQ(expectedDead, dead);
+  });
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
+#include <babylon/mesh/simplification/simplification_queue.h>
+#include <babylon/mesh/simplification/simplification_settings.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+namespace {
+
+/**
+ * Flat grid of size x size quads in the XY plane, split in two sub meshes.
+ */
+BABYLON::SimplificationMeshData CreateGrid(unsigned int size)
+{
+  using namespace BABYLON;
+  SimplificationMeshData meshData;
+  auto& positions = meshData.verticesData[VertexBuffer::PositionKind];
+  auto& uvs       = meshData.verticesData[VertexBuffer::UVKind];
+  for (unsigned int y = 0; y <= size; ++y) {
+    for (unsigned int x = 0; x <= size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x) * 2.f,
+                                         static_cast<float>(y) * 2.f, 0.f});
+      uvs.insert(uvs.end(), {static_cast<float>(x) / size,
+                             static_cast<float>(y) / size});
+    }
+  }
+  meshData.totalVertices = (size + 1) * (size + 1);
+  for (unsigned int y = 0; y < size; ++y) {
+    for (unsigned int x = 0; x < size; ++x) {
+      const uint32_t i = y * (size + 1) + x;
+      meshData.indices.insert(meshData.indices.end(),
+                              {i, i + 1, i + size + 2, i, i + size + 2,
+                               i + size + 1});
+    }
+  }
+  const size_t half = (meshData.indices.size() / 6) * 3;
+  meshData.subMeshes.push_back({0, 0, half});
+  meshData.subMeshes.push_back(
+    {1, static_cast<unsigned int>(half), meshData.indices.size() - half});
+  return meshData;
+}
+
+} // end of anonymous namespace
+
+TEST(TestQuadraticErrorSimplification, DecimatesFlatGrid)
+{
+  using namespace BABYLON;
+  const auto source = CreateGrid(16);
+  QuadraticErrorSimplification simplifier(source);
+
+  const auto result
+    = simplifier.decimate(SimplificationSettings(0.2f, 0.f, true));
+  ASSERT_EQ(result.subMeshes.size(), 2u);
+  EXPECT_EQ(result.subMeshes[0].materialIndex, 0u);
+  EXPECT_EQ(result.subMeshes[1].materialIndex, 1u);
+  EXPECT_EQ(result.subMeshes[1].indexStart, result.subMeshes[0].indexCount);
+  EXPECT_EQ(result.subMeshes[0].indexCount + result.subMeshes[1].indexCount,
+            result.indices.size());
+  EXPECT_EQ(result.indices.size() % 3, 0u);
+  EXPECT_LE(result.indices.size(), source.indices.size() / 5);
+  EXPECT_GT(result.indices.size(), 0u);
+
+  // The vertices stay on the plane, inside the grid, and the corners are kept
+  const auto& positions = result.verticesData.at(VertexBuffer::PositionKind);
+  const auto& uvs       = result.verticesData.at(VertexBuffer::UVKind);
+  ASSERT_EQ(positions.size(), result.totalVertices * 3);
+  ASSERT_EQ(uvs.size(), result.totalVertices * 2);
+  float minX = 1e6f, maxX = -1e6f, minY = 1e6f, maxY = -1e6f;
+  for (size_t i = 0; i < result.totalVertices; ++i) {
+    EXPECT_NEAR(positions[i * 3 + 2], 0.f, 1e-4f);
+    minX = std::min(minX, positions[i * 3 + 0]);
+    maxX = std::max(maxX, positions[i * 3 + 0]);
+    minY = std::min(minY, positions[i * 3 + 1]);
+    maxY = std::max(maxY, positions[i * 3 + 1]);
+    EXPECT_GE(uvs[i * 2 + 0], 0.f);
+    EXPECT_LE(uvs[i * 2 + 0], 1.f);
+  }
+  EXPECT_NEAR(minX, 0.f, 1e-4f);
+  EXPECT_NEAR(maxX, 32.f, 1e-4f);
+  EXPECT_NEAR(minY, 0.f, 1e-4f);
+  EXPECT_NEAR(maxY, 32.f, 1e-4f);
+  for (auto index : result.indices) {
+    EXPECT_LT(index, result.totalVertices);
+  }
+
+  // Full quality keeps every triangle
+  const auto full = simplifier.decimate(SimplificationSettings(1.f, 0.f, true));
+  EXPECT_EQ(full.indices.size(), source.indices.size());
+}
+
+TEST(TestQuadraticErrorSimplification, QueueAddsTheLevels)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto ground = Mesh::CreateGround("ground", 10, 10, 16, scene.get());
+
+  // The levels are computed concurrently on the default thread pool
+  bool completed = false;
+  ground->simplify({SimplificationSettings(0.5f, 10.f, true),
+                    SimplificationSettings(0.2f, 20.f, true)},
+                   true, SimplificationType::QUADRATIC,
+                   [&completed]() { completed = true; });
+  auto& queue = *scene->simplificationQueue;
+  queue.executeNext();
+  for (unsigned int i = 0; i < 1000 && !completed; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    queue.processResults();
+  }
+
+  EXPECT_TRUE(completed);
+  EXPECT_FALSE(queue.running);
+  EXPECT_TRUE(ground->hasLODLevels());
+  EXPECT_NE(ground->getLODLevelAtDistance(10.f), nullptr);
+  EXPECT_NE(ground->getLODLevelAtDistance(20.f), nullptr);
+}
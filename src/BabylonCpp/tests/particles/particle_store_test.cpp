@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_store.h>
+
+namespace {
+
+BABYLON::Particle makeParticle(unsigned int index, float lifeTime)
+{
+  using namespace BABYLON;
+  const float value = static_cast<float>(index);
+  Particle particle;
+  particle.position.set(value, value + 0.5f, -value);
+  particle.direction.set(1.f, value * 0.01f, 0.f);
+  particle.color.set(1.f, 0.5f, 0.25f, 1.f);
+  particle.colorStep.set(-0.1f, 0.f, 0.1f, -0.5f);
+  particle.lifeTime     = lifeTime;
+  particle.age          = 0.f;
+  particle.size         = value * 0.1f;
+  particle.angle        = 0.f;
+  particle.angularSpeed = value * 0.2f;
+  return particle;
+}
+
+// Previous update of the particle system, the reference of ParticleStore
+bool updateParticle(BABYLON::Particle& particle, float step,
+                    const BABYLON::Vector3& gravity)
+{
+  particle.age += step;
+  if (particle.age >= particle.lifeTime) {
+    return false;
+  }
+  particle.color.addInPlace(particle.colorStep.scale(step));
+  particle.color.a = std::max(particle.color.a, 0.f);
+  particle.angle += particle.angularSpeed * step;
+  particle.position.addInPlace(particle.direction.scale(step));
+  particle.direction.addInPlace(gravity.scale(step));
+  return true;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleStore, AddGetRemove)
+{
+  using namespace BABYLON;
+  ParticleStore store(3);
+  EXPECT_TRUE(store.empty());
+  EXPECT_EQ(store.capacity(), 3u);
+  // The streams are 64 bytes aligned
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(store.stream(ParticleStore::AGE)) % 64,
+            0u);
+
+  for (unsigned int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(store.add(makeParticle(i, 1.f)));
+  }
+  EXPECT_TRUE(store.full());
+  EXPECT_FALSE(store.add(makeParticle(3, 1.f)));
+
+  Particle particle;
+  store.get(1, particle);
+  EXPECT_FLOAT_EQ(particle.position.y, 1.5f);
+  EXPECT_FLOAT_EQ(particle.colorStep.a, -0.5f);
+  EXPECT_FLOAT_EQ(particle.angularSpeed, 0.2f);
+  EXPECT_FLOAT_EQ(store.stream(ParticleStore::SIZE)[2], 0.2f);
+
+  // The last particle replaces the removed one
+  store.remove(0);
+  EXPECT_EQ(store.size(), 2u);
+  store.get(0, particle);
+  EXPECT_FLOAT_EQ(particle.position.x, 2.f);
+
+  store.clear();
+  EXPECT_TRUE(store.empty());
+}
+
+TEST(TestParticleStore, Update)
+{
+  using namespace BABYLON;
+  // Not a multiple of the 32 particles of a dead mask word
+  const unsigned int count = 75;
+  const float step         = 0.1f;
+  const Vector3 gravity(0.f, -9.81f, 0.f);
+
+  ParticleStore store(count);
+  std::vector<Particle> expected;
+  for (unsigned int i = 0; i < count; ++i) {
+    // Dead particles at the start, in the middle and at the end
+    const float lifeTime = (i % 3 == 0 || i >= 70) ? 0.35f : 10.f;
+    store.add(makeParticle(i, lifeTime));
+    expected.emplace_back(makeParticle(i, lifeTime));
+  }
+
+  for (unsigned int frame = 0; frame < 5; ++frame) {
+    std::vector<Particle> alive;
+    for (auto& particle : expected) {
+      if (updateParticle(particle, step, gravity)) {
+        alive.emplace_back(particle);
+      }
+    }
+    const size_t removed = store.update(step, gravity);
+    EXPECT_EQ(removed, expected.size() - alive.size());
+    expected = alive;
+    ASSERT_EQ(store.size(), expected.size());
+
+    // Same particles, in a different order
+    std::vector<bool> found(expected.size(), false);
+    Particle particle;
+    for (size_t i = 0; i < store.size(); ++i) {
+      store.get(i, particle);
+      const auto index = static_cast<size_t>(particle.size * 10.f + 0.5f);
+      auto it = std::find_if(expected.begin(), expected.end(),
+                             [index](const Particle& p) {
+                               return static_cast<size_t>(p.size * 10.f + 0.5f)
+                                      == index;
+                             });
+      ASSERT_NE(it, expected.end());
+      const size_t position = static_cast<size_t>(it - expected.begin());
+      EXPECT_FALSE(found[position]);
+      found[position] = true;
+      EXPECT_NEAR(particle.position.x, it->position.x, 1e-4f);
+      EXPECT_NEAR(particle.position.y, it->position.y, 1e-4f);
+      EXPECT_NEAR(particle.direction.y, it->direction.y, 1e-4f);
+      EXPECT_NEAR(particle.color.r, it->color.r, 1e-5f);
+      EXPECT_FLOAT_EQ(particle.color.a, it->color.a);
+      EXPECT_NEAR(particle.angle, it->angle, 1e-5f);
+      EXPECT_NEAR(particle.age, it->age, 1e-5f);
+    }
+  }
+  EXPECT_EQ(store.size(), 46u);
+}
+
+TEST(TestParticleStore, FillVertexData)
+{
+  using namespace BABYLON;
+  ParticleStore store(4);
+  store.add(makeParticle(1, 1.f));
+  store.add(makeParticle(2, 1.f));
+
+  std::vector<float> vertexData(store.size() * 4
+                                * ParticleStore::VERTEX_STRIDE);
+  store.fillVertexData(vertexData.data());
+  const std::vector<float> lastVertex{2.f,  2.5f, -2.f, 1.f, 0.5f, 0.25f,
+                                      1.f,  0.f,  0.2f, 0.f, 1.f};
+  EXPECT_TRUE(std::equal(lastVertex.begin(), lastVertex.end(),
+                         vertexData.end() - ParticleStore::VERTEX_STRIDE));
+  // Corner offsets of the first particle
+  for (unsigned int corner = 0; corner < 4; ++corner) {
+    const float* vertex
+      = vertexData.data() + corner * ParticleStore::VERTEX_STRIDE;
+    EXPECT_FLOAT_EQ(vertex[0], 1.f);
+    EXPECT_FLOAT_EQ(vertex[9], (corner == 1 || corner == 2) ? 1.f : 0.f);
+    EXPECT_FLOAT_EQ(vertex[10], corner >= 2 ? 1.f : 0.f);
+  }
+}
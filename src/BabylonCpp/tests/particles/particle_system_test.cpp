@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/particles/particle_store.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+BABYLON::ParticleSystem* createParticleSystem(const std::string& name,
+                                              BABYLON::Scene* scene,
+                                              BABYLON::Effect* effect,
+                                              BABYLON::Texture* texture,
+                                              BABYLON::Mesh* emitter,
+                                              BABYLON::ThreadPool* pool,
+                                              BABYLON::ParticleStore*& store)
+{
+  using namespace BABYLON;
+  // Owned by the scene
+  auto particleSystem = new ParticleSystem(name, 4096, scene, effect);
+  particleSystem->emitter           = emitter;
+  particleSystem->particleTexture   = texture;
+  particleSystem->randomSeed        = 7;
+  particleSystem->parallelChunkSize = 256;
+  particleSystem->emitRate          = 0;
+  particleSystem->minLifeTime       = 0.005f;
+  particleSystem->maxLifeTime       = 0.05f;
+  particleSystem->minSize           = 0.5f;
+  particleSystem->maxSize           = 2.f;
+  particleSystem->minAngularSpeed   = -1.f;
+  particleSystem->maxAngularSpeed   = 1.f;
+  particleSystem->direction1        = Vector3(-1.f, 1.f, -1.f);
+  particleSystem->direction2        = Vector3(1.f, 2.f, 1.f);
+  particleSystem->color2            = Color4(0.f, 0.5f, 1.f, 0.5f);
+  particleSystem->gravity           = Vector3(0.f, -9.81f, 0.f);
+  // Default update, keeping the store to check the particles
+  particleSystem->updateFunction
+    = [particleSystem, pool, &store](ParticleStore& particles) {
+        store = &particles;
+        particles.update(0.01f, particleSystem->gravity, pool,
+                         particleSystem->parallelChunkSize);
+      };
+  particleSystem->start();
+  return particleSystem;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleSystem, ParallelSimulationIsDeterministic)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  Effect effect("base64:void main() {}", {"position"}, {}, {"diffuseSampler"},
+                engine.get(), "", nullptr, nullptr, nullptr);
+  ASSERT_TRUE(effect.isReady());
+  auto texture = RawTexture::CreateRGBTexture(Uint8Array(3, 255), 1, 1,
+                                              scene.get(), false);
+  auto emitter = Mesh::New("emitter", scene.get());
+  emitter->position().set(1.f, 2.f, 3.f);
+  emitter->computeWorldMatrix(true);
+
+  ThreadPool pool(3);
+  ParticleStore* serialStore   = nullptr;
+  ParticleStore* parallelStore = nullptr;
+  auto serial = createParticleSystem("serial", scene.get(), &effect,
+                                     texture.get(), emitter, nullptr,
+                                     serialStore);
+  auto parallel
+    = createParticleSystem("parallel", scene.get(), &effect, texture.get(),
+                           emitter, &pool, parallelStore);
+
+  for (unsigned int frame = 0; frame < 4; ++frame) {
+    scene->incrementRenderId();
+    serial->manualEmitCount   = 1000;
+    parallel->manualEmitCount = 1000;
+
+    serial->animate();
+    ASSERT_TRUE(parallel->_beginAnimate());
+    EXPECT_TRUE(parallel->_isChunked());
+    parallel->_simulate(&pool);
+    parallel->_endAnimate();
+
+    ASSERT_NE(serialStore, nullptr);
+    ASSERT_NE(parallelStore, nullptr);
+    ASSERT_EQ(serialStore->size(), parallelStore->size());
+    for (unsigned int k = 0; k < ParticleStore::STREAM_COUNT; ++k) {
+      const float* expected = serialStore->stream(k);
+      const float* actual   = parallelStore->stream(k);
+      for (size_t i = 0; i < serialStore->size(); ++i) {
+        ASSERT_FLOAT_EQ(actual[i], expected[i]) << "stream " << k;
+      }
+    }
+  }
+
+  // Some particles died, the others were emitted around the emitter
+  EXPECT_GT(serial->getActiveCount(), 1000u);
+  EXPECT_LT(serial->getActiveCount(), 4000u);
+  const float* x = serialStore->stream(ParticleStore::POSITION);
+  const float* y = serialStore->stream(ParticleStore::POSITION + 1);
+  for (size_t i = 0; i < serialStore->size(); ++i) {
+    EXPECT_NEAR(x[i], 1.f, 0.6f);
+    EXPECT_NEAR(y[i], 2.f, 0.6f);
+  }
+
+  // A different seed emits different particles
+  ParticleStore* otherStore = nullptr;
+  auto other = createParticleSystem("other", scene.get(), &effect,
+                                    texture.get(), emitter, nullptr,
+                                    otherStore);
+  other->randomSeed       = 8;
+  other->manualEmitCount  = 1;
+  serial->manualEmitCount = 1;
+  serialStore->clear();
+  scene->incrementRenderId();
+  serial->animate();
+  other->animate();
+  EXPECT_NE(otherStore->stream(ParticleStore::SIZE)[0],
+            serialStore->stream(ParticleStore::SIZE)[0]);
+
+  for (auto particleSystem : {serial, parallel, other}) {
+    particleSystem->particleTexture = nullptr;
+  }
+}
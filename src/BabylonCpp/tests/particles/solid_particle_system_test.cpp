@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/headless_rendering_context.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/particles/solid_particle.h>
+#include <babylon/particles/solid_particle_system.h>
+
+namespace {
+
+// Places the particles on a grid, rotated by their index
+class GridSolidParticleSystem : public BABYLON::SolidParticleSystem {
+
+public:
+  GridSolidParticleSystem(const std::string& name, BABYLON::Scene* scene)
+      : BABYLON::SolidParticleSystem(name, scene, {}), offset{0.f}
+  {
+  }
+
+  BABYLON::SolidParticle*
+  updateParticle(BABYLON::SolidParticle* particle) override
+  {
+    const float index = static_cast<float>(particle->idx);
+    particle->position.set(static_cast<float>(particle->idx % 100) + offset,
+                           static_cast<float>(particle->idx / 100), 0.f);
+    particle->rotation.set(index * 0.01f, index * 0.02f, index * 0.03f);
+    particle->scaling.set(0.5f, 0.5f, 0.5f);
+    particle->color->set(index * 0.001f, 0.5f, 1.f, 1.f);
+    return particle;
+  }
+
+  float offset;
+
+}; // end of class GridSolidParticleSystem
+
+} // end of anonymous namespace
+
+TEST(TestSolidParticleSystem, ParallelSetParticles)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+
+  const unsigned int count = 5000;
+  GridSolidParticleSystem serial("serial", scene.get());
+  GridSolidParticleSystem parallel("parallel", scene.get());
+  for (auto sps : {&serial, &parallel}) {
+    sps->addShape(box, count, {});
+    sps->buildMesh();
+    sps->setComputeBoundingBox(true);
+  }
+  parallel.setParallelUpdate(true);
+  scene->enableParallelEvaluation(3);
+
+  serial.setParticles();
+  parallel.setParticles();
+  for (auto kind : {VertexBuffer::PositionKind, VertexBuffer::NormalKind,
+                    VertexBuffer::ColorKind}) {
+    const auto expected = serial.mesh->getVerticesData(kind);
+    const auto actual   = parallel.mesh->getVerticesData(kind);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_FLOAT_EQ(actual[i], expected[i]) << i;
+    }
+  }
+  auto boundingInfo = parallel.mesh->getBoundingInfo();
+  EXPECT_EQ(boundingInfo->minimum, serial.mesh->getBoundingInfo()->minimum);
+  EXPECT_EQ(boundingInfo->maximum, serial.mesh->getBoundingInfo()->maximum);
+  // Half size of the rotated boxes between 0.25 and sqrt(3) * 0.25
+  EXPECT_GE(boundingInfo->maximum.x, 99.25f);
+  EXPECT_LE(boundingInfo->maximum.x, 99.44f);
+
+  // Only the vertices of the set particles are uploaded, to their place
+  const auto positions
+    = parallel.mesh->getVerticesData(VertexBuffer::PositionKind);
+  const size_t vertices    = box->getTotalVertices();
+  auto& gl                 = canvas.renderingContext();
+  const size_t uploadBytes = gl.frameStats().bufferUploadBytes;
+  parallel.offset          = 1000.f;
+  parallel.setParticles(10, 19);
+  // Positions, normals, colors and uvs
+  EXPECT_EQ(gl.frameStats().bufferUploadBytes - uploadBytes,
+            10 * vertices * (3 + 3 + 4 + 2) * sizeof(float));
+
+  const auto updatedPositions
+    = parallel.mesh->getVerticesData(VertexBuffer::PositionKind);
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const size_t particle = i / (vertices * 3);
+    if (particle >= 10 && particle <= 19 && i % 3 == 0) {
+      EXPECT_FLOAT_EQ(updatedPositions[i], positions[i] + 1000.f);
+    }
+    else {
+      EXPECT_FLOAT_EQ(updatedPositions[i], positions[i]);
+    }
+  }
+}
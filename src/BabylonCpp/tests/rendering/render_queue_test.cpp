@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+#include <babylon/rendering/render_queue.h>
+
+TEST(TestRenderQueue, RadixSortMatchesStableSort)
+{
+  using namespace BABYLON;
+
+  // Keys with duplicates, spreading over all the bytes
+  std::vector<uint64_t> keys;
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  for (unsigned int i = 0; i < 1000; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    keys.emplace_back((i % 3 == 0) ? (state & 0xFF00FF) : state);
+  }
+
+  // The sub mesh pointers are only used as payload to check the order
+  RenderQueue queue;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    queue.push(keys[i], reinterpret_cast<SubMesh*>(i + 1));
+  }
+  EXPECT_EQ(queue.size(), keys.size());
+  queue.sort();
+
+  std::vector<size_t> expected(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    expected[i] = i;
+  }
+  std::stable_sort(expected.begin(), expected.end(),
+                   [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+  const auto& subMeshes = queue.subMeshes();
+  ASSERT_EQ(subMeshes.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(reinterpret_cast<size_t>(subMeshes[i]) - 1, expected[i]);
+  }
+
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+  queue.sort();
+  EXPECT_TRUE(queue.subMeshes().empty());
+}
+
+TEST(TestRenderQueue, KeyOrdering)
+{
+  using namespace BABYLON;
+  using Pass = RenderQueue::Pass;
+
+  // Depth quantization preserves the order
+  EXPECT_LT(RenderQueue::QuantizeDepth(1.f), RenderQueue::QuantizeDepth(1.5f));
+  EXPECT_LT(RenderQueue::QuantizeDepth(0.01f),
+            RenderQueue::QuantizeDepth(1000.f));
+  EXPECT_EQ(RenderQueue::QuantizeDepth(-1.f), 0u);
+
+  // Opaque: rendering group, then pass, then material, then front to back
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::ALPHATEST_PASS, 9, 9, 100.f),
+            RenderQueue::OpaqueKey(1, Pass::OPAQUE_PASS, 0, 0, 1.f));
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 9, 9, 100.f),
+            RenderQueue::OpaqueKey(0, Pass::ALPHATEST_PASS, 0, 0, 1.f));
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 1, 9, 100.f),
+            RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 2, 0, 1.f));
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 1, 1, 1.f),
+            RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 1, 1, 2.f));
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 0xFFFF, 0x1FFFF, 9.f),
+            RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 0x10000, 0, 1.f));
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 1, 0xFFFF, 9.f),
+            RenderQueue::OpaqueKey(0, Pass::OPAQUE_PASS, 1, 0x10000, 1.f));
+
+  // Transparent: after the other passes, alpha index, then back to front
+  EXPECT_LT(RenderQueue::OpaqueKey(0, Pass::ALPHATEST_PASS, 9, 9, 1.f),
+            RenderQueue::TransparentKey(0, 0, 1.f, 0));
+  EXPECT_LT(RenderQueue::TransparentKey(0, 0, 1.f, 0),
+            RenderQueue::TransparentKey(0, 1, 100.f, 0));
+  EXPECT_LT(RenderQueue::TransparentKey(0, 1, 100.f, 5),
+            RenderQueue::TransparentKey(0, 1, 1.f, 0));
+}
+
+TEST(TestRenderQueue, DenseMaterialIndices)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+
+  // Unique ids sharing their 16 least significant bits
+  auto first       = StandardMaterial::New("first", scene.get());
+  auto second      = StandardMaterial::New("second", scene.get());
+  first->uniqueId  = 1;
+  second->uniqueId = 0x10001;
+
+  RenderQueue queue;
+  std::vector<SubMesh*> subMeshes;
+  for (unsigned int i = 0; i < 4; ++i) {
+    auto box
+      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->material = (i % 2 == 0) ? first : second;
+    box->computeWorldMatrix(true);
+    subMeshes.emplace_back(box->subMeshes[0].get());
+    queue.push(0, RenderQueue::Pass::OPAQUE_PASS, subMeshes.back(),
+               Vector3(0.f, 0.f, -10.f));
+  }
+  queue.sort();
+
+  // Grouped by material, in the order they were first pushed
+  std::vector<SubMesh*> expected{subMeshes[0], subMeshes[2], subMeshes[1],
+                                 subMeshes[3]};
+  EXPECT_EQ(queue.subMeshes(), expected);
+}
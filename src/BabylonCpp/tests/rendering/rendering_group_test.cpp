@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/headless_canvas.h>
+#include <babylon/engine/headless_rendering_context.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+
+namespace {
+
+// Boxes sharing the geometry and the material of the first one, in front of
+// the camera
+std::vector<BABYLON::Mesh*> createBoxes(BABYLON::Scene* scene,
+                                        unsigned int count)
+{
+  using namespace BABYLON;
+  auto material = StandardMaterial::New("material", scene);
+  std::vector<Mesh*> boxes{Mesh::CreateBox("box0", 1.f, scene)};
+  boxes[0]->material = material;
+  for (unsigned int i = 1; i < count; ++i) {
+    boxes.emplace_back(boxes[0]->clone("box" + std::to_string(i)));
+  }
+  for (unsigned int i = 0; i < count; ++i) {
+    boxes[i]->position().x = static_cast<float>(i) - count / 2.f;
+  }
+  return boxes;
+}
+
+// Renders a frame once the effects are compiled
+const BABYLON::GL::HeadlessFrameStats&
+renderFrame(BABYLON::HeadlessCanvas& canvas, BABYLON::Scene& scene)
+{
+  scene.render();
+  canvas.renderingContext().newFrame();
+  scene.render();
+  return canvas.renderingContext().frameStats();
+}
+
+} // end of anonymous namespace
+
+TEST(TestRenderingGroup, AutoInstancingBatchesTheMeshes)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  scene->activeCamera
+    = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+
+  const unsigned int count = 8;
+  auto boxes               = createBoxes(scene.get(), count);
+  const auto indexCount    = static_cast<size_t>(boxes[0]->getTotalIndices());
+
+  // One draw per box
+  const auto& unbatched = renderFrame(canvas, *scene);
+  EXPECT_EQ(unbatched.drawCalls, count);
+  EXPECT_EQ(unbatched.instancedDrawCalls, 0u);
+
+  // A single instanced draw
+  scene->setRenderingAutoInstancing(0, true);
+  const auto& batched = renderFrame(canvas, *scene);
+  EXPECT_EQ(batched.drawCalls, 1u);
+  EXPECT_EQ(batched.instancedDrawCalls, 1u);
+  EXPECT_EQ(batched.drawnInstances, count);
+  EXPECT_EQ(batched.drawnElements, count * indexCount);
+}
+
+TEST(TestRenderingGroup, AutoInstancingExclusions)
+{
+  using namespace BABYLON;
+  HeadlessCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  scene->activeCamera
+    = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+  auto light
+    = HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+  scene->setRenderingAutoInstancing(0, true);
+
+  const unsigned int count = 8;
+  auto boxes               = createBoxes(scene.get(), count);
+
+  // A skinned mesh is drawn on its own
+  boxes[0]->setSkeleton(new Skeleton("skeleton", "skeleton", scene.get()));
+  const auto& skinned = renderFrame(canvas, *scene);
+  EXPECT_EQ(skinned.instancedDrawCalls, 1u);
+  EXPECT_EQ(skinned.drawnInstances, count - 1);
+  EXPECT_EQ(skinned.drawCalls, 2u);
+  boxes[0]->setSkeleton(nullptr);
+
+  // Lights bound per mesh disable the batching
+  light->excludedMeshes.emplace_back(boxes[1]);
+  const auto& excluded = renderFrame(canvas, *scene);
+  EXPECT_EQ(excluded.instancedDrawCalls, 0u);
+  EXPECT_EQ(excluded.drawCalls, count);
+  light->excludedMeshes.clear();
+
+  light->includedOnlyMeshes.emplace_back(boxes[1]);
+  const auto& included = renderFrame(canvas, *scene);
+  EXPECT_EQ(included.instancedDrawCalls, 0u);
+  EXPECT_EQ(included.drawCalls, count);
+  light->includedOnlyMeshes.clear();
+
+  const auto& batched = renderFrame(canvas, *scene);
+  EXPECT_EQ(batched.instancedDrawCalls, 1u);
+  EXPECT_EQ(batched.drawnInstances, count);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/tools/file_loader.h>
+#include <babylon/tools/tools.h>
+
+namespace {
+
+const std::string filename = "file_loader_test.txt";
+const std::string contents = "0123456789abcdefghij";
+
+} // end of anonymous namespace
+
+TEST(TestFileLoader, LoadsLocalFilesInChunks)
+{
+  using namespace BABYLON;
+  ASSERT_TRUE(Filesystem::writeFileContents(filename.c_str(), contents));
+
+  FileLoader loader;
+  loader.chunkSize = 8;
+  std::vector<size_t> progress;
+  const auto onProgress = [&progress](size_t loaded, size_t total) {
+    EXPECT_EQ(total, contents.size());
+    progress.emplace_back(loaded);
+  };
+
+  std::string error;
+  auto data = loader.load("file:" + filename, onProgress, false, error);
+  ASSERT_NE(data, nullptr);
+  EXPECT_FALSE(data->isMapped());
+  EXPECT_EQ(data->toString(), contents);
+  EXPECT_EQ(progress, (std::vector<size_t>{8, 16, 20}));
+
+  // Array buffers are mapped without copy
+  data = loader.load(filename, nullptr, true, error);
+  ASSERT_NE(data, nullptr);
+#ifdef __unix__
+  EXPECT_TRUE(data->isMapped());
+#endif
+  EXPECT_EQ(std::string(data->data(), data->size()), contents);
+
+  EXPECT_EQ(loader.load("missing_" + filename, nullptr, true, error), nullptr);
+  EXPECT_FALSE(error.empty());
+
+  // Tools::LoadFile passes the content to its callback
+  std::string text;
+  Tools::LoadFile(filename, [&text](const std::string& data) { text = data; });
+  EXPECT_EQ(text, contents);
+
+  // or the loaded data, mapped on request
+  std::shared_ptr<FileData> loaded;
+  Tools::LoadFile(filename,
+                  [&loaded](const std::shared_ptr<FileData>& fileData) {
+                    loaded = fileData;
+                  },
+                  nullptr, true);
+  ASSERT_NE(loaded, nullptr);
+#ifdef __unix__
+  EXPECT_TRUE(loaded->isMapped());
+#endif
+  EXPECT_EQ(loaded->releaseString(), contents);
+
+  Filesystem::removeFile(filename);
+}
+
+TEST(TestFileLoader, LoadsUrlsAsynchronously)
+{
+  using namespace BABYLON;
+  FileLoader loader;
+  loader.registerUrlHandler(
+    "test", [](const std::string& url, const FileLoader::ChunkCallback& onChunk,
+               std::string& error) {
+      if (url != "test://scene") {
+        error = "Not found " + url;
+        return false;
+      }
+      onChunk("abc", 3, 6);
+      onChunk("def", 3, 6);
+      return true;
+    });
+
+  std::vector<size_t> progress;
+  std::string text, error;
+  loader.loadAsync(
+    "test://scene",
+    [&text](std::shared_ptr<FileData> data) { text = data->toString(); },
+    [&progress](size_t loaded, size_t) { progress.emplace_back(loaded); });
+  loader.loadAsync("test://missing", nullptr, nullptr,
+                   [&error](const std::string& e) { error += e; });
+  loader.loadAsync("ftp://scene", nullptr, nullptr,
+                   [&error](const std::string& e) { error += e; });
+  EXPECT_EQ(loader.pendingCount(), 3u);
+
+  // The callbacks are only called by processResults()
+  while (loader.pendingCount() > 0) {
+    loader.processResults();
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(text, "abcdef");
+  EXPECT_EQ(progress, (std::vector<size_t>{3, 6}));
+  EXPECT_NE(error.find("Not found test://missing"), std::string::npos);
+  EXPECT_NE(error.find("ftp://scene"), std::string::npos);
+}